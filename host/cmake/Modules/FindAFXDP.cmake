@@ -0,0 +1,30 @@
+#
+# Copyright 2026 Ettus Research, a National Instruments Brand
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+# Check whether the kernel headers provide everything needed for AF_XDP
+# sockets and for loading and attaching XDP programs through BPF links (Linux
+# 5.9 or newer). UHD uses the kernel interfaces directly, so there is no
+# library to find.
+#
+# The following variables are used by the UHD build system:
+#  AFXDP_FOUND, If false, do not try to use AF_XDP.
+
+include(CheckCXXSourceCompiles)
+
+CHECK_CXX_SOURCE_COMPILES("
+    #include <linux/bpf.h>
+    #include <linux/if_link.h>
+    #include <linux/if_xdp.h>
+    #include <sys/socket.h>
+    int main()
+    {
+        union bpf_attr attr;
+        attr.link_create.target_ifindex = 0;
+        return AF_XDP + XDP_USE_NEED_WAKEUP + XDP_UMEM_PGOFF_FILL_RING
+               + BPF_LINK_CREATE + BPF_XDP + BPF_MAP_TYPE_XSKMAP
+               + BPF_FUNC_redirect_map + XDP_FLAGS_DRV_MODE;
+    }
+    " AFXDP_FOUND
+)
@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace cal {
 
@@ -143,6 +144,46 @@ public:
         const double freq,
         const boost::optional<int> temperature = boost::none) const = 0;
 
+    /*! Batched version of get_power()
+     *
+     * Returns the same values as calling get_power(gains[i], freqs[i],
+     * temperature) for every i. The built-in implementation resolves the
+     * temperature only once, which is useful for precomputing power levels for
+     * a list of hop frequencies. The default implementation for other
+     * subclasses calls get_power() for every point.
+     *
+     * \param gains The gains at which we are checking the power
+     * \param freqs The frequencies at which we are checking the power. Must
+     *              have the same length as \p gains.
+     * \param temperature The temperature at which we are checking the power. If
+     *                    none is given, uses the current default temperature
+     *                    (see set_temperature()).
+     * \throws uhd::value_error if \p gains and \p freqs differ in length
+     */
+    virtual std::vector<double> get_power_batch(const std::vector<double>& gains,
+        const std::vector<double>& freqs,
+        const boost::optional<int> temperature = boost::none) const;
+
+    /*! Batched version of get_gain()
+     *
+     * Returns the same values as calling get_gain(powers_dbm[i], freqs[i],
+     * temperature) for every i. The built-in implementation resolves the
+     * temperature only once, the default implementation for other subclasses
+     * calls get_gain() for every point.
+     *
+     * \param powers_dbm The powers (in dBm) at which we are getting the gain
+     *                   values for
+     * \param freqs The frequencies at which we are finding the gain. Must have
+     *              the same length as \p powers_dbm.
+     * \param temperature The temperature at which we are finding the gain. If
+     *                    none is given, uses the current default temperature
+     *                    (see set_temperature()).
+     * \throws uhd::value_error if \p powers_dbm and \p freqs differ in length
+     */
+    virtual std::vector<double> get_gain_batch(const std::vector<double>& powers_dbm,
+        const std::vector<double>& freqs,
+        const boost::optional<int> temperature = boost::none) const;
+
     //! Factory for new cal data sets
     static sptr make(
         const std::string& name, const std::string& serial, const uint64_t timestamp);
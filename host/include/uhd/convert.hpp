@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace uhd { namespace convert {
 
@@ -90,6 +91,20 @@ UHD_API void register_converter(
  */
 UHD_API function_type get_converter(const id_type& id, const priority_type prio = -1);
 
+/*!
+ * Get the IDs of all registered converters.
+ * \return the converter IDs, in no particular order
+ */
+UHD_API std::vector<id_type> get_converter_ids();
+
+/*!
+ * Get the priorities at which a converter is registered.
+ * \param id identify the conversion
+ * \return the priorities, in ascending order
+ * \throws uhd::key_error if no converter is registered for this ID
+ */
+UHD_API std::vector<priority_type> get_converter_priorities(const id_type& id);
+
 /*!
  * Register the size of a particular item.
  * \param format the item format
@@ -58,7 +58,8 @@ public: // Methods
      * that no nodes receive stale data.
      * Nodes and their dependencies are resolved only if they are
      * dirty i.e. their contained values have changed since the
-     * last resolve.
+     * last resolve. Nodes that are not downstream of the specified
+     * node or of any other dirty node are not visited.
      * This call requires an acyclic expert graph.
      *
      * \param node_name Name of the node to start resolving from
@@ -76,7 +77,8 @@ public: // Methods
      * that no nodes receive stale data.
      * Nodes and their dependencies are resolved only if they are
      * dirty i.e. their contained values have changed since the
-     * last resolve.
+     * last resolve. Only the dependencies of the specified node are
+     * resolved, along with any workers that share dirty inputs with them.
      * This call requires an acyclic expert graph.
      *
      * \param node_name Name of the node to resolve
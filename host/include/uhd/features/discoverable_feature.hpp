@@ -39,7 +39,8 @@ public:
         GPIO_POWER,
         SPI_GETTER_IFACE,
         INTERNAL_SYNC,
-        GPS
+        GPS,
+        TIME_MODEL
     };
 
     virtual ~discoverable_feature() = default;
@@ -0,0 +1,86 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/features/discoverable_feature.hpp>
+#include <uhd/types/time_spec.hpp>
+#include <memory>
+#include <string>
+
+namespace uhd { namespace features {
+
+/*! Interface to the host-side model of the device time
+ *
+ * Reading the time of a timekeeper (see
+ * uhd::rfnoc::mb_controller::timekeeper::get_time_now()) requires a round trip
+ * to the device. Devices that support this feature track the time of each of
+ * their timekeepers against the host's monotonic clock instead. The model is
+ * refreshed every time the device time is read, and also from the timestamps of
+ * received RX packets where possible.
+ *
+ * Every estimate of the model comes with an upper bound for its error. When the
+ * tolerance is set to a non-zero value, get_time_now() will return the estimate
+ * of the model as long as the error bound does not exceed the tolerance, and
+ * read the time from the device otherwise. By default, the tolerance is zero,
+ * i.e., the time is always read from the device.
+ *
+ * Note that the model can only track changes of the device time that are made
+ * through the timekeeper API.
+ */
+class UHD_API time_model_iface : public discoverable_feature
+{
+public:
+    using sptr = std::shared_ptr<time_model_iface>;
+
+    //! Estimate of the device time
+    struct time_estimate_t
+    {
+        //! Estimated device time
+        uhd::time_spec_t time;
+        //! Upper bound for the difference to the actual device time, in seconds
+        double error;
+    };
+
+    static discoverable_feature::feature_id_t get_feature_id()
+    {
+        return discoverable_feature::TIME_MODEL;
+    }
+
+    std::string get_feature_name() const
+    {
+        return "Time Model";
+    }
+
+    virtual ~time_model_iface() = default;
+
+    /*! Set the maximum error at which get_time_now() returns the model estimate
+     *
+     * This applies to all timekeepers of the motherboard.
+     *
+     * \param tolerance Maximum error in seconds. A value of zero disables the
+     *                  use of the model for get_time_now().
+     */
+    virtual void set_tolerance(const double tolerance) = 0;
+
+    //! Return the tolerance set with set_tolerance()
+    virtual double get_tolerance() const = 0;
+
+    /*! Return the current time of a timekeeper, along with its error bound
+     *
+     * The time is obtained like get_time_now() does, i.e., it is read from the
+     * device if the error of the model exceeds the tolerance. If the model cannot
+     * provide an estimate at all (e.g., right after the time was changed), the
+     * error bound is the round trip time of the read.
+     *
+     * \param tk_idx The index of the timekeeper
+     * \throws uhd::index_error if \p tk_idx is not valid
+     */
+    virtual time_estimate_t get_time_estimate(const size_t tk_idx = 0) = 0;
+};
+
+}} // namespace uhd::features
@@ -255,6 +255,62 @@ struct UHD_API_HEADER fs_path : std::string
 UHD_API fs_path operator/(const fs_path&, const fs_path&);
 UHD_API fs_path operator/(const fs_path&, size_t);
 
+/*!
+ * A handle to a property that was resolved in a uhd::property_tree once.
+ *
+ * Accessing a property through property_tree::access() parses the path and
+ * walks the tree under a tree-wide lock on every call. A handle is obtained
+ * through property_tree::get_handle() and refers to the property directly,
+ * so code that accesses the same property many times (e.g., when retuning or
+ * changing gains in a loop) only pays for the lookup once.
+ *
+ * The handle does not keep the property alive. If the property is removed
+ * from the tree, the handle expires, and all further accesses throw a
+ * uhd::lookup_error. A default-constructed handle is not bound to any
+ * property and behaves like an expired one.
+ *
+ * Like the property itself, a handle provides no locking of its own.
+ */
+template <typename T>
+class UHD_API_HEADER property_handle
+{
+public:
+    //! Create a handle that is not bound to any property
+    property_handle(void) = default;
+
+    //! Create a handle for the given property, found at path
+    property_handle(const std::shared_ptr<property<T>>& prop, const fs_path& path);
+
+    //! True if the handle is bound to a property which was not removed since
+    explicit operator bool(void) const;
+
+    /*!
+     * Get the property this handle refers to
+     *
+     * \throws uhd::lookup_error if the handle is not bound or expired
+     */
+    std::shared_ptr<property<T>> lock(void) const;
+
+    //! Get the current value of the property, see property::get()
+    const T get(void) const;
+
+    //! Get the desired value of the property, see property::get_desired()
+    const T get_desired(void) const;
+
+    //! Set a new value on the property, see property::set()
+    void set(const T& value) const;
+
+    //! Set the coerced value of the property, see property::set_coerced()
+    void set_coerced(const T& value) const;
+
+    //! Get the path the property was found at when the handle was created
+    const fs_path& get_path(void) const;
+
+private:
+    std::weak_ptr<property<T>> _prop;
+    fs_path _path;
+};
+
 /*!
  * The property tree provides a file system structure for accessing properties.
  */
@@ -290,6 +346,18 @@ public:
     template <typename T>
     property<T>& access(const fs_path& path);
 
+    /*!
+     * Get a handle to a property in the tree
+     *
+     * The path is only resolved once, when the handle is created. Use this
+     * instead of access() for properties that are accessed frequently.
+     *
+     * \throws uhd::lookup_error if the path does not exist
+     * \throws uhd::type_error if the property has a different type
+     */
+    template <typename T>
+    property_handle<T> get_handle(const fs_path& path) const;
+
     //! Pop a property off the tree, and returns the property
     template <typename T>
     std::shared_ptr<property<T>> pop(const fs_path& path);
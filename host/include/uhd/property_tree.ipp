@@ -198,6 +198,17 @@ property<T>& property_tree::access(const fs_path& path)
     return *ptr;
 }
 
+template <typename T>
+property_handle<T> property_tree::get_handle(const fs_path& path) const
+{
+    auto ptr = std::dynamic_pointer_cast<property<T>>(this->_access(path));
+    if (!ptr) {
+        throw uhd::type_error(
+            "Property " + path + " exists, but was accessed with wrong type");
+    }
+    return property_handle<T>(ptr, path);
+}
+
 template <typename T>
 typename std::shared_ptr<property<T>> property_tree::pop(const fs_path& path)
 {
@@ -210,3 +221,66 @@ typename std::shared_ptr<property<T>> property_tree::pop(const fs_path& path)
 }
 
 } // namespace uhd
+
+/***********************************************************************
+ * Implement templated methods for the property handle
+ **********************************************************************/
+namespace uhd {
+
+template <typename T>
+property_handle<T>::property_handle(
+    const std::shared_ptr<property<T>>& prop, const fs_path& path)
+    : _prop(prop), _path(path)
+{
+    /* NOP */
+}
+
+template <typename T>
+property_handle<T>::operator bool(void) const
+{
+    return !_prop.expired();
+}
+
+template <typename T>
+std::shared_ptr<property<T>> property_handle<T>::lock(void) const
+{
+    auto ptr = _prop.lock();
+    if (!ptr) {
+        throw uhd::lookup_error(
+            _path.empty() ? std::string("Property handle is not bound to a property")
+                          : "Property handle expired, property was removed: " + _path);
+    }
+    return ptr;
+}
+
+template <typename T>
+const T property_handle<T>::get(void) const
+{
+    return this->lock()->get();
+}
+
+template <typename T>
+const T property_handle<T>::get_desired(void) const
+{
+    return this->lock()->get_desired();
+}
+
+template <typename T>
+void property_handle<T>::set(const T& value) const
+{
+    this->lock()->set(value);
+}
+
+template <typename T>
+void property_handle<T>::set_coerced(const T& value) const
+{
+    this->lock()->set_coerced(value);
+}
+
+template <typename T>
+const fs_path& property_handle<T>::get_path(void) const
+{
+    return _path;
+}
+
+} // namespace uhd
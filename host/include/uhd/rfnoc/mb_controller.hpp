@@ -503,6 +503,20 @@ public:
      */
     virtual void register_sync_source_updater(sync_source_updater_t callback_f);
 
+    /*! Get multiple motherboard sensor values at once
+     *
+     * Equivalent to calling get_sensor() for every name in \p names. Devices
+     * that are controlled over a network (e.g., MPM devices) issue all the
+     * requests before waiting for the first response, so reading N sensors
+     * costs roughly one round trip instead of N.
+     *
+     * \param names the names of the sensors
+     * \return the sensor values, in the same order as \p names
+     * \throws uhd::key_error if any of the names is not a valid sensor name
+     */
+    virtual std::vector<uhd::sensor_value_t> get_sensors(
+        const std::vector<std::string>& names);
+
 protected:
     /*! Stash away a timekeeper. This needs to be called by the implementer of
      * mb_controller.
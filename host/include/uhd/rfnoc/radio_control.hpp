@@ -50,7 +50,7 @@ namespace uhd { namespace rfnoc {
  * ```
  *
  * In all cases, when the radio block controller is notified of an overrun by
- * the FPGA, it will log a 'O' character (using UHD_LOG_FASTPATH()) and post an
+ * the FPGA, it will log an 'O' event (using UHD_LOG_FASTPATH_EVENT()) and post an
  * uhd::rfnoc::rx_event_action_info object downstream. The custom DSP block may
  * choose to act upon the overrun notification by registering an event handler
  * for such an action message, or it can ignore the message, in which case
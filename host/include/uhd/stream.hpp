@@ -14,6 +14,7 @@
 #include <uhd/types/stream_cmd.hpp>
 #include <uhd/utils/noncopyable.hpp>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -85,6 +86,16 @@ struct UHD_API stream_args_t
      *  - sc16 - complex<int16_t>
      *  - sc8 - complex<int8_t>
      *
+     * The following multi-buffer layouts are available for receive streamers
+     * with the sc16 and sc12 over-the-wire formats. They avoid rearranging the
+     * samples in a second pass after recv():
+     *  - fc32_planar - float I and Q in separate buffers. recv() takes two buffers
+     *    per channel, ordered I0, Q0, I1, Q1, ...
+     *  - fc32_chan_interleaved - complex<float>, with the samples of all channels
+     *    interleaved in a single buffer (sample 0 of channels 0..N-1, then sample 1
+     *    of channels 0..N-1, ...). recv() takes one buffer for all channels, which
+     *    must hold N times nsamps_per_buff samples.
+     *
      * The following are not implemented, but are listed to demonstrate naming convention:
      *  - f32 - float
      *  - f64 - double
@@ -157,6 +168,23 @@ struct UHD_API stream_args_t
      * Users should specify this option to request smaller than default
      * packets, probably with the intention of reducing packet latency.
      *
+     * - conv_threads: number of worker threads that convert samples in
+     * parallel with the calling thread, one channel at a time. Only useful
+     * for streamers with many channels, where converting all of them on a
+     * single core limits the achievable rate. The worker threads poll for
+     * work, so each of them keeps a core busy while the streamer exists.
+     * When not specified, all channels are converted on the calling thread.
+     *
+     * - conv_thread_<N>_cpu: CPU to pin conversion worker thread N to, with N
+     * ranging from 0 to conv_threads minus 1.
+     *
+     * - align_mode: how multi-channel receive streamers recover when some
+     * channels lose packets. In the default "drop" mode, samples of the other
+     * channels are discarded until the timestamps of all channels match again.
+     * In the "zero_fill" mode, the samples of the other channels are kept, and
+     * the channels that lost whole packets return zeros for the missing
+     * samples. See rx_streamer::get_zero_filled_chans().
+     *
      * - noclear: Used by tx_dsp_core_200 and rx_dsp_core_200
      *
      * The following are not implemented, but are listed for conceptual purposes:
@@ -182,6 +210,18 @@ struct UHD_API stream_args_t
      * - spp: (samples per packet) 控制 RX 数据包的大小。若未指定，则使用最大帧大小。
      *   用户可指定小于默认的包大小，以降低包延迟。
      *
+     * - conv_threads: 与调用线程并行转换样本的工作线程数量，每次转换一个通道。
+     *   仅对通道数很多的 streamer 有用，此时在单个核心上转换所有通道会限制可达速率。
+     *   工作线程以轮询方式等待任务，因此在 streamer 存在期间每个线程都会占满一个核心。
+     *   若未指定，则所有通道都在调用线程上转换。
+     *
+     * - conv_thread_<N>_cpu: 将第 N 个转换工作线程绑定到的 CPU，N 取值为 0 到 conv_threads 减 1。
+     *
+     * - align_mode: 多通道接收 streamer 在部分通道丢包时的恢复方式。默认的 "drop" 模式下，
+     *   会丢弃其他通道的样本，直到所有通道的时间戳重新一致。"zero_fill" 模式下，
+     *   保留其他通道的样本，丢失整包的通道对缺失的样本返回零。
+     *   参见 rx_streamer::get_zero_filled_chans()。
+     *
      * - noclear: 由 tx_dsp_core_200 和 rx_dsp_core_200 使用。
      *
      * 下列选项暂未实现，仅示意概念：
@@ -467,6 +507,27 @@ public:
      */
     virtual void post_input_action(
         const std::shared_ptr<uhd::rfnoc::action_info>& action, const size_t port) = 0;
+
+    /*!
+     * Get the channels that were zero-filled by the last call to recv().
+     *
+     * Only streamers with the stream argument align_mode=zero_fill return zeros
+     * for channels that lost packets. They report this by setting
+     * rx_metadata_t::out_of_sequence with error code ERROR_CODE_NONE. The
+     * return value is only meaningful after such a call to recv().
+     *
+     * \return the indices of the zero-filled channels
+     */
+    /*!
+     * 获取上一次 recv() 调用中被零填充的通道。
+     *
+     * 只有设置了流参数 align_mode=zero_fill 的 streamer 才会为丢包的通道返回零。
+     * 此时 rx_metadata_t::out_of_sequence 置位，且错误码为 ERROR_CODE_NONE。
+     * 返回值仅在这样的 recv() 调用之后才有意义。
+     *
+     * \return 被零填充的通道索引
+     */
+    virtual std::vector<size_t> get_zero_filled_chans(void) const;
 };
 
 /*!
@@ -549,6 +610,49 @@ public:
      */
     virtual void post_output_action(
         const std::shared_ptr<uhd::rfnoc::action_info>& action, const size_t port) = 0;
+
+    //! Typedef for a function that is called for every async message
+    typedef std::function<void(const async_metadata_t&)> async_msg_callback_t;
+
+    /*!
+     * Register a function that is called for every async message of this TX
+     * stream, as soon as the message arrives.
+     *
+     * The callback runs on a UHD-internal thread (usually the I/O thread of the
+     * transport), so it must return quickly. It is not a replacement for
+     * recv_async_msg(): Messages are still queued and need to be retrieved.
+     *
+     * \param callback the function to call for every async message
+     * \throws uhd::not_implemented_error if the streamer doesn't support it
+     */
+    /*!
+     * 注册一个函数，在此 TX 流的每条异步消息到达时立即调用。
+     *
+     * 回调在 UHD 内部线程（通常是传输的 I/O 线程）上运行，因此必须尽快返回。
+     * 它不能取代 recv_async_msg()：消息仍会进入队列，需要另行取出。
+     *
+     * \param callback 每条异步消息都会调用的函数
+     * \throws 若 streamer 不支持，则抛出 uhd::not_implemented_error
+     */
+    virtual void register_async_msg_callback(const async_msg_callback_t& callback);
+
+    /*!
+     * Return a file descriptor that is readable while async messages are
+     * queued, so applications can wait for them with poll() or epoll along
+     * with other events. Once it is readable, call recv_async_msg() with a
+     * timeout of zero. The descriptor belongs to the streamer, don't read
+     * from or close it.
+     *
+     * \return the file descriptor, or -1 if not supported
+     */
+    /*!
+     * 返回一个文件描述符，在有异步消息排队时可读，使应用程序能用 poll() 或 epoll
+     * 与其他事件一起等待。可读后，以零超时调用 recv_async_msg()。
+     * 该描述符归 streamer 所有，不要读取或关闭它。
+     *
+     * \return 文件描述符；若不支持，则返回 -1
+     */
+    virtual int get_async_msg_fd(void) const;
 };
 
 } // namespace uhd
@@ -200,9 +200,24 @@ struct UHD_API rx_metadata_t
         ERROR_CODE_BAD_PACKET = 0xf
     } error_code;
 
-    //! Out of sequence.  The transport has either dropped a packet or received data out
-    //! of order.
-    //! Out of sequence = 是否发生乱序。表示传输过程中丢包或乱序接收。
+    /*!
+     * Out of sequence.  The transport has either dropped a packet or received data out
+     * of order.
+     *
+     * Multi-channel streamers with the stream argument align_mode=zero_fill also
+     * set this flag, with error_code ERROR_CODE_NONE, when they return zeros for
+     * channels that lost packets which the other channels received. The gap starts
+     * at time_spec, and all samples returned for the zero-filled channels are
+     * zeros. rx_streamer::get_zero_filled_chans() returns these channels.
+     */
+    /*!
+     * Out of sequence = 是否发生乱序。表示传输过程中丢包或乱序接收。
+     *
+     * 设置了流参数 align_mode=zero_fill 的多通道 streamer 在为丢失了其他通道已收到的
+     * 数据包的通道返回零时，也会置位此标志，此时 error_code 为 ERROR_CODE_NONE。
+     * 缺口从 time_spec 开始，零填充通道返回的所有样本都为零。
+     * rx_streamer::get_zero_filled_chans() 返回这些通道。
+     */
     bool out_of_sequence;
 
     /*!
@@ -10,12 +10,15 @@
 #include <uhd/config.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <ostream>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 /*! \file log.hpp
  *
@@ -94,6 +97,20 @@
  * - `-DUHD_LOG_CONSOLE_TIME` adds a timestamp [2017-01-01 00:00:00.000000]
  * - `-DUHD_LOG_CONSOLE_THREAD` adds a thread-id `[0x001234]`
  * - `-DUHD_LOG_CONSOLE_SRC` adds a sourcefile and line tag `[src_file:line]`
+ *
+ * \subsection loghpp_fastpath Fastpath events
+ *
+ * Streaming threads report events such as overruns ('O') or underruns ('U')
+ * with UHD_LOG_FASTPATH_EVENT(). Every thread records these events into its
+ * own lock-free ring, which costs a few nanoseconds per event. A logging
+ * thread periodically prints the event codes to stderr, and forwards the
+ * details to the logging backends at 'trace' level. The events can also be
+ * read with uhd::log::read_fastpath_events(), and counted with
+ * uhd::log::get_fastpath_counters().
+ *
+ * Printing the event codes can be disabled by setting the environment variable
+ * `UHD_LOG_FASTPATH_DISABLE`. Specifying `-DUHD_LOG_FASTPATH_DISABLE` during
+ * configuration with CMake removes fastpath logging completely.
  */
 
 /*
@@ -189,6 +206,54 @@ UHD_API void set_file_level(uhd::log::severity_level level);
  * \throws uhd::key_error if \p logger was not defined
  */
 UHD_API void set_logger_level(const std::string& logger, uhd::log::severity_level level);
+
+/*! Fastpath event
+ *
+ * Fastpath events are recorded by UHD_LOG_FASTPATH_EVENT() and
+ * UHD_LOG_FASTPATH(), usually from within streaming threads.
+ */
+struct fastpath_event_t
+{
+    //! Value of \p channel for events which don't belong to a channel
+    static constexpr uint32_t NO_CHANNEL = 0xFFFFFFFF;
+
+    /*! Host time stamp counter at the time the event was recorded
+     *
+     * This is the CPU's time stamp counter on x86 platforms, and the tick
+     * count of std::chrono::steady_clock otherwise. It is only meaningful to
+     * order events and to measure the time between them.
+     */
+    uint64_t host_tsc = 0;
+    //! Device time of the event in ticks (only valid if has_device_ticks is set)
+    uint64_t device_ticks = 0;
+    //! Channel the event belongs to, or NO_CHANNEL
+    uint32_t channel = NO_CHANNEL;
+    //! Index of the thread which recorded the event, in order of their first event
+    uint32_t thread_index = 0;
+    //! Event code, e.g., 'O' for overrun or 'U' for underrun
+    char code = 0;
+    //! True if device_ticks is valid
+    bool has_device_ticks = false;
+};
+
+//! Fastpath event counters
+struct fastpath_counters_t
+{
+    //! Number of events per event code, including dropped events
+    std::map<char, uint64_t> num_events;
+    //! Number of events that were lost because events were recorded too quickly
+    uint64_t num_dropped = 0;
+};
+
+/*! Return the fastpath events recorded since the last call
+ *
+ * The events are returned in the order in which they were recorded. Only the
+ * most recent 4096 events are kept between calls.
+ */
+UHD_API std::vector<fastpath_event_t> read_fastpath_events();
+
+//! Return the number of fastpath events recorded since UHD was loaded
+UHD_API fastpath_counters_t get_fastpath_counters();
 }} // namespace uhd::log
 
 //! \cond
@@ -257,12 +322,17 @@ UHD_API void set_logger_level(const std::string& logger, uhd::log::severity_leve
 
 #ifndef UHD_LOG_FASTPATH_DISABLE
 //! Extra-fast logging macro for when speed matters.
-// No metadata is tracked. Only the message is displayed. This does not go
-// through the regular backends. Mostly used for printing the UOSDL characters
-// during streaming.
+// Records every character of the message as a fastpath event without channel
+// or timestamp. Prefer UHD_LOG_FASTPATH_EVENT().
 #    define UHD_LOG_FASTPATH(message) uhd::_log::log_fastpath(message);
+//! Record a fastpath event, e.g., UHD_LOG_FASTPATH_EVENT('O', chan, ticks)
+// Arguments are the event code, and optionally the channel and the device time
+// in ticks (as boost::optional<uint64_t>). Mostly used for the UOSDL
+// characters during streaming. See also \ref loghpp_fastpath.
+#    define UHD_LOG_FASTPATH_EVENT(...) uhd::_log::log_fastpath_event(__VA_ARGS__);
 #else
 #    define UHD_LOG_FASTPATH(message)
+#    define UHD_LOG_FASTPATH_EVENT(...)
 #endif
 
 // iostream-style logging
@@ -298,6 +368,10 @@ namespace _log {
 
 //! Fastpath logging
 void UHD_API log_fastpath(const std::string&);
+void UHD_API log_fastpath(const char*);
+void UHD_API log_fastpath_event(const char code,
+    const size_t channel = uhd::log::fastpath_event_t::NO_CHANNEL,
+    const boost::optional<uint64_t>& device_ticks = boost::none);
 
 //! Internal logging object (called by UHD_LOG* macros)
 class UHD_API log
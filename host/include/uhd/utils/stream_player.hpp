@@ -0,0 +1,97 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace utils {
+
+/*! Plays files back through a TX streamer
+ *
+ * The files are mapped into memory, and tx_streamer::send() reads the samples
+ * straight from the mapping, so there are no copies on the host besides the
+ * conversion in the streamer. The kernel is asked to read ahead of the
+ * samples being sent.
+ *
+ * The files have the format written by uhd::utils::stream_recorder: the
+ * samples of one channel each, in the CPU format of the streamer, without any
+ * header. All files should have the same length; if they don't, the shortest
+ * file determines the number of samples played. The player requires POSIX
+ * file I/O.
+ */
+class UHD_API stream_player : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<stream_player>;
+
+    //! Statistics of a playback, all sample counts are per channel
+    struct stats_t
+    {
+        //! Samples sent to the streamer
+        size_t num_samps_sent = 0;
+        //! Number of times the files were played completely
+        size_t num_repetitions = 0;
+    };
+
+    virtual ~stream_player() = 0;
+
+    /*! Create a player
+     *
+     * The following arguments are supported:
+     * - repeat: Set to 1 to play the files in a loop until stop() is called
+     *   (default: 0).
+     * - samps_per_send: Number of samples passed to each send() call
+     *   (default: 262144).
+     *
+     * \param tx_stream The streamer to send to. It must not be used otherwise
+     *                  while the player is running.
+     * \param cpu_format The CPU format of the streamer (e.g., "sc16")
+     * \param filenames The files to play, one per channel of the streamer
+     * \param args Player arguments
+     * \throws uhd::value_error if the files don't fit the streamer
+     * \throws uhd::os_error if a file can't be mapped
+     */
+    static sptr make(tx_streamer::sptr tx_stream,
+        const std::string& cpu_format,
+        const std::vector<std::string>& filenames,
+        const uhd::device_addr_t& args = uhd::device_addr_t());
+
+    /*! Start sending
+     *
+     * \param metadata The metadata of the first packet. Use its time spec to
+     *                 start at a given time. Start of burst is always set.
+     */
+    virtual void start(const uhd::tx_metadata_t& metadata = uhd::tx_metadata_t()) = 0;
+
+    /*! Wait until all samples have been sent
+     *
+     * \param timeout The timeout in seconds
+     * \return true if the playback is done, false on timeout
+     * \throws The exception thrown by tx_streamer::send(), if the playback
+     *         ended because of it. It is thrown only once, by whichever of
+     *         wait_done(), stop() or start() is called first.
+     */
+    virtual bool wait_done(const double timeout) = 0;
+
+    /*! Stop sending, and end the burst
+     *
+     * \throws The exception thrown by tx_streamer::send(), see wait_done()
+     */
+    virtual void stop() = 0;
+
+    //! Return the statistics of the playback so far
+    virtual stats_t get_stats() const = 0;
+};
+
+}} // namespace uhd::utils
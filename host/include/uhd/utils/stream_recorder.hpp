@@ -0,0 +1,111 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/stream.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace utils {
+
+/*! Records the samples of an RX streamer to files
+ *
+ * The recorder decouples rx_streamer::recv() from the storage: A receive
+ * thread calls recv() straight into a large, preallocated ring of blocks, and
+ * one writer thread per channel writes full blocks to its file. A disk stall
+ * only holds up the writer threads. If it lasts long enough to fill the ring,
+ * the receive thread keeps receiving and drops the samples (see
+ * stats_t::num_samps_dropped), so the device does not overflow.
+ *
+ * On Linux, the files are opened with O_DIRECT, so the blocks bypass the page
+ * cache. On file systems without O_DIRECT support (e.g., older tmpfs), the
+ * files are written through the page cache instead.
+ *
+ * The files contain the samples of one channel each, in the CPU format of the
+ * streamer, without any header. The recorder requires POSIX file I/O.
+ *
+ * Example:
+ * \code{.cpp}
+ * auto recorder = uhd::utils::stream_recorder::make(
+ *     rx_stream, "sc16", {"chan0.dat", "chan1.dat"});
+ * recorder->start();
+ * rx_stream->issue_stream_cmd(uhd::stream_cmd_t::STREAM_MODE_START_CONTINUOUS);
+ * // ...
+ * rx_stream->issue_stream_cmd(uhd::stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS);
+ * recorder->stop();
+ * \endcode
+ */
+class UHD_API stream_recorder : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<stream_recorder>;
+
+    //! Statistics of a recording, all sample counts are per channel
+    struct stats_t
+    {
+        //! Samples received from the streamer, including dropped ones
+        size_t num_samps_received = 0;
+        //! Samples written to the files
+        size_t num_samps_written = 0;
+        //! Samples dropped because the ring was full
+        size_t num_samps_dropped = 0;
+        //! Overflows reported by the streamer
+        size_t num_overflows = 0;
+        //! Highest fill level of the ring, in bytes
+        size_t max_ring_fill = 0;
+    };
+
+    virtual ~stream_recorder() = 0;
+
+    /*! Create a recorder
+     *
+     * The following arguments are supported:
+     * - ring_size: Size of the ring per channel in bytes (default: 256 MiB).
+     *   The ring needs to hold the samples of the longest expected disk stall.
+     * - block_size: Size of the blocks written to the files in bytes (default:
+     *   4 MiB). Must be a multiple of 4096 bytes and of the sample size.
+     * - direct: Set to 0 to write through the page cache (default: 1).
+     *
+     * \param rx_stream The streamer to record. It must not be used otherwise
+     *                  while the recorder is running.
+     * \param cpu_format The CPU format of the streamer (e.g., "sc16")
+     * \param filenames The files to write, one per channel of the streamer
+     * \param args Recorder arguments
+     * \throws uhd::value_error if the arguments don't fit the streamer
+     * \throws uhd::os_error if a file can't be created
+     */
+    static sptr make(rx_streamer::sptr rx_stream,
+        const std::string& cpu_format,
+        const std::vector<std::string>& filenames,
+        const uhd::device_addr_t& args = uhd::device_addr_t());
+
+    /*! Start receiving
+     *
+     * The stream command needs to be issued separately, after calling this.
+     */
+    virtual void start() = 0;
+
+    /*! Stop receiving, write all samples in the ring and close the files
+     *
+     * Stop the stream before calling this, or the samples still in flight are
+     * lost.
+     *
+     * \throws uhd::os_error if writing to a file failed
+     * \throws The exception thrown by rx_streamer::recv(), if receiving
+     *         ended because of it. The samples received before are written.
+     */
+    virtual void stop() = 0;
+
+    //! Return the statistics of the recording so far
+    virtual stats_t get_stats() const = 0;
+};
+
+}} // namespace uhd::utils
@@ -124,6 +124,16 @@ void export_cal(py::module& m)
             &pwr_cal::get_gain,
             py::arg("power_dbm"),
             py::arg("freq"),
+            py::arg("temperature") = boost::optional<int>())
+        .def("get_power_batch",
+            &pwr_cal::get_power_batch,
+            py::arg("gains"),
+            py::arg("freqs"),
+            py::arg("temperature") = boost::optional<int>())
+        .def("get_gain_batch",
+            &pwr_cal::get_gain_batch,
+            py::arg("powers_dbm"),
+            py::arg("freqs"),
             py::arg("temperature") = boost::optional<int>());
 
     py::class_<zbx_tx_dsa_cal, container, zbx_tx_dsa_cal::sptr>(m, "zbx_tx_dsa_cal")
@@ -10,8 +10,16 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
 #include <uhdlib/utils/interpolation.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace uhd::usrp::cal;
 using namespace uhd::math;
@@ -39,6 +47,103 @@ map_type reverse_map(const map_type& map)
     return result;
 }
 
+/******************************************************************************
+ * Flat lookup helpers
+ *
+ * The functions below operate on sorted, contiguous arrays of sample points
+ * and mirror the std::map-based helpers from uhdlib/utils/interpolation.hpp
+ * (get_bounding_iterators(), at_lin_interp(), at_nearest()) exactly. If the
+ * sample points are equidistant, \p inv_step is the inverse of their spacing
+ * and the index is computed directly instead of searched for.
+ *****************************************************************************/
+//! Return the reciprocal spacing of \p points, or 0 if they are not equidistant
+template <typename key_type>
+double get_inv_step(const std::vector<key_type>& points, size_t offset, size_t size)
+{
+    if (size < 2) {
+        return 0.0;
+    }
+    const double first = static_cast<double>(points[offset]);
+    const double step  = (static_cast<double>(points[offset + size - 1]) - first)
+                        / static_cast<double>(size - 1);
+    if (!(step > 0.0)) {
+        return 0.0;
+    }
+    for (size_t i = 1; i < size - 1; i++) {
+        const double expected = first + step * static_cast<double>(i);
+        if (std::abs(static_cast<double>(points[offset + i]) - expected) > step * 1e-6) {
+            return 0.0;
+        }
+    }
+    return 1.0 / step;
+}
+
+//! Index version of std::lower_bound()
+template <typename key_type>
+size_t lower_bound_index(
+    const key_type* points, const size_t size, const key_type key, const double inv_step)
+{
+    if (inv_step == 0.0) {
+        return std::lower_bound(points, points + size, key) - points;
+    }
+    // Guess the index from the spacing, then correct for rounding errors
+    const double pos =
+        std::ceil((static_cast<double>(key) - static_cast<double>(points[0])) * inv_step);
+    size_t idx = !(pos > 0.0) ? 0 : (pos >= size ? size : static_cast<size_t>(pos));
+    while (idx > 0 && !(points[idx - 1] < key)) {
+        idx--;
+    }
+    while (idx < size && points[idx] < key) {
+        idx++;
+    }
+    return idx;
+}
+
+//! Index version of get_bounding_iterators()
+template <typename key_type>
+std::pair<size_t, size_t> get_bounding_indices(
+    const key_type* points, const size_t size, const key_type key, const double inv_step)
+{
+    const size_t next_idx = lower_bound_index(points, size, key, inv_step);
+    if (next_idx == size) {
+        return {size - 1, size - 1};
+    }
+    return {next_idx == 0 ? 0 : next_idx - 1, next_idx};
+}
+
+//! Flat version of at_lin_interp()
+double lin_interp_flat(const double* keys,
+    const double* values,
+    const size_t size,
+    const double key,
+    const double inv_step)
+{
+    const size_t next_idx = lower_bound_index(keys, size, key, inv_step);
+    if (next_idx == size) {
+        return values[size - 1];
+    }
+    if (next_idx == 0) {
+        return values[0];
+    }
+    return linear_interp(
+        key, keys[next_idx - 1], values[next_idx - 1], keys[next_idx], values[next_idx]);
+}
+
+//! Flat version of at_nearest()
+template <typename key_type>
+size_t nearest_index_flat(
+    const key_type* keys, const size_t size, const key_type key, const double inv_step)
+{
+    const size_t next_idx = lower_bound_index(keys, size, key, inv_step);
+    if (next_idx == size) {
+        return size - 1;
+    }
+    if (next_idx == 0) {
+        return 0;
+    }
+    return (keys[next_idx] - key < key - keys[next_idx - 1]) ? next_idx : next_idx - 1;
+}
+
 } // namespace
 
 
@@ -79,61 +184,38 @@ public:
         const double freq,
         const boost::optional<int> temperature = boost::none) override
     {
-        if (min_power > max_power) {
-            throw uhd::runtime_error(
-                std::string("Invalid min/max power levels: Min power must be smaller "
-                            "than max power! (Is: "
-                            + std::to_string(min_power) + " dBm, "
-                            + std::to_string(max_power) + " dBm)"));
-        }
         const int temp = bool(temperature) ? temperature.get() : _default_temp;
-        _data[temp][static_cast<uint64_t>(freq)] = {
-            gain_power_map, reverse_map(gain_power_map), min_power, max_power};
+        _add_power_table(gain_power_map, min_power, max_power, freq, temp);
     }
 
-    // Note: This is very similar to at_bilin_interp(), but we can't use that
-    // because we mix types in the gain tables (we have uint64_t and double, and
-    // a struct).
     double get_power(const double gain,
         const double freq,
         const boost::optional<int> temperature = boost::none) const override
     {
-        UHD_ASSERT_THROW(!_data.empty());
-        const uint64_t freqi = static_cast<uint64_t>(freq);
-        const auto& table    = _get_table(temperature);
-
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
-        // Frequency is out of bounds
-        if (f1i == f2i) {
-            return at_lin_interp(table.at(f1i).g2p, gain);
+        return _get_compiled(temperature).get_power(gain, freq);
+    }
+
+    std::vector<double> get_power_batch(const std::vector<double>& gains,
+        const std::vector<double>& freqs,
+        const boost::optional<int> temperature = boost::none) const override
+    {
+        if (gains.size() != freqs.size()) {
+            throw uhd::value_error("pwr_cal: Number of gains and frequencies differ!");
         }
-        const double f1       = static_cast<double>(f1i);
-        const double f2       = static_cast<double>(f2i);
-        const auto gain_iters = get_bounding_iterators(table.at(f1).g2p, gain);
-        const double gain1    = gain_iters.first->first;
-        const double gain2    = gain_iters.second->first;
-        // Gain is out of bounds
-        if (gain1 == gain2) {
-            return linear_interp(
-                freq, f1, table.at(f1i).g2p.at(gain1), f2, table.at(f2i).g2p.at(gain1));
+        const auto& table = _get_compiled(temperature);
+        std::vector<double> powers(gains.size());
+        for (size_t i = 0; i < gains.size(); i++) {
+            powers[i] = table.get_power(gains[i], freqs[i]);
         }
-
-        // Both gain and freq are within bounds: Bi-Linear interpolation
-        // Find power values
-        const auto power11 = table.at(f1i).g2p.at(gain1);
-        const auto power12 = table.at(f1i).g2p.at(gain2);
-        const auto power21 = table.at(f2i).g2p.at(gain1);
-        const auto power22 = table.at(f2i).g2p.at(gain2);
-
-        return bilinear_interp(
-            freq, gain, f1, gain1, f2, gain2, power11, power12, power21, power22);
+        return powers;
     }
 
     void clear() override
     {
         _data.clear();
+        _compiled.clear();
+        _dirty_temps.clear();
+        _dirty = false;
     }
 
     void set_temperature(const int temperature) override
@@ -159,62 +241,30 @@ public:
     uhd::meta_range_t get_power_limits(const double freq,
         const boost::optional<int> temperature = boost::none) const override
     {
-        const auto table = at_nearest(_get_table(temperature), uint64_t(freq));
-        return uhd::meta_range_t(table.min_power, table.max_power);
+        const auto& row = _get_compiled(temperature).get_nearest_row(freq);
+        return uhd::meta_range_t(row.min_power, row.max_power);
     }
 
     double get_gain(const double power_dbm,
         const double freq,
         const boost::optional<int> temperature = boost::none) const override
     {
-        UHD_ASSERT_THROW(!_data.empty());
-        const uint64_t freqi       = static_cast<uint64_t>(freq);
-        const auto& table          = _get_table(temperature);
-        const double power_coerced = get_power_limits(freq, temperature).clip(power_dbm);
-
-        const auto f_iters = get_bounding_iterators(table, freqi);
-        const uint64_t f1i = f_iters.first->first;
-        const uint64_t f2i = f_iters.second->first;
-        if (f1i == f2i) {
-            // Frequency is out of bounds
-            return at_lin_interp(table.at(f1i).p2g, power_coerced);
-        }
+        return _get_compiled(temperature).get_gain(power_dbm, freq);
+    }
 
-        // NOTE: bilinear_interp() does not interpolate on an arbitrary tetragon,
-        // but requires the coordinates to be on a rectangular grid. Due to the
-        // frequency-dependent nature of power calibration, it is unlikely that
-        // the bounding power values for f1 and f2 (respectively) are identical.
-        // We therefore not only interpolate the final gain values, but we also
-        // nearest-neighbor-interpolate the grid coordinates for the power.
-        // This snap-to-grid adds another error, which can be counteracted by
-        // good choice of frequency and gain points on which to sample.
-        const auto f1pwr_iters = get_bounding_iterators(table.at(f1i).p2g, power_coerced);
-        const double f1pwr1    = f1pwr_iters.first->first;
-        const double f1pwr2    = f1pwr_iters.second->first;
-        const auto f2pwr_iters = get_bounding_iterators(table.at(f2i).p2g, power_coerced);
-        const double f2pwr1    = f2pwr_iters.first->first;
-        const double f2pwr2    = f2pwr_iters.second->first;
-        const double f1        = static_cast<double>(f1i);
-        const double f2        = static_cast<double>(f2i);
-        const double pwr1      = linear_interp(freq, f1, f1pwr1, f2, f2pwr1);
-        const double pwr2      = linear_interp(freq, f1, f1pwr2, f2, f2pwr2);
-        // Power is out of bounds (this shouldn't happen after coercing, but this
-        // is just another good sanity check on our data)
-        if (pwr1 == pwr2) {
-            return linear_interp(freq,
-                f1,
-                at_nearest(table.at(f1i).p2g, pwr1),
-                f2,
-                at_nearest(table.at(f2i).p2g, pwr2));
+    std::vector<double> get_gain_batch(const std::vector<double>& powers_dbm,
+        const std::vector<double>& freqs,
+        const boost::optional<int> temperature = boost::none) const override
+    {
+        if (powers_dbm.size() != freqs.size()) {
+            throw uhd::value_error("pwr_cal: Number of powers and frequencies differ!");
+        }
+        const auto& table = _get_compiled(temperature);
+        std::vector<double> gains(powers_dbm.size());
+        for (size_t i = 0; i < powers_dbm.size(); i++) {
+            gains[i] = table.get_gain(powers_dbm[i], freqs[i]);
         }
-        // Both gain and freq are within bounds => Bi-Linear interpolation
-        // Find gain values:
-        const auto gain11 = table.at(f1i).p2g.at(f1pwr1);
-        const auto gain12 = table.at(f1i).p2g.at(f1pwr2);
-        const auto gain21 = table.at(f2i).p2g.at(f2pwr1);
-        const auto gain22 = table.at(f2i).p2g.at(f2pwr2);
-        return bilinear_interp(
-            freq, power_coerced, f1, pwr1, f2, pwr2, gain11, gain12, gain21, gain22);
+        return gains;
     }
 
     /**************************************************************************
@@ -300,7 +350,7 @@ public:
                 for (auto g_it = power_map->begin(); g_it != power_map->end(); ++g_it) {
                     power.insert({g_it->gain(), g_it->power_dbm()});
                 }
-                add_power_table(power,
+                _add_power_table(power,
                     f_it->min_power(),
                     f_it->max_power(),
                     f_it->freq(),
@@ -326,10 +376,258 @@ private:
 
     using freq_table_map = std::map<uint64_t /* freq */, pwr_cal_table>;
 
-    freq_table_map _get_table(const boost::optional<int> temperature) const
+    /*! Read-only copy of a freq_table_map, optimized for lookups
+     *
+     * All frequencies, and the gain/power tables of all frequencies, are
+     * stored back-to-back in flat arrays. The lookup algorithms are identical
+     * to those of the map-based data, but they don't chase pointers through
+     * tree nodes, and equidistant axes are indexed without searching.
+     */
+    class compiled_table
     {
+    public:
+        //! Location of the gain/power tables of one frequency
+        struct row_t
+        {
+            size_t g2p_offset;
+            size_t g2p_size;
+            double g2p_inv_step;
+            size_t p2g_offset;
+            size_t p2g_size;
+            double p2g_inv_step;
+            double min_power;
+            double max_power;
+        };
+
+        compiled_table() = default;
+
+        compiled_table(const freq_table_map& table)
+        {
+            for (const auto& freq_table : table) {
+                const auto& data = freq_table.second;
+                UHD_ASSERT_THROW(!data.g2p.empty());
+                row_t row;
+                row.g2p_offset = _g2p_gains.size();
+                row.g2p_size   = data.g2p.size();
+                row.p2g_offset = _p2g_powers.size();
+                row.p2g_size   = data.p2g.size();
+                row.min_power  = data.min_power;
+                row.max_power  = data.max_power;
+                for (const auto& gain_power : data.g2p) {
+                    _g2p_gains.push_back(gain_power.first);
+                    _g2p_powers.push_back(gain_power.second);
+                }
+                for (const auto& power_gain : data.p2g) {
+                    _p2g_powers.push_back(power_gain.first);
+                    _p2g_gains.push_back(power_gain.second);
+                }
+                row.g2p_inv_step = get_inv_step(_g2p_gains, row.g2p_offset, row.g2p_size);
+                row.p2g_inv_step =
+                    get_inv_step(_p2g_powers, row.p2g_offset, row.p2g_size);
+                _freqs.push_back(freq_table.first);
+                _rows.push_back(row);
+            }
+            _freq_inv_step = get_inv_step(_freqs, 0, _freqs.size());
+        }
+
+        const row_t& get_nearest_row(const double freq) const
+        {
+            const uint64_t freqi = static_cast<uint64_t>(freq);
+            return _rows[nearest_index_flat(
+                _freqs.data(), _freqs.size(), freqi, _freq_inv_step)];
+        }
+
+        // Note: This is very similar to at_bilin_interp(), but we can't use that
+        // because we mix types in the gain tables (we have uint64_t and double).
+        double get_power(const double gain, const double freq) const
+        {
+            const uint64_t freqi = static_cast<uint64_t>(freq);
+            const auto f_idxs    = get_bounding_indices(
+                _freqs.data(), _freqs.size(), freqi, _freq_inv_step);
+            const row_t& row1         = _rows[f_idxs.first];
+            const row_t& row2         = _rows[f_idxs.second];
+            const double* row1_gains  = _g2p_gains.data() + row1.g2p_offset;
+            const double* row1_powers = _g2p_powers.data() + row1.g2p_offset;
+            // Frequency is out of bounds
+            if (f_idxs.first == f_idxs.second) {
+                return lin_interp_flat(
+                    row1_gains, row1_powers, row1.g2p_size, gain, row1.g2p_inv_step);
+            }
+            const double f1      = static_cast<double>(_freqs[f_idxs.first]);
+            const double f2      = static_cast<double>(_freqs[f_idxs.second]);
+            const auto gain_idxs =
+                get_bounding_indices(row1_gains, row1.g2p_size, gain, row1.g2p_inv_step);
+            const double gain1 = row1_gains[gain_idxs.first];
+            const double gain2 = row1_gains[gain_idxs.second];
+            // Gain is out of bounds
+            if (gain1 == gain2) {
+                return linear_interp(freq,
+                    f1,
+                    row1_powers[gain_idxs.first],
+                    f2,
+                    _power_at(row2, gain_idxs.first, gain1));
+            }
+
+            // Both gain and freq are within bounds: Bi-Linear interpolation
+            // Find power values
+            const double power11 = row1_powers[gain_idxs.first];
+            const double power12 = row1_powers[gain_idxs.second];
+            const double power21 = _power_at(row2, gain_idxs.first, gain1);
+            const double power22 = _power_at(row2, gain_idxs.second, gain2);
+
+            return bilinear_interp(
+                freq, gain, f1, gain1, f2, gain2, power11, power12, power21, power22);
+        }
+
+        double get_gain(const double power_dbm, const double freq) const
+        {
+            const uint64_t freqi = static_cast<uint64_t>(freq);
+            const auto f_idxs    = get_bounding_indices(
+                _freqs.data(), _freqs.size(), freqi, _freq_inv_step);
+            const row_t& row1 = _rows[f_idxs.first];
+            const row_t& row2 = _rows[f_idxs.second];
+            // Same as get_power_limits().clip(power_dbm), without the allocation
+            const row_t& limits        = get_nearest_row(freq);
+            const double power_coerced = power_dbm < limits.min_power
+                                             ? limits.min_power
+                                             : (power_dbm <= limits.max_power
+                                                       ? power_dbm
+                                                       : limits.max_power);
+            const double* row1_powers = _p2g_powers.data() + row1.p2g_offset;
+            const double* row1_gains  = _p2g_gains.data() + row1.p2g_offset;
+            const double* row2_powers = _p2g_powers.data() + row2.p2g_offset;
+            const double* row2_gains  = _p2g_gains.data() + row2.p2g_offset;
+            if (f_idxs.first == f_idxs.second) {
+                // Frequency is out of bounds
+                return lin_interp_flat(row1_powers,
+                    row1_gains,
+                    row1.p2g_size,
+                    power_coerced,
+                    row1.p2g_inv_step);
+            }
+
+            // NOTE: bilinear_interp() does not interpolate on an arbitrary
+            // tetragon, but requires the coordinates to be on a rectangular
+            // grid. Due to the frequency-dependent nature of power calibration,
+            // it is unlikely that the bounding power values for f1 and f2
+            // (respectively) are identical. We therefore not only interpolate
+            // the final gain values, but we also nearest-neighbor-interpolate
+            // the grid coordinates for the power. This snap-to-grid adds
+            // another error, which can be counteracted by good choice of
+            // frequency and gain points on which to sample.
+            const auto f1pwr_idxs = get_bounding_indices(
+                row1_powers, row1.p2g_size, power_coerced, row1.p2g_inv_step);
+            const auto f2pwr_idxs = get_bounding_indices(
+                row2_powers, row2.p2g_size, power_coerced, row2.p2g_inv_step);
+            const double f1   = static_cast<double>(_freqs[f_idxs.first]);
+            const double f2   = static_cast<double>(_freqs[f_idxs.second]);
+            const double pwr1 = linear_interp(freq,
+                f1,
+                row1_powers[f1pwr_idxs.first],
+                f2,
+                row2_powers[f2pwr_idxs.first]);
+            const double pwr2 = linear_interp(freq,
+                f1,
+                row1_powers[f1pwr_idxs.second],
+                f2,
+                row2_powers[f2pwr_idxs.second]);
+            // Power is out of bounds (this shouldn't happen after coercing, but
+            // this is just another good sanity check on our data)
+            if (pwr1 == pwr2) {
+                return linear_interp(freq,
+                    f1,
+                    row1_gains[nearest_index_flat(
+                        row1_powers, row1.p2g_size, pwr1, row1.p2g_inv_step)],
+                    f2,
+                    row2_gains[nearest_index_flat(
+                        row2_powers, row2.p2g_size, pwr2, row2.p2g_inv_step)]);
+            }
+            // Both gain and freq are within bounds => Bi-Linear interpolation
+            // Find gain values:
+            const double gain11 = row1_gains[f1pwr_idxs.first];
+            const double gain12 = row1_gains[f1pwr_idxs.second];
+            const double gain21 = row2_gains[f2pwr_idxs.first];
+            const double gain22 = row2_gains[f2pwr_idxs.second];
+            return bilinear_interp(
+                freq, power_coerced, f1, pwr1, f2, pwr2, gain11, gain12, gain21, gain22);
+        }
+
+    private:
+        //! Return the power for \p gain in \p row, which must contain it
+        //
+        // \p idx_hint is where \p gain is expected, which is true whenever
+        // all frequencies were measured at the same gain points.
+        double _power_at(const row_t& row, const size_t idx_hint, const double gain) const
+        {
+            const double* gains = _g2p_gains.data() + row.g2p_offset;
+            if (idx_hint < row.g2p_size && gains[idx_hint] == gain) {
+                return _g2p_powers[row.g2p_offset + idx_hint];
+            }
+            const size_t idx =
+                lower_bound_index(gains, row.g2p_size, gain, row.g2p_inv_step);
+            if (idx == row.g2p_size || gains[idx] != gain) {
+                throw std::out_of_range("pwr_cal: Gain point missing from power table");
+            }
+            return _g2p_powers[row.g2p_offset + idx];
+        }
+
+        std::vector<uint64_t> _freqs;
+        double _freq_inv_step = 0.0;
+        std::vector<row_t> _rows;
+        //! Gain -> power tables (sorted by gain), for all rows
+        std::vector<double> _g2p_gains;
+        std::vector<double> _g2p_powers;
+        //! Power -> gain tables (sorted by power), for all rows
+        std::vector<double> _p2g_powers;
+        std::vector<double> _p2g_gains;
+    };
+
+    void _add_power_table(const std::map<double, double>& gain_power_map,
+        const double min_power,
+        const double max_power,
+        const double freq,
+        const int temperature)
+    {
+        if (min_power > max_power) {
+            throw uhd::runtime_error(
+                std::string("Invalid min/max power levels: Min power must be smaller "
+                            "than max power! (Is: "
+                            + std::to_string(min_power) + " dBm, "
+                            + std::to_string(max_power) + " dBm)"));
+        }
+        _data[temperature][static_cast<uint64_t>(freq)] = {
+            gain_power_map, reverse_map(gain_power_map), min_power, max_power};
+        // Tables are typically added one frequency at a time, so we only
+        // compile them once they are needed
+        _dirty_temps.insert(temperature);
+        _dirty = true;
+    }
+
+    const compiled_table& _get_compiled(const boost::optional<int> temperature) const
+    {
+        if (_dirty.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(_compile_mutex);
+            if (_dirty.load(std::memory_order_relaxed)) {
+                for (const int temp : _dirty_temps) {
+                    _compiled[temp] = compiled_table(_data.at(temp));
+                }
+                _dirty_temps.clear();
+                _dirty.store(false, std::memory_order_release);
+            }
+        }
+        UHD_ASSERT_THROW(!_compiled.empty());
         const int temp = bool(temperature) ? temperature.get() : _default_temp;
-        return at_nearest(_data, temp);
+        // Same as at_nearest(), but without copying the table
+        const auto next_it = _compiled.lower_bound(temp);
+        if (next_it == _compiled.cend()) {
+            return _compiled.crbegin()->second;
+        }
+        if (next_it == _compiled.cbegin()) {
+            return next_it->second;
+        }
+        const auto prev_it = std::prev(next_it);
+        return (next_it->first - temp < temp - prev_it->first) ? next_it->second
+                                                                : prev_it->second;
     }
 
     std::string _name;
@@ -338,6 +636,14 @@ private:
 
     //! The actual gain table
     std::map<int /* temp */, freq_table_map> _data;
+    //! Lookup-optimized copy of _data, compiled on first use
+    mutable std::map<int /* temp */, compiled_table> _compiled;
+    //! Temperatures whose tables changed since they were last compiled
+    mutable std::set<int> _dirty_temps;
+    //! True if _dirty_temps is not empty
+    mutable std::atomic<bool> _dirty{false};
+    //! Serializes compiling among concurrent lookups
+    mutable std::mutex _compile_mutex;
     double _ref_gain  = 0.0;
     int _default_temp = NORMAL_TEMPERATURE;
 };
@@ -353,3 +659,32 @@ pwr_cal::sptr pwr_cal::make(
 {
     return std::make_shared<pwr_cal_impl>(name, serial, timestamp);
 }
+
+
+std::vector<double> pwr_cal::get_power_batch(const std::vector<double>& gains,
+    const std::vector<double>& freqs,
+    const boost::optional<int> temperature) const
+{
+    if (gains.size() != freqs.size()) {
+        throw uhd::value_error("pwr_cal: Number of gains and frequencies differ!");
+    }
+    std::vector<double> powers(gains.size());
+    for (size_t i = 0; i < gains.size(); i++) {
+        powers[i] = get_power(gains[i], freqs[i], temperature);
+    }
+    return powers;
+}
+
+std::vector<double> pwr_cal::get_gain_batch(const std::vector<double>& powers_dbm,
+    const std::vector<double>& freqs,
+    const boost::optional<int> temperature) const
+{
+    if (powers_dbm.size() != freqs.size()) {
+        throw uhd::value_error("pwr_cal: Number of powers and frequencies differ!");
+    }
+    std::vector<double> gains(powers_dbm.size());
+    for (size_t i = 0; i < powers_dbm.size(); i++) {
+        gains[i] = get_gain(powers_dbm[i], freqs[i], temperature);
+    }
+    return gains;
+}
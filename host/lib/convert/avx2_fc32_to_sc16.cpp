@@ -0,0 +1,83 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 8 fc32 samples to saturated, rounded sc16 samples
+ *
+ * _mm256_packs_epi32() packs within 128-bit lanes, so the result needs to be
+ * put back into order by swapping the middle 64-bit words.
+ */
+UHD_CONVERT_TARGET(avx2)
+static UHD_INLINE __m256i pack_sc16_8x(
+    const __m256& in0, const __m256& in1, const __m256& scalar)
+{
+    const __m256i tmpilo = _mm256_cvtps_epi32(_mm256_mul_ps(in0, scalar));
+    const __m256i tmpihi = _mm256_cvtps_epi32(_mm256_mul_ps(in1, scalar));
+    return _mm256_permute4x64_epi64(
+        _mm256_packs_epi32(tmpilo, tmpihi), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+DECLARE_CONVERTER_TARGET(avx2, fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input */
+        const __m256 tmplo =
+            _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        const __m256 tmphi =
+            _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 4));
+
+        /* convert, scale and pack */
+        __m256i tmpi = pack_sc16_8x(tmplo, tmphi, scalar);
+
+        /* swap 16-bit pairs */
+        tmpi = _mm256_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm256_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        /* store to output */
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input */
+        const __m256 tmplo =
+            _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        const __m256 tmphi =
+            _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 4));
+
+        /* convert, scale and pack */
+        const __m256i tmpi = pack_sc16_8x(tmplo, tmphi, scalar);
+
+        /* store to output */
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), tmpi);
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
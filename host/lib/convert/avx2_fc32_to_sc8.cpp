@@ -0,0 +1,59 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 8 fc32 samples to four sc8_item32_le words
+ *
+ * The values are rounded and saturated like in the SSE2 converter. The four
+ * values that go into each word are reversed first, and the packed 16-bit
+ * values are put back into order before the final pack to 8 bit.
+ */
+UHD_CONVERT_TARGET(avx2)
+static UHD_INLINE __m128i pack_sc8_8x(
+    const __m256& in0, const __m256& in1, const __m256& scalar)
+{
+    __m256i tmpi0 = _mm256_cvtps_epi32(_mm256_mul_ps(in0, scalar));
+    tmpi0         = _mm256_shuffle_epi32(tmpi0, _MM_SHUFFLE(0, 1, 2, 3));
+    __m256i tmpi1 = _mm256_cvtps_epi32(_mm256_mul_ps(in1, scalar));
+    tmpi1         = _mm256_shuffle_epi32(tmpi1, _MM_SHUFFLE(0, 1, 2, 3));
+
+    const __m256i tmpi = _mm256_permute4x64_epi64(
+        _mm256_packs_epi32(tmpi0, tmpi1), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_packs_epi16(
+        _mm256_castsi256_si128(tmpi), _mm256_extracti128_si256(tmpi, 1));
+}
+
+DECLARE_CONVERTER_TARGET(avx2, fc32, 1, sc8_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (size_t j = 0; i + 7 < nsamps; i += 8, j += 4) {
+        /* load from input */
+        const __m256 tmp0 =
+            _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 0));
+        const __m256 tmp1 =
+            _mm256_loadu_ps(reinterpret_cast<const float*>(input + i + 4));
+
+        /* convert */
+        const __m128i tmpi = pack_sc8_8x(tmp0, tmp1, scalar);
+
+        /* store to output */
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + j), tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc8<uhd::htowx>(input + i, output + (i / 2), nsamps - i, scale_factor);
+}
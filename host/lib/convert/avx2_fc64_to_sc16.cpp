@@ -0,0 +1,69 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 4 fc64 samples to saturated sc16 samples
+ *
+ * Like the SSE2 converter, this truncates instead of rounding.
+ */
+UHD_CONVERT_TARGET(avx2)
+static UHD_INLINE __m128i pack_sc16_4x(const fc64_t* input, const __m256d& scalar)
+{
+    const __m256d tmp0 = _mm256_loadu_pd(reinterpret_cast<const double*>(input + 0));
+    const __m256d tmp1 = _mm256_loadu_pd(reinterpret_cast<const double*>(input + 2));
+
+    const __m128i tmpilo = _mm256_cvttpd_epi32(_mm256_mul_pd(tmp0, scalar));
+    const __m128i tmpihi = _mm256_cvttpd_epi32(_mm256_mul_pd(tmp1, scalar));
+    return _mm_packs_epi32(tmpilo, tmpihi);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, fc64, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        /* load from input, convert, scale and pack */
+        __m128i tmpi = pack_sc16_4x(input + i, scalar);
+
+        /* swap 16-bit pairs */
+        tmpi = _mm_shufflelo_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpi = _mm_shufflehi_epi16(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        /* store to output */
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), tmpi);
+    }
+
+    // convert remainder
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, fc64, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX2)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        /* load from input, convert, scale, pack and store to output */
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + i), pack_sc16_4x(input + i, scalar));
+    }
+
+    // convert remainder
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,249 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_pack_sc12.hpp"
+#include <immintrin.h>
+
+/*
+ * This works like the SSSE3 converter, see ssse3_pack_sc12.cpp for the
+ * shuffle orderings. Each 128-bit lane of an AVX2 register packs 4 samples
+ * into one 3 x 32-bit struct, so 8 samples are converted at a time.
+ */
+#define SC12_SHIFT_MASK    0xfff0fff0, 0xfff0fff0, 0x0fff0fff, 0x0fff0fff
+#define SC12_PACK_SHUFFLE1 13, 12, 9, 8, 5, 4, 1, 0, 15, 14, 11, 10, 7, 6, 3, 2
+#define SC12_PACK_SHUFFLE2 9, 8, 0, 11, 10, 2, 13, 12, 4, 15, 14, 6, 0, 0, 0, 0
+#define SC12_PACK_SHUFFLE3 8, 1, 8, 8, 3, 8, 8, 5, 8, 8, 7, 8, 8, 8, 8, 8
+
+namespace {
+
+//! Interleave the values in each lane, and store the lanes to two structs
+UHD_CONVERT_TARGET(avx2)
+UHD_INLINE void store_sc12_item32_6(__m256i m0, item32_sc12_3x* output)
+{
+    const __m256i shuf2 = _mm256_broadcastsi128_si256(_mm_set_epi8(SC12_PACK_SHUFFLE2));
+    const __m256i shuf3 = _mm256_broadcastsi128_si256(_mm_set_epi8(SC12_PACK_SHUFFLE3));
+
+    // Clear the upper 64 bits of each lane
+    __m256i m1 = _mm256_blend_epi32(_mm256_setzero_si256(), m0, 0x33);
+    m0         = _mm256_shuffle_epi8(m0, shuf2);
+    m1         = _mm256_shuffle_epi8(m1, shuf3);
+    m0         = _mm256_or_si256(m0, m1);
+    m0         = _mm256_shuffle_epi32(m0, _MM_SHUFFLE(0, 1, 2, 3));
+
+    // Each lane also writes 4 bytes past its struct. The second store
+    // overwrites those of the first one.
+    _mm_storeu_si128((__m128i*)&output[0], _mm256_castsi256_si128(m0));
+    _mm_storeu_si128((__m128i*)&output[1], _mm256_extracti128_si256(m0, 1));
+}
+
+template <typename type>
+UHD_CONVERT_TARGET(avx2)
+UHD_INLINE void convert_star_8_to_sc12_item32_6(const std::complex<type>* in,
+    item32_sc12_3x* output,
+    const double scalar,
+    typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
+{
+    const __m256 in0 = _mm256_loadu_ps((const float*)&in[0]);
+    const __m256 in1 = _mm256_loadu_ps((const float*)&in[4]);
+
+    // Each lane gets samples 0, 1 | 2, 3 of its struct in m1 | m2
+    __m256 m0, m1, m2;
+    m0 = _mm256_set1_ps(scalar);
+    m1 = _mm256_permute2f128_ps(in0, in1, 0x20);
+    m2 = _mm256_permute2f128_ps(in0, in1, 0x31);
+    m1 = _mm256_mul_ps(m1, m0);
+    m2 = _mm256_mul_ps(m2, m0);
+    m0 = _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 0, 2, 0));
+    m1 = _mm256_shuffle_ps(m1, m2, _MM_SHUFFLE(3, 1, 3, 1));
+
+    __m256i m3, m6, m7;
+    m3 = _mm256_broadcastsi128_si256(_mm_set_epi32(SC12_SHIFT_MASK));
+
+    m6 = _mm256_cvtps_epi32(m0);
+    m7 = _mm256_cvtps_epi32(m1);
+    m6 = _mm256_slli_epi32(m6, 4);
+    m6 = _mm256_packs_epi32(m7, m6);
+    m6 = _mm256_and_si256(m6, m3);
+
+    store_sc12_item32_6(m6, output);
+}
+
+template <typename type>
+UHD_CONVERT_TARGET(avx2)
+UHD_INLINE void convert_star_8_to_sc12_item32_6(const std::complex<type>* in,
+    item32_sc12_3x* output,
+    const double,
+    typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
+{
+    __m256i m0, m1, m4, m5;
+    m0 = _mm256_broadcastsi128_si256(_mm_set_epi32(SC12_SHIFT_MASK));
+    m1 = _mm256_broadcastsi128_si256(_mm_set_epi8(SC12_PACK_SHUFFLE1));
+
+    m4 = _mm256_loadu_si256((const __m256i*)in);
+    m4 = _mm256_shuffle_epi8(m4, m1);
+    m5 = _mm256_srli_epi16(m4, 4);
+    m4 = _mm256_shuffle_epi32(m4, _MM_SHUFFLE(0, 0, 3, 2));
+    m4 = _mm256_unpacklo_epi64(m5, m4);
+    m4 = _mm256_and_si256(m4, m0);
+
+    store_sc12_item32_6(m4, output);
+}
+
+template <typename type, towire32_type towire>
+struct convert_star_1_to_sc12_item32_2_avx2 : public converter
+{
+    convert_star_1_to_sc12_item32_2_avx2(void) : _scalar(0.0) {}
+
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    UHD_CONVERT_TARGET(avx2)
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const std::complex<type>* input =
+            reinterpret_cast<const std::complex<type>*>(inputs[0]);
+
+        const size_t head_samps = size_t(outputs[0]) & 0x3;
+        int enable;
+        size_t rewind = 0;
+        switch (head_samps) {
+            case 0:
+                break;
+            case 1:
+                rewind = 9;
+                break;
+            case 2:
+                rewind = 6;
+                break;
+            case 3:
+                rewind = 3;
+                break;
+        }
+        item32_sc12_3x* output =
+            reinterpret_cast<item32_sc12_3x*>(size_t(outputs[0]) - rewind);
+
+        // helper variables
+        size_t i = 0, o = 0;
+
+        // handle the head case
+        switch (head_samps) {
+            case 0:
+                break; // no head
+            case 1:
+                enable = CONVERT12_LINE2;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    0, 0, 0, input[0], enable, output[o++], _scalar);
+                break;
+            case 2:
+                enable = CONVERT12_LINE2 | CONVERT12_LINE1;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    0, 0, input[0], input[1], enable, output[o++], _scalar);
+                break;
+            case 3:
+                enable = CONVERT12_LINE2 | CONVERT12_LINE1 | CONVERT12_LINE0;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    0, input[0], input[1], input[2], enable, output[o++], _scalar);
+                break;
+        }
+        i += head_samps;
+
+        // The vector stores write 4 bytes past the last struct, so like in
+        // the SSSE3 converter, the final samples are always left for the tail
+        // case.
+        while (i + 8 < nsamps) {
+            convert_star_8_to_sc12_item32_6<type>(&input[i], &output[o], _scalar);
+            o += 2;
+            i += 8;
+        }
+        if (i + 4 < nsamps) {
+            convert_star_4_to_sc12_item32_3<type, towire>(input[i + 0],
+                input[i + 1],
+                input[i + 2],
+                input[i + 3],
+                CONVERT12_LINE_ALL,
+                output[o],
+                _scalar);
+            o++;
+            i += 4;
+        }
+
+        // handle the tail case
+        const size_t tail_samps = nsamps - i;
+        switch (tail_samps) {
+            case 0:
+                break; // no tail
+            case 1:
+                enable = CONVERT12_LINE0;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    input[i + 0], 0, 0, 0, enable, output[o], _scalar);
+                break;
+            case 2:
+                enable = CONVERT12_LINE0 | CONVERT12_LINE1;
+                convert_star_4_to_sc12_item32_3<type, towire>(
+                    input[i + 0], input[i + 1], 0, 0, enable, output[o], _scalar);
+                break;
+            case 3:
+                enable = CONVERT12_LINE0 | CONVERT12_LINE1 | CONVERT12_LINE2;
+                convert_star_4_to_sc12_item32_3<type, towire>(input[i + 0],
+                    input[i + 1],
+                    input[i + 2],
+                    0,
+                    enable,
+                    output[o],
+                    _scalar);
+                break;
+            case 4:
+                enable = CONVERT12_LINE_ALL;
+                convert_star_4_to_sc12_item32_3<type, towire>(input[i + 0],
+                    input[i + 1],
+                    input[i + 2],
+                    input[i + 3],
+                    enable,
+                    output[o],
+                    _scalar);
+                break;
+        }
+    }
+
+    double _scalar;
+};
+
+} // namespace
+
+static converter::sptr make_convert_fc32_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(new convert_star_1_to_sc12_item32_2_avx2<float, uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc16_1_to_sc12_item32_le_1(void)
+{
+    return converter::sptr(new convert_star_1_to_sc12_item32_2_avx2<short, uhd::wtohx>());
+}
+
+UHD_STATIC_BLOCK(register_avx2_pack_sc12)
+{
+    if (!cpu_has_avx2()) {
+        return;
+    }
+
+    uhd::convert::id_type id;
+    id.num_inputs  = 1;
+    id.num_outputs = 1;
+
+    id.input_format  = "fc32";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_fc32_1_to_sc12_item32_le_1, PRIORITY_SIMD_AVX2);
+
+    id.input_format  = "sc16";
+    id.output_format = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_1_to_sc12_item32_le_1, PRIORITY_SIMD_AVX2);
+}
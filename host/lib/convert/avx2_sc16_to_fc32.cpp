@@ -0,0 +1,109 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+// Unlike the SSE2 converters, these don't dispatch according to alignment:
+// On CPUs with AVX2, unaligned loads and stores are just as fast as aligned
+// ones if the data is aligned, and cheap if it isn't.
+
+DECLARE_CONVERTER_TARGET(avx2, sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    // Sign-extending the 16-bit values gives the same result as the SSE2
+    // converter, which moves them into the upper 16 bits and scales by 2^-16
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input and sign-extend to 32 bit */
+        __m256i tmpilo = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 0)));
+        __m256i tmpihi = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4)));
+
+        /* swap I and Q */
+        tmpilo = _mm256_shuffle_epi32(tmpilo, _MM_SHUFFLE(2, 3, 0, 1));
+        tmpihi = _mm256_shuffle_epi32(tmpihi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        /* convert and scale */
+        const __m256 tmplo = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpilo), scalar);
+        const __m256 tmphi = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpihi), scalar);
+
+        /* store to output */
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 4), tmphi);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc16_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input and sign-extend to 32 bit */
+        const __m256i tmpilo = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 0)));
+        const __m256i tmpihi = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4)));
+
+        /* convert and scale */
+        const __m256 tmplo = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpilo), scalar);
+        const __m256 tmphi = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpihi), scalar);
+
+        /* store to output */
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 0), tmplo);
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + i + 4), tmphi);
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc16_chdr, 1, fc32_planar, 2, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    float* output_i     = reinterpret_cast<float*>(outputs[0]);
+    float* output_q     = reinterpret_cast<float*>(outputs[1]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input */
+        const __m256i tmpi =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+        /* sign-extend I and Q into separate registers */
+        const __m256i tmpii = _mm256_srai_epi32(_mm256_slli_epi32(tmpi, 16), 16);
+        const __m256i tmpiq = _mm256_srai_epi32(tmpi, 16);
+
+        /* convert and scale */
+        const __m256 tmp_i = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpii), scalar);
+        const __m256 tmp_q = _mm256_mul_ps(_mm256_cvtepi32_ps(tmpiq), scalar);
+
+        /* store to outputs */
+        _mm256_storeu_ps(output_i + i, tmp_i);
+        _mm256_storeu_ps(output_q + i, tmp_q);
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_fc32_strided(
+        input + i, output_i + i, output_q + i, 1, nsamps - i, scale_factor);
+}
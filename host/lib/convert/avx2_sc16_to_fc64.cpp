@@ -0,0 +1,71 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 4 samples of sign-extended I/Q values to fc64
+ */
+UHD_CONVERT_TARGET(avx2)
+static UHD_INLINE void store_fc64_4x(
+    fc64_t* output, const __m256i& in, const __m256d& scalar)
+{
+    const __m256d tmp0 =
+        _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(in)), scalar);
+    const __m256d tmp1 =
+        _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(in, 1)), scalar);
+    _mm256_storeu_pd(reinterpret_cast<double*>(output + 0), tmp0);
+    _mm256_storeu_pd(reinterpret_cast<double*>(output + 2), tmp1);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc16_item32_le, 1, fc64, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        /* load from input and sign-extend to 32 bit */
+        __m256i tmpi = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+
+        /* swap I and Q */
+        tmpi = _mm256_shuffle_epi32(tmpi, _MM_SHUFFLE(2, 3, 0, 1));
+
+        /* convert, scale and store to output */
+        store_fc64_4x(output + i, tmpi, scalar);
+    }
+
+    // convert remainder
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc16_chdr, 1, fc64, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc64_t* output      = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m256d scalar = _mm256_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        /* load from input and sign-extend to 32 bit */
+        const __m256i tmpi = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+
+        /* convert, scale and store to output */
+        store_fc64_4x(output + i, tmpi, scalar);
+    }
+
+    // convert remainder
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
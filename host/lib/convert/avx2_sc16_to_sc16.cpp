@@ -0,0 +1,51 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Swap the 16-bit halves of each 32-bit word, for 8 samples at a time
+ */
+UHD_CONVERT_TARGET(avx2)
+static UHD_INLINE void swap_sc16_8x(const void* input, void* output)
+{
+    __m256i m0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+    m0         = _mm256_shufflelo_epi16(m0, _MM_SHUFFLE(2, 3, 0, 1));
+    m0         = _mm256_shufflehi_epi16(m0, _MM_SHUFFLE(2, 3, 0, 1));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), m0);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX2)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        swap_sc16_8x(input + i, output + i);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        swap_sc16_8x(input + i, output + i);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
@@ -0,0 +1,57 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*!
+ * Convert two sc8_item32_le words (4 samples) to fc32
+ *
+ * The 8-bit values are sign-extended to 32 bit, and the four values of each
+ * word are reversed to get them into I/Q order.
+ */
+UHD_CONVERT_TARGET(avx2)
+static UHD_INLINE __m256 unpack_sc8_4x(const __m128i& in, const __m256& scalar)
+{
+    const __m256i tmpi =
+        _mm256_shuffle_epi32(_mm256_cvtepi8_epi32(in), _MM_SHUFFLE(0, 1, 2, 3));
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(tmpi), scalar);
+}
+
+DECLARE_CONVERTER_TARGET(avx2, sc8_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX2)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(size_t(inputs[0]) & ~0x3);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m256 scalar = _mm256_set1_ps(float(scale_factor));
+
+    size_t i = 0, j = 0;
+    size_t num_samps = nsamps;
+
+    if ((size_t(inputs[0]) & 0x3) != 0) {
+        item32_sc8_to_xx<uhd::wtohx>(input++, output++, 1, scale_factor);
+        num_samps--;
+    }
+
+    for (; j + 7 < num_samps; j += 8, i += 4) {
+        /* load from input */
+        const __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        /* unpack, convert and scale */
+        const __m256 tmplo = unpack_sc8_4x(tmpi, scalar);
+        const __m256 tmphi = unpack_sc8_4x(_mm_unpackhi_epi64(tmpi, tmpi), scalar);
+
+        /* store to output */
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + j + 0), tmplo);
+        _mm256_storeu_ps(reinterpret_cast<float*>(output + j + 4), tmphi);
+    }
+
+    // convert remainder
+    item32_sc8_to_xx<uhd::wtohx>(input + i, output + j, num_samps - j, scale_factor);
+}
@@ -0,0 +1,218 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_unpack_sc12.hpp"
+#include <immintrin.h>
+
+using namespace uhd::convert;
+
+/*
+ * This works like the SSSE3 converter, see ssse3_unpack_sc12.cpp for the
+ * shuffle orderings. Each 128-bit lane of an AVX2 register unpacks one 3 x
+ * 32-bit struct, so 8 samples are converted at a time.
+ */
+#define SC12_SHIFT_MASK    0x0fff0fff, 0x0fff0fff, 0xfff0fff0, 0xfff0fff0
+#define SC12_PACK_SHUFFLE1 5, 4, 8, 7, 11, 10, 14, 13, 6, 5, 9, 8, 12, 11, 15, 14
+#define SC12_PACK_SHUFFLE2 15, 14, 7, 6, 13, 12, 5, 4, 11, 10, 3, 2, 9, 8, 1, 0
+
+namespace {
+
+//! Load two 3 x 32-bit structs into the lanes, and deinterleave the values
+UHD_CONVERT_TARGET(avx2)
+UHD_INLINE __m256i load_sc12_item32_6(const item32_sc12_3x* input)
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_set_epi32(SC12_SHIFT_MASK));
+    const __m256i shuf = _mm256_broadcastsi128_si256(_mm_set_epi8(SC12_PACK_SHUFFLE1));
+
+    __m256i m0 = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&input[0])),
+        _mm_loadu_si128((const __m128i*)&input[1]),
+        1);
+    m0 = _mm256_shuffle_epi32(m0, _MM_SHUFFLE(0, 1, 2, 3));
+    m0 = _mm256_shuffle_epi8(m0, shuf);
+    return _mm256_and_si256(m0, mask);
+}
+
+template <typename type>
+UHD_CONVERT_TARGET(avx2)
+UHD_INLINE void convert_sc12_item32_6_to_star_8(const item32_sc12_3x* input,
+    std::complex<type>* out,
+    double scalar,
+    typename std::enable_if<std::is_same<type, float>::value>::type* = NULL)
+{
+    __m256i m1, m2, m3, m4;
+    m3 = load_sc12_item32_6(input);
+
+    m4 = _mm256_setzero_si256();
+    m1 = _mm256_unpacklo_epi16(m4, m3);
+    m2 = _mm256_unpackhi_epi16(m4, m3);
+    m2 = _mm256_slli_epi32(m2, 4);
+    m3 = _mm256_unpacklo_epi32(m1, m2);
+    m4 = _mm256_unpackhi_epi32(m1, m2);
+
+    __m256 m5, m6, m7;
+    m5 = _mm256_set1_ps(scalar / (1 << 16));
+    m6 = _mm256_mul_ps(_mm256_cvtepi32_ps(m3), m5);
+    m7 = _mm256_mul_ps(_mm256_cvtepi32_ps(m4), m5);
+
+    // Each lane holds samples 0, 1 | 2, 3 of its struct in m6 | m7
+    _mm256_storeu_ps(
+        reinterpret_cast<float*>(&out[0]), _mm256_permute2f128_ps(m6, m7, 0x20));
+    _mm256_storeu_ps(
+        reinterpret_cast<float*>(&out[4]), _mm256_permute2f128_ps(m6, m7, 0x31));
+}
+
+template <typename type>
+UHD_CONVERT_TARGET(avx2)
+UHD_INLINE void convert_sc12_item32_6_to_star_8(const item32_sc12_3x* input,
+    std::complex<type>* out,
+    double,
+    typename std::enable_if<std::is_same<type, short>::value>::type* = NULL)
+{
+    __m256i m0, m1, m2, m3;
+    m2 = _mm256_broadcastsi128_si256(_mm_set_epi8(SC12_PACK_SHUFFLE2));
+    m3 = load_sc12_item32_6(input);
+
+    m0 = _mm256_slli_epi16(m3, 4);
+    m1 = _mm256_shuffle_epi32(m3, _MM_SHUFFLE(1, 0, 0, 0));
+    m0 = _mm256_unpackhi_epi64(m1, m0);
+    m1 = _mm256_shuffle_epi8(m0, m2);
+
+    _mm256_storeu_si256((__m256i*)out, m1);
+}
+
+template <typename type, tohost32_type tohost>
+struct convert_sc12_item32_1_to_star_2_avx2 : public converter
+{
+    convert_sc12_item32_1_to_star_2_avx2(void) : _scalar(0.0)
+    {
+        // NOP
+    }
+
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    UHD_CONVERT_TARGET(avx2)
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t head_samps = size_t(inputs[0]) & 0x3;
+        size_t rewind           = 0;
+        switch (head_samps) {
+            case 0:
+                break;
+            case 1:
+                rewind = 9;
+                break;
+            case 2:
+                rewind = 6;
+                break;
+            case 3:
+                rewind = 3;
+                break;
+        }
+
+        const item32_sc12_3x* input =
+            reinterpret_cast<const item32_sc12_3x*>(size_t(inputs[0]) - rewind);
+        std::complex<type>* output = reinterpret_cast<std::complex<type>*>(outputs[0]);
+        std::complex<type> dummy;
+        size_t i = 0, o = 0;
+        switch (head_samps) {
+            case 0:
+                break; // no head
+            case 1:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, dummy, dummy, output[0], _scalar);
+                break;
+            case 2:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, dummy, output[0], output[1], _scalar);
+                break;
+            case 3:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i++], dummy, output[0], output[1], output[2], _scalar);
+                break;
+        }
+        o += head_samps;
+
+        // convert the body
+        while (o + 7 < nsamps) {
+            convert_sc12_item32_6_to_star_8<type>(&input[i], &output[o], _scalar);
+            i += 2;
+            o += 8;
+        }
+        if (o + 3 < nsamps) {
+            convert_sc12_item32_3_to_star_4<type, tohost>(input[i],
+                output[o + 0],
+                output[o + 1],
+                output[o + 2],
+                output[o + 3],
+                _scalar);
+            i += 1;
+            o += 4;
+        }
+
+        const size_t tail_samps = nsamps - o;
+        switch (tail_samps) {
+            case 0:
+                break; // no tail
+            case 1:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i], output[o + 0], dummy, dummy, dummy, _scalar);
+                break;
+            case 2:
+                convert_sc12_item32_3_to_star_4<type, tohost>(
+                    input[i], output[o + 0], output[o + 1], dummy, dummy, _scalar);
+                break;
+            case 3:
+                convert_sc12_item32_3_to_star_4<type, tohost>(input[i],
+                    output[o + 0],
+                    output[o + 1],
+                    output[o + 2],
+                    dummy,
+                    _scalar);
+                break;
+        }
+    }
+
+    double _scalar;
+};
+
+} // namespace
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_1(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_star_2_avx2<float, uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_1_to_sc16_1(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_star_2_avx2<short, uhd::wtohx>());
+}
+
+UHD_STATIC_BLOCK(register_avx2_unpack_sc12)
+{
+    if (!cpu_has_avx2()) {
+        return;
+    }
+
+    uhd::convert::id_type id;
+    id.num_inputs    = 1;
+    id.num_outputs   = 1;
+    id.output_format = "fc32";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_1, PRIORITY_SIMD_AVX2);
+
+    id.output_format = "sc16";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_sc16_1, PRIORITY_SIMD_AVX2);
+}
@@ -0,0 +1,65 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+// Compiled with -Wno-maybe-uninitialized on GCC, see CMakeLists.txt
+
+using namespace uhd::convert;
+
+// _mm512_cvtsepi32_epi16() saturates like _mm_packs_epi32(), but keeps the
+// values in order, so no shuffling across lanes is needed.
+
+DECLARE_CONVERTER_TARGET(avx512f, fc32, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input */
+        const __m512 tmp = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i));
+
+        /* convert, scale and swap I and Q */
+        __m512i tmpi = _mm512_cvtps_epi32(_mm512_mul_ps(tmp, scalar));
+        tmpi         = _mm512_shuffle_epi32(tmpi, _MM_PERM_CDAB);
+
+        /* pack and store to output */
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + i), _mm512_cvtsepi32_epi16(tmpi));
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, fc32, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc32_t* input = reinterpret_cast<const fc32_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input */
+        const __m512 tmp = _mm512_loadu_ps(reinterpret_cast<const float*>(input + i));
+
+        /* convert and scale */
+        const __m512i tmpi = _mm512_cvtps_epi32(_mm512_mul_ps(tmp, scalar));
+
+        /* pack and store to output */
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + i), _mm512_cvtsepi32_epi16(tmpi));
+    }
+
+    // convert any remaining samples
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
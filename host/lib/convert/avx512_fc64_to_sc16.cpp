@@ -0,0 +1,72 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+// Compiled with -Wno-maybe-uninitialized on GCC, see CMakeLists.txt
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 8 fc64 samples to sc16 samples, which are still 32 bits wide
+ *
+ * Like the SSE2 converter, this truncates instead of rounding.
+ */
+UHD_CONVERT_TARGET(avx512f)
+static UHD_INLINE __m512i convert_sc32_8x(const fc64_t* input, const __m512d& scalar)
+{
+    const __m512d tmp0 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + 0));
+    const __m512d tmp1 = _mm512_loadu_pd(reinterpret_cast<const double*>(input + 4));
+
+    const __m256i tmpilo = _mm512_cvttpd_epi32(_mm512_mul_pd(tmp0, scalar));
+    const __m256i tmpihi = _mm512_cvttpd_epi32(_mm512_mul_pd(tmp1, scalar));
+    return _mm512_inserti64x4(_mm512_castsi256_si512(tmpilo), tmpihi, 1);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, fc64, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input, convert, scale and swap I and Q */
+        const __m512i tmpi =
+            _mm512_shuffle_epi32(convert_sc32_8x(input + i, scalar), _MM_PERM_CDAB);
+
+        /* pack with saturation and store to output */
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + i), _mm512_cvtsepi32_epi16(tmpi));
+    }
+
+    // convert remainder
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, fc64, 1, sc16_chdr, 1, PRIORITY_SIMD_AVX512)
+{
+    const fc64_t* input = reinterpret_cast<const fc64_t*>(inputs[0]);
+    sc16_t* output      = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input, convert and scale */
+        const __m512i tmpi = convert_sc32_8x(input + i, scalar);
+
+        /* pack with saturation and store to output */
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(output + i), _mm512_cvtsepi32_epi16(tmpi));
+    }
+
+    // convert remainder
+    xx_to_chdr_sc16(input + i, output + i, nsamps - i, scale_factor);
+}
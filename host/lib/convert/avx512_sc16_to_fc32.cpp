@@ -0,0 +1,60 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+// Compiled with -Wno-maybe-uninitialized on GCC, see CMakeLists.txt
+
+using namespace uhd::convert;
+
+DECLARE_CONVERTER_TARGET(avx512f, sc16_item32_le, 1, fc32, 1, PRIORITY_SIMD_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc32_t* output        = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input and sign-extend to 32 bit */
+        __m512i tmpi = _mm512_cvtepi16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+
+        /* swap I and Q */
+        tmpi = _mm512_shuffle_epi32(tmpi, _MM_PERM_CDAB);
+
+        /* convert, scale and store to output */
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i),
+            _mm512_mul_ps(_mm512_cvtepi32_ps(tmpi), scalar));
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, sc16_chdr, 1, fc32, 1, PRIORITY_SIMD_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc32_t* output      = reinterpret_cast<fc32_t*>(outputs[0]);
+
+    const __m512 scalar = _mm512_set1_ps(float(scale_factor));
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input and sign-extend to 32 bit */
+        const __m512i tmpi = _mm512_cvtepi16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+
+        /* convert, scale and store to output */
+        _mm512_storeu_ps(reinterpret_cast<float*>(output + i),
+            _mm512_mul_ps(_mm512_cvtepi32_ps(tmpi), scalar));
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
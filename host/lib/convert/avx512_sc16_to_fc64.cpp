@@ -0,0 +1,73 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+// Compiled with -Wno-maybe-uninitialized on GCC, see CMakeLists.txt
+
+using namespace uhd::convert;
+
+/*!
+ * Convert 8 samples of sign-extended I/Q values to fc64
+ */
+UHD_CONVERT_TARGET(avx512f)
+static UHD_INLINE void store_fc64_8x(
+    fc64_t* output, const __m512i& in, const __m512d& scalar)
+{
+    const __m512d tmp0 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(in)), scalar);
+    const __m512d tmp1 =
+        _mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(in, 1)), scalar);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 0), tmp0);
+    _mm512_storeu_pd(reinterpret_cast<double*>(output + 4), tmp1);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, sc16_item32_le, 1, fc64, 1, PRIORITY_SIMD_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    fc64_t* output        = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input and sign-extend to 32 bit */
+        __m512i tmpi = _mm512_cvtepi16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+
+        /* swap I and Q */
+        tmpi = _mm512_shuffle_epi32(tmpi, _MM_PERM_CDAB);
+
+        /* convert, scale and store to output */
+        store_fc64_8x(output + i, tmpi, scalar);
+    }
+
+    // convert remainder
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, scale_factor);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, sc16_chdr, 1, fc64, 1, PRIORITY_SIMD_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    fc64_t* output      = reinterpret_cast<fc64_t*>(outputs[0]);
+
+    const __m512d scalar = _mm512_set1_pd(scale_factor);
+
+    size_t i = 0;
+    for (; i + 7 < nsamps; i += 8) {
+        /* load from input and sign-extend to 32 bit */
+        const __m512i tmpi = _mm512_cvtepi16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+
+        /* convert, scale and store to output */
+        store_fc64_8x(output + i, tmpi, scalar);
+    }
+
+    // convert remainder
+    chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
+}
@@ -0,0 +1,51 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+#include <immintrin.h>
+
+// Compiled with -Wno-maybe-uninitialized on GCC, see CMakeLists.txt
+
+using namespace uhd::convert;
+
+/*!
+ * Swap the 16-bit halves of each 32-bit word, for 16 samples at a time
+ */
+UHD_CONVERT_TARGET(avx512f)
+static UHD_INLINE void swap_sc16_16x(const void* input, void* output)
+{
+    const __m512i m0 = _mm512_loadu_si512(input);
+    _mm512_storeu_si512(output, _mm512_rol_epi32(m0, 16));
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, sc16, 1, sc16_item32_le, 1, PRIORITY_SIMD_AVX512)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    item32_t* output    = reinterpret_cast<item32_t*>(outputs[0]);
+
+    size_t i = 0;
+    for (; i + 15 < nsamps; i += 16) {
+        swap_sc16_16x(input + i, output + i);
+    }
+
+    // convert any remaining samples
+    xx_to_item32_sc16<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
+
+DECLARE_CONVERTER_TARGET(avx512f, sc16_item32_le, 1, sc16, 1, PRIORITY_SIMD_AVX512)
+{
+    const item32_t* input = reinterpret_cast<const item32_t*>(inputs[0]);
+    sc16_t* output        = reinterpret_cast<sc16_t*>(outputs[0]);
+
+    size_t i = 0;
+    for (; i + 15 < nsamps; i += 16) {
+        swap_sc16_16x(input + i, output + i);
+    }
+
+    // convert any remaining samples
+    item32_sc16_to_xx<uhd::htowx>(input + i, output + i, nsamps - i, 1.0);
+}
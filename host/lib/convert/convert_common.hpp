@@ -14,7 +14,8 @@
 #include <complex>
 #include <limits>
 
-#define _DECLARE_CONVERTER(name, in_form, num_in, out_form, num_out, prio)    \
+#define _DECLARE_CONVERTER_IF(                                                \
+    cond, attr, name, in_form, num_in, out_form, num_out, prio)               \
     struct name : public uhd::convert::converter                              \
     {                                                                         \
         static sptr make(void)                                                \
@@ -26,10 +27,14 @@
         {                                                                     \
             scale_factor = s;                                                 \
         }                                                                     \
-        void operator()(const input_type&, const output_type&, const size_t); \
+        attr void operator()(                                                 \
+            const input_type&, const output_type&, const size_t);             \
     };                                                                        \
     UHD_STATIC_BLOCK(__register_##name##_##prio)                              \
     {                                                                         \
+        if (!(cond)) {                                                        \
+            return;                                                           \
+        }                                                                     \
         uhd::convert::id_type id;                                             \
         id.input_format  = #in_form;                                          \
         id.num_inputs    = num_in;                                            \
@@ -37,9 +42,12 @@
         id.num_outputs   = num_out;                                           \
         uhd::convert::register_converter(id, &name::make, prio);              \
     }                                                                         \
-    void name::operator()(                                                    \
+    attr void name::operator()(                                               \
         const input_type& inputs, const output_type& outputs, const size_t nsamps)
 
+#define _DECLARE_CONVERTER(name, in_form, num_in, out_form, num_out, prio) \
+    _DECLARE_CONVERTER_IF(true, , name, in_form, num_in, out_form, num_out, prio)
+
 /*! Convenience macro to declare a single-function converter
  *
  * Most converters consist of a single for loop, and can make use of
@@ -62,6 +70,45 @@
         num_out,                                                                         \
         prio)
 
+/*! Declare a converter that uses an x86 instruction set extension
+ *
+ * Works like DECLARE_CONVERTER(), except that the conversion function is
+ * compiled for the instruction set extension `target` (`avx2` or `avx512f`),
+ * and that the converter is only registered if the CPU UHD runs on supports
+ * that extension. The source file itself is compiled without any special
+ * flags, so the same binary runs on any x86 host. Helper functions that use
+ * the extension's intrinsics must be marked with UHD_CONVERT_TARGET(target).
+ */
+#define DECLARE_CONVERTER_TARGET(target, in_form, num_in, out_form, num_out, prio) \
+    _DECLARE_CONVERTER_IF(uhd::convert::cpu_has_##target(),                        \
+        UHD_CONVERT_TARGET(target),                                                \
+        __convert_##in_form##_##num_in##_##out_form##_##num_out##_##prio,          \
+        in_form,                                                                   \
+        num_in,                                                                    \
+        out_form,                                                                  \
+        num_out,                                                                   \
+        prio)
+
+#if defined(__GNUC__) || defined(__clang__)
+#    define UHD_CONVERT_TARGET_avx2 __attribute__((target("avx2")))
+#    define UHD_CONVERT_TARGET_avx512f __attribute__((target("avx512f")))
+#else
+// MSVC lets us use all intrinsics without changing the target architecture
+#    define UHD_CONVERT_TARGET_avx2
+#    define UHD_CONVERT_TARGET_avx512f
+#endif
+#define UHD_CONVERT_TARGET(target) UHD_CONVERT_TARGET_##target
+
+namespace uhd { namespace convert {
+
+//! Returns true if both the CPU and the OS support AVX2
+bool cpu_has_avx2(void);
+
+//! Returns true if both the CPU and the OS support AVX-512 Foundation
+bool cpu_has_avx512f(void);
+
+}} // namespace uhd::convert
+
 /***********************************************************************
  * Setup priorities
  **********************************************************************/
@@ -76,6 +123,9 @@ static const int PRIORITY_TABLE =
 // We used to have ORC, too, so SIMD is 3
 static const int PRIORITY_SIMD  = 3;
 static const int PRIORITY_TABLE = 1;
+// Only registered on CPUs that support the respective instruction set
+static const int PRIORITY_SIMD_AVX2   = 4;
+static const int PRIORITY_SIMD_AVX512 = 5;
 #endif
 
 /***********************************************************************
@@ -205,6 +255,79 @@ UHD_FORCE_INLINE void chdr_sc16_to_xx(const sc16_t* input,
     }
 }
 
+/*!
+ * Convert chdr sc16 buffer to separate I and Q outputs
+ *
+ * Sample n is written to out_i[n * stride] and out_q[n * stride]. A stride of
+ * 1 writes planar I and Q arrays. Pointing out_i and out_q to the real and
+ * imaginary part of an fc32 sample, with a stride of 2 * N floats, interleaves
+ * the sample with those of N-1 other channels.
+ */
+UHD_FORCE_INLINE void chdr_sc16_to_fc32_strided(const sc16_t* input,
+    float* out_i,
+    float* out_q,
+    const size_t stride,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        out_i[i * stride] = float(input[i].real()) * float(scale_factor);
+        out_q[i * stride] = float(input[i].imag()) * float(scale_factor);
+    }
+}
+
+/*!
+ * Convert items32 sc16 buffer to separate I and Q outputs
+ *
+ * Like chdr_sc16_to_fc32_strided(), sample n is written to out_i[n * stride]
+ * and out_q[n * stride].
+ */
+template <xtox_t to_host>
+UHD_INLINE void item32_sc16_to_fc32_strided(const item32_t* input,
+    float* out_i,
+    float* out_q,
+    const size_t stride,
+    const size_t nsamps,
+    const double scale_factor)
+{
+    for (size_t i = 0; i < nsamps; i++) {
+        const item32_t item = to_host(input[i]);
+        out_i[i * stride]   = float(int16_t(item >> 16)) * float(scale_factor);
+        out_q[i * stride]   = float(int16_t(item >> 0)) * float(scale_factor);
+    }
+}
+
+/***********************************************************************
+ * Multi-channel converters
+ **********************************************************************/
+//! Largest number of channels chan_interleaved converters are registered for
+static const size_t MAX_CHAN_INTERLEAVED_INPUTS = 32;
+
+/*!
+ * Register a converter that interleaves the samples of several channels
+ *
+ * Converters to a chan_interleaved format have one input per channel and a
+ * single output, which holds sample 0 of all channels, followed by sample 1
+ * of all channels, and so on. They are registered for 1 up to
+ * MAX_CHAN_INTERLEAVED_INPUTS inputs, so they must get the number of channels
+ * from the size of their input vector.
+ */
+UHD_INLINE void register_chan_interleaved_converter(const std::string& input_format,
+    const std::string& output_format,
+    const uhd::convert::function_type& fcn,
+    const uhd::convert::priority_type prio)
+{
+    uhd::convert::id_type id;
+    id.input_format  = input_format;
+    id.output_format = output_format;
+    id.num_outputs   = 1;
+    for (size_t num_inputs = 1; num_inputs <= MAX_CHAN_INTERLEAVED_INPUTS;
+         num_inputs++) {
+        id.num_inputs = num_inputs;
+        uhd::convert::register_converter(id, fcn, prio);
+    }
+}
+
 /***********************************************************************
  * Convert xx to items32 sc8 buffer
  **********************************************************************/
@@ -0,0 +1,71 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+
+#ifdef _MSC_VER
+#    include <immintrin.h>
+#    include <intrin.h>
+
+namespace {
+
+// Bits in the results of CPUID
+constexpr int CPUID_1_ECX_OSXSAVE = 1 << 27;
+constexpr int CPUID_1_ECX_AVX     = 1 << 28;
+constexpr int CPUID_7_EBX_AVX2    = 1 << 5;
+constexpr int CPUID_7_EBX_AVX512F = 1 << 16;
+// Bits in XCR0 which tell us that the OS saves the vector registers
+constexpr uint64_t XCR0_AVX_STATE    = 0x06; // XMM, YMM
+constexpr uint64_t XCR0_AVX512_STATE = 0xe6; // XMM, YMM, opmask, ZMM
+
+bool cpu_has(const int leaf7_ebx_bit, const uint64_t xcr0_mask)
+{
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) {
+        return false;
+    }
+    __cpuidex(regs, 1, 0);
+    const int avx_bits = CPUID_1_ECX_OSXSAVE | CPUID_1_ECX_AVX;
+    if ((regs[2] & avx_bits) != avx_bits) {
+        return false;
+    }
+    if ((_xgetbv(0) & xcr0_mask) != xcr0_mask) {
+        return false;
+    }
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & leaf7_ebx_bit) != 0;
+}
+
+} // namespace
+
+bool uhd::convert::cpu_has_avx2(void)
+{
+    static const bool has_avx2 = cpu_has(CPUID_7_EBX_AVX2, XCR0_AVX_STATE);
+    return has_avx2;
+}
+
+bool uhd::convert::cpu_has_avx512f(void)
+{
+    static const bool has_avx512f = cpu_has(CPUID_7_EBX_AVX512F, XCR0_AVX512_STATE);
+    return has_avx512f;
+}
+
+#else
+// GCC and Clang also check whether the OS saves the vector registers
+
+bool uhd::convert::cpu_has_avx2(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+bool uhd::convert::cpu_has_avx512f(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f");
+}
+#endif
@@ -0,0 +1,167 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "convert_common.hpp"
+#include <uhd/utils/byteswap.hpp>
+
+using namespace uhd::convert;
+
+/***********************************************************************
+ * sc16 -> fc32 with planar I and Q outputs
+ **********************************************************************/
+DECLARE_CONVERTER(sc16_chdr, 1, fc32_planar, 2, PRIORITY_GENERAL)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    float* output_i     = reinterpret_cast<float*>(outputs[0]);
+    float* output_q     = reinterpret_cast<float*>(outputs[1]);
+
+    chdr_sc16_to_fc32_strided(input, output_i, output_q, 1, nsamps, scale_factor);
+}
+
+/***********************************************************************
+ * N x sc16 -> fc32, with the samples of all channels interleaved
+ **********************************************************************/
+namespace {
+
+struct convert_sc16_chdr_n_to_fc32_chan_interleaved_1 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t num_chans = inputs.size();
+        float* output          = reinterpret_cast<float*>(outputs[0]);
+
+        for (size_t chan = 0; chan < num_chans; chan++) {
+            chdr_sc16_to_fc32_strided(reinterpret_cast<const sc16_t*>(inputs[chan]),
+                output + 2 * chan,
+                output + 2 * chan + 1,
+                2 * num_chans,
+                nsamps,
+                _scalar);
+        }
+    }
+
+    double _scalar = 1.0;
+};
+
+/***********************************************************************
+ * sc16 items32 -> fc32, planar or with the samples of all channels interleaved
+ **********************************************************************/
+template <xtox_t to_host>
+struct convert_sc16_item32_1_to_fc32_planar_2 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        item32_sc16_to_fc32_strided<to_host>(
+            reinterpret_cast<const item32_t*>(inputs[0]),
+            reinterpret_cast<float*>(outputs[0]),
+            reinterpret_cast<float*>(outputs[1]),
+            1,
+            nsamps,
+            _scalar);
+    }
+
+    double _scalar = 1.0;
+};
+
+template <xtox_t to_host>
+struct convert_sc16_item32_n_to_fc32_chan_interleaved_1 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t num_chans = inputs.size();
+        float* output          = reinterpret_cast<float*>(outputs[0]);
+
+        for (size_t chan = 0; chan < num_chans; chan++) {
+            item32_sc16_to_fc32_strided<to_host>(
+                reinterpret_cast<const item32_t*>(inputs[chan]),
+                output + 2 * chan,
+                output + 2 * chan + 1,
+                2 * num_chans,
+                nsamps,
+                _scalar);
+        }
+    }
+
+    double _scalar = 1.0;
+};
+
+} // namespace
+
+static converter::sptr make_convert_sc16_chdr_n_to_fc32_chan_interleaved_1(void)
+{
+    return converter::sptr(new convert_sc16_chdr_n_to_fc32_chan_interleaved_1());
+}
+
+static converter::sptr make_convert_sc16_item32_le_1_to_fc32_planar_2(void)
+{
+    return converter::sptr(new convert_sc16_item32_1_to_fc32_planar_2<uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc16_item32_be_1_to_fc32_planar_2(void)
+{
+    return converter::sptr(new convert_sc16_item32_1_to_fc32_planar_2<uhd::ntohx>());
+}
+
+static converter::sptr make_convert_sc16_item32_le_n_to_fc32_chan_interleaved_1(void)
+{
+    return converter::sptr(
+        new convert_sc16_item32_n_to_fc32_chan_interleaved_1<uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc16_item32_be_n_to_fc32_chan_interleaved_1(void)
+{
+    return converter::sptr(
+        new convert_sc16_item32_n_to_fc32_chan_interleaved_1<uhd::ntohx>());
+}
+
+UHD_STATIC_BLOCK(register_convert_sc16_to_fc32_multi_buffer)
+{
+    register_chan_interleaved_converter("sc16_chdr",
+        "fc32_chan_interleaved",
+        &make_convert_sc16_chdr_n_to_fc32_chan_interleaved_1,
+        PRIORITY_GENERAL);
+
+    uhd::convert::id_type id;
+    id.num_inputs    = 1;
+    id.num_outputs   = 2;
+    id.output_format = "fc32_planar";
+    id.input_format  = "sc16_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_item32_le_1_to_fc32_planar_2, PRIORITY_GENERAL);
+    id.input_format = "sc16_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc16_item32_be_1_to_fc32_planar_2, PRIORITY_GENERAL);
+
+    register_chan_interleaved_converter("sc16_item32_le",
+        "fc32_chan_interleaved",
+        &make_convert_sc16_item32_le_n_to_fc32_chan_interleaved_1,
+        PRIORITY_GENERAL);
+    register_chan_interleaved_converter("sc16_item32_be",
+        "fc32_chan_interleaved",
+        &make_convert_sc16_item32_be_n_to_fc32_chan_interleaved_1,
+        PRIORITY_GENERAL);
+}
@@ -12,6 +12,7 @@
 #include <uhd/utils/static.hpp>
 #include <stdint.h>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <complex>
 
 using namespace uhd;
@@ -106,6 +107,21 @@ convert::function_type convert::get_converter(const id_type& id, const priority_
     return get_table()[id][best_prio];
 }
 
+std::vector<convert::id_type> convert::get_converter_ids()
+{
+    return get_table().keys();
+}
+
+std::vector<convert::priority_type> convert::get_converter_priorities(const id_type& id)
+{
+    if (not get_table().has_key(id))
+        throw uhd::key_error("Cannot find a conversion routine for " + id.to_pp_string());
+
+    std::vector<priority_type> prios = get_table()[id].keys();
+    std::sort(prios.begin(), prios.end());
+    return prios;
+}
+
 /***********************************************************************
  * Mappings for item format to byte size for all items we can
  **********************************************************************/
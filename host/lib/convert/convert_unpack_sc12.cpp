@@ -164,6 +164,85 @@ static converter::sptr make_convert_sc12_item32_be_1_to_sc16_1(void)
     return converter::sptr(new convert_sc12_item32_1_to_star_1<short, uhd::ntohx>());
 }
 
+/*
+ * These converters write I and Q to separate outputs, or interleave the samples
+ * of several input channels into a single output.
+ */
+template <tohost32_type tohost>
+struct convert_sc12_item32_1_to_fc32_planar_2 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        unpack_sc12_to_fc32_strided<tohost>(inputs[0],
+            reinterpret_cast<float*>(outputs[0]),
+            reinterpret_cast<float*>(outputs[1]),
+            1,
+            nsamps,
+            _scalar);
+    }
+
+    double _scalar = 0.0;
+};
+
+template <tohost32_type tohost>
+struct convert_sc12_item32_n_to_fc32_chan_interleaved_1 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        const int unpack_growth = 16;
+        _scalar                 = scalar / unpack_growth;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t num_chans = inputs.size();
+        float* output          = reinterpret_cast<float*>(outputs[0]);
+
+        for (size_t chan = 0; chan < num_chans; chan++) {
+            unpack_sc12_to_fc32_strided<tohost>(inputs[chan],
+                output + 2 * chan,
+                output + 2 * chan + 1,
+                2 * num_chans,
+                nsamps,
+                _scalar);
+        }
+    }
+
+    double _scalar = 0.0;
+};
+
+static converter::sptr make_convert_sc12_item32_le_1_to_fc32_planar_2(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_fc32_planar_2<uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_1_to_fc32_planar_2(void)
+{
+    return converter::sptr(new convert_sc12_item32_1_to_fc32_planar_2<uhd::ntohx>());
+}
+
+static converter::sptr make_convert_sc12_item32_le_n_to_fc32_chan_interleaved_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_n_to_fc32_chan_interleaved_1<uhd::wtohx>());
+}
+
+static converter::sptr make_convert_sc12_item32_be_n_to_fc32_chan_interleaved_1(void)
+{
+    return converter::sptr(
+        new convert_sc12_item32_n_to_fc32_chan_interleaved_1<uhd::ntohx>());
+}
+
 UHD_STATIC_BLOCK(register_convert_unpack_sc12)
 {
     uhd::convert::register_bytes_per_item("sc12", 3 /*bytes*/);
@@ -186,4 +265,22 @@ UHD_STATIC_BLOCK(register_convert_unpack_sc12)
     id.input_format = "sc12_item32_be";
     uhd::convert::register_converter(
         id, &make_convert_sc12_item32_be_1_to_sc16_1, PRIORITY_GENERAL);
+
+    id.num_outputs   = 2;
+    id.output_format = "fc32_planar";
+    id.input_format  = "sc12_item32_le";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_le_1_to_fc32_planar_2, PRIORITY_GENERAL);
+    id.input_format = "sc12_item32_be";
+    uhd::convert::register_converter(
+        id, &make_convert_sc12_item32_be_1_to_fc32_planar_2, PRIORITY_GENERAL);
+
+    register_chan_interleaved_converter("sc12_item32_le",
+        "fc32_chan_interleaved",
+        &make_convert_sc12_item32_le_n_to_fc32_chan_interleaved_1,
+        PRIORITY_GENERAL);
+    register_chan_interleaved_converter("sc12_item32_be",
+        "fc32_chan_interleaved",
+        &make_convert_sc12_item32_be_n_to_fc32_chan_interleaved_1,
+        PRIORITY_GENERAL);
 }
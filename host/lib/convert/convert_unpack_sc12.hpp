@@ -7,6 +7,8 @@
 
 #include "convert_common.hpp"
 #include <uhd/utils/byteswap.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 
 using namespace uhd::convert;
@@ -94,3 +96,39 @@ void convert_sc12_item32_3_to_star_4(const item32_sc12_3x& input,
     out2 = std::complex<type>(line1 >> 0 & 0xfff0, line12 >> 20 & 0xfff0);
     out3 = std::complex<type>(line2 >> 8 & 0xfff0, line2 << 4 & 0xfff0);
 }
+
+/*
+ * unpack_sc12_to_fc32_strided converts nsamps samples, starting at input,
+ * which may point to any of the 4 samples within a 3 line block. Like
+ * chdr_sc16_to_fc32_strided(), it writes sample n to out_i[n * stride] and
+ * out_q[n * stride], which allows writing planar I and Q arrays as well as
+ * interleaving several channels. Like the regular converters, it may read the
+ * remainder of the last 3 line block.
+ */
+template <tohost32_type tohost>
+void unpack_sc12_to_fc32_strided(const void* input,
+    float* out_i,
+    float* out_q,
+    const size_t stride,
+    const size_t nsamps,
+    const double scalar)
+{
+    // Number of samples in the first 3 line block that precede the input
+    const ptrdiff_t head_skip = (4 - (size_t(input) & 0x3)) & 0x3;
+
+    const item32_sc12_3x* block =
+        reinterpret_cast<const item32_sc12_3x*>(size_t(input) - 3 * head_skip);
+    std::complex<float> samps[4];
+
+    // o is the index of the first sample of the current block
+    for (ptrdiff_t o = -head_skip; o < ptrdiff_t(nsamps); o += 4, block++) {
+        convert_sc12_item32_3_to_star_4<float, tohost>(
+            *block, samps[0], samps[1], samps[2], samps[3], scalar);
+        const ptrdiff_t first = std::max<ptrdiff_t>(0, -o);
+        const ptrdiff_t last  = std::min<ptrdiff_t>(4, ptrdiff_t(nsamps) - o);
+        for (ptrdiff_t k = first; k < last; k++) {
+            out_i[(o + k) * stride] = samps[k].real();
+            out_q[(o + k) * stride] = samps[k].imag();
+        }
+    }
+}
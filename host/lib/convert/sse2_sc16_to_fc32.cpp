@@ -172,3 +172,125 @@ DECLARE_CONVERTER(sc16_chdr, 1, fc32, 1, PRIORITY_SIMD)
     // convert any remaining samples
     chdr_sc16_to_xx(input + i, output + i, nsamps - i, scale_factor);
 }
+
+DECLARE_CONVERTER(sc16_chdr, 1, fc32_planar, 2, PRIORITY_SIMD)
+{
+    const sc16_t* input = reinterpret_cast<const sc16_t*>(inputs[0]);
+    float* output_i     = reinterpret_cast<float*>(outputs[0]);
+    float* output_q     = reinterpret_cast<float*>(outputs[1]);
+
+    const __m128 scalar = _mm_set_ps1(float(scale_factor) / (1 << 16));
+    const __m128i qmask = _mm_set1_epi32(0xffff0000);
+
+    size_t i = 0;
+    for (; i + 3 < nsamps; i += 4) {
+        /* load from input */
+        const __m128i tmpi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        /* move I and Q into the upper 16 bits of separate registers */
+        const __m128i tmpii = _mm_slli_epi32(tmpi, 16);
+        const __m128i tmpiq = _mm_and_si128(tmpi, qmask);
+
+        /* convert and scale */
+        const __m128 tmp_i = _mm_mul_ps(_mm_cvtepi32_ps(tmpii), scalar);
+        const __m128 tmp_q = _mm_mul_ps(_mm_cvtepi32_ps(tmpiq), scalar);
+
+        /* store to outputs */
+        _mm_storeu_ps(output_i + i, tmp_i);
+        _mm_storeu_ps(output_q + i, tmp_q);
+    }
+
+    // convert any remaining samples
+    chdr_sc16_to_fc32_strided(
+        input + i, output_i + i, output_q + i, 1, nsamps - i, scale_factor);
+}
+
+namespace {
+
+/*!
+ * Interleaves the channels 4 samples at a time, so the output is written
+ * front to back. Pairs of channels are written with full 16 byte stores.
+ */
+struct convert_sc16_chdr_n_to_fc32_chan_interleaved_1_sse2 : public converter
+{
+    void set_scalar(const double scalar) override
+    {
+        _scalar = scalar;
+    }
+
+    void operator()(const input_type& inputs,
+        const output_type& outputs,
+        const size_t nsamps) override
+    {
+        const size_t num_chans = inputs.size();
+        const size_t stride    = 2 * num_chans; // in floats
+        float* output          = reinterpret_cast<float*>(outputs[0]);
+
+        const __m128 scalar = _mm_set_ps1(float(_scalar) / (1 << 16));
+        const __m128i zeroi = _mm_setzero_si128();
+
+        // Converts samples i to i+3 of one channel, the results hold samples
+        // i, i+1 and i+2, i+3
+        auto convert4 = [&](const size_t chan, const size_t i, __m128& lo, __m128& hi) {
+            const __m128i tmpi = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(
+                    reinterpret_cast<const sc16_t*>(inputs[chan]) + i));
+            const __m128i tmpilo = _mm_unpacklo_epi16(zeroi, tmpi);
+            const __m128i tmpihi = _mm_unpackhi_epi16(zeroi, tmpi);
+            lo = _mm_mul_ps(_mm_cvtepi32_ps(tmpilo), scalar);
+            hi = _mm_mul_ps(_mm_cvtepi32_ps(tmpihi), scalar);
+        };
+
+        size_t i = 0;
+        for (; i + 3 < nsamps; i += 4) {
+            float* out = output + i * stride;
+            size_t chan = 0;
+            for (; chan + 1 < num_chans; chan += 2) {
+                __m128 alo, ahi, blo, bhi;
+                convert4(chan, i, alo, ahi);
+                convert4(chan + 1, i, blo, bhi);
+                _mm_storeu_ps(out + 2 * chan + 0 * stride, _mm_movelh_ps(alo, blo));
+                _mm_storeu_ps(out + 2 * chan + 1 * stride, _mm_movehl_ps(blo, alo));
+                _mm_storeu_ps(out + 2 * chan + 2 * stride, _mm_movelh_ps(ahi, bhi));
+                _mm_storeu_ps(out + 2 * chan + 3 * stride, _mm_movehl_ps(bhi, ahi));
+            }
+            if (chan < num_chans) {
+                __m128 lo, hi;
+                convert4(chan, i, lo, hi);
+                float* out_chan = out + 2 * chan;
+                _mm_storel_pi(reinterpret_cast<__m64*>(out_chan + 0 * stride), lo);
+                _mm_storeh_pi(reinterpret_cast<__m64*>(out_chan + 1 * stride), lo);
+                _mm_storel_pi(reinterpret_cast<__m64*>(out_chan + 2 * stride), hi);
+                _mm_storeh_pi(reinterpret_cast<__m64*>(out_chan + 3 * stride), hi);
+            }
+        }
+
+        // convert any remaining samples
+        for (size_t chan = 0; chan < num_chans; chan++) {
+            float* out_chan = output + i * stride + 2 * chan;
+            chdr_sc16_to_fc32_strided(reinterpret_cast<const sc16_t*>(inputs[chan]) + i,
+                out_chan,
+                out_chan + 1,
+                stride,
+                nsamps - i,
+                _scalar);
+        }
+    }
+
+    double _scalar = 1.0;
+};
+
+} // namespace
+
+static converter::sptr make_convert_sc16_chdr_n_to_fc32_chan_interleaved_1_sse2(void)
+{
+    return converter::sptr(new convert_sc16_chdr_n_to_fc32_chan_interleaved_1_sse2());
+}
+
+UHD_STATIC_BLOCK(register_sse2_sc16_chdr_to_fc32_chan_interleaved)
+{
+    register_chan_interleaved_converter("sc16_chdr",
+        "fc32_chan_interleaved",
+        &make_convert_sc16_chdr_n_to_fc32_chan_interleaved_1_sse2,
+        PRIORITY_SIMD);
+}
@@ -14,9 +14,11 @@
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/topological_sort.hpp>
 #include <boost/thread.hpp>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #ifdef UHD_EXPERT_LOGGING
 #    define EX_LOG(depth, str) _log(depth, str)
@@ -24,6 +26,12 @@
 #    define EX_LOG(depth, str)
 #endif
 
+// Resolves are only timed if the trace messages that report the times are
+// compiled in
+#if UHD_LOG_MIN_LEVEL < 1
+#    define EX_TIMING
+#endif
+
 
 namespace uhd { namespace experts {
 
@@ -43,6 +51,9 @@ typedef std::list<expert_graph_t::vertex_descriptor> node_queue_t;
 
 typedef boost::graph_traits<expert_graph_t>::edge_iterator edge_iter;
 typedef boost::graph_traits<expert_graph_t>::vertex_iterator vertex_iter;
+typedef std::vector<expert_graph_t::vertex_descriptor> vertex_list_t;
+//! Per-vertex flags, indexed by vertex descriptor
+typedef std::vector<char> vertex_set_t;
 
 class expert_container_impl : public expert_container
 {
@@ -83,27 +94,59 @@ public:
         std::lock_guard<std::mutex> lock(_mutex);
         EX_LOG(0, str(boost::format("resolve_all(%s)") % (force ? "force" : "")));
         // Do a full resolve of the graph
-        _resolve_helper("", "", force);
+        _update_graph_cache();
+        _resolve_helper(nullptr, force, "resolve_all", "");
     }
 
-    void resolve_from(const std::string&) override
+    void resolve_from(const std::string& node_name) override
     {
         std::lock_guard<std::recursive_mutex> resolve_lock(_resolve_mutex);
         std::lock_guard<std::mutex> lock(_mutex);
-        EX_LOG(0, "resolve_from (overridden to resolve_all)");
-        // Do a full resolve of the graph
-        // Not optimizing the traversal using node_name to reduce experts complexity
-        _resolve_helper("", "", false);
+        EX_LOG(0, str(boost::format("resolve_from(%s)") % node_name));
+        _update_graph_cache();
+        // Everything downstream of this node, and of any other node that was
+        // changed without triggering a resolve, may need to be updated. All
+        // other nodes are clean and don't have to be looked at.
+        const vertex_set_t affected = _get_affected_nodes(_lookup_vertex(node_name));
+        _resolve_helper(&affected, false, "resolve_from", node_name);
     }
 
-    void resolve_to(const std::string&) override
+    void resolve_to(const std::string& node_name) override
     {
         std::lock_guard<std::recursive_mutex> resolve_lock(_resolve_mutex);
         std::lock_guard<std::mutex> lock(_mutex);
-        EX_LOG(0, "resolve_to (overridden to resolve_all)");
-        // Do a full resolve of the graph
-        // Not optimizing the traversal using node_name to reduce experts complexity
-        _resolve_helper("", "", false);
+        EX_LOG(0, str(boost::format("resolve_to(%s)") % node_name));
+        _update_graph_cache();
+        const expert_graph_t::vertex_descriptor target = _lookup_vertex(node_name);
+        const vertex_set_t affected                    = _get_affected_nodes(target);
+        if (!affected[target]) {
+            EX_LOG(1, "target is up to date");
+            return;
+        }
+
+        // Resolve everything the target depends on. Resolving a worker will
+        // mark its inputs clean, so every other worker that reads the same
+        // inputs must also be resolved (or it would never see the change).
+        // Those workers may in turn depend on more nodes, so iterate.
+        vertex_set_t needed(affected.size(), 0);
+        vertex_list_t pending{target};
+        while (!pending.empty()) {
+            const expert_graph_t::vertex_descriptor vertex = pending.back();
+            pending.pop_back();
+            if (!affected[vertex] || needed[vertex]) {
+                continue;
+            }
+            needed[vertex] = 1;
+            for (const auto input : _predecessors[vertex]) {
+                pending.push_back(input);
+                if (_get_vertex(vertex).get_class() == CLASS_WORKER) {
+                    pending.insert(pending.end(),
+                        _successors[input].cbegin(),
+                        _successors[input].cend());
+                }
+            }
+        }
+        _resolve_helper(&needed, false, "resolve_to", node_name);
     }
 
     dag_vertex_t& retrieve(const std::string& name) const override
@@ -307,6 +350,7 @@ protected:
             EX_LOG(1, str(boost::format("added vertex %s") % data_node->get_name()));
             _datanode_map.insert(
                 vertex_map_t::value_type(data_node->get_name(), gr_node));
+            _graph_cache_valid = false;
 
             // Add resolve callbacks
             if (resolve_mode == AUTO_RESOLVE_ON_WRITE
@@ -355,6 +399,7 @@ protected:
                 boost::add_vertex(worker, _expert_dag);
             EX_LOG(1, str(boost::format("added vertex %s") % worker->get_name()));
             _worker_map.insert(vertex_map_t::value_type(worker->get_name(), gr_node));
+            _graph_cache_valid = false;
 
             // For each input, add an edge from the input to this node
             for (const std::string& node_name : worker->get_inputs()) {
@@ -427,11 +472,24 @@ protected:
         // Release all nodes in the map
         _worker_map.clear();
         _datanode_map.clear();
+
+        _graph_cache_valid = false;
+        _sorted_nodes.clear();
+        _successors.clear();
+        _predecessors.clear();
     }
 
 private:
-    void _resolve_helper(std::string start, std::string stop, bool force)
+    /*! Update the topological order and adjacency lists of the graph
+     *
+     * These only change when nodes are added or removed, so they are computed
+     * once and then reused for every resolve.
+     */
+    void _update_graph_cache()
     {
+        if (_graph_cache_valid) {
+            return;
+        }
         // Sort the graph topologically. This ensures that for all dependencies, the
         // dependant is always after all of its dependencies.
         node_queue_t sorted_nodes;
@@ -452,63 +510,127 @@ private:
                     + edges);
             }
         }
-        if (sorted_nodes.empty())
-            return;
+        _sorted_nodes.assign(sorted_nodes.cbegin(), sorted_nodes.cend());
+
+        const size_t num_vertices = boost::num_vertices(_expert_dag);
+        _successors.assign(num_vertices, vertex_list_t());
+        _predecessors.assign(num_vertices, vertex_list_t());
+        for (std::pair<edge_iter, edge_iter> ei = boost::edges(_expert_dag);
+             ei.first != ei.second;
+             ++ei.first) {
+            const auto source = boost::source(*(ei.first), _expert_dag);
+            const auto target = boost::target(*(ei.first), _expert_dag);
+            _successors[source].push_back(target);
+            _predecessors[target].push_back(source);
+        }
+        _graph_cache_valid = true;
+    }
+
+    /*! Return the set of nodes that may need resolving
+     *
+     * These are all nodes downstream of \p start_vertex, or of any data node
+     * that is currently dirty (this includes nodes that were written with
+     * auto-resolve turned off).
+     */
+    vertex_set_t _get_affected_nodes(expert_graph_t::vertex_descriptor start_vertex) const
+    {
+        vertex_set_t affected(_successors.size(), 0);
+        vertex_list_t pending{start_vertex};
+        for (const vertex_map_t::value_type& data_node : _datanode_map) {
+            if (_get_vertex(data_node.second).is_dirty()) {
+                pending.push_back(data_node.second);
+            }
+        }
+        while (!pending.empty()) {
+            const expert_graph_t::vertex_descriptor vertex = pending.back();
+            pending.pop_back();
+            if (affected[vertex]) {
+                continue;
+            }
+            affected[vertex] = 1;
+            pending.insert(
+                pending.end(), _successors[vertex].cbegin(), _successors[vertex].cend());
+        }
+        return affected;
+    }
 
-        // Determine the start and stop node. If one is not explicitly specified then
-        // resolve everything
-        expert_graph_t::vertex_descriptor start_vertex = sorted_nodes.front();
-        expert_graph_t::vertex_descriptor stop_vertex  = sorted_nodes.back();
-        if (not start.empty())
-            start_vertex = _lookup_vertex(start);
-        if (not stop.empty())
-            stop_vertex = _lookup_vertex(stop);
+    /*! Resolve nodes in topological order
+     *
+     * \param selection If not null, only nodes flagged in this set are
+     *                  considered. Otherwise, all nodes are.
+     * \param force If true, resolve nodes even if they are not dirty
+     * \param context Name of the resolve method, for the timing trace
+     * \param node_name Argument of the resolve method, for the timing trace
+     */
+    void _resolve_helper(const vertex_set_t* selection,
+        bool force,
+        const char* UHD_UNUSED(context),
+        const std::string& UHD_UNUSED(node_name))
+    {
+        if (_sorted_nodes.empty())
+            return;
+#ifdef EX_TIMING
+        const auto resolve_start = std::chrono::steady_clock::now();
+#endif
 
         // First Pass: Resolve all nodes if they are dirty, in a topological order
-        std::list<dag_vertex_t*> resolved_workers;
-        bool start_node_encountered = false;
-        for (node_queue_t::iterator node_iter = sorted_nodes.begin();
-             node_iter != sorted_nodes.end();
-             ++node_iter) {
-            // Determine if we are at or beyond the starting node
-            if (*node_iter == start_vertex)
-                start_node_encountered = true;
-
-            // Only resolve if the starting node has passed
-            if (start_node_encountered) {
-                dag_vertex_t& node = _get_vertex(*node_iter);
-                std::string node_val;
-                if (force or node.is_dirty()) {
+        std::vector<dag_vertex_t*> resolved_workers;
+        for (const auto vertex : _sorted_nodes) {
+            if (selection && !(*selection)[vertex]) {
+                continue;
+            }
+            dag_vertex_t& node = _get_vertex(vertex);
+            if (force or node.is_dirty()) {
+                if (node.get_class() == CLASS_WORKER) {
+#ifdef EX_TIMING
+                    const auto worker_start = std::chrono::steady_clock::now();
+#endif
                     node.resolve();
-                    if (node.get_class() == CLASS_WORKER) {
-                        resolved_workers.push_back(&node);
-                    }
-                    EX_LOG(1,
-                        str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
-                            % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+                    resolved_workers.push_back(&node);
+#ifdef EX_TIMING
+                    UHD_LOG_TRACE("EXPERT",
+                        "[expert::" << _name << "] " << context << "(" << node_name
+                                    << "): " << node.get_name() << " took "
+                                    << _elapsed_us(worker_start) << " us");
+#endif
                 } else {
-                    EX_LOG(1,
-                        str(boost::format("skipped node %s (%s) [%s]") % node.get_name()
-                            % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+                    node.resolve();
                 }
+                EX_LOG(1,
+                    str(boost::format("resolved node %s (%s) [%s]") % node.get_name()
+                        % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
+            } else {
+                EX_LOG(1,
+                    str(boost::format("skipped node %s (%s) [%s]") % node.get_name()
+                        % (node.is_dirty() ? "dirty" : "clean") % node.to_string()));
             }
-
-            // Determine if we are beyond the stop node
-            if (*node_iter == stop_vertex)
-                break;
         }
 
         // Second Pass: Mark all the workers clean. The policy is that a worker will mark
         // all of its dependencies clean so after this step all data nodes that are not
         // consumed by a worker will remain dirty (as they should because no one has
         // consumed their value)
-        for (std::list<dag_vertex_t*>::iterator worker = resolved_workers.begin();
-             worker != resolved_workers.end();
-             ++worker) {
-            (*worker)->mark_clean();
+        for (dag_vertex_t* worker : resolved_workers) {
+            worker->mark_clean();
         }
+#ifdef EX_TIMING
+        UHD_LOG_TRACE("EXPERT",
+            "[expert::" << _name << "] " << context << "(" << node_name
+                        << "): resolved " << resolved_workers.size() << " of "
+                        << _worker_map.size() << " workers in "
+                        << _elapsed_us(resolve_start) << " us");
+#endif
     }
 
+#ifdef EX_TIMING
+    static double _elapsed_us(const std::chrono::steady_clock::time_point& start)
+    {
+        return std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    }
+#endif
+
     expert_graph_t::vertex_descriptor _lookup_vertex(const std::string& name) const
     {
         expert_graph_t::vertex_descriptor vertex;
@@ -555,6 +677,15 @@ private:
         _datanode_map; // A map from vertex name to vertex descriptor for data nodes
     std::mutex _mutex;
     std::recursive_mutex _resolve_mutex;
+
+    //! True if the fields below match the current graph
+    bool _graph_cache_valid = false;
+    //! All vertices, in topological order
+    vertex_list_t _sorted_nodes;
+    //! For each vertex, the vertices it has edges to
+    std::vector<vertex_list_t> _successors;
+    //! For each vertex, the vertices that have edges to it
+    std::vector<vertex_list_t> _predecessors;
 };
 
 expert_container::sptr expert_container::make(const std::string& name)
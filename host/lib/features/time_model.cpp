@@ -0,0 +1,66 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/features/time_model.hpp>
+#include <chrono>
+#include <string>
+
+using namespace uhd::features;
+using uhd::rfnoc::device_clock_model;
+
+void time_model::add_timekeeper(uhd::rfnoc::mb_controller::timekeeper::sptr timekeeper,
+    device_clock_model::sptr clock_model)
+{
+    clock_model->set_tolerance(_tolerance);
+    _timekeepers.push_back(timekeeper);
+    _clock_models.push_back(clock_model);
+}
+
+device_clock_model::sptr time_model::get_clock_model(const size_t tk_idx) const
+{
+    if (tk_idx >= _clock_models.size()) {
+        throw uhd::index_error(
+            "Invalid timekeeper index for time model: " + std::to_string(tk_idx));
+    }
+    return _clock_models.at(tk_idx);
+}
+
+void time_model::set_tolerance(const double tolerance)
+{
+    if (tolerance < 0.0) {
+        throw uhd::value_error("Time model tolerance must not be negative!");
+    }
+    _tolerance = tolerance;
+    for (auto& clock_model : _clock_models) {
+        clock_model->set_tolerance(tolerance);
+    }
+}
+
+double time_model::get_tolerance() const
+{
+    return _tolerance;
+}
+
+time_model_iface::time_estimate_t time_model::get_time_estimate(const size_t tk_idx)
+{
+    auto clock_model = get_clock_model(tk_idx);
+    auto timekeeper  = _timekeepers.at(tk_idx);
+
+    // Either served by the model, or read from the device (which refreshes the
+    // model). In both cases, the model now has the most accurate estimate.
+    const auto t0        = device_clock_model::clock_t::now();
+    const uint64_t ticks = timekeeper->get_ticks_now();
+    const auto t1        = device_clock_model::clock_t::now();
+
+    const double tick_rate = timekeeper->get_tick_rate();
+    if (const auto estimate = clock_model->get_estimate(t1)) {
+        return {uhd::time_spec_t::from_ticks(estimate->ticks, tick_rate),
+            estimate->error / tick_rate};
+    }
+    return {uhd::time_spec_t::from_ticks(ticks, tick_rate),
+        std::chrono::duration<double>(t1 - t0).count()};
+}
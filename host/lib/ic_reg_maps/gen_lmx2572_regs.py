@@ -346,7 +346,7 @@ reg65_reserved0         65[0:15]    0
 ########################################################################
 ## address 66
 ########################################################################
-reg66_reserved0         6[0:15]    0x1F4
+reg66_reserved0         66[0:15]   0x1F4
 ########################################################################
 ## address 67
 ########################################################################
@@ -623,6 +623,18 @@ uint16_t get_reg(int addr){
     return reg;
 }
 
+void set_reg(int addr, uint16_t reg){
+    switch(addr){
+    % for addr in sorted(set(map(lambda r: r.get_addr(), regs))):
+    case ${addr}:
+        % for reg in filter(lambda r: r.get_addr() == addr, regs):
+        ${reg.get_name()} = ${reg.get_type()}((reg >> ${reg.get_shift()}) & ${reg.get_mask()});
+        % endfor
+        break;
+    % endfor
+    }
+}
+
 std::set<uint8_t> get_ro_regs()
 {
     return {107, 108, 109, 110, 111, 112, 113};
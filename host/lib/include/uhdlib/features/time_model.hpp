@@ -0,0 +1,48 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/features/time_model_iface.hpp>
+#include <uhd/rfnoc/mb_controller.hpp>
+#include <uhdlib/rfnoc/device_clock_model.hpp>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace features {
+
+/*! Implementation of the time model feature
+ *
+ * Motherboard controllers whose timekeepers are backed by a
+ * uhd::rfnoc::device_clock_model register each timekeeper along with its model
+ * here, in order of their timekeeper index.
+ */
+class time_model : public time_model_iface
+{
+public:
+    using sptr = std::shared_ptr<time_model>;
+
+    //! Add the next timekeeper and the model that tracks its time
+    void add_timekeeper(uhd::rfnoc::mb_controller::timekeeper::sptr timekeeper,
+        uhd::rfnoc::device_clock_model::sptr clock_model);
+
+    /*! Return the model of a timekeeper
+     *
+     * \throws uhd::index_error if \p tk_idx is not valid
+     */
+    uhd::rfnoc::device_clock_model::sptr get_clock_model(const size_t tk_idx) const;
+
+    void set_tolerance(const double tolerance) override;
+    double get_tolerance() const override;
+    time_estimate_t get_time_estimate(const size_t tk_idx) override;
+
+private:
+    double _tolerance = 0.0;
+    std::vector<uhd::rfnoc::mb_controller::timekeeper::sptr> _timekeepers;
+    std::vector<uhd::rfnoc::device_clock_model::sptr> _clock_models;
+};
+
+}} // namespace uhd::features
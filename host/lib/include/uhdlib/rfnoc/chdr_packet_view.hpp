@@ -0,0 +1,208 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/rfnoc/rfnoc_types.hpp>
+#include <uhd/types/endianness.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <cstdint>
+
+namespace uhd { namespace rfnoc { namespace chdr {
+
+/*! Read-only view of a CHDR data packet with a fixed CHDR width and endianness
+ *
+ * Unlike chdr_packet_writer, this class has no virtual functions and no
+ * runtime branches on the CHDR width or the link endianness, so all accessors
+ * can be inlined. It is meant for the per-packet path of the data transports,
+ * which know the CHDR width and endianness for the lifetime of a stream.
+ *
+ * The data transports are not templated on the CHDR width and endianness,
+ * because the streamers and stream managers use them as concrete types. They
+ * store both values instead and reach the view through visit_specialized() on
+ * every packet, which leaves no indirect call on the per-packet path.
+ *
+ * Only the header, timestamp and payload of the packet are accessible. The
+ * packet buffer must stay valid for the lifetime of the view.
+ *
+ * \tparam chdr_w The CHDR width of the packet
+ * \tparam endianness The endianness of the link (not the host)
+ */
+template <chdr_w_t chdr_w, endianness_t endianness>
+class chdr_packet_view
+{
+public:
+    //! Number of bytes in one CHDR word
+    static constexpr size_t CHDR_W_BYTES = chdr_w_to_bits(chdr_w) / 8;
+
+    /*! Create a view of the packet in pkt_buff and decode its header
+     *
+     * \param pkt_buff Pointer to the start of the packet
+     */
+    explicit chdr_packet_view(const void* pkt_buff)
+        : _pkt_buff(reinterpret_cast<const uint64_t*>(pkt_buff))
+        , _header(read_chdr_header(pkt_buff))
+    {
+    }
+
+    //! Returns the header of the packet
+    const chdr_header& get_chdr_header() const
+    {
+        return _header;
+    }
+
+    //! Returns true if the packet has a timestamp
+    bool has_timestamp() const
+    {
+        return _header.get_pkt_type() == PKT_TYPE_DATA_WITH_TS;
+    }
+
+    //! Returns the timestamp of the packet. Only valid if has_timestamp().
+    uint64_t get_timestamp() const
+    {
+        // In a uint64_t buffer, the timestamp is always immediately after the
+        // header regardless of chdr_w.
+        return u64_to_host(_pkt_buff[1]);
+    }
+
+    //! Returns the size of the payload in bytes, as given by the header
+    size_t get_payload_size() const
+    {
+        return _header.get_length() - get_payload_offset(_header);
+    }
+
+    //! Returns a pointer to the start of the payload
+    const void* get_payload_const_ptr() const
+    {
+        return reinterpret_cast<const uint8_t*>(_pkt_buff)
+               + get_payload_offset(_header);
+    }
+
+    //! Returns the offset of the payload in bytes for a packet with this header
+    static size_t get_payload_offset(const chdr_header& header)
+    {
+        // The metadata offset depends on the chdr_w and whether we have a
+        // timestamp
+        const size_t mdata_offset =
+            (chdr_w == CHDR_W_64 && header.get_pkt_type() == PKT_TYPE_DATA_WITH_TS)
+                ? 2
+                : 1;
+        return (mdata_offset + header.get_num_mdata()) * CHDR_W_BYTES;
+    }
+
+    //! Decodes the header of the packet in pkt_buff
+    static chdr_header read_chdr_header(const void* pkt_buff)
+    {
+        return chdr_header(u64_to_host(*reinterpret_cast<const uint64_t*>(pkt_buff)));
+    }
+
+    /*! Write the header and timestamp of a packet into pkt_buff
+     *
+     * The length field of the header is updated to match payload_size. The
+     * timestamp is only written if the packet type calls for one.
+     *
+     * \param pkt_buff Pointer to the start of the packet
+     * \param header The header of the packet
+     * \param timestamp The timestamp of the packet
+     * \param payload_size The size of the payload in bytes
+     * \return The offset of the payload in bytes
+     */
+    static size_t write_header(void* pkt_buff,
+        chdr_header& header,
+        const uint64_t timestamp,
+        const size_t payload_size)
+    {
+        uint64_t* buff           = reinterpret_cast<uint64_t*>(pkt_buff);
+        const size_t pyld_offset = get_payload_offset(header);
+        header.set_length(static_cast<uint16_t>(pyld_offset + payload_size));
+        buff[0] = u64_from_host(header);
+        if (header.get_pkt_type() == PKT_TYPE_DATA_WITH_TS) {
+            buff[1] = u64_from_host(timestamp);
+        }
+        return pyld_offset;
+    }
+
+    //! Converts a 64-bit word from link to host byte order
+    static uint64_t u64_to_host(const uint64_t word)
+    {
+        return (endianness == ENDIANNESS_BIG) ? uhd::ntohx<uint64_t>(word)
+                                              : uhd::wtohx<uint64_t>(word);
+    }
+
+    //! Converts a 64-bit word from host to link byte order
+    static uint64_t u64_from_host(const uint64_t word)
+    {
+        return (endianness == ENDIANNESS_BIG) ? uhd::htonx<uint64_t>(word)
+                                              : uhd::htowx<uint64_t>(word);
+    }
+
+private:
+    const uint64_t* _pkt_buff;
+    const chdr_header _header;
+};
+
+//! Tag type for a CHDR width and endianness, see visit_specialized()
+template <chdr_w_t chdr_w, endianness_t endianness>
+struct packet_format
+{
+    using view_t = chdr_packet_view<chdr_w, endianness>;
+};
+
+/*! Call visitor with the packet_format<chdr_w, endianness> for runtime values
+ *
+ * This is the single place where the runtime CHDR width and endianness of a
+ * stream are mapped onto template arguments. visitor is usually a generic
+ * lambda, which is instantiated for every format, so the chdr_packet_view
+ * accessors it calls are inlined. The data transports call this for every
+ * packet: Their CHDR width and endianness never change, so the switch is a
+ * pair of well-predicted branches rather than an indirect call.
+ *
+ * \throws uhd::value_error if chdr_w is not a valid CHDR width
+ */
+template <typename visitor_t>
+UHD_FORCE_INLINE auto visit_specialized(
+    const chdr_w_t chdr_w, const endianness_t endianness, visitor_t&& visitor)
+    -> decltype(visitor(packet_format<CHDR_W_64, ENDIANNESS_BIG>{}))
+{
+    if (endianness == ENDIANNESS_BIG) {
+        switch (chdr_w) {
+            case CHDR_W_512:
+                return visitor(packet_format<CHDR_W_512, ENDIANNESS_BIG>{});
+            case CHDR_W_256:
+                return visitor(packet_format<CHDR_W_256, ENDIANNESS_BIG>{});
+            case CHDR_W_128:
+                return visitor(packet_format<CHDR_W_128, ENDIANNESS_BIG>{});
+            case CHDR_W_64:
+                return visitor(packet_format<CHDR_W_64, ENDIANNESS_BIG>{});
+        }
+    } else {
+        switch (chdr_w) {
+            case CHDR_W_512:
+                return visitor(packet_format<CHDR_W_512, ENDIANNESS_LITTLE>{});
+            case CHDR_W_256:
+                return visitor(packet_format<CHDR_W_256, ENDIANNESS_LITTLE>{});
+            case CHDR_W_128:
+                return visitor(packet_format<CHDR_W_128, ENDIANNESS_LITTLE>{});
+            case CHDR_W_64:
+                return visitor(packet_format<CHDR_W_64, ENDIANNESS_LITTLE>{});
+        }
+    }
+    throw uhd::value_error("Invalid CHDR width");
+}
+
+//! Decodes the header of the packet in pkt_buff, see visit_specialized()
+UHD_FORCE_INLINE chdr_header read_chdr_header(
+    const chdr_w_t chdr_w, const endianness_t endianness, const void* pkt_buff)
+{
+    return visit_specialized(chdr_w, endianness, [pkt_buff](auto fmt) {
+        return decltype(fmt)::view_t::read_chdr_header(pkt_buff);
+    });
+}
+
+}}} // namespace uhd::rfnoc::chdr
@@ -10,11 +10,13 @@
 #include <uhd/exception.hpp>
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/types/device_addr.hpp>
+#include <uhdlib/rfnoc/chdr_packet_view.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/rfnoc/rx_flow_ctrl_state.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <uhdlib/transport/link_if.hpp>
+#include <functional>
 #include <memory>
 
 namespace uhd { namespace rfnoc {
@@ -104,6 +106,7 @@ public:
     using uptr                  = std::unique_ptr<chdr_rx_data_xport>;
     using buff_t                = transport::frame_buff;
     using disconnect_callback_t = uhd::transport::disconnect_callback_t;
+    using tsf_callback_t        = std::function<void(const uint64_t tsf)>;
 
     //! Values extracted from received RX data packets
     struct packet_info_t
@@ -238,9 +241,30 @@ public:
         auto info      = _read_data_packet_info(buff);
         bool seq_error = _is_out_of_sequence(std::get<1>(info));
 
+        const packet_info_t& pkt_info = std::get<0>(info);
+        if (_tsf_callback && pkt_info.has_tsf
+            && ++_tsf_callback_count == TSF_CALLBACK_PERIOD) {
+            _tsf_callback_count = 0;
+            _tsf_callback(pkt_info.tsf);
+        }
+
         return std::make_tuple(std::move(buff), std::get<0>(info), seq_error);
     }
 
+    /*!
+     * Sets a callback to observe the timestamps of received packets
+     *
+     * The callback is invoked from get_recv_buff() for one out of every
+     * TSF_CALLBACK_PERIOD packets that carry a timestamp. It must be set before
+     * packets are received.
+     *
+     * \param callback the callback, receives the timestamp of the packet
+     */
+    void set_tsf_callback(tsf_callback_t callback)
+    {
+        _tsf_callback = std::move(callback);
+    }
+
     /*!
      * Releases an RX frame buffer
      *
@@ -252,6 +276,9 @@ public:
     }
 
 private:
+    //! Number of timestamped packets per invocation of the timestamp callback
+    static constexpr size_t TSF_CALLBACK_PERIOD = 64;
+
     /*!
      * Recv callback for I/O service
      *
@@ -266,8 +293,7 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* send_link)
     {
-        _recv_packet_cb->refresh(buff->data());
-        const auto header   = _recv_packet_cb->get_chdr_header();
+        const auto header   = chdr::read_chdr_header(_chdr_w, _endianness, buff->data());
         const auto dst_epid = header.get_dst_epid();
 
         if (dst_epid != _epid) {
@@ -282,6 +308,7 @@ private:
 
         if (type == chdr::PKT_TYPE_STRC) {
             chdr::strc_payload strc;
+            _recv_packet_cb->refresh(buff->data());
             strc.deserialize(_recv_packet_cb->get_payload_const_ptr_as<uint64_t>(),
                 _recv_packet_cb->get_payload_size() / sizeof(uint64_t),
                 _recv_packet_cb->conv_to_host<uint64_t>());
@@ -338,8 +365,8 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* send_link)
     {
-        _recv_packet_cb->refresh(buff->data());
-        const auto header        = _recv_packet_cb->get_chdr_header();
+        const auto header =
+            chdr::read_chdr_header(_chdr_w, _endianness, buff->data());
         const size_t packet_size = _round_pkt_size(header.get_length());
         recv_link->release_recv_buff(std::move(buff));
         _fc_state.xfer_done(packet_size);
@@ -383,18 +410,13 @@ private:
      */
     std::tuple<packet_info_t, uint16_t> _read_data_packet_info(buff_t::uptr& buff)
     {
-        const void* data = buff->data();
-        _recv_packet->refresh(data);
-        const auto header        = _recv_packet->get_chdr_header();
-        const auto optional_time = _recv_packet->get_timestamp();
-
         packet_info_t info;
-        info.eob           = header.get_eob();
-        info.eov           = header.get_eov();
-        info.has_tsf       = optional_time.is_initialized();
-        info.tsf           = optional_time ? *optional_time : 0;
-        info.payload_bytes = _recv_packet->get_payload_size();
-        info.payload       = _recv_packet->get_payload_const_ptr();
+        const void* pkt_buff = buff->data();
+        const auto header =
+            chdr::visit_specialized(_chdr_w, _endianness, [pkt_buff, &info](auto fmt) {
+                return _read_data_packet_info_impl<typename decltype(fmt)::view_t>(
+                    pkt_buff, info);
+            });
 
         const uint8_t* pkt_end =
             reinterpret_cast<uint8_t*>(buff->data()) + buff->packet_size();
@@ -409,6 +431,29 @@ private:
         return std::make_tuple(info, header.get_seq_num());
     }
 
+    /*!
+     * Reads packet header of a packet with the format of view_t and fills in
+     * the packet info struct.
+     *
+     * \return the packet header
+     */
+    template <typename view_t>
+    static UHD_FORCE_INLINE chdr::chdr_header _read_data_packet_info_impl(
+        const void* pkt_buff, packet_info_t& info)
+    {
+        const view_t packet(pkt_buff);
+        const auto& header = packet.get_chdr_header();
+
+        info.eob           = header.get_eob();
+        info.eov           = header.get_eov();
+        info.has_tsf       = packet.has_timestamp();
+        info.tsf           = info.has_tsf ? packet.get_timestamp() : 0;
+        info.payload_bytes = packet.get_payload_size();
+        info.payload       = packet.get_payload_const_ptr();
+
+        return header;
+    }
+
     inline size_t _round_pkt_size(const size_t pkt_size_bytes)
     {
         return ((pkt_size_bytes + _chdr_w_bytes - 1) / _chdr_w_bytes) * _chdr_w_bytes;
@@ -429,10 +474,11 @@ private:
     // Sequence number for data packets
     uint16_t _data_seq_num = 0;
 
-    // Packet for received data
-    chdr::chdr_packet_writer::uptr _recv_packet;
+    // CHDR width and endianness of this stream, select the packet view
+    const chdr_w_t _chdr_w;
+    const endianness_t _endianness;
 
-    // Packet for received data used in callbacks
+    // Packet for received stream commands used in callbacks
     chdr::chdr_packet_writer::uptr _recv_packet_cb;
 
     // Handles sending of strs flow control response packets
@@ -446,6 +492,12 @@ private:
 
     // Disconnect callback
     disconnect_callback_t _disconnect;
+
+    // Callback for timestamps of received packets
+    tsf_callback_t _tsf_callback;
+
+    // Number of timestamped packets since the last invocation of _tsf_callback
+    size_t _tsf_callback_count = 0;
 };
 
 }} // namespace uhd::rfnoc
@@ -10,6 +10,7 @@
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/chdr_packet_view.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/rfnoc/tx_flow_ctrl_state.hpp>
@@ -270,11 +271,15 @@ public:
         _send_header.set_eov(info.eov);
         _send_header.set_seq_num(_data_seq_num++);
 
-        _send_packet->refresh(buff->data(), _send_header, tsf);
-        _send_packet->update_payload_size(info.payload_bytes);
+        void* pkt_buff           = buff->data();
+        const size_t pyld_offset = chdr::visit_specialized(
+            _chdr_w, _endianness, [this, pkt_buff, tsf, &info](auto fmt) {
+                return decltype(fmt)::view_t::write_header(
+                    pkt_buff, _send_header, tsf, info.payload_bytes);
+            });
 
-        return std::make_pair(_send_packet->get_payload_ptr(),
-            _send_packet->get_chdr_header().get_length());
+        return std::make_pair(static_cast<uint8_t*>(buff->data()) + pyld_offset,
+            _send_header.get_length());
     }
 
 private:
@@ -292,8 +297,7 @@ private:
         transport::recv_link_if* recv_link,
         transport::send_link_if* /*send_link*/)
     {
-        _recv_packet->refresh(buff->data());
-        const auto header   = _recv_packet->get_chdr_header();
+        const auto header   = chdr::read_chdr_header(_chdr_w, _endianness, buff->data());
         const auto type     = header.get_pkt_type();
         const auto dst_epid = header.get_dst_epid();
 
@@ -303,6 +307,7 @@ private:
 
         if (type == chdr::PKT_TYPE_STRS) {
             chdr::strs_payload strs;
+            _recv_packet->refresh(buff->data());
             strs.deserialize(_recv_packet->get_payload_const_ptr_as<uint64_t>(),
                 _recv_packet->get_payload_size() / sizeof(uint64_t),
                 _recv_packet->conv_to_host<uint64_t>());
@@ -313,7 +318,7 @@ private:
             if (strs.status != chdr::STRS_OKAY) {
                 switch (strs.status) {
                     case chdr::STRS_SEQERR:
-                        UHD_LOG_FASTPATH("S");
+                        UHD_LOG_FASTPATH_EVENT('S');
                         if (_enqueue_async_msg) {
                             _enqueue_async_msg(
                                 async_metadata_t::EVENT_CODE_SEQ_ERROR, false, 0);
@@ -413,8 +418,9 @@ private:
     // Header to write into send packets
     chdr::chdr_header _send_header;
 
-    // Packet for send data
-    chdr::chdr_packet_writer::uptr _send_packet;
+    // CHDR width and endianness of this stream, select the packet view
+    const chdr_w_t _chdr_w;
+    const endianness_t _endianness;
 
     // Packet to receive strs messages
     chdr::chdr_packet_writer::uptr _recv_packet;
@@ -9,6 +9,7 @@
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/rfnoc/register_iface.hpp>
 #include <uhdlib/rfnoc/clock_iface.hpp>
+#include <future>
 #include <memory>
 
 namespace uhd { namespace rfnoc {
@@ -17,8 +18,17 @@ namespace uhd { namespace rfnoc {
  *
  * This interface supports the following:
  * - All capabilities of register_iface
+ * - Pipelined transactions which do not wait for their ACKs
  * - A function to handle received packets
  * - A static factory class to create these endpoints
+ *
+ * Transactions are sent as long as there is room in the downstream buffer,
+ * without waiting for the responses of earlier transactions. Only peeks and
+ * acknowledged pokes wait for a response. The block operations of
+ * register_iface (block_peek32(), block_poke32() and multi_poke32()) send all
+ * their transactions before they wait for any response, so they take about
+ * one round trip instead of one per transaction. peek32_async() and
+ * poke32_async() make the same available for arbitrary sequences.
  */
 class ctrlport_endpoint : public register_iface
 {
@@ -30,6 +40,32 @@ public:
 
     ~ctrlport_endpoint() override = 0;
 
+    //! Sends a read request without waiting for the response
+    //
+    // The returned future waits for the response when get() is called, and
+    // returns the value or throws like peek32() would. The policy timeout
+    // starts when get() is called. If the future is destroyed without calling
+    // get(), the response is discarded.
+    //
+    // \param addr The register address
+    // \param timestamp The time at which the read is executed
+    //
+    virtual std::future<uint32_t> peek32_async(
+        uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) = 0;
+
+    //! Sends an acknowledged write request without waiting for the ACK
+    //
+    // The returned future waits for the ACK when get() is called, and throws
+    // like an acknowledged poke32() would.
+    //
+    // \param addr The register address
+    // \param data The value to write
+    // \param timestamp The time at which the write is executed
+    //
+    virtual std::future<void> poke32_async(uint32_t addr,
+        uint32_t data,
+        uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) = 0;
+
     //! Handles an incoming control packet (request and response)
     //
     // \param rx_ctrl The control payload of the received packet
@@ -0,0 +1,178 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace uhd { namespace rfnoc {
+
+/*! Host-side model of the tick count of a timekeeper
+ *
+ * The model tracks the device ticks against std::chrono::steady_clock (which
+ * is CLOCK_MONOTONIC on Linux). Rather than a single best guess, it keeps the
+ * interval of tick counts the device can possibly be at for a given host time,
+ * as well as the interval of possible tick rates. These are narrowed down by
+ * observations of the device time:
+ * - Reads of the tick count bound the device time from both sides, because
+ *   the device sampled its tick count while the read was in flight.
+ * - Timestamps of received packets bound the device time from below, because
+ *   samples are never received before they were acquired.
+ *
+ * Between observations, the interval of tick counts widens according to the
+ * interval of tick rates. The error of an estimate is half the width of that
+ * interval, i.e., it is an upper bound rather than a statistical measure.
+ *
+ * All methods are thread-safe.
+ */
+class device_clock_model
+{
+public:
+    using sptr      = std::shared_ptr<device_clock_model>;
+    using clock_t   = std::chrono::steady_clock;
+    using peek_fn_t = std::function<uint64_t()>;
+
+    //! An estimate of the tick count
+    struct estimate_t
+    {
+        //! Estimated tick count (center of the interval of possible tick counts)
+        uint64_t ticks;
+        //! Upper bound for the error of ticks, in ticks
+        double error;
+    };
+
+    //! Default bound for the relative frequency offset between device and host
+    //
+    // This covers the offset of the device's reference clock as well as the
+    // frequency corrections NTP applies to CLOCK_MONOTONIC (up to 500 ppm).
+    static constexpr double DEFAULT_MAX_FREQ_OFFSET = 600e-6;
+
+    /*!
+     * \param max_freq_offset Maximum relative frequency offset between the
+     *                        device tick rate and the host clock
+     */
+    device_clock_model(const double max_freq_offset = DEFAULT_MAX_FREQ_OFFSET);
+
+    /*! Set the nominal tick rate
+     *
+     * This resets the model. As long as the tick rate is zero (the default),
+     * the model provides no estimates.
+     */
+    void set_tick_rate(const double tick_rate);
+
+    //! Return the nominal tick rate
+    double get_tick_rate() const;
+
+    /*! Set the maximum error at which get_ticks_now() uses the model
+     *
+     * \param tolerance Maximum error in seconds. Zero disables the model in
+     *                  get_ticks_now().
+     */
+    void set_tolerance(const double tolerance);
+
+    //! Return the tolerance set with set_tolerance()
+    double get_tolerance() const;
+
+    /*! Return true if get_ticks_now() may use the model, i.e., the tolerance
+     * is not zero
+     *
+     * This does not lock, so it is cheap enough for the packet path: Callers
+     * can skip add_lower_bound() (and taking the host time) while it returns
+     * false, because those observations would not save any device reads.
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    //! Discard all observations, e.g., because the device time was changed
+    void reset();
+
+    /*! Discard all observations because the device time will change on the next
+     * PPS edge
+     *
+     * Observations made within the next PPS period are ignored, because it is
+     * not known when exactly the device time changes.
+     */
+    void reset_at_next_pps();
+
+    /*! Return the current tick count
+     *
+     * If the error of the current estimate is within the tolerance, the
+     * estimate is returned. Otherwise, the tick count is read from the device
+     * using \p peek, and the model is updated with the result.
+     *
+     * \param peek Function which reads the current tick count from the device
+     */
+    uint64_t get_ticks_now(const peek_fn_t& peek);
+
+    /*! Add the observation that the device tick count was at least \p ticks at
+     * host time \p time
+     *
+     * This is used for timestamps of received packets. Observations that
+     * contradict the model (e.g., timestamps from before a time change)
+     * invalidate it, so the next call to get_ticks_now() reads the device time.
+     */
+    void add_lower_bound(const uint64_t ticks, const clock_t::time_point time);
+
+    //! Return an estimate of the tick count at host time \p time, if available
+    boost::optional<estimate_t> get_estimate(const clock_t::time_point time) const;
+
+private:
+    //! Interval of possible tick counts, relative to _anchor_ticks
+    struct interval_t
+    {
+        double lo;
+        double hi;
+    };
+
+    void _add_peek(const uint64_t ticks,
+        const clock_t::time_point t0,
+        const clock_t::time_point t1);
+    void _init(const uint64_t ticks, const clock_t::time_point time, const double width);
+    void _reset(const clock_t::time_point hold_off_until);
+    bool _is_usable(const clock_t::time_point time) const;
+    interval_t _propagate(const clock_t::time_point time) const;
+    boost::optional<estimate_t> _get_estimate(const clock_t::time_point time) const;
+
+    //! Relative frequency offset bound between device and host clock
+    const double _max_freq_offset;
+
+    mutable std::mutex _mutex;
+    double _tick_rate = 0.0;
+    double _tolerance = 0.0;
+    //! Mirrors _tolerance > 0, for is_enabled()
+    std::atomic<bool> _enabled{false};
+
+    //! Incremented on every reset, to discard reads which straddle a reset
+    uint64_t _epoch = 0;
+    //! Observations made before this time are ignored
+    clock_t::time_point _hold_off_until;
+    //! True if the observations below describe the current device time
+    bool _valid = false;
+
+    //! Host time and tick count which the interval of tick counts refers to
+    clock_t::time_point _anchor_time;
+    uint64_t _anchor_ticks = 0;
+    interval_t _anchor_interval{0.0, 0.0};
+
+    //! Interval of possible tick rates
+    double _rate_min = 0.0;
+    double _rate_max = 0.0;
+
+    //! First read since the last reset, used to measure the tick rate
+    clock_t::time_point _ref_time;
+    uint64_t _ref_ticks  = 0;
+    double _ref_width    = 0.0;
+};
+
+}} // namespace uhd::rfnoc
@@ -15,6 +15,7 @@
 #include <memory>
 #include <mutex>
 #include <tuple>
+#include <vector>
 
 namespace uhd { namespace rfnoc { namespace detail {
 
@@ -184,6 +185,12 @@ private:
         uhd::rfnoc::resolve_context context, node_ref_t initial_node);
 
     /*! This is the real implementation of the property propagation algorithm.
+     *
+     * Nodes are resolved from a worklist, which initially contains
+     * \p initial_node (and on commit, all nodes). Whenever resolving a node
+     * makes one of its neighbours dirty, the neighbour is added to the
+     * worklist. The worklist is processed in topological order, sweeping back
+     * and forth, so only nodes affected by a change are visited.
      *
      * This method must only be called from resolve_all_properties(). It assumes
      * that sanity checks have run, and that the graph mutex is being held.
@@ -254,6 +261,15 @@ private:
      */
     vertex_list_t _get_topo_sorted_nodes();
 
+    /*! Returns nodes in topologically sorted order, using a cached result
+     *
+     * The cache is updated after the graph has changed. It also updates
+     * _topo_index.
+     *
+     * \throws uhd::runtime_error if the graph was not sortable
+     */
+    const std::vector<rfnoc_graph_t::vertex_descriptor>& _get_topo_order();
+
     /*! Add a node, but only if it's not already in the graph.
      *
      * If it's already there, do nothing.
@@ -327,6 +343,20 @@ private:
     //! Changes to the state of the graph are locked with this mutex
     std::recursive_mutex _graph_mutex;
 
+    //! Cache of the topologically sorted vertices, see _get_topo_order()
+    std::vector<rfnoc_graph_t::vertex_descriptor> _topo_order;
+
+    //! Position of every vertex in _topo_order, indexed by vertex descriptor
+    std::vector<size_t> _topo_index;
+
+    //! False if the graph has changed since _topo_order was computed
+    bool _topo_order_valid{false};
+
+    //! True if nodes other than the initial node may be dirty when property
+    // resolution starts, e.g., because the previous resolution failed. Then,
+    // the next resolution looks for dirty nodes in the entire graph.
+    bool _dirty_nodes_unknown{true};
+
     //! This counter gets decremented everytime commit() is called. When zero,
     // the graph is committed.
     size_t _release_count{1};
@@ -17,6 +17,7 @@
 #include <uhdlib/rfnoc/rfnoc_common.hpp>
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <memory>
+#include <string>
 
 namespace uhd { namespace rfnoc {
 
@@ -83,6 +84,18 @@ public:
      */
     virtual void reset_network() = 0;
 
+    /*! Return a string that identifies this device and its FPGA image
+     *
+     * When not empty, the link stream managers use this to cache topology
+     * discovery results across sessions, which speeds up re-opening the same
+     * device. The string must change whenever the FPGA image changes. The
+     * default implementation returns an empty string, which disables caching.
+     */
+    virtual std::string get_fpga_signature()
+    {
+        return "";
+    }
+
     /*! Return a reference to a clock iface
      *
      * The MB interface may interact with the hardware to determine clock
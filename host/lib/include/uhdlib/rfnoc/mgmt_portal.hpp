@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <string>
 
 namespace uhd { namespace rfnoc { namespace mgmt {
 
@@ -224,10 +225,17 @@ public:
     // local device endpoint, using the \p xport. The transport object is not
     // stored in the management portal.
     // The discovered topology will be stored within the referenced topo_graph.
+    //
+    // If \p topo_cache_key is not empty, the paths that turned out to be
+    // empty during discovery are stored in the user's cache directory, and are
+    // not probed again by the next management portal created with the same key,
+    // also in later sessions. The key must therefore identify the device, its
+    // FPGA image, and the transport used to reach it.
     static uptr make(chdr_ctrl_xport& xport,
         const chdr::chdr_packet_factory& pkt_factory,
         sep_addr_t my_sep_addr,
-        uhd::rfnoc::detail::topo_graph_t::sptr topo_graph);
+        uhd::rfnoc::detail::topo_graph_t::sptr topo_graph,
+        const std::string& topo_cache_key = "");
 };
 
 }}} // namespace uhd::rfnoc::mgmt
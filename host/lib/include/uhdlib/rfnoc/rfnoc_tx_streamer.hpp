@@ -106,6 +106,20 @@ public:
      */
     bool recv_async_msg(uhd::async_metadata_t& async_metadata, double timeout) override;
 
+    /*! Register a callback for asynchronous messages from this tx stream
+     *
+     *  Implementation of tx_streamer API method.
+     *
+     * \param callback the function to call for every async message
+     */
+    void register_async_msg_callback(const async_msg_callback_t& callback) override;
+
+    /*! Return a file descriptor that is readable while async messages are queued
+     *
+     *  Implementation of tx_streamer API method.
+     */
+    int get_async_msg_fd() const override;
+
 private:
     void _register_props(const size_t chan, const std::string& otw_format);
 
@@ -8,21 +8,35 @@
 
 #include <uhd/types/metadata.hpp>
 #include <boost/lockfree/queue.hpp>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace uhd { namespace rfnoc {
 
 /*!
  *  Implements queue of async messages originating from the tx data transport
  *  and from the rfnoc graph.
+ *
+ *  Threads waiting in recv_async_msg() are woken up as soon as a message is
+ *  enqueued. On Linux, the queue also provides an eventfd which is readable
+ *  while messages are pending, so the queue can be watched with poll() or
+ *  epoll together with other file descriptors.
  */
 class tx_async_msg_queue
 {
 public:
-    using sptr = std::shared_ptr<tx_async_msg_queue>;
+    using sptr       = std::shared_ptr<tx_async_msg_queue>;
+    using callback_t = std::function<void(const async_metadata_t&)>;
 
     //! Constructor
     tx_async_msg_queue(size_t capacity);
 
+    //! Destructor
+    ~tx_async_msg_queue();
+
     /*!
      *  Retrieve async message from queue
      *
@@ -35,12 +49,58 @@ public:
     /*!
      *  Push an async message onto the queue
      *
+     * Calls all registered callbacks, then wakes up waiting threads.
+     *
      * \param async_metadata the metadata to be pushed
      */
     void enqueue(const async_metadata_t& async_metadata);
 
+    /*!
+     *  Register a callback for async messages
+     *
+     * The callback is called from the thread that enqueues the message, which
+     * is usually the I/O thread of the transport. It must therefore return
+     * quickly, and must not wait for other async messages. Messages are still
+     * queued for recv_async_msg() when callbacks are registered. Callbacks may
+     * register further callbacks, which are called from the next message on.
+     *
+     * \param callback the function to call for every async message
+     */
+    void register_callback(const callback_t& callback);
+
+    /*!
+     *  Return a file descriptor which is readable while messages are queued
+     *
+     * The descriptor may occasionally be readable when the queue is empty, so
+     * recv_async_msg() should be called with a timeout of zero once it becomes
+     * readable. Callers must not read from or close the descriptor.
+     *
+     * \return the file descriptor, or -1 if not supported on this platform
+     */
+    int get_event_fd() const
+    {
+        return _event_fd;
+    }
+
 private:
+    //! Pop a message from the queue and keep the eventfd count in sync
+    bool _pop(async_metadata_t& async_metadata);
+
     boost::lockfree::queue<async_metadata_t> _queue;
+
+    //! Mutex and condition to wake up threads waiting in recv_async_msg()
+    std::mutex _wait_mutex;
+    std::condition_variable _wait_cond;
+
+    using callback_list_t = std::vector<callback_t>;
+
+    //! Registered callbacks. The list is replaced, never modified, so
+    //  enqueue() can call a copy of the pointer without holding the mutex.
+    std::mutex _callback_mutex;
+    std::shared_ptr<const callback_list_t> _callbacks;
+
+    //! Counts the queued messages, or -1 if eventfd is not available
+    int _event_fd = -1;
 };
 
 }} // namespace uhd::rfnoc
@@ -7,7 +7,7 @@
 #pragma once
 
 #include <uhdlib/transport/adapter_info.hpp>
-#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <string>
 
 namespace uhd { namespace transport {
 
@@ -20,6 +20,13 @@ public:
 
     adapter_id_t register_adapter(adapter_info& info);
 
+    //! Return the description (adapter_info::to_string()) of a registered
+    // adapter, or an empty string if \p id is unknown
+    //
+    // Unlike the adapter ID, which depends on the order in which adapters are
+    // registered, this identifies the adapter across sessions.
+    std::string get_adapter_name(const adapter_id_t id);
+
 private:
     adapter_ctx() = default;
 
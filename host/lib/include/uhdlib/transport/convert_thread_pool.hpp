@@ -0,0 +1,204 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhd/utils/thread.hpp>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Pool of polling threads that run per-channel sample conversion
+ *
+ * Streamers use this pool to spread the converter calls for the channels of
+ * one packet across several cores. run() hands out the work items (channels)
+ * to the worker threads and to the calling thread, and only returns when all
+ * of them have been processed.
+ *
+ * Since a conversion only takes a few hundred nanoseconds per packet, the
+ * worker threads poll for work instead of blocking on a condition variable,
+ * just like the polling offload threads of offload_io_service do. Each worker
+ * thread therefore keeps one core busy for the lifetime of the pool, and
+ * should be pinned to a core of its own. Polling threads yield between polls,
+ * so they still make progress if there are fewer cores than threads.
+ */
+class convert_thread_pool
+{
+public:
+    using uptr = std::unique_ptr<convert_thread_pool>;
+
+    //! Function that processes one work item
+    using work_fn_t = std::function<void(size_t)>;
+
+    /*!
+     * Create a pool from stream args, if requested
+     *
+     * The following keys are used:
+     * - conv_threads: Number of worker threads. The thread that calls run()
+     *   also processes work items, so N worker threads spread the work across
+     *   N+1 cores. When not set or 0, no pool is created.
+     * - conv_thread_<N>_cpu: Core to pin worker thread N to, starting with 0
+     *   and up to conv_threads minus 1.
+     *
+     * \param args Stream args
+     * \param name Name of the worker threads
+     * \returns The pool, or nullptr if conv_threads is not set or 0
+     */
+    static uptr make(const uhd::device_addr_t& args, const std::string& name)
+    {
+        const size_t num_threads = args.cast<size_t>("conv_threads", 0);
+        if (num_threads == 0) {
+            return nullptr;
+        }
+
+        std::vector<std::vector<size_t>> cpu_affinity(num_threads);
+        for (size_t i = 0; i < num_threads; i++) {
+            const std::string key = "conv_thread_" + std::to_string(i) + "_cpu";
+            if (args.has_key(key)) {
+                cpu_affinity[i].push_back(args.cast<size_t>(key, 0));
+            }
+        }
+        return uptr(new convert_thread_pool(cpu_affinity, name));
+    }
+
+    /*!
+     * Create a pool with one worker thread per entry of cpu_affinity
+     *
+     * \param cpu_affinity CPU affinity list for each worker thread. An empty
+     *                     list leaves the thread unpinned.
+     * \param name Name of the worker threads
+     */
+    convert_thread_pool(
+        const std::vector<std::vector<size_t>>& cpu_affinity, const std::string& name)
+    {
+        for (size_t i = 0; i < cpu_affinity.size(); i++) {
+            _threads.emplace_back(
+                &convert_thread_pool::_worker, this, cpu_affinity[i]);
+            uhd::set_thread_name(&_threads.back(), name + std::to_string(i));
+        }
+    }
+
+    ~convert_thread_pool()
+    {
+        _stop = true;
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    //! Returns the number of worker threads
+    size_t get_num_threads() const
+    {
+        return _threads.size();
+    }
+
+    /*!
+     * Call fn(i) for every i in [0, num_items) and wait for all calls to finish
+     *
+     * The calls are spread across the worker threads and the calling thread.
+     * If any of the calls throws, the first exception is rethrown here, after
+     * all other work items have been processed.
+     *
+     * Only one thread may call run() at a time.
+     *
+     * \param num_items Number of work items
+     * \param fn Function that processes one work item. It must remain valid
+     *           until run() returns.
+     */
+    void run(const size_t num_items, const work_fn_t& fn)
+    {
+        _work_fn   = &fn;
+        _num_items = num_items;
+        _next_item.store(0, std::memory_order_relaxed);
+        _num_idle.store(0, std::memory_order_relaxed);
+        // Publish the work to the worker threads
+        _generation.fetch_add(1, std::memory_order_release);
+
+        _do_work();
+
+        while (_num_idle.load(std::memory_order_acquire) != _threads.size()) {
+            std::this_thread::yield();
+        }
+
+        if (_exception) {
+            std::exception_ptr exception = _exception;
+            _exception                   = nullptr;
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    //! Process work items until there are none left
+    UHD_FORCE_INLINE void _do_work()
+    {
+        size_t item;
+        while ((item = _next_item.fetch_add(1, std::memory_order_relaxed))
+               < _num_items) {
+            try {
+                (*_work_fn)(item);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(_exception_mutex);
+                if (!_exception) {
+                    _exception = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void _worker(const std::vector<size_t> cpu_affinity)
+    {
+        if (!cpu_affinity.empty()) {
+            uhd::set_thread_affinity(cpu_affinity);
+        }
+
+        size_t last_generation = 0;
+        while (!_stop) {
+            const size_t generation = _generation.load(std::memory_order_acquire);
+            if (generation == last_generation) {
+                std::this_thread::yield();
+                continue;
+            }
+            last_generation = generation;
+            _do_work();
+            _num_idle.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    //! Worker threads
+    std::vector<std::thread> _threads;
+
+    //! Incremented by run() for every new set of work items
+    std::atomic<size_t> _generation{0};
+
+    //! Next work item to be processed
+    std::atomic<size_t> _next_item{0};
+
+    //! Number of worker threads that are done with the current work items
+    std::atomic<size_t> _num_idle{0};
+
+    //! Signals the worker threads to exit
+    std::atomic<bool> _stop{false};
+
+    //! Work items of the current run() call, only written by run()
+    const work_fn_t* _work_fn = nullptr;
+    size_t _num_items         = 0;
+
+    //! First exception thrown by a work item
+    std::exception_ptr _exception;
+    std::mutex _exception_mutex;
+};
+
+}} // namespace uhd::transport
@@ -26,7 +26,6 @@
 #include <rte_flow.h>
 #include <rte_mbuf.h>
 #include <rte_mempool.h>
-#include <rte_spinlock.h>
 #include <rte_version.h>
 
 #pragma GCC diagnostic pop
@@ -37,6 +36,8 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 /* NOTE: There are changes to all the network standard fields in 19.x */
 
@@ -293,6 +294,18 @@ public:
         return (network == 0xffffffff);
     }
 
+    /*! Determine if this port computes IPv4 checksums in hardware
+     *
+     * Ports without checksum offloads (e.g., DPDK's virtual devices) fall
+     * back to computing and verifying IPv4 header checksums in software.
+     *
+     * \return whether the IPv4 checksum offloads are enabled
+     */
+    inline bool has_hw_cksum() const
+    {
+        return _hw_cksum;
+    }
+
     /*!
      * Allocate a UDP port and return it in network order
      *
@@ -301,6 +314,27 @@ public:
      */
     uint16_t alloc_udp_port(uint16_t udp_port);
 
+    /*!
+     * Select the DMA queue for a local UDP port, and steer its packets there
+     *
+     * On ports with multiple queues, the queue with the fewest UDP ports is
+     * selected, and a flow rule is installed which steers all packets destined
+     * for \p udp_port to that queue. Ports which cannot steer packets only
+     * use queue 0.
+     *
+     * \param udp_port The local UDP port (in network order)
+     * \return The queue which receives the packets for \p udp_port, and which
+     *         must be used to send packets from it
+     */
+    queue_id_t steer_udp_port(uint16_t udp_port);
+
+    /*!
+     * Remove the flow rule installed by steer_udp_port()
+     *
+     * \param udp_port The local UDP port (in network order)
+     */
+    void unsteer_udp_port(uint16_t udp_port);
+
 private:
     friend uhd::transport::dpdk_io_service;
 
@@ -317,14 +351,21 @@ private:
     struct rte_ether_addr _mac_addr;
     rte_ipv4_addr _ipv4;
     rte_ipv4_addr _netmask;
+    bool _hw_cksum = true;
+    //! Whether packets can be steered to queues other than queue 0
+    bool _steering = false;
+    //! Whether steering requires flow rules (see steer_udp_port())
+    bool _flow_rules = false;
 
     // Structures protected by mutex
     std::mutex _mutex;
     std::set<uint16_t> _udp_ports;
     uint16_t _next_udp_port = 0xffff;
-
-    // Structures protected by spin lock
-    rte_spinlock_t _spinlock = RTE_SPINLOCK_INITIALIZER;
+    //! Number of UDP ports steered to each queue
+    std::vector<size_t> _queue_users;
+    //! Queue and flow rule for each steered UDP port (in network order)
+    std::unordered_map<uint16_t, std::pair<queue_id_t, struct rte_flow*>> _udp_queues;
+    //! ARP table, shared by all I/O services that serve this port
     std::unordered_map<rte_ipv4_addr, struct arp_entry*> _arp_table;
 };
 
@@ -401,9 +442,14 @@ public:
      */
     bool is_init_done(void) const;
 
-    /*! Return a reference to an IO service given a port ID
+    /*! Return a reference to an IO service given a port ID and DMA queue
+     *
+     * Each DMA queue of a port is served by the I/O service of one lcore.
+     * Links must use the I/O service which serves their queue (see
+     * dpdk_port::steer_udp_port()).
      */
-    std::shared_ptr<uhd::transport::dpdk_io_service> get_io_service(const size_t port_id);
+    std::shared_ptr<uhd::transport::dpdk_io_service> get_io_service(
+        const size_t port_id, const queue_id_t queue_id = 0);
 
 private:
     /*! Convert the args to DPDK's EAL args and Initialize the EAL
@@ -434,14 +480,18 @@ private:
     int _num_mbufs;
     int _mbuf_cache_size;
     int _link_init_timeout;
+    size_t _rx_burst_size;
+    size_t _tx_burst_size;
     std::mutex _init_mutex;
     std::atomic<bool> _init_done;
     uhd::dict<uint32_t, port_id_t> _routes;
     std::unordered_map<port_id_t, dpdk_port::uptr> _ports;
     std::vector<struct rte_mempool*> _rx_pktbuf_pools;
     std::vector<struct rte_mempool*> _tx_pktbuf_pools;
-    // Store all the I/O services, and also store the corresponding port ID
-    std::map<std::shared_ptr<uhd::transport::dpdk_io_service>, std::vector<size_t>>
+    // Store all the I/O services, and also store the corresponding port IDs and
+    // the DMA queue of each port
+    std::map<std::shared_ptr<uhd::transport::dpdk_io_service>,
+        std::vector<std::pair<size_t, queue_id_t>>>
         _io_srv_portid_map;
 };
 
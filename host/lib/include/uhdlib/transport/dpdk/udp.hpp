@@ -55,14 +55,19 @@ inline void fill_rte_ipv4_hdr(struct rte_mbuf* mbuf,
     ip_hdr->fragment_offset = rte_cpu_to_be_16(RTE_IPV4_HDR_DF_FLAG);
     ip_hdr->time_to_live    = 64;
     ip_hdr->next_proto_id   = proto_id;
-    ip_hdr->hdr_checksum    = 0; // Require HW offload
+    ip_hdr->hdr_checksum    = 0; // Filled in by HW offload, or below
     ip_hdr->src_addr        = port->get_ipv4();
     ip_hdr->dst_addr        = dst_rte_ipv4_addr;
+    if (port->has_hw_cksum()) {
 #if RTE_VER_YEAR > 21 || (RTE_VER_YEAR == 21 && RTE_VER_MONTH == 11)
-    mbuf->ol_flags = RTE_MBUF_F_TX_IP_CKSUM | RTE_MBUF_F_TX_IPV4;
+        mbuf->ol_flags = RTE_MBUF_F_TX_IP_CKSUM | RTE_MBUF_F_TX_IPV4;
 #else
-    mbuf->ol_flags = PKT_TX_IP_CKSUM | PKT_TX_IPV4;
+        mbuf->ol_flags = PKT_TX_IP_CKSUM | PKT_TX_IPV4;
 #endif
+    } else {
+        ip_hdr->hdr_checksum = rte_ipv4_cksum(ip_hdr);
+        mbuf->ol_flags       = 0;
+    }
     mbuf->l2_len = sizeof(struct rte_ether_hdr);
     mbuf->l3_len = sizeof(struct rte_ipv4_hdr);
     mbuf->pkt_len =
@@ -7,6 +7,7 @@
 
 #include <uhdlib/transport/dpdk/common.hpp>
 #include <uhdlib/transport/dpdk/service_queue.hpp>
+#include <uhdlib/transport/dpdk/udp.hpp>
 #include <uhdlib/transport/io_service.hpp>
 #include <rte_arp.h>
 #include <rte_hash.h>
@@ -27,8 +28,27 @@ class dpdk_io_service : public virtual io_service,
 public:
     using sptr = std::shared_ptr<dpdk_io_service>;
 
-    static sptr make(
-        unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth);
+    //! Upper limit for the RX and TX burst sizes
+    static constexpr size_t MAX_BURST_SIZE = 256;
+
+    /*! Create an I/O service and launch it on an lcore
+     *
+     * \param lcore_id The lcore to run the I/O service on
+     * \param ports The NIC ports served by this I/O service
+     * \param queues The DMA queue of each port in \p ports which this I/O
+     *               service polls and transmits on
+     * \param servq_depth Number of requests the service queue can hold
+     * \param rx_burst_size Maximum number of packets received (and buffers
+     *                      released) per port and client in one iteration
+     * \param tx_burst_size Maximum number of packets sent per client in one
+     *                      iteration
+     */
+    static sptr make(unsigned int lcore_id,
+        std::vector<dpdk::dpdk_port*> ports,
+        std::vector<dpdk::queue_id_t> queues,
+        size_t servq_depth,
+        size_t rx_burst_size,
+        size_t tx_burst_size);
 
     ~dpdk_io_service();
 
@@ -65,8 +85,12 @@ private:
     friend class dpdk_recv_io;
     friend class dpdk_send_io;
 
-    dpdk_io_service(
-        unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth);
+    dpdk_io_service(unsigned int lcore_id,
+        std::vector<dpdk::dpdk_port*> ports,
+        std::vector<dpdk::queue_id_t> queues,
+        size_t servq_depth,
+        size_t rx_burst_size,
+        size_t tx_burst_size);
     dpdk_io_service(const dpdk_io_service&) = delete;
 
     /*!
@@ -129,6 +153,9 @@ private:
      * Helper function for I/O thread to do a burst of packet retrieval and
      * processing on an RX queue
      *
+     * UDP packets are collected, and then looked up in the RX table and
+     * handed to their clients as a group (see _process_udp()).
+     *
      * \param port the DPDK NIC port used for RX
      * \param queue the DMA queue on the port to recv from
      */
@@ -172,29 +199,64 @@ private:
     int _process_arp(
         dpdk::dpdk_port* port, dpdk::queue_id_t queue_id, struct rte_arp_hdr* arp_frame);
 
+    /*!
+     * Helper function for I/O thread to retry completing the ARP requests
+     * which _process_arp() could not complete because the service queue was
+     * full
+     */
+    void _complete_arp_requests();
+
     /*!
      * Helper function for I/O thread to process an IPv4 packet
      *
+     * If the packet is a UDP packet for this port, the key for looking up its
+     * flow in the RX table is filled in. Otherwise, the packet is dropped.
+     *
      * \param port the DPDK NIC port to send any ARP replies from
      * \param mbuf a pointer to the packet buffer container
      * \param pkt a pointer to the IPv4 header of the packet
+     * \param key the RX table key to fill in
+     * \return 0 if the packet is a UDP packet for this port, else a negative
+     *         error code
      */
-    int _process_ipv4(
-        dpdk::dpdk_port* port, struct rte_mbuf* mbuf, struct rte_ipv4_hdr* pkt);
+    int _process_ipv4(dpdk::dpdk_port* port,
+        struct rte_mbuf* mbuf,
+        struct rte_ipv4_hdr* pkt,
+        struct dpdk::ipv4_5tuple* key);
 
     /*!
-     * Helper function for I/O thread to process an IPv4 packet
+     * Helper function for I/O thread to process a burst of UDP packets
      *
-     * \param port the DPDK NIC port to send any ARP replies from
-     * \param mbuf a pointer to the packet buffer container
-     * \param pkt a pointer to the UDP header of the packet
-     * \param bcast whether this packet was destined for the port's broadcast
-     *              IPv4 address
+     * The flows of all packets are looked up in the RX table in bulk, and
+     * consecutive packets for the same client are enqueued together.
+     *
+     * \param mbufs the packet buffer containers
+     * \param keys the RX table key of each packet
+     * \param num_pkts the number of packets
      */
-    int _process_udp(dpdk::dpdk_port* port,
-        struct rte_mbuf* mbuf,
-        struct rte_udp_hdr* pkt,
-        bool bcast);
+    void _process_udp(struct rte_mbuf** mbufs,
+        const struct dpdk::ipv4_5tuple* keys,
+        unsigned int num_pkts);
+
+    /*!
+     * Helper function for I/O thread to enqueue received frames for a client,
+     * and wake it
+     *
+     * Frames which don't fit into the client's recv queue are dropped.
+     *
+     * \param recv_io the client
+     * \param buffs the received frames
+     * \param num_buffs the number of frames
+     */
+    void _enqueue_recv(
+        dpdk_recv_io* recv_io, dpdk::dpdk_frame_buff** buffs, unsigned int num_buffs);
+
+    /*!
+     * Return the DMA queue this I/O service uses on a port
+     *
+     * \param port one of the DPDK NIC ports served by this I/O service
+     */
+    dpdk::queue_id_t _get_queue(const dpdk::dpdk_port* port) const;
 
     /*!
      * Helper function to get a unique client ID
@@ -214,6 +276,13 @@ private:
     unsigned int _lcore_id;
     //! The NIC ports served by this dpdk_io_service
     std::vector<dpdk::dpdk_port*> _ports;
+    //! The DMA queue used on each port in _ports
+    std::vector<dpdk::queue_id_t> _queues;
+    //! Maximum number of packets received per port, and of buffers released
+    //  per client, in one iteration
+    const size_t _rx_burst_size;
+    //! Maximum number of packets sent per client in one iteration
+    const size_t _tx_burst_size;
     //! The set of TX queues associated with a given port
     std::unordered_map<dpdk::port_id_t, std::list<dpdk_send_io*>> _tx_queues;
     //! The list of recv_io for each port
@@ -224,6 +293,8 @@ private:
     dpdk::service_queue _servq;
     //! Retry list for waking clients
     dpdk_io_if* _retry_head = NULL;
+    //! ARP requests which could not be completed yet, see _process_arp()
+    std::vector<dpdk::wait_req*> _arp_completions;
 
     //! Mutex to protect below data structures
     std::mutex _mutex;
@@ -239,8 +310,6 @@ private:
     static constexpr int MAX_PENDING_SERVICE_REQS = 32;
     static constexpr int MAX_FLOWS                = 128;
     static constexpr int MAX_CLIENTS              = 2048;
-    static constexpr int RX_BURST_SIZE            = 16;
-    static constexpr int TX_BURST_SIZE            = 16;
 };
 
 }} // namespace uhd::transport
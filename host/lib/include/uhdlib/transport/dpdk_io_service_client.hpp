@@ -81,11 +81,12 @@ public:
         size_t queue_size        = (size_t)exp2(ceil(log2(num_send_frames + 1)));
         dpdk::port_id_t nic_port = link->get_port()->get_port_id();
         uint16_t id              = io_srv->_get_unique_client_id();
-        char name[16];
-        snprintf(name, sizeof(name), "tx%hu-%hu", nic_port, id);
+        // Several I/O services may serve the port, so the name includes the lcore
+        char name[RTE_RING_NAMESIZE];
+        snprintf(name, sizeof(name), "tx%hu-%u-%hu", nic_port, io_srv->_lcore_id, id);
         _buffer_queue = rte_ring_create(
             name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
-        snprintf(name, sizeof(name), "~tx%hu-%hu", nic_port, id);
+        snprintf(name, sizeof(name), "~tx%hu-%u-%hu", nic_port, io_srv->_lcore_id, id);
         _send_queue = rte_ring_create(
             name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
         UHD_LOG_TRACE("DPDK::SEND_IO", "dpdk_send_io() " << _buffer_queue->name);
@@ -129,6 +130,11 @@ public:
             auto timeout_point =
                 std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
             std::unique_lock<std::mutex> lock(_waiter->mutex);
+            // The I/O service doesn't wake us up if it filled the queue before
+            // we took the lock, so check again
+            if (!rte_ring_dequeue(_buffer_queue, (void**)&buff_ptr)) {
+                return frame_buff::uptr(buff_ptr);
+            }
             wait_req_get(_waiter);
             _waiter->complete = false;
             auto is_complete  = [this] { return _waiter->complete; };
@@ -166,6 +172,11 @@ private:
 
     dpdk_io_if _dpdk_io_if;
     size_t _num_frames_in_use = 0;
+    //! Frames dequeued from the send queue by the I/O service, but not sent
+    //  yet because of flow control
+    frame_buff* _staged[dpdk_io_service::MAX_BURST_SIZE];
+    unsigned int _num_staged  = 0;
+    unsigned int _next_staged = 0;
 
     dpdk::service_queue& _servq;
     dpdk::dpdk_ctx::sptr _ctx;
@@ -202,11 +213,12 @@ public:
         uint16_t id              = io_srv->_get_unique_client_id();
         UHD_LOG_DEBUG(
             "DPDK::IO_SERVICE", "Creating recv client with queue size of " << queue_size);
-        char name[16];
-        snprintf(name, sizeof(name), "rx%hu-%hu", nic_port, id);
+        // Several I/O services may serve the port, so the name includes the lcore
+        char name[RTE_RING_NAMESIZE];
+        snprintf(name, sizeof(name), "rx%hu-%u-%hu", nic_port, io_srv->_lcore_id, id);
         _recv_queue = rte_ring_create(
             name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
-        snprintf(name, sizeof(name), "~rx%hu-%hu", nic_port, id);
+        snprintf(name, sizeof(name), "~rx%hu-%u-%hu", nic_port, io_srv->_lcore_id, id);
         _release_queue = rte_ring_create(
             name, queue_size, rte_socket_id(), RING_F_SP_ENQ | RING_F_SC_DEQ);
         UHD_LOG_TRACE("DPDK::RECV_IO", "dpdk_recv_io() " << _recv_queue->name);
@@ -241,6 +253,11 @@ public:
             auto timeout_point =
                 std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
             std::unique_lock<std::mutex> lock(_waiter->mutex);
+            // The I/O service doesn't wake us up if it filled the queue before
+            // we took the lock, so check again
+            if (!rte_ring_dequeue(_recv_queue, (void**)&buff_ptr)) {
+                return frame_buff::uptr(buff_ptr);
+            }
             wait_req_get(_waiter);
             _waiter->complete = false;
             auto is_complete  = [this] { return _waiter->complete; };
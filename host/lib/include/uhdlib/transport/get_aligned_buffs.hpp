@@ -10,6 +10,7 @@
 #include <uhd/utils/log.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/format.hpp>
+#include <cmath>
 
 namespace uhd { namespace transport {
 
@@ -20,11 +21,22 @@ namespace uhd { namespace transport {
 // aligning timestamps on all channels to the new timestamp.
 constexpr size_t ALIGNMENT_FAILURE_THRESHOLD = 1000;
 
+// Largest gap, in packets, that get_aligned_buffs fills with zeros when zero
+// fill is enabled. Larger gaps are more likely caused by a change of the
+// device time than by lost packets, so the channels are realigned instead.
+constexpr size_t ZERO_FILL_MAX_GAP_PACKETS = 1000;
+
 /*!
  * Implementation of rx time alignment. This method reads packets from the
  * transports for each channel and discards any packets whose tsf does not
  * match those of other channels due to dropped packets. Packets that do not
  * have a tsf are not checked for alignment and never dropped.
+ *
+ * When zero fill is enabled, packets are not discarded when a channel lost
+ * whole packets. Instead, the packets of the channels that are behind in time
+ * are returned, and the channels that are ahead are reported as zero-filled.
+ * Their packets are kept until the other channels catch up. Gaps that are not
+ * a whole number of packets fall back to discarding packets.
  */
 template <typename transport_t, bool ignore_seq_err = false>
 class get_aligned_buffs
@@ -46,11 +58,58 @@ public:
         , _infos(infos)
         , _prev_tsf(_xports.size(), 0)
         , _channels_to_align(_xports.size())
+        , _zero_filled_chans(_xports.size())
+        , _prev_zero_filled_chans(_xports.size())
+        , _seq_error_chans(_xports.size())
+    {
+    }
+
+    //! Enables filling the gaps of lost packets with zeros
+    void set_zero_fill(const bool enable)
+    {
+        _zero_fill = enable;
+    }
+
+    //! Configures the ratio of tick rate to sample rate, used to find gaps
+    void set_ticks_per_samp(const double ticks_per_samp)
+    {
+        _ticks_per_samp = ticks_per_samp;
+    }
+
+    //! Configures the size of each sample, used to find gaps
+    void set_bytes_per_item(const size_t bpi)
     {
+        _bytes_per_item = bpi;
+    }
+
+    /*!
+     * Returns the channels which are zero-filled in the last set of aligned
+     * buffers. The packets of these channels come later in time than the
+     * others, and must not be released.
+     */
+    const boost::dynamic_bitset<>& get_zero_filled_chans() const
+    {
+        return _zero_filled_chans;
+    }
+
+    //! Clears the state of zero fill, after the caller dropped all packets
+    void reset()
+    {
+        _zero_filled_chans.reset();
+        _prev_zero_filled_chans.reset();
+        _seq_error_chans.reset();
     }
 
     alignment_result_t operator()(const int32_t timeout_ms)
     {
+        _zero_filled_chans.reset();
+        if (_zero_fill) {
+            alignment_result_t result;
+            if (_align_zero_fill(timeout_ms, result)) {
+                return result;
+            }
+        }
+
         // Clear state
         _channels_to_align.set();
         bool time_valid   = false;
@@ -59,32 +118,21 @@ public:
 
         while (_channels_to_align.any()) {
             const size_t chan = _channels_to_align.find_first();
-            auto& xport       = _xports[chan];
-            auto& info        = _infos[chan];
-            auto& frame_buff  = _frame_buffs[chan];
-            bool seq_error    = false;
+            auto& info       = _infos[chan];
+            auto& frame_buff = _frame_buffs[chan];
+            bool seq_error   = false;
 
             // Receive a data packet for the channel if we don't have one. A
             // packet may already be there if the previous call was interrupted
             // by an error.
             if (!frame_buff) {
-                try {
-                    std::tie(frame_buff, info, seq_error) =
-                        xport->get_recv_buff(timeout_ms);
-                } catch (const uhd::value_error& e) {
-                    // Bad packet
-                    UHD_LOGGER_ERROR("STREAMER")
-                        << boost::format(
-                               "The receive transport caught a value exception.\n%s")
-                               % e.what();
-                    return BAD_PACKET;
+                const alignment_result_t result =
+                    _recv_packet(chan, timeout_ms, seq_error);
+                if (result != SUCCESS) {
+                    return result;
                 }
             }
 
-            if (!frame_buff) {
-                return TIMEOUT;
-            }
-
             if (info.has_tsf) {
                 const bool time_out_of_order = _prev_tsf[chan] > info.tsf;
                 _prev_tsf[chan]              = info.tsf;
@@ -144,7 +192,7 @@ public:
             // If this packet had a sequence error, stop to return the error.
             // Keep the packet for the next call to get_aligned_buffs.
             if (seq_error && !ignore_seq_err) {
-                UHD_LOG_FASTPATH("D");
+                UHD_LOG_FASTPATH_EVENT('D', chan);
                 return SEQUENCE_ERROR;
             }
         }
@@ -154,6 +202,152 @@ public:
     }
 
 private:
+    //! Receives a packet for a channel
+    alignment_result_t _recv_packet(
+        const size_t chan, const int32_t timeout_ms, bool& seq_error)
+    {
+        try {
+            std::tie(_frame_buffs[chan], _infos[chan], seq_error) =
+                _xports[chan]->get_recv_buff(timeout_ms);
+        } catch (const uhd::value_error& e) {
+            // Bad packet
+            UHD_LOGGER_ERROR("STREAMER")
+                << boost::format("The receive transport caught a value exception.\n%s")
+                       % e.what();
+            return BAD_PACKET;
+        }
+
+        if (!_frame_buffs[chan]) {
+            return TIMEOUT;
+        }
+        return SUCCESS;
+    }
+
+    /*!
+     * Aligns the packets of all channels by filling the gaps of lost packets
+     * with zeros. Returns false if the gaps can't be filled, and packets must
+     * be discarded to align the channels.
+     */
+    bool _align_zero_fill(const int32_t timeout_ms, alignment_result_t& result)
+    {
+        // Receive a packet for each channel that doesn't have one. Packets of
+        // channels which were zero-filled are still there.
+        for (size_t chan = 0; chan < _xports.size(); chan++) {
+            if (!_frame_buffs[chan]) {
+                bool seq_error = false;
+                result         = _recv_packet(chan, timeout_ms, seq_error);
+                if (result != SUCCESS) {
+                    return true;
+                }
+                if (seq_error) {
+                    _seq_error_chans.set(chan);
+                }
+            }
+        }
+
+        // The packets with the earliest time are returned, the channels whose
+        // packets come later are zero-filled
+        bool time_valid = false;
+        uint64_t tsf    = 0;
+        size_t ref_chan = 0;
+        for (size_t chan = 0; chan < _xports.size(); chan++) {
+            const auto& info = _infos[chan];
+            if (!info.has_tsf) {
+                continue;
+            }
+            // The device time was changed, start over
+            if (info.tsf < _prev_tsf[chan]) {
+                return _realign(result);
+            }
+            if (!time_valid || info.tsf < tsf) {
+                time_valid = true;
+                tsf        = info.tsf;
+                ref_chan   = chan;
+            }
+        }
+
+        if (time_valid) {
+            const double packet_ticks =
+                _ticks_per_samp
+                * static_cast<double>(_infos[ref_chan].payload_bytes / _bytes_per_item);
+            for (size_t chan = 0; chan < _xports.size(); chan++) {
+                const auto& info = _infos[chan];
+                if (!info.has_tsf || info.tsf == tsf) {
+                    continue;
+                }
+                // Only fill gaps of whole packets. Both timestamps may be
+                // rounded to ticks, so allow for one tick of error.
+                if (packet_ticks <= 0.0) {
+                    return _realign(result);
+                }
+                const double gap_ticks   = static_cast<double>(info.tsf - tsf);
+                const double gap_packets = std::round(gap_ticks / packet_ticks);
+                if (gap_packets < 1.0 || gap_packets > ZERO_FILL_MAX_GAP_PACKETS
+                    || std::abs(gap_ticks - gap_packets * packet_ticks) > 1.0) {
+                    return _realign(result);
+                }
+                _zero_filled_chans.set(chan);
+            }
+        }
+
+        // Sequence errors of channels which were zero-filled are explained by
+        // the gap, report the others since the samples are lost on all channels
+        bool seq_error = false;
+        for (size_t chan = 0; chan < _xports.size(); chan++) {
+            if (_zero_filled_chans.test(chan)) {
+                continue;
+            }
+            _prev_tsf[chan] = _infos[chan].tsf;
+            if (_seq_error_chans.test(chan)) {
+                if (!_prev_zero_filled_chans.test(chan) && !ignore_seq_err) {
+                    seq_error = true;
+                    _log_seq_error(chan);
+                }
+                _seq_error_chans.reset(chan);
+            }
+        }
+        _prev_zero_filled_chans = _zero_filled_chans;
+
+        if (seq_error) {
+            result = SEQUENCE_ERROR;
+        } else {
+            result = SUCCESS;
+        }
+        return true;
+    }
+
+    //! Falls back to discarding packets, after reporting any sequence error
+    bool _realign(alignment_result_t& result)
+    {
+        _zero_filled_chans.reset();
+        _prev_zero_filled_chans.reset();
+        if (_seq_error_chans.any()) {
+            if (!ignore_seq_err) {
+                for (size_t chan = 0; chan < _xports.size(); chan++) {
+                    if (_seq_error_chans.test(chan)) {
+                        _log_seq_error(chan);
+                    }
+                }
+            }
+            _seq_error_chans.reset();
+            if (!ignore_seq_err) {
+                result = SEQUENCE_ERROR;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Records a 'D' event for a channel, with the time of its current packet
+    void _log_seq_error(const size_t chan)
+    {
+        if (_infos[chan].has_tsf) {
+            UHD_LOG_FASTPATH_EVENT('D', chan, _infos[chan].tsf);
+        } else {
+            UHD_LOG_FASTPATH_EVENT('D', chan);
+        }
+    }
+
     // Transports for each channel
     std::vector<typename transport_t::uptr>& _xports;
 
@@ -168,6 +362,22 @@ private:
 
     // Keeps track of channels that are aligned
     boost::dynamic_bitset<> _channels_to_align;
+
+    // Whether gaps of lost packets are filled with zeros
+    bool _zero_fill = false;
+
+    // Ratio of tick rate to sample rate
+    double _ticks_per_samp = 1.0;
+
+    // Size of a sample on the device
+    size_t _bytes_per_item = 1;
+
+    // Channels zero-filled in the last set of aligned buffers, and in the one before
+    boost::dynamic_bitset<> _zero_filled_chans;
+    boost::dynamic_bitset<> _prev_zero_filled_chans;
+
+    // Channels whose packet had a sequence error that is not reported yet
+    boost::dynamic_bitset<> _seq_error_chans;
 };
 
 }} // namespace uhd::transport
@@ -0,0 +1,41 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhdlib/transport/io_service.hpp>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Single-threaded I/O service that receives through io_uring
+ *
+ * This I/O service schedules work like inline_io_service, which it uses under
+ * the hood. In addition, every udp_boost_asio_link attached for receiving is
+ * switched to receive through an io_uring of its own (see
+ * udp_boost_asio_link::enable_io_uring()): A read is kept posted into a
+ * registered buffer for every free receive frame, and completions are reaped
+ * in batches, so most packets are delivered without a system call.
+ *
+ * Other types of links, and UDP links on kernels without io_uring support, are
+ * served exactly like by inline_io_service. Sends are not affected, since a
+ * UDP send already completes within a single system call.
+ *
+ * Like inline_io_service, this I/O service can also be run inside of an
+ * offload_io_service.
+ */
+class io_uring_io_service : public virtual io_service
+{
+public:
+    using sptr = std::shared_ptr<io_uring_io_service>;
+
+    /*!
+     * Creates an I/O service that receives on UDP links through io_uring
+     */
+    static sptr make();
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,135 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <sys/uio.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace uhd { namespace transport {
+
+/*!
+ * An io_uring that keeps receives posted on one socket.
+ *
+ * Every memory block handed to the ring gets a read queued on the socket. The
+ * kernel copies datagrams into the blocks as they arrive, without a system
+ * call per datagram. recv() hands out completed blocks straight from the
+ * completion queue, and only enters the kernel to submit reposted blocks and
+ * to wait when the completion queue is empty. Submissions and completions are
+ * therefore batched whenever data arrives faster than it is consumed.
+ *
+ * The memory regions containing the blocks are registered with the kernel
+ * (fixed buffers), which saves pinning the pages on every read. If the
+ * registration fails (e.g., because of RLIMIT_MEMLOCK), plain reads are used.
+ *
+ * The ring is not thread-safe, like the links it is used by.
+ */
+class io_uring_recv_ring : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<io_uring_recv_ring>;
+
+    /*!
+     * Create the ring and post reads into the first num_posted blocks.
+     *
+     * \param sock_fd a connected datagram socket
+     * \param block_size the size of each memory block
+     * \param regions the memory regions that contain all blocks
+     * \param blocks all memory blocks that will ever be posted to this ring
+     * \param num_posted the number of blocks to post right away
+     * \throws uhd::os_error if the kernel does not support io_uring
+     */
+    io_uring_recv_ring(int sock_fd,
+        size_t block_size,
+        const std::vector<iovec>& regions,
+        const std::vector<void*>& blocks,
+        size_t num_posted);
+
+    //! Cancels all posted reads, and waits for the kernel to let go of them
+    ~io_uring_recv_ring();
+
+    /*!
+     * Get a block that a datagram was received into.
+     *
+     * \param mem on success, the block holding the datagram
+     * \param timeout_ms a positive timeout value specifies the maximum number
+     *                   of ms to wait, a negative value specifies to block
+     *                   until successful, and a value of 0 specifies no wait.
+     * \return the size of the datagram, or 0 on timeout
+     */
+    size_t recv(void*& mem, int32_t timeout_ms);
+
+    /*!
+     * Post a read into a block. The block must be one of the blocks passed to
+     * the constructor, and not be posted already.
+     */
+    void post(void* mem);
+
+private:
+    struct completion_t
+    {
+        void* mem;
+        int32_t res;
+    };
+
+    //! Hand all queued submissions to the kernel
+    void _submit();
+    //! Move all entries from the completion queue to _completed
+    void _reap();
+    //! Get the next free, zeroed submission queue entry
+    io_uring_sqe* _get_sqe();
+    //! Queue the entry returned by the last call to _get_sqe()
+    void _push_sqe();
+    //! Cancel all reads that are still in flight
+    void _cancel_all();
+    //! Unmap the queues and close the ring
+    void _release();
+
+    int _ring_fd = -1;
+    int _sock_fd;
+    //! Index of the socket in the registered file table, or -1
+    int _fixed_file = -1;
+    const size_t _block_size;
+    //! Registered regions, or empty if plain reads are used
+    std::vector<iovec> _regions;
+    //! All blocks, only used to cancel the posted reads on destruction
+    const std::vector<void*> _blocks;
+
+    // Memory mapped submission and completion queues
+    void* _sq_ptr       = nullptr;
+    size_t _sq_size     = 0;
+    void* _cq_ptr       = nullptr;
+    size_t _cq_size     = 0;
+    io_uring_sqe* _sqes = nullptr;
+    size_t _sqes_size   = 0;
+
+    uint32_t* _sq_tail   = nullptr;
+    uint32_t* _sq_array  = nullptr;
+    uint32_t _sq_mask    = 0;
+    uint32_t _sq_entries = 0;
+    uint32_t* _cq_head   = nullptr;
+    uint32_t* _cq_tail   = nullptr;
+    uint32_t _cq_mask    = 0;
+    io_uring_cqe* _cqes  = nullptr;
+
+    //! Submissions queued, but not yet handed to the kernel
+    uint32_t _num_unsubmitted = 0;
+    //! Reads handed to the kernel that have not completed yet
+    size_t _num_in_flight = 0;
+
+    //! Completions reaped from the completion queue, but not yet handed out
+    std::vector<completion_t> _completed;
+    size_t _completed_idx = 0;
+};
+
+}} // namespace uhd::transport
@@ -34,6 +34,8 @@ struct link_params_t
     size_t num_send_frames = 0;
     size_t recv_buff_size  = 0;
     size_t send_buff_size  = 0;
+    //! Datagrams per receive call, ignored by links without batched receives
+    size_t recv_batch_size = 1;
 };
 
 
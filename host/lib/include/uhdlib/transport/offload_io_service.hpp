@@ -25,6 +25,22 @@ public:
 
     enum wait_mode_t { POLL, BLOCK };
 
+    /*!
+     * How a thread waits for buffers from the queues between the offload
+     * thread and its clients
+     *
+     * Buffers are handed over through lock-free queues. A thread that finds
+     * its queue empty, and is allowed to wait, first polls the queue for
+     * params_t::queue_spin_count iterations. After that:
+     * - SPIN: keeps polling until a buffer arrives or the timeout expires.
+     *   Lowest latency, but the waiting thread never gives up its core.
+     * - SPIN_YIELD: keeps polling, but yields the core between polls.
+     * - SPIN_FUTEX: sleeps until the other thread pushes a buffer (on a futex
+     *   on Linux, on a condition variable elsewhere). The other thread only
+     *   makes a system call if a thread is actually asleep.
+     */
+    enum queue_wait_policy_t { SPIN, SPIN_YIELD, SPIN_FUTEX };
+
     /*!
      * Options for configuring offload I/O service
      */
@@ -37,6 +53,11 @@ public:
         //! The thread behavior when waiting for incoming packets If set to
         //! BLOCK, the client type must be set to either RECV_ONLY or SEND_ONLY.
         wait_mode_t wait_mode = POLL;
+        //! How clients and the offload thread wait for buffers from each other
+        queue_wait_policy_t queue_wait_policy = SPIN_FUTEX;
+        //! Number of times an empty queue is polled before the wait policy
+        //! yields or sleeps
+        size_t queue_spin_count = 1000;
     };
 
     /*!
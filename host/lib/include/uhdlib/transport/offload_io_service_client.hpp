@@ -8,49 +8,13 @@
 
 #include <uhd/transport/frame_buff.hpp>
 #include <cassert>
-#include <chrono>
-#include <thread>
 
 namespace uhd { namespace transport {
 
-namespace detail {
-
-// Implementation of get_send_buff used below by send and recv clients
-template <typename pop_func_t>
-static frame_buff::uptr client_get_buff(pop_func_t pop, const int32_t timeout_ms)
-{
-    using namespace std::chrono;
-
-    if (timeout_ms == 0) {
-        return frame_buff::uptr(pop());
-    }
-
-    const auto end_time = steady_clock::now() + milliseconds(timeout_ms);
-
-    bool last_check = false;
-
-    while (true) {
-        if (frame_buff* buff = pop()) {
-            return frame_buff::uptr(buff);
-        }
-
-        if (timeout_ms > 0 && steady_clock::now() > end_time) {
-            if (last_check) {
-                return nullptr;
-            } else {
-                last_check = true;
-            }
-        }
-        std::this_thread::yield();
-    }
-}
-
-} // namespace detail
-
 /*!
  * Recv I/O client for offload I/O service
  */
-template <typename io_service_t, bool polling>
+template <typename io_service_t>
 class offload_recv_io : public recv_io_if
 {
 public:
@@ -75,19 +39,10 @@ public:
 
     frame_buff::uptr get_recv_buff(int32_t timeout_ms)
     {
-        if (polling) {
-            return detail::client_get_buff(
-                [this]() {
-                    frame_buff* buff = _port->client_pop();
-                    _num_frames_in_use += buff ? 1 : 0;
-                    return buff;
-                },
-                timeout_ms);
-        } else {
-            frame_buff* buff = _port->client_pop(timeout_ms);
-            _num_frames_in_use += buff ? 1 : 0;
-            return frame_buff::uptr(buff);
-        }
+        // The port waits according to the queue wait policy of the I/O service
+        frame_buff* buff = _port->client_pop(timeout_ms);
+        _num_frames_in_use += buff ? 1 : 0;
+        return frame_buff::uptr(buff);
     }
 
     void release_recv_buff(frame_buff::uptr buff)
@@ -109,7 +64,7 @@ private:
 /*!
  * Send I/O client for offload I/O service
  */
-template <typename io_service_t, bool polling>
+template <typename io_service_t>
 class offload_send_io : public send_io_if
 {
 public:
@@ -142,19 +97,10 @@ public:
 
     frame_buff::uptr get_send_buff(int32_t timeout_ms)
     {
-        if (polling) {
-            return detail::client_get_buff(
-                [this]() {
-                    frame_buff* buff = _port->client_pop();
-                    _num_frames_in_use += buff ? 1 : 0;
-                    return buff;
-                },
-                timeout_ms);
-        } else {
-            frame_buff* buff = _port->client_pop(timeout_ms);
-            _num_frames_in_use += buff ? 1 : 0;
-            return frame_buff::uptr(buff);
-        }
+        // The port waits according to the queue wait policy of the I/O service
+        frame_buff* buff = _port->client_pop(timeout_ms);
+        _num_frames_in_use += buff ? 1 : 0;
+        return frame_buff::uptr(buff);
     }
 
     void release_send_buff(frame_buff::uptr buff)
@@ -12,9 +12,11 @@
 #include <uhd/stream.hpp>
 #include <uhd/types/endianness.hpp>
 #include <uhd/utils/log.hpp>
+#include <uhdlib/transport/convert_thread_pool.hpp>
 #include <uhdlib/transport/rx_streamer_zero_copy.hpp>
 #include <algorithm>
 #include <limits>
+#include <string>
 #include <vector>
 
 namespace uhd { namespace transport {
@@ -73,8 +75,15 @@ template <typename transport_t, bool ignore_seq_err = false>
 class rx_streamer_impl : public rx_streamer
 {
 public:
-    //! Constructor
-    rx_streamer_impl(const size_t num_ports, const uhd::stream_args_t stream_args)
+    /*! Constructor
+     *
+     * The otw_format_suffix selects the converters, the default matches the
+     * CHDR transports. Transports of other packet formats (e.g., VRT) pass the
+     * suffix of their item format, such as "_item32_le".
+     */
+    rx_streamer_impl(const size_t num_ports,
+        const uhd::stream_args_t stream_args,
+        const std::string& otw_format_suffix = "_chdr")
         : _zero_copy_streamer(num_ports)
         , _in_buffs(num_ports)
         , _chans_connected(num_ports, false)
@@ -85,13 +94,32 @@ public:
         if (stream_args.otw_format.empty()) {
             throw uhd::value_error("[rx_stream] Must provide a otw_format!");
         }
-        _setup_converters(num_ports, stream_args);
+        _setup_converters(num_ports, stream_args, otw_format_suffix);
         _zero_copy_streamer.set_samp_rate(_samp_rate);
         _zero_copy_streamer.set_bytes_per_item(_convert_info.bytes_per_otw_item);
 
         if (stream_args.args.has_key("spp")) {
             _spp = stream_args.args.cast<size_t>("spp", _spp);
         }
+
+        const std::string align_mode = stream_args.args.get("align_mode", "drop");
+        if (align_mode == "zero_fill") {
+            _zero_copy_streamer.set_zero_fill(true);
+        } else if (align_mode != "drop") {
+            throw uhd::value_error(
+                "[rx_stream] Invalid align_mode, must be drop or zero_fill: "
+                + align_mode);
+        }
+
+        _convert_pool = convert_thread_pool::make(stream_args.args, "uhd_rx_conv");
+        if (_convert_pool) {
+            _convert_fn = [this](const size_t chan) {
+                _convert_chan(*_convert_job.buffs,
+                    _convert_job.offset,
+                    chan,
+                    _convert_job.num_samps);
+            };
+        }
     }
 
     //! Connect a new channel to the streamer
@@ -145,6 +173,16 @@ public:
                                      "channels are connected!");
         }
 
+        // Planar CPU formats need two buffers per channel, chan_interleaved
+        // ones a single buffer for all channels
+        const size_t num_buffs =
+            _chan_interleaved ? 1 : get_num_channels() * _num_cpu_buffs_per_chan;
+        if (buffs.size() < num_buffs) {
+            throw uhd::value_error("[rx_stream] recv() requires "
+                                   + std::to_string(num_buffs) + " buffers, but got "
+                                   + std::to_string(buffs.size()));
+        }
+
         if (_error_metadata_cache.check(metadata)) {
             return 0;
         }
@@ -156,7 +194,7 @@ public:
         size_t total_samps_recv =
             _recv_one_packet(buffs, nsamps_per_buff, metadata, eov_positions, timeout_ms);
 
-        if (one_packet or metadata.end_of_burst
+        if (one_packet or metadata.end_of_burst or _is_zero_filled(metadata)
             or (eov_positions.data() and eov_positions.remaining() == 0)) {
             return total_samps_recv;
         }
@@ -177,7 +215,8 @@ public:
                 loop_metadata,
                 eov_positions,
                 timeout_ms,
-                total_samps_recv * _convert_info.bytes_per_cpu_item);
+                total_samps_recv * _convert_info.bytes_per_cpu_item,
+                false);
 
             // If metadata had an error code set, store for next call and return
             if (loop_metadata.error_code != rx_metadata_t::ERROR_CODE_NONE) {
@@ -185,6 +224,11 @@ public:
                 break;
             }
 
+            // Zero-filled samples are kept for the next call
+            if (_is_zero_filled(loop_metadata)) {
+                break;
+            }
+
             total_samps_recv += num_samps;
 
             // Return immediately if end of burst
@@ -201,10 +245,35 @@ public:
         return total_samps_recv;
     }
 
+    //! Implementation of rx_streamer API method
+    std::vector<size_t> get_zero_filled_chans() const override
+    {
+        const auto& zero_filled = _zero_copy_streamer.get_zero_filled_chans();
+        std::vector<size_t> chans;
+        for (size_t i = 0; i < zero_filled.size(); i++) {
+            if (zero_filled.test(i)) {
+                chans.push_back(i);
+            }
+        }
+        return chans;
+    }
+
 protected:
     //! Configures scaling factor for conversion
     void set_scale_factor(const size_t chan, const double scale_factor)
     {
+        if (_chan_interleaved) {
+            // All channels share a single converter
+            if (chan != 0 && scale_factor != _chan_interleaved_scale_factor) {
+                UHD_LOG_WARNING("STREAMER",
+                    "Channels of a streamer with a chan_interleaved CPU format "
+                    "must use the same scale factor, using the one of channel "
+                    << chan);
+            }
+            _chan_interleaved_scale_factor = scale_factor;
+            _converters[0]->set_scalar(scale_factor);
+            return;
+        }
         _converters[chan]->set_scalar(scale_factor);
     }
 
@@ -264,6 +333,13 @@ protected:
     }
 
 private:
+    //! Zero-filled samples are reported as out of sequence without an error
+    static bool _is_zero_filled(const rx_metadata_t& metadata)
+    {
+        return metadata.out_of_sequence
+               && metadata.error_code == rx_metadata_t::ERROR_CODE_NONE;
+    }
+
     //! Converter and associated item sizes
     struct convert_info
     {
@@ -278,7 +354,8 @@ private:
         uhd::rx_metadata_t& metadata,
         detail::eov_data_wrapper& eov_positions,
         const int32_t timeout_ms,
-        const size_t buffer_offset_bytes = 0)
+        const size_t buffer_offset_bytes = 0,
+        const bool first_packet          = true)
     {
         // A request to read zero samples should effectively be a no-op.
         // However, in a2f10ee, a change was made to increase the probability
@@ -316,6 +393,15 @@ private:
             _buff_samps_remaining = _zero_copy_streamer.get_recv_buffs(
                 _in_buffs, metadata, eov_positions, timeout_ms);
             _fragment_offset_in_samps = 0;
+
+            // Zero-filled samples are returned by a recv() call of their own,
+            // so its metadata describes all of the samples. Keep them as a
+            // fragment for the next call.
+            if (_is_zero_filled(metadata) && !first_packet
+                && _buff_samps_remaining != 0) {
+                _last_fragment_metadata = metadata;
+                return 0;
+            }
         } else {
             // There are samples still left in the current set of buffers
             metadata = _last_fragment_metadata;
@@ -327,10 +413,23 @@ private:
             const size_t num_samps = std::min(nsamps_per_buff, _buff_samps_remaining);
 
             // Convert samples to the streamer's output format
-            for (size_t i = 0; i < get_num_channels(); i++) {
-                char* b = reinterpret_cast<char*>(buffs[i]);
-                const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
-                _convert_to_out_buff(out_buffs, i, num_samps);
+            if (_chan_interleaved) {
+                _convert_chan_interleaved(buffs, buffer_offset_bytes, num_samps);
+            } else if (_convert_pool) {
+                _convert_job = {&buffs, buffer_offset_bytes, num_samps};
+                _convert_pool->run(get_num_channels(), _convert_fn);
+
+                // Buffers are released from this thread, since the transports
+                // of different channels may share an I/O service
+                if (_buff_samps_remaining == num_samps) {
+                    for (size_t i = 0; i < get_num_channels(); i++) {
+                        _zero_copy_streamer.release_recv_buff(i);
+                    }
+                }
+            } else {
+                for (size_t i = 0; i < get_num_channels(); i++) {
+                    _convert_to_out_buff(buffs, buffer_offset_bytes, i, num_samps);
+                }
             }
 
             _buff_samps_remaining -= num_samps;
@@ -350,32 +449,73 @@ private:
         }
     }
 
-    //! Convert samples for one channel into its buffer
-    UHD_FORCE_INLINE void _convert_to_out_buff(
-        const uhd::rx_streamer::buffs_type& out_buffs,
+    //! Convert samples for one channel into its buffer(s)
+    UHD_FORCE_INLINE void _convert_to_out_buff(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
+        const size_t chan,
+        const size_t num_samps)
+    {
+        _convert_chan(buffs, buffer_offset_bytes, chan, num_samps);
+
+        if (_buff_samps_remaining == num_samps) {
+            _zero_copy_streamer.release_recv_buff(chan);
+        }
+    }
+
+    //! Convert samples for one channel, without releasing its buffer
+    UHD_FORCE_INLINE void _convert_chan(const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
         const size_t chan,
         const size_t num_samps)
     {
+        // Planar CPU formats use two consecutive user buffers per channel
+        const size_t num_buffs = _num_cpu_buffs_per_chan;
+        for (size_t i = chan * num_buffs; i < (chan + 1) * num_buffs; i++) {
+            _out_buffs[i] = reinterpret_cast<char*>(buffs[i]) + buffer_offset_bytes;
+        }
+        const uhd::rx_streamer::buffs_type out_buffs(
+            &_out_buffs[chan * num_buffs], num_buffs);
+
         const char* buffer_ptr = reinterpret_cast<const char*>(_in_buffs[chan]);
 
         _converters[chan]->conv(buffer_ptr, out_buffs, num_samps);
 
         // Advance the pointer for the source buffer
         _in_buffs[chan] = buffer_ptr + num_samps * _convert_info.bytes_per_otw_item;
+    }
 
-        if (_buff_samps_remaining == num_samps) {
-            _zero_copy_streamer.release_recv_buff(chan);
+    //! Convert samples for all channels into a single, chan_interleaved buffer
+    UHD_FORCE_INLINE void _convert_chan_interleaved(
+        const uhd::rx_streamer::buffs_type& buffs,
+        const size_t buffer_offset_bytes,
+        const size_t num_samps)
+    {
+        char* b = reinterpret_cast<char*>(buffs[0]);
+        const uhd::rx_streamer::buffs_type out_buffs(b + buffer_offset_bytes);
+
+        _converters[0]->conv(_in_buffs, out_buffs, num_samps);
+
+        for (size_t chan = 0; chan < get_num_channels(); chan++) {
+            // Advance the pointer for the source buffer
+            _in_buffs[chan] = reinterpret_cast<const char*>(_in_buffs[chan])
+                              + num_samps * _convert_info.bytes_per_otw_item;
+
+            if (_buff_samps_remaining == num_samps) {
+                _zero_copy_streamer.release_recv_buff(chan);
+            }
         }
     }
 
     //! Create converters and initialize _convert_info
-    void _setup_converters(const size_t num_ports, const uhd::stream_args_t stream_args)
+    void _setup_converters(const size_t num_ports,
+        const uhd::stream_args_t stream_args,
+        const std::string& otw_format_suffix)
     {
         // Note to code archaeologists: In the past, we had to also specify the
         // endianness here, but that is no longer necessary because we can make
         // the wire endianness match the host endianness.
         convert::id_type id;
-        id.input_format  = stream_args.otw_format + "_chdr";
+        id.input_format  = stream_args.otw_format + otw_format_suffix;
         id.num_inputs    = 1;
         id.output_format = stream_args.cpu_format;
         id.num_outputs   = 1;
@@ -397,9 +537,30 @@ private:
             info.otw_item_bit_width = info.bytes_per_otw_item * 8;
         }
 
+        auto ends_with = [](const std::string& s, const std::string v) {
+            return s.size() >= v.size()
+                   && s.compare(s.size() - v.size(), v.size(), v) == 0;
+        };
+
+        size_t num_converters = num_ports;
+        if (ends_with(stream_args.cpu_format, "_planar")) {
+            // I and Q go to separate buffers
+            _num_cpu_buffs_per_chan = 2;
+            id.num_outputs          = 2;
+            info.bytes_per_cpu_item /= 2;
+        } else if (ends_with(stream_args.cpu_format, "_chan_interleaved")) {
+            // A single converter writes the samples of all channels to one
+            // buffer
+            _chan_interleaved = true;
+            num_converters    = 1;
+            id.num_inputs     = num_ports;
+            info.bytes_per_cpu_item *= num_ports;
+        }
+        _out_buffs.resize(num_ports * _num_cpu_buffs_per_chan);
+
         _convert_info = info;
 
-        for (size_t i = 0; i < num_ports; i++) {
+        for (size_t i = 0; i < num_converters; i++) {
             _converters.push_back(convert::get_converter(id)());
             _converters.back()->set_scalar(1 / 32767.0);
         }
@@ -411,12 +572,41 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // Number of user buffers per channel, 2 for planar CPU formats
+    size_t _num_cpu_buffs_per_chan = 1;
+
+    // Whether the CPU format interleaves all channels into one buffer, which
+    // is converted by a single converter
+    bool _chan_interleaved = false;
+
+    // Scale factor of the single converter used with chan_interleaved CPU
+    // formats
+    double _chan_interleaved_scale_factor = 1 / 32767.0;
+
+    // Worker threads for converting channels in parallel, if enabled through
+    // the conv_threads stream arg
+    convert_thread_pool::uptr _convert_pool;
+
+    // Arguments of the current parallel conversion, read by _convert_fn
+    struct
+    {
+        const uhd::rx_streamer::buffs_type* buffs;
+        size_t offset;
+        size_t num_samps;
+    } _convert_job;
+
+    // Converts one channel of _convert_job
+    convert_thread_pool::work_fn_t _convert_fn;
+
     // Implementation of frame buffer management and packet info
     rx_streamer_zero_copy<transport_t, ignore_seq_err> _zero_copy_streamer;
 
     // Container for buffer pointers used in recv method
     std::vector<const void*> _in_buffs;
 
+    // User buffer pointers, offset to where the current packet is written
+    std::vector<void*> _out_buffs;
+
     // Sample rate used to calculate metadata time_spec_t
     double _samp_rate = 1.0;
 
@@ -12,6 +12,7 @@
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/get_aligned_buffs.hpp>
 #include <boost/format.hpp>
+#include <algorithm>
 #include <atomic>
 #include <vector>
 
@@ -132,18 +133,33 @@ public:
     void set_tick_rate(const double rate)
     {
         _tick_rate = rate;
+        _get_aligned_buffs.set_ticks_per_samp(_tick_rate / _samp_rate);
     }
 
     //! Configures sample rate for conversion of timestamp
     void set_samp_rate(const double rate)
     {
         _samp_rate = rate;
+        _get_aligned_buffs.set_ticks_per_samp(_tick_rate / _samp_rate);
     }
 
     //! Configures the size of each sample
     void set_bytes_per_item(const size_t bpi)
     {
         _bytes_per_item = bpi;
+        _get_aligned_buffs.set_bytes_per_item(bpi);
+    }
+
+    //! Enables filling the gaps of lost packets with zeros, see get_aligned_buffs
+    void set_zero_fill(const bool enable)
+    {
+        _get_aligned_buffs.set_zero_fill(enable);
+    }
+
+    //! Returns the channels which are zero-filled in the last set of buffers
+    const boost::dynamic_bitset<>& get_zero_filled_chans() const
+    {
+        return _get_aligned_buffs.get_zero_filled_chans();
     }
 
     //! Notifies the streamer that an overrun has occured
@@ -250,6 +266,19 @@ public:
             return 0;
         }
 
+        // Channels that lost packets read from a buffer of zeros. Their packets
+        // come later in time, so the metadata is set from another channel.
+        const auto& zero_filled = _get_aligned_buffs.get_zero_filled_chans();
+        size_t ref_chan         = 0;
+        if (zero_filled.any()) {
+            while (zero_filled.test(ref_chan)) {
+                ref_chan++;
+            }
+            if (_zero_buff.size() < _infos[ref_chan].payload_bytes) {
+                _zero_buff.resize(_infos[ref_chan].payload_bytes, 0);
+            }
+        }
+
         // Get payload pointers for each buffer and aggregate eob. We set eob to
         // true if any channel has it set, since no more data will be received for
         // that channel. In most cases, all channels should have the same value.
@@ -258,19 +287,26 @@ public:
         bool eob = false;
         bool eov = false;
         for (size_t i = 0; i < buffs.size(); i++) {
+            if (zero_filled.test(i)) {
+                buffs[i] = _zero_buff.data();
+                continue;
+            }
             buffs[i] = _infos[i].payload;
             eob |= _infos[i].eob;
             eov |= _infos[i].eov;
         }
 
-        // Set the metadata from the buffer information at index zero
-        const auto& info_0 = _infos[0];
+        // Set the metadata from the buffer information of the first channel
+        // with data
+        const auto& info_0 = _infos[ref_chan];
 
         metadata.has_time_spec  = info_0.has_tsf;
         metadata.time_spec      = time_spec_t::from_ticks(info_0.tsf, _tick_rate);
         metadata.start_of_burst = false;
         metadata.end_of_burst   = eob;
         metadata.error_code     = rx_metadata_t::ERROR_CODE_NONE;
+        // Zero-filled samples are reported as out of sequence without an error
+        metadata.out_of_sequence = zero_filled.any();
 
         // If the caller wants eov indications via metadata, then check
         // eov and set the metadata values appropriately. Note that only
@@ -297,6 +333,10 @@ public:
      */
     void release_recv_buff(const size_t channel)
     {
+        // The packet of a zero-filled channel is returned by a later call
+        if (_get_aligned_buffs.get_zero_filled_chans().test(channel)) {
+            return;
+        }
         _xports[channel]->release_recv_buff(std::move(_frame_buffs[channel]));
         _frame_buffs[channel] = typename transport_t::buff_t::uptr();
     }
@@ -325,6 +365,7 @@ private:
                 _xports[chan]->release_recv_buff(std::move(buff));
             }
         }
+        _get_aligned_buffs.reset();
 
         // Now call the overrun handler
         if (_overrun_handler) {
@@ -373,6 +414,9 @@ private:
     // Implementation of packet time alignment
     get_aligned_buffs_t _get_aligned_buffs;
 
+    // Samples of zero-filled channels
+    std::vector<uint8_t> _zero_buff;
+
     // Information about the last data packet processed
     last_read_time_info_t _last_read_time_info;
 
@@ -12,6 +12,7 @@
 #include <uhd/types/metadata.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/tasks.hpp>
+#include <uhdlib/transport/convert_thread_pool.hpp>
 #include <uhdlib/transport/tx_streamer_zero_copy.hpp>
 #include <algorithm>
 #include <limits>
@@ -103,18 +104,35 @@ template <typename transport_t>
 class tx_streamer_impl : public tx_streamer
 {
 public:
-    tx_streamer_impl(const size_t num_chans, const uhd::stream_args_t stream_args)
+    /*! Constructor
+     *
+     * The otw_format_suffix selects the converters, see rx_streamer_impl.
+     */
+    tx_streamer_impl(const size_t num_chans,
+        const uhd::stream_args_t stream_args,
+        const std::string& otw_format_suffix = "_chdr")
         : _zero_copy_streamer(num_chans)
         , _zero_buffs(num_chans, &_zero)
         , _out_buffs(num_chans)
         , _chans_connected(num_chans, false)
     {
-        _setup_converters(num_chans, stream_args);
+        _setup_converters(num_chans, stream_args, otw_format_suffix);
         _zero_copy_streamer.set_bytes_per_item(_convert_info.bytes_per_otw_item);
 
         if (stream_args.args.has_key("spp")) {
             _spp = stream_args.args.cast<size_t>("spp", _spp);
         }
+
+        _convert_pool = convert_thread_pool::make(stream_args.args, "uhd_tx_conv");
+        if (_convert_pool) {
+            _convert_fn = [this](const size_t chan) {
+                const void* input_ptr =
+                    static_cast<const uint8_t*>((*_convert_job.buffs)[chan])
+                    + _convert_job.offset;
+                _converters[chan]->conv(
+                    input_ptr, _out_buffs[chan], _convert_job.num_samps);
+            };
+        }
     }
 
     virtual void connect_channel(const size_t channel, typename transport_t::uptr xport)
@@ -396,6 +414,18 @@ private:
 
         size_t byte_offset = buffer_offset_in_samps * _convert_info.bytes_per_cpu_item;
 
+        if (_convert_pool) {
+            _convert_job = {&buffs, byte_offset, num_samples};
+            _convert_pool->run(get_num_channels(), _convert_fn);
+
+            // Buffers are released from this thread, since the transports of
+            // different channels may share an I/O service
+            for (size_t i = 0; i < get_num_channels(); i++) {
+                _zero_copy_streamer.release_send_buff(i);
+            }
+            return num_samples;
+        }
+
         for (size_t i = 0; i < get_num_channels(); i++) {
             const void* input_ptr = static_cast<const uint8_t*>(buffs[i]) + byte_offset;
             _converters[i]->conv(input_ptr, _out_buffs[i], num_samples);
@@ -407,7 +437,9 @@ private:
     }
 
     //! Create converters and initialize _bytes_per_cpu_item
-    void _setup_converters(const size_t num_chans, const uhd::stream_args_t stream_args)
+    void _setup_converters(const size_t num_chans,
+        const uhd::stream_args_t stream_args,
+        const std::string& otw_format_suffix)
     {
         // Note to code archaeologists: In the past, we had to also specify the
         // endianness here, but that is no longer necessary because we can make
@@ -415,7 +447,7 @@ private:
         convert::id_type id;
         id.input_format  = stream_args.cpu_format;
         id.num_inputs    = 1;
-        id.output_format = stream_args.otw_format + "_chdr";
+        id.output_format = stream_args.otw_format + otw_format_suffix;
         id.num_outputs   = 1;
 
         auto starts_with = [](const std::string& s, const std::string v) {
@@ -449,6 +481,21 @@ private:
     // Converters
     std::vector<uhd::convert::converter::sptr> _converters;
 
+    // Worker threads for converting channels in parallel, if enabled through
+    // the conv_threads stream arg
+    convert_thread_pool::uptr _convert_pool;
+
+    // Arguments of the current parallel conversion, read by _convert_fn
+    struct
+    {
+        const uhd::tx_streamer::buffs_type* buffs;
+        size_t offset;
+        size_t num_samps;
+    } _convert_job;
+
+    // Converts one channel of _convert_job
+    convert_thread_pool::work_fn_t _convert_fn;
+
     // Manages frame buffers and packet info
     tx_streamer_zero_copy<transport_t> _zero_copy_streamer;
 
@@ -19,6 +19,8 @@
 
 namespace uhd { namespace transport {
 
+class io_uring_recv_ring;
+
 class udp_boost_asio_frame_buff : public frame_buff
 {
 public:
@@ -26,6 +28,15 @@ public:
     {
         _data = mem;
     }
+
+    /*!
+     * Replace the memory this frame points to. Used by the batched receive
+     * path to hand out datagrams that were received into spare memory.
+     */
+    void set_data(void* mem)
+    {
+        _data = mem;
+    }
 };
 
 class udp_boost_asio_adapter_info : public adapter_info
@@ -62,6 +73,11 @@ public:
     /*!
      * Make a new udp link.
      *
+     * If params.recv_batch_size is larger than one (and the platform supports
+     * it), the link drains up to that many datagrams from the socket with a
+     * single recvmmsg() call, and hands them out on subsequent calls to
+     * get_recv_buff() without going back to the kernel.
+     *
      * \param addr a string representing the destination address
      * \param port a string representing the destination port
      * \param params Values for frame sizes, num frames, and buffer sizes
@@ -87,6 +103,28 @@ public:
      */
     std::string get_local_addr() const;
 
+    /*!
+     * Receive through an io_uring instead of recv() calls.
+     *
+     * The link keeps a read posted for every block of receive memory that is
+     * not attached to a frame, see io_uring_recv_ring. For that purpose, it
+     * allocates a second set of num_recv_frames blocks. Batched receives
+     * (params.recv_batch_size) are turned off, and datagrams that were
+     * received in a batch but not handed out yet are dropped.
+     *
+     * Does nothing if the link already receives through an io_uring.
+     *
+     * \throws uhd::not_implemented_error if UHD was built without io_uring
+     * \throws uhd::os_error if the kernel does not provide io_uring
+     */
+    void enable_io_uring();
+
+    /*!
+     * Go back to receiving with recv() calls. Datagrams that were received
+     * through the io_uring but not handed out yet are dropped.
+     */
+    void disable_io_uring();
+
     /*!
      * Get the physical adapter ID used for this link
      */
@@ -120,9 +158,40 @@ private:
     // Methods called by recv_link_base
     UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
     {
+        if (_recv_uring) {
+            return get_recv_buff_uring(
+                static_cast<udp_boost_asio_frame_buff&>(buff), timeout_ms);
+        }
+#ifdef UHD_PLATFORM_LINUX
+        if (_recv_batch_size > 1) {
+            return get_recv_buff_batched(
+                static_cast<udp_boost_asio_frame_buff&>(buff), timeout_ms);
+        }
+#endif
         return recv_udp_packet(_sock_fd, buff.data(), get_recv_frame_size(), timeout_ms);
     }
 
+#ifdef UHD_PLATFORM_LINUX
+    /*!
+     * Batched version of get_recv_buff_derived().
+     *
+     * The datagrams are received into the memory of the frame that was passed
+     * in, plus a set of spare memory blocks owned by the link. When more than
+     * one datagram is returned by the kernel, the extra datagrams are staged,
+     * and handed out by swapping the memory of the next frames with the staged
+     * blocks. This keeps the receive path zero-copy.
+     */
+    size_t get_recv_buff_batched(udp_boost_asio_frame_buff& buff, int32_t timeout_ms);
+#endif
+
+    /*!
+     * io_uring version of get_recv_buff_derived().
+     *
+     * Takes a completed block from the ring, and posts the memory of the frame
+     * that was passed in to the ring in its place.
+     */
+    size_t get_recv_buff_uring(udp_boost_asio_frame_buff& buff, int32_t timeout_ms);
+
     UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& /*buff*/)
     {
         // No-op
@@ -146,10 +215,39 @@ private:
     std::vector<udp_boost_asio_frame_buff> _recv_buffs;
     std::vector<udp_boost_asio_frame_buff> _send_buffs;
 
+    //! Max. number of datagrams received per recvmmsg() call
+    size_t _recv_batch_size;
+
+#ifdef UHD_PLATFORM_LINUX
+    //! A datagram which was received, but not yet handed out
+    struct staged_datagram_t
+    {
+        void* mem;
+        size_t len;
+    };
+
+    //! Extra memory for the batched receive path
+    buffer_pool::sptr _recv_batch_pool;
+    //! Spare memory blocks not holding any datagram
+    std::vector<void*> _recv_spare_mem;
+    //! Datagrams received in the last batch that have not been handed out yet
+    std::vector<staged_datagram_t> _recv_staged;
+    //! Index of the next staged datagram to hand out
+    size_t _recv_staged_idx = 0;
+    std::vector<mmsghdr> _recv_msgs;
+    std::vector<iovec> _recv_iovs;
+#endif
+
     boost::asio::io_context _io_context;
     std::shared_ptr<boost::asio::ip::udp::socket> _socket;
     int _sock_fd;
     adapter_id_t _adapter_id;
+
+    //! Extra memory for the io_uring receive path
+    buffer_pool::sptr _recv_uring_pool;
+    //! Set while receiving through an io_uring. Declared last, so it gets
+    // destroyed (and cancels its reads) before the memory and the socket.
+    std::shared_ptr<io_uring_recv_ring> _recv_uring;
 };
 
 }} // namespace uhd::transport
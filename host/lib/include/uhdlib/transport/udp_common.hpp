@@ -124,6 +124,56 @@ UHD_INLINE size_t recv_udp_packet(
     return 0; // timeout
 }
 
+#ifdef UHD_PLATFORM_LINUX
+/*!
+ * Receive up to num_msgs datagrams with a single recvmmsg() call.
+ *
+ * The caller owns the message headers and the buffers they point to. On
+ * return, the msg_len field of the first N message headers contains the
+ * length of the corresponding datagram.
+ *
+ * \param sock_fd the open socket file descriptor
+ * \param msgs array of message headers, one per buffer
+ * \param num_msgs the number of entries in msgs
+ * \param timeout_ms the timeout duration in milliseconds
+ * \return the number of datagrams received, or 0 on timeout
+ */
+UHD_INLINE size_t recv_udp_packets(
+    int sock_fd, mmsghdr* msgs, size_t num_msgs, int32_t timeout_ms)
+{
+    int ret = ::recvmmsg(
+        sock_fd, msgs, static_cast<unsigned int>(num_msgs), MSG_DONTWAIT, nullptr);
+    if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        throw uhd::io_error(
+            str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+    }
+
+    if (ret <= 0) {
+        if (!wait_for_recv_ready(sock_fd, timeout_ms)) {
+            return 0; // timeout
+        }
+        ret = ::recvmmsg(
+            sock_fd, msgs, static_cast<unsigned int>(num_msgs), MSG_DONTWAIT, nullptr);
+        if (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            // The socket was readable, but the datagram was discarded again
+            // (e.g., bad checksum). Treat it like a timeout.
+            return 0;
+        }
+        if (ret < 0) {
+            throw uhd::io_error(
+                str(boost::format("recvmmsg error on socket: %s") % strerror(errno)));
+        }
+    }
+
+    for (int i = 0; i < ret; i++) {
+        if (msgs[i].msg_len == 0) {
+            throw uhd::io_error("socket closed");
+        }
+    }
+    return static_cast<size_t>(ret);
+}
+#endif
+
 UHD_INLINE void send_udp_packet(int sock_fd, void* mem, size_t len)
 {
     // Retry logic because send may fail with ENOBUFS.
@@ -242,6 +292,8 @@ inline link_params_t calculate_udp_link_params(
         device_args.cast<size_t>("send_buff_size", default_link_params.send_buff_size);
     link_params.recv_buff_size =
         device_args.cast<size_t>("recv_buff_size", default_link_params.recv_buff_size);
+    link_params.recv_batch_size =
+        device_args.cast<size_t>("recv_batch_size", default_link_params.recv_batch_size);
 
     // Now apply stream-level overrides based on the link type.
     if (link_type == link_type_t::CTRL) {
@@ -268,6 +320,8 @@ inline link_params_t calculate_udp_link_params(
             link_args.cast<size_t>("num_recv_frames", link_params.num_recv_frames);
         link_params.recv_buff_size =
             link_args.cast<size_t>("recv_buff_size", link_params.recv_buff_size);
+        link_params.recv_batch_size =
+            link_args.cast<size_t>("recv_batch_size", link_params.recv_batch_size);
     }
 
 #if defined(UHD_PLATFORM_MACOS) || defined(UHD_PLATFORM_BSD)
@@ -33,7 +33,7 @@ public:
         const std::string& local_port,
         const link_params_t& params);
 
-    virtual ~udp_dpdk_link() = default;
+    virtual ~udp_dpdk_link();
 
     /*!
      * Make a new dpdk link. Get port ID from routing table.
@@ -257,7 +257,7 @@ private:
     adapter_id_t _adapter_id;
     //! The RX frame buff list head
     dpdk::dpdk_frame_buff* _recv_buff_head = nullptr;
-    // TODO: Implement ability to use multiple queues
+    //! The DMA queue which the local UDP port is steered to
     dpdk::queue_id_t _queue = 0;
 };
 
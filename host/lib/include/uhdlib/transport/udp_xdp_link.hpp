@@ -0,0 +1,168 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/types/device_addr.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <uhdlib/transport/links.hpp>
+#include <uhdlib/transport/xdp/xsk_port.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+/*!
+ * Frame buffer pointing into the UMEM of an xsk_port
+ */
+class udp_xdp_frame_buff : public frame_buff
+{
+public:
+    //! Marks a frame that has no UMEM chunk attached
+    static constexpr uint64_t NO_CHUNK = ~uint64_t(0);
+
+    void set_chunk(uint64_t addr, void* data)
+    {
+        _addr = addr;
+        _data = data;
+    }
+
+    uint64_t get_chunk() const
+    {
+        return _addr;
+    }
+
+private:
+    uint64_t _addr = NO_CHUNK;
+};
+
+class udp_xdp_adapter_info : public adapter_info
+{
+public:
+    udp_xdp_adapter_info(const std::string& port_name) : _port_name(port_name) {}
+
+    ~udp_xdp_adapter_info() {}
+
+    std::string to_string() override
+    {
+        return std::string("Ethernet(xdp):") + _port_name;
+    }
+
+private:
+    //! Interface and queue of the AF_XDP socket
+    std::string _port_name;
+};
+
+/*!
+ * A UDP link on top of an AF_XDP socket.
+ *
+ * Packets bypass the kernel network stack: the NIC driver writes them straight
+ * into a UMEM region shared with user space, and frame buffers point into that
+ * region. Unlike DPDK, the interface stays under control of the kernel, so no
+ * hugepages or driver rebinding are required. The XDP program only redirects
+ * UDP packets for the links' local ports, everything else on the queue
+ * (including ARP) still goes to the kernel. Packets only reach the link if
+ * they arrive on the queue it is bound to, so use flow steering to direct the
+ * device's traffic to a known queue, e.g.:
+ *
+ *     ethtool -N eth0 flow-type udp4 src-ip 192.168.10.2 action 4
+ *
+ * and pass xdp_queue=4 as a device argument.
+ *
+ * All links to the same (interface, queue) pair share one AF_XDP socket, see
+ * xdp::xsk_port.
+ */
+class udp_xdp_link : public recv_link_base<udp_xdp_link>,
+                     public send_link_base<udp_xdp_link>
+{
+public:
+    using sptr = std::shared_ptr<udp_xdp_link>;
+
+    ~udp_xdp_link();
+
+    /*!
+     * Make a new AF_XDP link.
+     *
+     * The following keys of link_args are used:
+     * - xdp_iface: Name of the network interface. By default, the interface
+     *   that the kernel routes the remote address through is used.
+     * - xdp_queue: The NIC queue to bind to (required)
+     * - xdp_num_frames: Number of UMEM chunks shared by all links on the same
+     *   interface and queue (default: xdp::DEFAULT_NUM_CHUNKS)
+     *
+     * Frame sizes are limited to xdp::MAX_PAYLOAD_SIZE, larger values in
+     * params are reduced.
+     *
+     * \param addr a string representing the destination address
+     * \param port a string representing the destination port
+     * \param params Values for frame sizes and num frames
+     * \param link_args Device arguments to configure the AF_XDP socket
+     */
+    static sptr make(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const uhd::device_addr_t& link_args);
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<udp_xdp_link>;
+    using send_link_base_t = send_link_base<udp_xdp_link>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    udp_xdp_link(const std::string& addr,
+        const std::string& port,
+        const link_params_t& params,
+        const uhd::device_addr_t& link_args);
+
+    // Methods called by recv_link_base
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms);
+    void release_recv_buff_derived(frame_buff& buff);
+
+    // Methods called by send_link_base
+    bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms);
+    void release_send_buff_derived(frame_buff& buff);
+
+    //! Write the Ethernet, IPv4 and UDP headers in front of a payload
+    void _write_headers(uint8_t* frame, size_t payload_size);
+
+    std::vector<udp_xdp_frame_buff> _recv_buffs;
+    std::vector<udp_xdp_frame_buff> _send_buffs;
+
+    xdp::xsk_port::sptr _port;
+    //! Kernel socket which reserves the local UDP port
+    int _kernel_sock = -1;
+    //! Local UDP port, in network order
+    uint16_t _local_port;
+    //! Remote UDP port, in network order
+    uint16_t _remote_port;
+    //! Remote IPv4 address, in network order
+    uint32_t _remote_ipv4;
+    uint8_t _remote_mac[6];
+    adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
@@ -0,0 +1,370 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/transport/frame_buff.hpp>
+#include <uhd/transport/vrt_if_packet.hpp>
+#include <uhd/types/endianness.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/transport/io_service.hpp>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace uhd { namespace transport {
+
+namespace detail {
+
+//! Size of the VRT header of data packets, they never use class ID or TSI
+constexpr size_t VRT_DATA_HDR_LEN = vrt::max_if_hdr_words32 * sizeof(uint32_t)
+                                    - sizeof(vrt::if_packet_info_t().cid)
+                                    - sizeof(vrt::if_packet_info_t().tsi);
+
+} // namespace detail
+
+/*!
+ * VRT receive data transport
+ *
+ * Unpacks VRT data packets received through an I/O service, for use with
+ * rx_streamer_impl. Inline message packets (e.g., overflow notifications) are
+ * passed to a handler and don't reach the streamer. The handler is called from
+ * get_recv_buff(), not from the I/O service.
+ *
+ * The transport claims all packets of the recv link, so the link must only
+ * carry this stream (e.g., a link on a demuxer proxy).
+ */
+class vrt_rx_data_xport
+{
+public:
+    using uptr                  = std::unique_ptr<vrt_rx_data_xport>;
+    using buff_t                = frame_buff;
+    using disconnect_callback_t = uhd::transport::disconnect_callback_t;
+
+    //! Handler for inline message packets, gets the error code of the message
+    using msg_handler_t = std::function<void(const rx_metadata_t::error_code_t)>;
+
+    //! Values extracted from received RX data packets
+    struct packet_info_t
+    {
+        bool eob             = false;
+        bool eov             = false;
+        bool has_tsf         = false;
+        uint64_t tsf         = 0;
+        size_t payload_bytes = 0;
+        const void* payload  = nullptr;
+    };
+
+    /*! Constructor
+     *
+     * \param io_srv The service that will schedule the xport I/O
+     * \param recv_link The recv link, already attached to the I/O service
+     * \param link_type Link layer of the packets
+     * \param endianness Endianness of the packet headers
+     * \param msg_handler Handler for inline message packets
+     * \param disconnect Callback function to disconnect the link
+     */
+    vrt_rx_data_xport(io_service::sptr io_srv,
+        recv_link_if::sptr recv_link,
+        const vrt::if_packet_info_t::link_type_t link_type,
+        const uhd::endianness_t endianness,
+        msg_handler_t msg_handler,
+        disconnect_callback_t disconnect)
+        : _mtu(recv_link->get_recv_frame_size())
+        , _link_type(link_type)
+        , _unpack(endianness == uhd::ENDIANNESS_BIG ? &vrt::if_hdr_unpack_be
+                                                    : &vrt::if_hdr_unpack_le)
+        , _seq_mask(link_type == vrt::if_packet_info_t::LINK_TYPE_NONE ? 0xf : 0xfff)
+        , _msg_handler(std::move(msg_handler))
+        , _disconnect(std::move(disconnect))
+    {
+        // Every packet on the link belongs to this stream
+        auto recv_cb = [](buff_t::uptr&, recv_link_if*, send_link_if*) { return true; };
+        // There is no flow control, just hand the buffer back to the link
+        auto fc_cb = [](buff_t::uptr buff, recv_link_if* link, send_link_if*) {
+            link->release_recv_buff(std::move(buff));
+        };
+        const size_t num_recv_frames = recv_link->get_num_recv_frames();
+        _recv_io                     = io_srv->make_recv_client(
+            recv_link, num_recv_frames, recv_cb, nullptr, 0, fc_cb);
+    }
+
+    ~vrt_rx_data_xport()
+    {
+        // Release recv_io before disconnecting the link from the I/O service
+        _recv_io.reset();
+        if (_disconnect) {
+            _disconnect();
+        }
+    }
+
+    /*! Gets an RX frame buffer containing a data packet
+     *
+     * Inline message packets are consumed and passed to the message handler.
+     * Packets that follow a message are only returned if they are already
+     * available, since a message usually means the stream has stopped.
+     *
+     * \param timeout_ms timeout in milliseconds
+     * \return RX data frame buffer, packet info, and whether a sequence error
+     *         occurred
+     */
+    std::tuple<buff_t::uptr, packet_info_t, bool> get_recv_buff(
+        const int32_t timeout_ms)
+    {
+        int32_t timeout = timeout_ms;
+        while (true) {
+            buff_t::uptr buff = _recv_io->get_recv_buff(timeout);
+            if (!buff) {
+                return std::make_tuple(buff_t::uptr(), packet_info_t(), false);
+            }
+
+            const uint32_t* vrt_hdr = static_cast<const uint32_t*>(buff->data());
+            vrt::if_packet_info_t ifpi;
+            ifpi.link_type          = _link_type;
+            ifpi.num_packet_words32 = buff->packet_size() / sizeof(uint32_t);
+            _unpack(vrt_hdr, ifpi);
+            const uint32_t* payload = vrt_hdr + ifpi.num_header_words32;
+
+            if (ifpi.packet_type != vrt::if_packet_info_t::PACKET_TYPE_DATA) {
+                // The first payload word holds the error code. We don't know
+                // its endianness, so mirror the bytes.
+                const uint32_t word0 =
+                    ifpi.num_payload_words32 ? payload[0] | uhd::byteswap(payload[0])
+                                             : 0;
+                // The stream restarts after a message, don't flag the gap in
+                // sequence numbers as an error
+                _seq_valid = false;
+                _recv_io->release_recv_buff(std::move(buff));
+                if (_msg_handler) {
+                    _msg_handler(rx_metadata_t::error_code_t(word0 & 0xff));
+                }
+                timeout = 0;
+                continue;
+            }
+
+            const bool seq_error = _seq_valid && ifpi.packet_count != _expected_seq;
+            _expected_seq        = (ifpi.packet_count + 1) & _seq_mask;
+            _seq_valid           = true;
+
+            packet_info_t info;
+            info.eob           = ifpi.eob;
+            info.has_tsf       = ifpi.has_tsf;
+            info.tsf           = ifpi.tsf;
+            info.payload_bytes = ifpi.num_payload_bytes;
+            info.payload       = payload;
+
+            return std::make_tuple(std::move(buff), info, seq_error);
+        }
+    }
+
+    /*! Releases an RX frame buffer
+     *
+     * \param buff the frame buffer to release
+     */
+    void release_recv_buff(buff_t::uptr buff)
+    {
+        _recv_io->release_recv_buff(std::move(buff));
+    }
+
+    /*! Don't check the sequence number of the next packet
+     *
+     * Call this after packets were flushed from the underlying link.
+     */
+    void resync()
+    {
+        _seq_valid = false;
+    }
+
+    //! Get the maximum size of a packet
+    size_t get_mtu() const
+    {
+        return _mtu;
+    }
+
+    //! Get the size of the packet header (the name matches the other transports)
+    size_t get_chdr_hdr_len() const
+    {
+        return detail::VRT_DATA_HDR_LEN;
+    }
+
+    //! Get the maximum payload size
+    size_t get_max_payload_size() const
+    {
+        return get_mtu() - detail::VRT_DATA_HDR_LEN;
+    }
+
+private:
+    using unpack_fn_t = void (*)(const uint32_t*, vrt::if_packet_info_t&);
+
+    const size_t _mtu;
+    const vrt::if_packet_info_t::link_type_t _link_type;
+    const unpack_fn_t _unpack;
+
+    // Sequence number checking
+    const size_t _seq_mask;
+    size_t _expected_seq = 0;
+    bool _seq_valid      = false;
+
+    msg_handler_t _msg_handler;
+
+    recv_io_if::sptr _recv_io;
+    disconnect_callback_t _disconnect;
+};
+
+/*!
+ * VRT transmit data transport
+ *
+ * Packs VRT data packets and sends them through an I/O service, for use with
+ * tx_streamer_impl. The transport does not do flow control, the send link is
+ * expected to apply back pressure.
+ */
+class vrt_tx_data_xport
+{
+public:
+    using uptr                  = std::unique_ptr<vrt_tx_data_xport>;
+    using buff_t                = frame_buff;
+    using disconnect_callback_t = uhd::transport::disconnect_callback_t;
+
+    //! Information about data packet
+    struct packet_info_t
+    {
+        bool eob             = false;
+        bool eov             = false;
+        bool has_tsf         = false;
+        uint64_t tsf         = 0;
+        size_t payload_bytes = 0;
+    };
+
+    /*! Constructor
+     *
+     * \param io_srv The service that will schedule the xport I/O
+     * \param send_link The send link, already attached to the I/O service
+     * \param sid The stream ID written to the packets
+     * \param link_type Link layer of the packets
+     * \param endianness Endianness of the packet headers
+     * \param disconnect Callback function to disconnect the link
+     */
+    vrt_tx_data_xport(io_service::sptr io_srv,
+        send_link_if::sptr send_link,
+        const uint32_t sid,
+        const vrt::if_packet_info_t::link_type_t link_type,
+        const uhd::endianness_t endianness,
+        disconnect_callback_t disconnect)
+        : _mtu(send_link->get_send_frame_size())
+        , _sid(sid)
+        , _link_type(link_type)
+        , _pack(endianness == uhd::ENDIANNESS_BIG ? &vrt::if_hdr_pack_be
+                                                  : &vrt::if_hdr_pack_le)
+        , _seq_mask(link_type == vrt::if_packet_info_t::LINK_TYPE_NONE ? 0xf : 0xfff)
+        , _disconnect(std::move(disconnect))
+    {
+        auto send_cb = [](buff_t::uptr buff, send_link_if* link) {
+            link->release_send_buff(std::move(buff));
+        };
+        const size_t num_send_frames = send_link->get_num_send_frames();
+        _send_io                     = io_srv->make_send_client(
+            send_link, num_send_frames, send_cb, nullptr, 0, nullptr, nullptr);
+    }
+
+    ~vrt_tx_data_xport()
+    {
+        // Release send_io before disconnecting the link from the I/O service
+        _send_io.reset();
+        if (_disconnect) {
+            _disconnect();
+        }
+    }
+
+    /*! Gets a TX frame buffer
+     *
+     * \param timeout_ms timeout in milliseconds
+     * \return the frame buffer, or nullptr if timeout occurs
+     */
+    buff_t::uptr get_send_buff(const int32_t timeout_ms)
+    {
+        return _send_io->get_send_buff(timeout_ms);
+    }
+
+    /*! Writes header into frame buffer and returns payload pointer
+     *
+     * \param buff Frame buffer to write header into
+     * \param info Information to include in the header
+     * \return A pointer to the payload data area and the packet size in bytes
+     */
+    std::pair<void*, size_t> write_packet_header(
+        buff_t::uptr& buff, const packet_info_t& info)
+    {
+        vrt::if_packet_info_t ifpi;
+        ifpi.link_type           = _link_type;
+        ifpi.packet_type         = vrt::if_packet_info_t::PACKET_TYPE_DATA;
+        ifpi.num_payload_bytes   = info.payload_bytes;
+        ifpi.num_payload_words32 = (info.payload_bytes + sizeof(uint32_t) - 1)
+                                   / sizeof(uint32_t);
+        ifpi.packet_count        = _seq_num;
+        ifpi.has_sid             = true;
+        ifpi.sid                 = _sid;
+        ifpi.has_cid             = false;
+        ifpi.has_tsi             = false;
+        ifpi.has_tsf             = info.has_tsf;
+        ifpi.tsf                 = info.tsf;
+        ifpi.sob                 = false;
+        ifpi.eob                 = info.eob;
+        ifpi.has_tlr             = false;
+
+        uint32_t* packet_buff = static_cast<uint32_t*>(buff->data());
+        _pack(packet_buff, ifpi);
+        _seq_num = (_seq_num + 1) & _seq_mask;
+
+        return std::make_pair(packet_buff + ifpi.num_header_words32,
+            ifpi.num_packet_words32 * sizeof(uint32_t));
+    }
+
+    /*! Sends a TX data packet
+     *
+     * \param buff the frame buffer containing the packet to send
+     */
+    void release_send_buff(buff_t::uptr buff)
+    {
+        _send_io->release_send_buff(std::move(buff));
+    }
+
+    //! Get the maximum size of a packet
+    size_t get_mtu() const
+    {
+        return _mtu;
+    }
+
+    //! Get the size of the packet header (the name matches the other transports)
+    size_t get_chdr_hdr_len() const
+    {
+        return detail::VRT_DATA_HDR_LEN;
+    }
+
+    //! Get the maximum payload size
+    size_t get_max_payload_size() const
+    {
+        return get_mtu() - detail::VRT_DATA_HDR_LEN;
+    }
+
+private:
+    using pack_fn_t = void (*)(uint32_t*, vrt::if_packet_info_t&);
+
+    const size_t _mtu;
+    const uint32_t _sid;
+    const vrt::if_packet_info_t::link_type_t _link_type;
+    const pack_fn_t _pack;
+
+    const size_t _seq_mask;
+    size_t _seq_num = 0;
+
+    send_io_if::sptr _send_io;
+    disconnect_callback_t _disconnect;
+};
+
+}} // namespace uhd::transport
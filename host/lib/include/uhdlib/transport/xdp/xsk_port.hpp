@@ -0,0 +1,247 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/utils/noncopyable.hpp>
+#include <uhdlib/transport/adapter_info.hpp>
+#include <linux/if_xdp.h>
+#include <sys/types.h>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace uhd { namespace transport { namespace xdp {
+
+/*! Size of a UMEM chunk. AF_XDP without multi-buffer support limits a packet
+ * to a single chunk, and a chunk to a single page.
+ */
+constexpr size_t CHUNK_SIZE = 4096;
+
+//! Bytes of Ethernet, IPv4 and UDP headers in front of the UDP payload
+constexpr size_t HDR_SIZE_UDP_IPV4 = 14 + 20 + 8;
+
+/*! Largest UDP payload that fits into a chunk (the kernel reserves
+ * XDP_PACKET_HEADROOM at the front of every RX chunk)
+ */
+constexpr size_t MAX_PAYLOAD_SIZE = CHUNK_SIZE - 256 - HDR_SIZE_UDP_IPV4;
+
+//! Default number of UMEM chunks per port
+constexpr size_t DEFAULT_NUM_CHUNKS = 4096;
+
+//! Number of NIC queues of an interface that AF_XDP sockets can be bound to
+constexpr uint32_t MAX_NUM_QUEUES = 64;
+
+/*!
+ * A received packet that belongs to one endpoint of an xsk_port
+ */
+struct rx_desc_t
+{
+    //! UMEM address of the chunk holding the packet
+    uint64_t addr;
+    //! Pointer to the UDP payload
+    uint8_t* payload;
+    //! Size of the UDP payload in bytes
+    size_t payload_size;
+};
+
+/*!
+ * Addressing information of the interface an xsk_port is bound to. All values
+ * are in network byte order.
+ */
+struct iface_info_t
+{
+    std::string name;
+    uint8_t mac_addr[6];
+    uint32_t ipv4_addr;
+};
+
+/*!
+ * User space side of one of the four rings of an AF_XDP socket
+ *
+ * The producer and consumer indices are shared with the kernel. The cached
+ * copies are only accessed by user space, with the xsk_port mutex held.
+ */
+struct xsk_ring_t
+{
+    uint32_t* producer   = nullptr;
+    uint32_t* consumer   = nullptr;
+    uint32_t* flags      = nullptr;
+    void* descs          = nullptr;
+    uint32_t size        = 0;
+    uint32_t cached_prod = 0;
+    uint32_t cached_cons = 0;
+    //! The mmap()ed region holding the ring
+    void* map       = nullptr;
+    size_t map_size = 0;
+};
+
+class xdp_filter;
+
+/*!
+ * An AF_XDP socket bound to one queue of one network interface.
+ *
+ * Only one AF_XDP socket can be bound to a (interface, queue) pair, but UHD
+ * opens many UDP links to the same device (control, plus one per stream), so
+ * they all share one xsk_port. Each link registers its local UDP port as an
+ * endpoint. Received packets are demultiplexed by UDP destination port into
+ * per-endpoint queues, so whichever link thread drains the RX ring delivers
+ * packets for all links.
+ *
+ * The XDP program on the interface only redirects IPv4 UDP packets for the
+ * registered ports into the socket. Everything else, including ARP, other
+ * UDP ports and TCP, is passed on to the kernel, so the queue can be shared
+ * with the rest of the host.
+ *
+ * The UMEM is split in two halves. The RX half cycles through the fill ring,
+ * the RX ring and the endpoint queues; the TX half cycles through a free list,
+ * the TX ring and the completion ring.
+ *
+ * All methods are thread-safe.
+ */
+class xsk_port : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<xsk_port>;
+
+    ~xsk_port();
+
+    /*!
+     * Get the port for the given interface and queue, creating it if needed.
+     *
+     * \param iface the interface the socket is bound to
+     * \param queue_id the NIC queue the socket is bound to
+     * \param num_chunks the number of UMEM chunks, if the port needs to be
+     *                   created
+     */
+    static sptr get(const iface_info_t& iface, uint32_t queue_id, size_t num_chunks);
+
+    //! Get a unique string identifying the interface and queue
+    std::string to_string() const;
+
+    //! Get information about the interface this port is bound to
+    const iface_info_t& get_iface() const
+    {
+        return _iface;
+    }
+
+    /*!
+     * Register an endpoint. Packets arriving for the UDP port from the given
+     * remote IPv4 address are queued for this endpoint from now on.
+     *
+     * An endpoint that does not keep up must not starve the others of RX
+     * chunks, so packets arriving while its queue is full are dropped.
+     *
+     * \param udp_port local UDP port, in network byte order
+     * \param remote_ipv4 remote IPv4 address, in network byte order
+     * \param max_queued maximum number of packets queued for the endpoint,
+     *                   usually its number of receive frames
+     */
+    void add_endpoint(uint16_t udp_port, uint32_t remote_ipv4, size_t max_queued);
+
+    /*!
+     * Unregister an endpoint, and recycle all packets queued for it.
+     *
+     * \param udp_port local UDP port, in network byte order
+     */
+    void remove_endpoint(uint16_t udp_port);
+
+    /*!
+     * Receive a packet for an endpoint.
+     *
+     * \param udp_port local UDP port of the endpoint, in network byte order
+     * \param desc on success, the descriptor of the received packet
+     * \param timeout_ms a positive timeout value specifies the maximum number
+     *                   of ms to wait, a negative value specifies to block
+     *                   until successful, and a value of 0 specifies no wait.
+     * \return true if a packet was received
+     */
+    bool recv(uint16_t udp_port, rx_desc_t& desc, int32_t timeout_ms);
+
+    //! Return a chunk received via recv() to the fill ring
+    void release_recv(uint64_t addr);
+
+    /*!
+     * Get a free TX chunk.
+     *
+     * \param addr on success, the UMEM address of the chunk
+     * \param timeout_ms same semantics as for recv()
+     * \return true if a chunk is available
+     */
+    bool get_send_chunk(uint64_t& addr, int32_t timeout_ms);
+
+    //! Queue a TX chunk for transmission. len is the full Ethernet frame size.
+    void send(uint64_t addr, size_t len);
+
+    //! Return a TX chunk obtained via get_send_chunk() without sending it
+    void release_send_chunk(uint64_t addr);
+
+    //! Get a pointer to the memory of a chunk
+    uint8_t* get_chunk_data(uint64_t addr) const
+    {
+        return static_cast<uint8_t*>(_umem_area) + addr;
+    }
+
+private:
+    xsk_port(const iface_info_t& iface, uint32_t queue_id, size_t num_chunks);
+
+    struct endpoint_t
+    {
+        uint32_t remote_ipv4;
+        size_t max_queued;
+        std::deque<rx_desc_t> queue;
+    };
+
+    //! Move all free RX chunks into the fill ring
+    void _refill_locked();
+    //! Pull packets off the RX ring and sort them into the endpoint queues
+    void _drain_rx_locked();
+    //! Move completed TX chunks back to the free list
+    void _reap_tx_locked();
+    //! Tell the kernel to process the TX ring, if it asked for it
+    void _kick_tx_locked();
+    void _send_locked(uint64_t addr, size_t len);
+    //! Map one of the rings of the socket
+    void _map_ring(xsk_ring_t& ring,
+        const xdp_ring_offset& offsets,
+        uint32_t size,
+        size_t desc_size,
+        off_t pgoff);
+    //! Bind the socket to the queue, in zero-copy mode if possible
+    void _bind(unsigned int ifindex);
+    //! Release the socket, its rings and the UMEM
+    void _close();
+
+    iface_info_t _iface;
+    uint32_t _queue_id;
+
+    void* _umem_area  = nullptr;
+    size_t _umem_size = 0;
+    int _fd           = -1;
+    xsk_ring_t _fill;
+    xsk_ring_t _comp;
+    xsk_ring_t _rx;
+    xsk_ring_t _tx;
+    //! The XDP program which redirects the endpoints' packets to the socket
+    std::shared_ptr<xdp_filter> _filter;
+
+    std::mutex _mutex;
+    //! Signaled whenever packets were sorted into endpoint queues
+    std::condition_variable _rx_cond;
+    //! True while one thread is blocked in poll() on behalf of all endpoints
+    bool _rx_poller_active = false;
+
+    std::vector<uint64_t> _free_rx_chunks;
+    std::vector<uint64_t> _free_tx_chunks;
+    std::unordered_map<uint16_t, endpoint_t> _endpoints;
+};
+
+}}} // namespace uhd::transport::xdp
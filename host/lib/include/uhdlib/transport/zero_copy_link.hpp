@@ -0,0 +1,219 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/transport/zero_copy.hpp>
+#include <uhdlib/transport/link_base.hpp>
+#include <memory>
+#include <vector>
+
+namespace uhd { namespace transport {
+
+namespace detail {
+
+/*!
+ * Frame buffer that holds a managed buffer of a zero_copy_if
+ */
+template <typename managed_buffer_t>
+class zero_copy_frame_buff : public frame_buff
+{
+public:
+    //! Take over a managed buffer, returns its size
+    size_t set(typename managed_buffer_t::sptr buff)
+    {
+        _data = buff->template cast<void*>();
+        _buff = std::move(buff);
+        return _buff->size();
+    }
+
+    //! Whether the frame holds a managed buffer
+    bool has_buff() const
+    {
+        return bool(_buff);
+    }
+
+    //! Give up the managed buffer
+    typename managed_buffer_t::sptr reset()
+    {
+        _data        = nullptr;
+        _packet_size = 0;
+        return std::move(_buff);
+    }
+
+private:
+    typename managed_buffer_t::sptr _buff;
+};
+
+} // namespace detail
+
+/*!
+ * Link on top of a zero_copy_if
+ *
+ * This lets devices whose transports only implement zero_copy_if (e.g., the
+ * USB transport of the B200) use the I/O services. A frame buffer holds a
+ * managed buffer of the transport while it is in use, so the packets are not
+ * copied. Releasing a receive frame releases its managed buffer, and releasing
+ * a send frame commits its managed buffer with the packet size of the frame.
+ *
+ * Several links may share one transport, e.g., one link per channel on a
+ * shared transport, so the links are not muxed. The transport must then be
+ * thread-safe, and the frames of the links should add up to the frames of the
+ * transport.
+ */
+class zero_copy_link : public recv_link_base<zero_copy_link>,
+                       public send_link_base<zero_copy_link>
+{
+public:
+    using sptr = std::shared_ptr<zero_copy_link>;
+
+    /*! Make a new link on top of a zero_copy_if
+     *
+     * \param xport The transport to receive and send packets on
+     * \param num_recv_frames The number of recv frames the link hands out at a
+     *                        time, at most the number of recv frames of xport
+     * \param num_send_frames The number of send frames the link hands out at a
+     *                        time, at most the number of send frames of xport
+     * \param adapter_id The adapter ID of the link
+     * \return a new link
+     */
+    static sptr make(zero_copy_if::sptr xport,
+        const size_t num_recv_frames,
+        const size_t num_send_frames,
+        const adapter_id_t adapter_id = NULL_ADAPTER_ID)
+    {
+        if (num_recv_frames > xport->get_num_recv_frames()
+            || num_send_frames > xport->get_num_send_frames()) {
+            throw uhd::value_error(
+                "zero_copy_link: more frames requested than the transport has");
+        }
+        return sptr(new zero_copy_link(
+            std::move(xport), num_recv_frames, num_send_frames, adapter_id));
+    }
+
+    /*!
+     * Release the managed buffers of frames that were released without
+     * sending. The transport can't take back a buffer without sending it, so
+     * they are sent with a length of zero instead of sending stale contents.
+     */
+    ~zero_copy_link() override
+    {
+        for (auto& frame : _send_frames) {
+            if (frame.has_buff()) {
+                frame.reset()->commit(0);
+            }
+        }
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_send_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+    /*!
+     * Get the physical adapter ID used for this link
+     */
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return _adapter_id;
+    }
+
+private:
+    using recv_link_base_t = recv_link_base<zero_copy_link>;
+    using send_link_base_t = send_link_base<zero_copy_link>;
+    using recv_frame_t     = detail::zero_copy_frame_buff<managed_recv_buffer>;
+    using send_frame_t     = detail::zero_copy_frame_buff<managed_send_buffer>;
+
+    // Friend declarations to allow base classes to call private methods
+    friend recv_link_base_t;
+    friend send_link_base_t;
+
+    //! Timeout of each attempt to get a buffer when blocking, in seconds
+    static constexpr double BLOCKING_TIMEOUT = 0.1;
+
+    zero_copy_link(zero_copy_if::sptr xport,
+        const size_t num_recv_frames,
+        const size_t num_send_frames,
+        const adapter_id_t adapter_id)
+        : recv_link_base_t(num_recv_frames, xport->get_recv_frame_size())
+        , send_link_base_t(num_send_frames, xport->get_send_frame_size())
+        , _xport(std::move(xport))
+        , _recv_frames(num_recv_frames)
+        , _send_frames(num_send_frames)
+        , _adapter_id(adapter_id)
+    {
+        for (auto& frame : _recv_frames) {
+            recv_link_base_t::preload_free_buff(&frame);
+        }
+        for (auto& frame : _send_frames) {
+            send_link_base_t::preload_free_buff(&frame);
+        }
+    }
+
+    //! Convert a link timeout to a transport timeout, which can't block
+    static double _get_timeout(const int32_t timeout_ms)
+    {
+        return timeout_ms < 0 ? BLOCKING_TIMEOUT : timeout_ms / 1000.0;
+    }
+
+    // Methods called by recv_link_base
+    UHD_FORCE_INLINE size_t get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+    {
+        managed_recv_buffer::sptr mrb;
+        do {
+            mrb = _xport->get_recv_buff(_get_timeout(timeout_ms));
+        } while (!mrb && timeout_ms < 0);
+
+        if (!mrb) {
+            return 0;
+        }
+        return static_cast<recv_frame_t&>(buff).set(std::move(mrb));
+    }
+
+    UHD_FORCE_INLINE void release_recv_buff_derived(frame_buff& buff)
+    {
+        static_cast<recv_frame_t&>(buff).reset();
+    }
+
+    // Methods called by send_link_base
+    UHD_FORCE_INLINE bool get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+    {
+        auto& frame = static_cast<send_frame_t&>(buff);
+        // A frame that was released without sending still holds its buffer
+        if (frame.has_buff()) {
+            return true;
+        }
+
+        managed_send_buffer::sptr msb;
+        do {
+            msb = _xport->get_send_buff(_get_timeout(timeout_ms));
+        } while (!msb && timeout_ms < 0);
+
+        if (!msb) {
+            return false;
+        }
+        frame.set(std::move(msb));
+        return true;
+    }
+
+    UHD_FORCE_INLINE void release_send_buff_derived(frame_buff& buff)
+    {
+        const size_t packet_size = buff.packet_size();
+        static_cast<send_frame_t&>(buff).reset()->commit(packet_size);
+    }
+
+    zero_copy_if::sptr _xport;
+    std::vector<recv_frame_t> _recv_frames;
+    std::vector<send_frame_t> _send_frames;
+    const adapter_id_t _adapter_id;
+};
+
+}} // namespace uhd::transport
@@ -48,13 +48,13 @@ UHD_INLINE void standard_async_msg_prints(const async_metadata_t& metadata)
     if (metadata.event_code
         & (async_metadata_t::EVENT_CODE_UNDERFLOW
             | async_metadata_t::EVENT_CODE_UNDERFLOW_IN_PACKET)) {
-        UHD_LOG_FASTPATH("U")
+        UHD_LOG_FASTPATH_EVENT('U', metadata.channel)
     } else if (metadata.event_code
                & (async_metadata_t::EVENT_CODE_SEQ_ERROR
                    | async_metadata_t::EVENT_CODE_SEQ_ERROR_IN_BURST)) {
-        UHD_LOG_FASTPATH("S")
+        UHD_LOG_FASTPATH_EVENT('S', metadata.channel)
     } else if (metadata.event_code & async_metadata_t::EVENT_CODE_TIME_ERROR) {
-        UHD_LOG_FASTPATH("L")
+        UHD_LOG_FASTPATH_EVENT('L', metadata.channel)
     }
 }
 
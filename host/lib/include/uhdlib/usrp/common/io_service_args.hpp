@@ -42,11 +42,21 @@ namespace uhd { namespace usrp {
  *                              thread. N indicates the thread instance, starting
  *                              with 0 and up to num_poll_offload_threads minus 1.
  *                              Only used if the I/O service is configured to poll.
+ * offload_queue_wait: how streamers and offload threads wait for buffers from
+ *                     each other. Set to "spin" to poll continuously, "yield"
+ *                     to poll and yield the CPU between polls, or "futex" to
+ *                     sleep until a buffer arrives (the default).
+ * recv_io_uring: set to "true" to receive on RX_DATA links through io_uring
+ *                (Linux only, kernel UDP links only). If recv_offload is also
+ *                set, the offload thread receives through io_uring. Polling
+ *                offload threads use io_uring for all links they serve.
  */
 struct io_service_args_t
 {
     enum wait_mode_t { POLL, BLOCK };
 
+    enum queue_wait_policy_t { SPIN, SPIN_YIELD, SPIN_FUTEX };
+
     //! Whether to offload streaming I/O to a worker thread
     bool recv_offload = false;
 
@@ -59,6 +69,9 @@ struct io_service_args_t
     //! Whether the offload thread should poll or block
     wait_mode_t send_offload_wait_mode = BLOCK;
 
+    //! How streamers and offload threads wait for buffers from each other
+    queue_wait_policy_t offload_queue_wait_policy = SPIN_FUTEX;
+
     //! Number of polling threads to use, if wait_mode is set to POLL
     size_t num_poll_offload_threads = 1;
 
@@ -70,6 +83,9 @@ struct io_service_args_t
 
     //! CPU affinity of offload threads, if wait_mode is set to POLL
     std::map<size_t, size_t> poll_offload_thread_cpu;
+
+    //! Whether to receive through io_uring
+    bool recv_io_uring = false;
 };
 
 /*! Reads I/O service args from provided dictionary
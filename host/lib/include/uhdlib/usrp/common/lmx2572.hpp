@@ -9,6 +9,8 @@
 #include <uhd/types/time_spec.hpp>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 //! Control interface for an LMX2572 synthesizer
 class lmx2572_iface
@@ -36,6 +38,15 @@ public:
     //! Sleep functor: sleep for the specified time
     using sleep_fn_t = std::function<void(const uhd::time_spec_t&)>;
 
+    //! Register state for one output frequency, see compute_frequency_image()
+    struct freq_image_t
+    {
+        //! The actual output frequency
+        double freq;
+        //! Register values, indexed by address
+        std::vector<uint16_t> regs;
+    };
+
     //! Factory
     //
     // \param write SPI write function object
@@ -46,6 +57,16 @@ public:
     //! Save state to chip
     virtual void commit() = 0;
 
+    //! Address / data pair of a register write, see commit_to_burst()
+    using reg_write_t = std::pair<uint8_t, uint16_t>;
+
+    //! Return the writes commit() would do instead of writing them
+    //
+    // The register cache is marked as saved, so the call site must write all
+    // of them, in order (R0 is last). This allows writing the registers of
+    // several chips in one burst.
+    virtual std::vector<reg_write_t> commit_to_burst() = 0;
+
     //! Get enabled status
     virtual bool get_enabled() = 0;
 
@@ -98,4 +119,33 @@ public:
     // \param spur_dodging Set to true to enable spur dodging
     virtual double set_frequency(
         const double target_freq, const double ref_freq, const bool spur_dodging) = 0;
+
+    //! Calculate the register state for an output frequency
+    //
+    // This does the same calculations as set_frequency(), but neither modifies
+    // the register cache nor accesses the device. The result can be applied
+    // later using set_frequency_image(), which skips all calculations.
+    //
+    // The image does not contain the power-down state and the output enables,
+    // set_frequency_image() keeps their current values. Like set_frequency(),
+    // it only sets the output mux and power of enabled outputs. All other
+    // settings that are not frequency-dependent (sync mode, etc.) are
+    // contained as they were at the time of this call. If any of those are
+    // changed, images need to be recalculated.
+    //
+    // \param target_freq The target frequency
+    // \param ref_freq The input reference frequency
+    // \param spur_dodging Set to true to enable spur dodging
+    // \returns the register image, and the frequency it will produce
+    virtual freq_image_t compute_frequency_image(
+        const double target_freq, const double ref_freq, const bool spur_dodging) = 0;
+
+    //! Load a register image from compute_frequency_image()
+    //
+    // Like set_frequency(), this only updates the register cache. When
+    // calling commit() afterwards, only those registers that differ from the
+    // current state are written.
+    //
+    // \returns the output frequency of this image
+    virtual double set_frequency_image(const freq_image_t& image) = 0;
 };
@@ -12,6 +12,8 @@
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhdlib/features/discoverable_feature_registry.hpp>
 #include <uhdlib/features/fpga_load_notification_iface.hpp>
+#include <uhdlib/features/time_model.hpp>
+#include <uhdlib/rfnoc/device_clock_model.hpp>
 #include <uhdlib/usrp/common/rpc.hpp>
 #include <uhdlib/utils/rpc.hpp>
 #include <map>
@@ -51,14 +53,17 @@ public:
      *************************************************************************/
     //! MPM-specific version of the timekeeper controls
     //
-    // MPM devices talk to MPM via RPC to control the timekeeper
+    // MPM devices talk to MPM via RPC to control the timekeeper. Reads of the
+    // current time are served by the clock model if it is accurate enough.
     class mpmd_timekeeper : public mb_controller::timekeeper
     {
     public:
         using sptr = std::shared_ptr<mpmd_timekeeper>;
 
-        mpmd_timekeeper(const size_t tk_idx, uhd::usrp::mpmd_rpc_iface::sptr rpc_client)
-            : _tk_idx(tk_idx), _rpc(rpc_client)
+        mpmd_timekeeper(const size_t tk_idx,
+            uhd::usrp::mpmd_rpc_iface::sptr rpc_client,
+            device_clock_model::sptr clock_model)
+            : _tk_idx(tk_idx), _rpc(rpc_client), _clock_model(clock_model)
         {
             // nop
         }
@@ -78,6 +83,7 @@ public:
     private:
         const size_t _tk_idx;
         uhd::usrp::mpmd_rpc_iface::sptr _rpc;
+        device_clock_model::sptr _clock_model;
     };
 
     /**************************************************************************
@@ -110,6 +116,8 @@ public:
         const std::string& bank, const std::vector<std::string>& src) override;
     void register_sync_source_updater(
         mb_controller::sync_source_updater_t callback_f) override;
+    std::vector<uhd::sensor_value_t> get_sensors(
+        const std::vector<std::string>& names) override;
 
 private:
     //! Helper for synchronize(): Dispatch the synchronize() RPC call
@@ -223,6 +231,7 @@ public:
     ref_clk_calibration::sptr _ref_clk_cal;
     trig_io_mode::sptr _trig_io_mode;
     gpio_power::sptr _gpio_power;
+    uhd::features::time_model::sptr _time_model;
 };
 
 }} // namespace uhd::rfnoc
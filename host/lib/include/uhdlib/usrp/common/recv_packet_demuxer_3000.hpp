@@ -8,19 +8,30 @@
 #pragma once
 
 #include <uhd/config.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/transport/vrt_if_packet.hpp>
 #include <uhd/transport/zero_copy.hpp>
 #include <uhd/types/time_spec.hpp>
 #include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
 #include <stdint.h>
+#include <boost/lockfree/queue.hpp>
+#include <array>
+#include <atomic>
 #include <chrono>
-#include <map>
 #include <memory>
-#include <mutex>
-#include <queue>
 
 namespace uhd { namespace usrp {
 
+/*!
+ * Demultiplexes the packets of a shared receive transport by SID
+ *
+ * Whichever caller pulls a packet for another SID from the transport hands it
+ * over to the owner of that SID through a per-SID ring. The rings are bounded
+ * lock-free queues of buffer pointers, sized to the number of receive frames
+ * of the transport, so the packet path neither locks nor allocates. SIDs are
+ * registered with realloc_sid() (or make_proxy()) before streaming.
+ */
 struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demuxer_3000>
 {
     typedef std::shared_ptr<recv_packet_demuxer_3000> sptr;
@@ -30,7 +41,18 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
     }
 
     recv_packet_demuxer_3000(transport::zero_copy_if::sptr xport) : _xport(xport)
-    { /*NOP*/
+    {
+        for (auto& slot : _slots) {
+            slot.sid = INVALID_SID;
+            slot.ring.reset(new ring_type_t(_xport->get_num_recv_frames()));
+        }
+    }
+
+    ~recv_packet_demuxer_3000(void)
+    {
+        for (auto& slot : _slots) {
+            _clear(slot);
+        }
     }
 
     transport::managed_recv_buffer::sptr get_recv_buff(
@@ -56,55 +78,117 @@ struct recv_packet_demuxer_3000 : std::enable_shared_from_this<recv_packet_demux
     transport::managed_recv_buffer::sptr _internal_get_recv_buff(
         const uint32_t sid, const double timeout)
     {
-        transport::managed_recv_buffer::sptr buff;
+        transport::managed_recv_buffer* raw_buff = nullptr;
 
         //----------------------------------------------------------
-        //-- Check the queue to see if we already have a buffer
+        //-- Check the ring to see if we already have a buffer
         //----------------------------------------------------------
-        {
-            std::lock_guard<std::mutex> l(mutex);
-            queue_type_t& queue = _queues[sid];
-            if (not queue.empty()) {
-                buff = queue.front();
-                queue.front().reset();
-                queue.pop();
-                return buff;
-            }
+        slot_t* slot = _find_slot(sid);
+        if (slot and slot->ring->pop(raw_buff)) {
+            // The ring holds the reference that was detached on push
+            return transport::managed_recv_buffer::sptr(raw_buff, false);
         }
-        {
-            buff = _xport->get_recv_buff(timeout);
-            if (buff) {
-                const uint32_t new_sid = uhd::wtohx(buff->cast<const uint32_t*>()[1]);
-                if (new_sid != sid) {
-                    std::lock_guard<std::mutex> l(mutex);
-                    if (_queues.count(new_sid) == 0)
-                        UHD_LOGGER_ERROR("STREAMER")
-                            << "recv packet demuxer unexpected sid 0x" << std::hex
-                            << new_sid << std::dec;
-                    else
-                        _queues[new_sid].push(buff);
-                    buff.reset();
+
+        transport::managed_recv_buffer::sptr buff = _xport->get_recv_buff(timeout);
+        if (buff) {
+            const uint32_t new_sid = uhd::wtohx(buff->cast<const uint32_t*>()[1]);
+            if (new_sid != sid) {
+                slot_t* new_slot = _find_slot(new_sid);
+                if (not new_slot) {
+                    UHD_LOGGER_ERROR("STREAMER")
+                        << "recv packet demuxer unexpected sid 0x" << std::hex
+                        << new_sid << std::dec;
+                } else if (new_slot->ring->bounded_push(buff.get())) {
+                    buff.detach();
+                } else {
+                    // Can only happen if the transport hands out more frames
+                    // than it claims. The owner sees a sequence error.
+                    _log_dropped(*buff, *new_slot);
                 }
+                buff.reset();
             }
         }
         return buff;
     }
 
+    //! Register the SID if necessary, and drop all of its queued packets
     void realloc_sid(const uint32_t sid)
     {
-        std::lock_guard<std::mutex> l(mutex);
-        while (not _queues[sid].empty()) // allocated and clears if already allocated
-        {
-            _queues[sid].pop();
+        slot_t* slot = _find_slot(sid);
+        if (not slot) {
+            for (auto& free_slot : _slots) {
+                uint32_t expected = INVALID_SID;
+                if (free_slot.sid.compare_exchange_strong(expected, sid)
+                    or expected == sid) {
+                    slot = &free_slot;
+                    break;
+                }
+            }
+        }
+        if (not slot) {
+            throw uhd::runtime_error(
+                "recv packet demuxer: too many SIDs on one transport");
         }
+        _clear(*slot);
     }
 
     transport::zero_copy_if::sptr make_proxy(const uint32_t sid);
 
-    typedef std::queue<transport::managed_recv_buffer::sptr> queue_type_t;
-    std::map<uint32_t, queue_type_t> _queues;
+private:
+    static constexpr uint32_t INVALID_SID = ~uint32_t(0);
+    static constexpr size_t MAX_NUM_SIDS  = 8;
+
+    using ring_type_t = boost::lockfree::queue<transport::managed_recv_buffer*,
+        boost::lockfree::fixed_sized<true>>;
+
+    struct slot_t
+    {
+        std::atomic<uint32_t> sid;
+        std::unique_ptr<ring_type_t> ring;
+    };
+
+    slot_t* _find_slot(const uint32_t sid)
+    {
+        for (auto& slot : _slots) {
+            if (slot.sid.load(std::memory_order_acquire) == sid) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    /*! Records a 'D' event for a packet that is dropped
+     *
+     * The channel of the event is the index of the slot of the SID, and the
+     * device time is the timestamp of the packet, if it has one.
+     */
+    void _log_dropped(const transport::managed_recv_buffer& buff, const slot_t& slot)
+    {
+        const size_t chan = static_cast<size_t>(&slot - _slots.data());
+        transport::vrt::if_packet_info_t info;
+        info.num_packet_words32 = buff.size() / sizeof(uint32_t);
+        try {
+            transport::vrt::if_hdr_unpack_le(buff.cast<const uint32_t*>(), info);
+        } catch (const uhd::exception&) {
+            info.has_tsf = false;
+        }
+        if (info.has_tsf) {
+            UHD_LOG_FASTPATH_EVENT('D', chan, info.tsf);
+        } else {
+            UHD_LOG_FASTPATH_EVENT('D', chan);
+        }
+    }
+
+    static void _clear(slot_t& slot)
+    {
+        transport::managed_recv_buffer* raw_buff = nullptr;
+        while (slot.ring->pop(raw_buff)) {
+            transport::managed_recv_buffer::sptr(raw_buff, false).reset();
+        }
+    }
+
     transport::zero_copy_if::sptr _xport;
-    std::mutex mutex;
+    std::array<slot_t, MAX_NUM_SIDS> _slots;
 };
 
 struct recv_packet_demuxer_proxy_3000 : transport::zero_copy_if
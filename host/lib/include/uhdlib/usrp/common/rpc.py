@@ -9,7 +9,7 @@ import sys
 from mako.template import Template
 
 class Function:
-    def __init__(self, return_type, function_name, args, no_claim=False):
+    def __init__(self, return_type, function_name, args, no_claim=False, batch=False):
         self.name = function_name
         self.does_return = return_type != "void"
         self.return_type = return_type
@@ -18,6 +18,16 @@ class Function:
         self.args = [" ".join(arg) for arg in args]
         self.has_rpcprefix = False
         self.no_claim = no_claim
+        # Batched calls take a vector of argument sets and pipeline the
+        # individual requests instead of waiting for each response in turn.
+        self.batch = batch and self.does_return
+        arg_types = [re.sub(r"^const\s+|\s*&$", "", arg[0]) for arg in args]
+        if len(args) == 1:
+            self.batch_arg_type = arg_types[0]
+            self.batch_arg_exprs = ["batch_arg"]
+        else:
+            self.batch_arg_type = f"std::tuple<{', '.join(arg_types)}>"
+            self.batch_arg_exprs = [f"std::get<{i}>(batch_arg)" for i in range(len(args))]
 
     def enable_rpcprefix(self):
         self.rpcname = f"_rpc_prefix + \"{self.name}\""
@@ -32,7 +42,7 @@ class Interface:
             for fn in self.functions:
                 fn.enable_rpcprefix()
 
-def fn_from_string(function_string, no_claim=False):
+def fn_from_string(function_string, no_claim=False, batch=False):
     m = re.match(r"^([a-zA-Z:<>,_0-9 ]+)\s+([a-zA-Z0-9_]+)\(([a-zA-Z0-9,_:&<> ]*)\)$", function_string)
     return_type = m.group(1)
     function_name = m.group(2)
@@ -40,15 +50,15 @@ def fn_from_string(function_string, no_claim=False):
     args = [arg.strip() for arg in args.split(",")]
     args = [arg.split(" ") for arg in args if len(arg) > 0]
     args = [(" ".join(arg[:-1]), arg[-1]) for arg in args]
-    return Function(return_type, function_name, args, no_claim)
+    return Function(return_type, function_name, args, no_claim, batch)
 
 IFACES = [
     Interface("mpmd_rpc", [
         fn_from_string("size_t get_num_timekeepers()"),
         fn_from_string("std::vector<std::string> get_mb_sensors()"),
-        fn_from_string("sensor_value_t::sensor_map_t get_mb_sensor(const std::string& sensor)"),
+        fn_from_string("sensor_value_t::sensor_map_t get_mb_sensor(const std::string& sensor)", batch=True),
         fn_from_string("std::vector<std::string> get_gpio_banks()"),
-        fn_from_string("std::vector<std::string> get_gpio_srcs(const std::string& bank)"),
+        fn_from_string("std::vector<std::string> get_gpio_srcs(const std::string& bank)", batch=True),
         fn_from_string("bool supports_feature(const std::string& feature)"),
         fn_from_string("void set_tick_period(size_t tick_index, uint64_t period_ns)"),
         fn_from_string("uint64_t get_timekeeper_time(size_t timekeeper_idx, bool last_pps)"),
@@ -109,8 +119,8 @@ IFACES = [
         fn_from_string("std::string dio_get_external_power_state(const std::string& port)"),
     ]),
     Interface("dboard_base_rpc", [
-        fn_from_string("std::vector<std::string> get_sensors(const std::string& trx)"),
-        fn_from_string("sensor_value_t::sensor_map_t get_sensor(const std::string& trx, const std::string& sensor, size_t chan)"),
+        fn_from_string("std::vector<std::string> get_sensors(const std::string& trx)", batch=True),
+        fn_from_string("sensor_value_t::sensor_map_t get_sensor(const std::string& trx, const std::string& sensor, size_t chan)", batch=True),
         fn_from_string("double get_master_clock_rate()")
     ], has_rpcprefix=True),
     Interface("zbx_rpc", [
@@ -140,8 +150,10 @@ COMMON_TMPL = """<% import time %>\
 #include <uhd/types/sensors.hpp>
 #include <uhdlib/utils/rpc.hpp>
 #include <stddef.h>
+#include <future>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace uhd { namespace usrp {
@@ -157,6 +169,21 @@ namespace uhd { namespace usrp {
             virtual ${function.return_type} ${function.name}(${",".join(function.args)}) = 0;
         %endfor
 
+        %for function in iface.functions:
+            %if function.batch:
+            //! Call ${function.name}() once per entry of batch_args
+            virtual std::vector<${function.return_type}> ${function.name}_batch(const std::vector<${function.batch_arg_type}>& batch_args)
+            {
+                std::vector<${function.return_type}> results;
+                results.reserve(batch_args.size());
+                for (const auto& batch_arg : batch_args) {
+                    results.push_back(${function.name}(${",".join(function.batch_arg_exprs)}));
+                }
+                return results;
+            }
+            %endif
+        %endfor
+
         // Deprecated
         virtual uhd::rpc_client::sptr get_raw_rpc_client() = 0;
     };
@@ -189,6 +216,31 @@ namespace uhd { namespace usrp {
             }
         %endfor
 
+        %for function in iface.functions:
+            %if function.batch:
+            std::vector<${function.return_type}> ${function.name}_batch(const std::vector<${function.batch_arg_type}>& batch_args) override
+            {
+                // Issue all requests first, then collect the responses
+                std::vector<std::future<${function.return_type}>> futures;
+                futures.reserve(batch_args.size());
+                for (const auto& batch_arg : batch_args) {
+                    %if function.no_claim:
+                    futures.push_back(_rpcc->request_async<${function.return_type}>
+                    %else:
+                    futures.push_back(_rpcc->request_async_with_token<${function.return_type}>
+                    %endif
+                        (${",".join([function.rpcname] + function.batch_arg_exprs)}));
+                }
+                std::vector<${function.return_type}> results;
+                results.reserve(batch_args.size());
+                for (auto& future : futures) {
+                    results.push_back(future.get());
+                }
+                return results;
+            }
+            %endif
+        %endfor
+
         // Deprecated
         uhd::rpc_client::sptr get_raw_rpc_client() override { return _rpcc; }
 
@@ -53,6 +53,14 @@ public:
     using peek_fn_type  = std::function<uint32_t(const uint32_t)>;
     using sleep_fn_type = std::function<void(const uhd::time_spec_t&)>;
 
+    //! One register write of an LO SPI burst, see lo_poke16_burst()
+    struct lo_spi_write_t
+    {
+        zbx_lo_t lo;
+        uint8_t addr;
+        uint16_t data;
+    };
+
     //! Maps a DSA name ("DSA1", "DSA2", etc.) to its equivalent dsa_type
     static const std::unordered_map<std::string, dsa_type> dsa_map;
 
@@ -321,6 +329,15 @@ public:
     // \param data The data to write to the LO register (see the LMX2572 datasheet)
     void lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint16_t data);
 
+    //! Write a burst of LO registers, which may go to several LOs
+    //
+    // Like lo_poke16(), consecutive SPI writes are throttled. The throttle
+    // after the last write is deferred until the next LO SPI transaction or
+    // LO SYNC pulse, so CPLD writes that follow the burst are not delayed.
+    //
+    // \param writes The register writes, in the order they are to be written
+    void lo_poke16_burst(const std::vector<lo_spi_write_t>& writes);
+
     //! Read back from the LO
     //
     // Note: The LMX2572 has a MUXout pin, not just an SDO pin. This means the
@@ -428,8 +445,9 @@ private:
      * Note: This has the ability to throttle the SPI transactions. The reason
      * is that the peek/poke interface from UHD to the CPLD is faster than the
      * SPI interface from the CPLD to the LO. If two SPI writes were to be
-     * sent without a throttle, the second one would clobber the first.  Never
-     * call this with throttle == false if another SPI transaction is following!
+     * sent without a throttle, the second one would clobber the first. With
+     * throttle == false, the wait is deferred to the start of the next SPI
+     * transaction or LO SYNC pulse.
      *
      * \param lo Which LO to address
      * \param addr 7-bit address of the LO's register
@@ -454,6 +472,9 @@ private:
     void write_register_vector(
         const std::string& reg_addr_name, const std::vector<uint32_t>& values);
 
+    //! Do the throttle a previous _lo_spi_transact() deferred, if any
+    void _finish_lo_spi_throttle();
+
     // Cached register state
     zbx_cpld_regs_t _regs = zbx_cpld_regs_t();
 
@@ -469,6 +490,9 @@ private:
     // Address offset (on top of _db_cpld_offset) where the LO SPI register is
     const uint32_t _lo_spi_offset;
 
+    // True if the last LO SPI transaction deferred its throttle
+    bool _lo_spi_throttle_pending = false;
+
     // infos about the daughtherboard revision
     std::string _db_rev_info;
 
@@ -340,6 +340,54 @@ private:
 
     freq_range_t _get_lo_freq_range(const std::string& name, const size_t chan) const;
 
+    //! Precalculate the LO settings for a list of RF frequencies
+    //
+    // Backs the tune_plan/freqs property: Tuning to any of these frequencies
+    // afterwards will skip the LO calculations and only write those LO
+    // registers that differ from the current state.
+    void _set_tune_plan_freqs(
+        const direction_t trx, const size_t chan, const std::vector<double>& freqs);
+
+    //! Retune to a planned RF frequency without resolving the expert graph
+    //
+    // Backs the tune_plan/hop property: Writes only those LO registers, CPLD
+    // switches and NCO settings that differ from the current state, as one
+    // burst at the current command time. The expert graph catches up on its
+    // next resolve.
+    //
+    // \throws uhd::key_error if freq is not one of the planned frequencies
+    void _hop_to_tune_plan(const direction_t trx, const size_t chan, const double freq);
+
+    //! Init the expert graph accessors used by _hop_to_tune_plan()
+    void _init_tune_plan_hop(uhd::experts::expert_container::sptr expert,
+        const uhd::direction_t trx,
+        const size_t chan_idx,
+        const fs_path fe_path);
+
+    //! Per-frontend state for tune plan hops
+    struct tune_plan_hop_state_t
+    {
+        //! The plans for the frequencies passed to _set_tune_plan_freqs()
+        std::map<double, zbx_tune_plan_t> plans;
+        //! Expert graph nodes which a hop updates or compares against
+        std::shared_ptr<uhd::experts::data_writer_t<double>> desired_freq;
+        std::shared_ptr<uhd::experts::data_writer_t<double>> coerced_freq;
+        std::shared_ptr<uhd::experts::data_reader_t<double>> desired_if2_freq;
+        std::shared_ptr<uhd::experts::data_reader_t<double>> coerced_if2_freq;
+        std::shared_ptr<uhd::experts::data_reader_t<bool>> band_inverted;
+        std::shared_ptr<uhd::experts::data_reader_t<double>> desired_gain;
+        std::shared_ptr<uhd::experts::data_reader_t<std::string>> gain_profile;
+        std::shared_ptr<uhd::experts::data_reader_t<std::string>> antenna;
+        //! NCO and IQ swap settings written by the last hop. They are valid
+        //  as long as the graph has not caught up (desired_freq is dirty).
+        double nco_desired_freq = 0.0;
+        double nco_coerced_freq = 0.0;
+        bool iq_swapped         = false;
+    };
+
+    //! Tune plan hop state, keyed by _get_frontend_path()
+    std::map<std::string, tune_plan_hop_state_t> _tune_plan_hops;
+
     /**************************************************************************
      * Private attributes
      *************************************************************************/
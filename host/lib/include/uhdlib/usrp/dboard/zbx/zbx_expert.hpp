@@ -43,6 +43,38 @@ uhd::freq_range_t _get_quantized_lo_range(const double lo_step_size)
 
 } // namespace
 
+//! Frontend settings for a single RF frequency, see calc_tune_plan()
+struct zbx_tune_plan_t
+{
+    zbx_tune_map_item_t tune_settings;
+    bool is_highband;
+    //! If false, lo1_freq is not valid
+    bool lo1_enabled;
+    double lo1_freq;
+    double lo2_freq;
+    double if2_freq;
+    bool band_inverted;
+};
+
+/*! Calculate LO, IF and filter settings for an RF frequency
+ *
+ * This is the calculation zbx_freq_fe_expert performs. It has no side effects,
+ * so it can also be used to plan frequencies ahead of time.
+ *
+ * \param trx Direction of the frontend
+ * \param chan Channel of the frontend (0 or 1)
+ * \param freq The desired RF frequency. It is clipped to the valid range.
+ * \param tune_table The tune map for this frontend
+ * \param lo_freq_range Valid (quantized) LO frequencies
+ * \param rfdc_rate The RFDC converter rate
+ */
+zbx_tune_plan_t calc_tune_plan(const uhd::direction_t trx,
+    const size_t chan,
+    const double freq,
+    const std::vector<zbx_tune_map_item_t>& tune_table,
+    const uhd::freq_range_t& lo_freq_range,
+    const double rfdc_rate);
+
 /*!---------------------------------------------------------
  * zbx_scheduling_expert
  *
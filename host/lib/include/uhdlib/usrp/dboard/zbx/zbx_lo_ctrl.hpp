@@ -10,6 +10,9 @@
 #include <uhd/types/direction.hpp>
 #include <uhdlib/usrp/common/lmx2572.hpp>
 #include <functional>
+#include <map>
+#include <optional>
+#include <vector>
 
 namespace uhd { namespace usrp { namespace zbx {
 
@@ -31,6 +34,19 @@ public:
     // Returns cached LO frequency value
     double get_lo_freq();
 
+    // Precalculate the LMX2572 register state for a list of LO frequencies.
+    // When set_lo_freq() is called with one of these frequencies, the PLL
+    // calculations are skipped and only those registers that differ from the
+    // current state are written. Replaces any previously planned frequencies.
+    void set_planned_lo_freqs(const std::vector<double>& freqs);
+
+    // Load the precalculated register image for a planned frequency and return
+    // the register writes needed to get there, instead of writing them. The
+    // caller must write all of them, in order. Returns no writes if the image
+    // for this frequency is already loaded.
+    // \throws uhd::key_error if freq was not planned
+    std::vector<lmx2572_iface::reg_write_t> get_tune_plan_writes(const double freq);
+
     // Spins up a timeout loop to wait for the PLL's to lock
     // \throws uhd::runtime_error on a failure to lock
     void wait_for_lo_lock();
@@ -62,6 +78,9 @@ private:
     // Returns the appropriate output port for given LO
     lmx2572_iface::output_t _get_output_port(bool test_port);
 
+    // Recalculate the register images for all planned frequencies
+    void _update_tune_plans();
+
     // String prefix for log messages
     const std::string _log_id;
 
@@ -79,6 +98,17 @@ private:
     // Set LO output mode, RF output mode is considered normal use case
     // Testing mode is for LMX V&V
     bool _testing_mode_enabled;
+
+    // Frequencies passed to set_planned_lo_freqs()
+    std::vector<double> _planned_freqs;
+
+    // Precalculated LMX register images, keyed by requested frequency
+    std::map<double, lmx2572_iface::freq_image_t> _tune_plans;
+
+    // Requested frequency of the planned image that is currently loaded, if
+    // any. Setting this frequency again is a no-op, so that an expert graph
+    // catching up after a tune plan hop won't retrigger the LO calibration.
+    std::optional<double> _plan_freq;
 };
 
 }}} // namespace uhd::usrp::zbx
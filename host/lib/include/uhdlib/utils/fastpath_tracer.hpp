@@ -0,0 +1,92 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#pragma once
+
+#include <uhd/utils/log.hpp>
+#include <boost/optional.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace uhd { namespace log {
+
+/*! Lock-free recorder for fastpath events
+ *
+ * Every thread that records events gets its own single-producer,
+ * single-consumer ring. Recording an event takes no locks, does not allocate,
+ * and makes no system calls (except for the first event of a thread, which
+ * allocates and registers its ring). If a ring is full, the event is dropped
+ * and counted.
+ *
+ * Draining the rings moves the events into a history of limited size, which
+ * can be read with read_events(). All methods except record() are serialized
+ * by a mutex.
+ */
+class fastpath_tracer
+{
+public:
+    //! Number of events per thread that can be recorded between two drains
+    static constexpr size_t RING_SIZE = 1024;
+
+    using drain_fn_t = std::function<void(const fastpath_event_t&)>;
+
+    /*!
+     * \param history_size Maximum number of drained events that are kept
+     *                     for read_events()
+     */
+    fastpath_tracer(const size_t history_size = 4096);
+    ~fastpath_tracer();
+
+    //! Record an event. Lock-free, may be called from any thread.
+    void record(const char code,
+        const uint32_t channel,
+        const boost::optional<uint64_t>& device_ticks = boost::none);
+
+    /*! Move the recorded events of all threads into the history
+     *
+     * \param fn Called for every drained event, in the order in which the
+     *           events were recorded
+     * \returns the number of drained events
+     */
+    size_t drain(const drain_fn_t& fn = drain_fn_t());
+
+    //! Drain, then return and clear the history
+    std::vector<fastpath_event_t> read_events();
+
+    //! Return the number of events recorded by all threads so far
+    fastpath_counters_t get_counters();
+
+private:
+    struct ring;
+    struct thread_rings;
+
+    //! Return the calling thread's ring, creating it if necessary
+    ring& _get_ring();
+    //! Allocate a ring for the calling thread and register it
+    std::shared_ptr<ring> _make_ring();
+
+    //! Unique ID of this tracer, to find this tracer's ring in thread_rings
+    const uint64_t _id;
+    const size_t _history_size;
+
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<ring>> _rings;
+    std::deque<fastpath_event_t> _history;
+    //! Events of the current drain, sorted before they are passed on
+    std::vector<fastpath_event_t> _batch;
+    uint32_t _next_thread_index = 0;
+    //! Counts of rings whose thread has exited
+    std::array<uint64_t, 256> _retired_num_events{};
+    uint64_t _retired_num_dropped = 0;
+};
+
+}} // namespace uhd::log
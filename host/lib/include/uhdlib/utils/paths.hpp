@@ -46,6 +46,18 @@ boost::filesystem::path get_xdg_data_home();
 // such path can be found, an empty string is returned.
 boost::filesystem::path get_xdg_config_home();
 
+//! Return a path to XDG_CACHE_HOME
+//
+// https://specifications.freedesktop.org/basedir-spec/basedir-spec-latest.html
+//
+// Even on non-Linux systems, this should return the place where non-essential
+// data can be stored, i.e., data that can be regenerated if it goes missing.
+//
+// There are valid scenarios when there is no such variable, e.g., when a process
+// is being spawned as a system process (there is no 'user' specified). If no
+// such path can be found, an empty string is returned.
+boost::filesystem::path get_xdg_cache_home();
+
 //! Return a path to ~/.uhd
 //
 // If no home directory can be found, an empty string is returned.
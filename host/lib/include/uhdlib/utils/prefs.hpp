@@ -92,6 +92,9 @@ uhd::device_addr_t get_dpdk_args(const uhd::device_addr_t& user_args);
  * dpdk-ipv4 = 192.168.40.1/24
  * dpdk-io-cpu = 1
  *
+ * Virtual devices can also be configured by their name:
+ * [dpdk_name=net_ring0]
+ *
  * \param user_args After getting the device args from the config
  *                  files, all of these key/value pairs will be applied
  *                  and will overwrite the settings from config files
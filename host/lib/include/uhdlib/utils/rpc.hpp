@@ -13,6 +13,7 @@
 #include <rpc/rpc_error.h>
 #include <boost/format.hpp>
 #include <chrono>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -264,6 +265,95 @@ public:
         notify(timeout_ms, func_name, _token, std::forward<Args>(args)...);
     };
 
+    /*! Issue an RPC request without waiting for the response.
+     *
+     * Thread safe (locked while the request is being issued). Unlike
+     * request(), this returns as soon as the request has been queued, so
+     * multiple independent requests can be in flight at the same time. The
+     * server still sees all requests in the order they were issued.
+     *
+     * The returned future is deferred: calling get() on it blocks until the
+     * response arrives or until \p timeout_ms (counted from the time of this
+     * call) expires. Errors are reported by get() the same way request()
+     * reports them. The future must not outlive this client.
+     *
+     * \param timeout_ms is time limit for this RPC call.
+     * \param func_name The function name that is called via RPC
+     * \param args All these arguments are passed to the RPC call
+     *
+     * \throws uhd::runtime_error (from the future's get()) in case of failure
+     */
+    template <typename return_type, typename... Args>
+    std::future<return_type> request_async(
+        uint64_t timeout_ms, std::string const& func_name, Args&&... args)
+    {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        std::future<RPCLIB_MSGPACK::object_handle> response;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            response = _client->async_call(func_name, std::forward<Args>(args)...);
+        }
+        return std::async(
+            std::launch::deferred,
+            [this, func_name, timeout_ms, deadline](
+                std::future<RPCLIB_MSGPACK::object_handle> response) {
+                if (response.wait_until(deadline) == std::future_status::timeout) {
+                    throw uhd::runtime_error(str(
+                        boost::format("Error during RPC call to `%s'. Error message: "
+                                      "Timeout of %d ms exceeded")
+                        % func_name % timeout_ms));
+                }
+                try {
+                    return response.get().template as<return_type>();
+                } catch (const ::rpc::rpc_error& ex) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    const std::string error = _get_last_error_safe();
+                    if (not error.empty()) {
+                        UHD_LOG_ERROR("RPC", error);
+                    }
+                    throw uhd::runtime_error(str(
+                        boost::format("Error during RPC call to `%s'. Error message: %s")
+                        % func_name % (error.empty() ? ex.what() : error)));
+                } catch (const std::bad_cast& ex) {
+                    throw uhd::runtime_error(str(
+                        boost::format("Error during RPC call to `%s'. Error message: %s")
+                        % func_name % ex.what()));
+                }
+            },
+            std::move(response));
+    };
+
+    /*! Like request_async(), but uses the default timeout.
+     */
+    template <typename return_type, typename... Args>
+    std::future<return_type> request_async(std::string const& func_name, Args&&... args)
+    {
+        return request_async<return_type>(
+            _default_timeout_ms, func_name, std::forward<Args>(args)...);
+    };
+
+    /*! Like request_async(), also provides a token.
+     */
+    template <typename return_type, typename... Args>
+    std::future<return_type> request_async_with_token(
+        std::string const& func_name, Args&&... args)
+    {
+        return request_async<return_type>(
+            _default_timeout_ms, func_name, _token, std::forward<Args>(args)...);
+    };
+
+    /*! Like request_async_with_token(), but it can be specified different timeout
+     * than default.
+     */
+    template <typename return_type, typename... Args>
+    std::future<return_type> request_async_with_token(
+        uint64_t timeout_ms, std::string const& func_name, Args&&... args)
+    {
+        return request_async<return_type>(
+            timeout_ms, func_name, _token, std::forward<Args>(args)...);
+    };
+
     /*! Sets the token value. This is used by the `_with_token` methods.
      */
     void set_token(const std::string& token)
@@ -41,6 +41,8 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
     disconnect_callback_t disconnect)
     : _fc_state(epids, fc_params.freq)
     , _mtu(recv_link->get_recv_frame_size())
+    , _chdr_w(pkt_factory.get_chdr_w())
+    , _endianness(pkt_factory.get_endianness())
     , _fc_sender(pkt_factory, epids)
     , _epid(epids.second)
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
@@ -50,12 +52,11 @@ chdr_rx_data_xport::chdr_rx_data_xport(uhd::transport::io_service::sptr io_srv,
         "Creating rx xport with local epid=" << epids.second
                                              << ", remote epid=" << epids.first);
 
-    _recv_packet    = pkt_factory.make_generic();
     _recv_packet_cb = pkt_factory.make_generic();
     _fc_sender.set_capacity(fc_params.buff_capacity);
 
     // Calculate header size
-    _hdr_len = _recv_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
+    _hdr_len = _recv_packet_cb->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     UHD_ASSERT_THROW(_hdr_len);
 
     // Make data transport
@@ -36,6 +36,8 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
     disconnect_callback_t disconnect)
     : _fc_state(fc_params.buff_capacity)
     , _mtu(send_link->get_send_frame_size())
+    , _chdr_w(pkt_factory.get_chdr_w())
+    , _endianness(pkt_factory.get_endianness())
     , _fc_sender(pkt_factory, epids)
     , _epid(epids.first)
     , _chdr_w_bytes(chdr_w_to_bits(pkt_factory.get_chdr_w()) / 8)
@@ -47,11 +49,10 @@ chdr_tx_data_xport::chdr_tx_data_xport(uhd::transport::io_service::sptr io_srv,
                                              << ", remote epid=" << epids.second);
 
     _send_header.set_dst_epid(epids.second);
-    _send_packet = pkt_factory.make_generic();
     _recv_packet = pkt_factory.make_generic();
 
     // Calculate header length
-    _hdr_len = _send_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
+    _hdr_len = _recv_packet->calculate_payload_offset(chdr::PKT_TYPE_DATA_WITH_TS);
     UHD_ASSERT_THROW(_hdr_len);
 
     // Now create the send I/O we will use for data
@@ -13,6 +13,8 @@
 #include <boost/optional.hpp>
 #include <chrono>
 #include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <set>
@@ -33,11 +35,15 @@ constexpr double DEFAULT_TIMEOUT = 1.0;
 constexpr double MASSIVE_TIMEOUT = 10.0;
 //! Default value for whether ACKs are always required
 constexpr bool DEFAULT_FORCE_ACKS = false;
+//! Max number of requests in flight. Sequence numbers are 6 bits wide, so this is
+// half the sequence number space, which lets us tell dropped responses from late ones.
+constexpr size_t MAX_OUTSTANDING_REQUESTS = 32;
 } // namespace
 
 ctrlport_endpoint::~ctrlport_endpoint() = default;
 
-class ctrlport_endpoint_impl : public ctrlport_endpoint
+class ctrlport_endpoint_impl : public ctrlport_endpoint,
+                               public std::enable_shared_from_this<ctrlport_endpoint_impl>
 {
 public:
     ctrlport_endpoint_impl(const send_fn_t& send_fcn,
@@ -64,15 +70,11 @@ public:
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
         bool ack                   = false) override
     {
-        for (auto it = _custom_register_spaces.begin();
-             it != _custom_register_spaces.end() && addr >= it->first;
-             ++it) {
-            if (addr >= it->first && addr < it->second.end_addr) {
-                UHD_LOG_TRACE("CTRLEP",
-                    "Poking custom register space at address 0x" << std::hex << addr);
-                it->second.poke_fn(addr, data);
-                return;
-            }
+        if (const custom_register_space* space = find_custom_register_space(addr)) {
+            UHD_LOG_TRACE("CTRLEP",
+                "Poking custom register space at address 0x" << std::hex << addr);
+            space->poke_fn(addr, data);
+            return;
         }
         // Send request and optionally wait for an ACK
         send_request_packet(OP_WRITE, addr, {data}, timestamp, ack);
@@ -86,12 +88,16 @@ public:
         if (addrs.size() != data.size()) {
             throw uhd::value_error("addrs and data vectors must be of the same length");
         }
+        // Send all requests before waiting for any ACK
+        std::vector<pending_ack> acks;
         for (size_t i = 0; i < data.size(); i++) {
-            poke32(addrs[i],
+            issue_poke32(addrs[i],
                 data[i],
                 (i == 0) ? timestamp : uhd::time_spec_t::ASAP,
-                (i == data.size() - 1) ? ack : false);
+                (i == data.size() - 1) ? ack : false,
+                acks);
         }
+        wait_for_acks(acks);
     }
 
     void block_poke32(uint32_t first_addr,
@@ -99,12 +105,16 @@ public:
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP,
         bool ack                   = false) override
     {
+        // Send all requests before waiting for any ACK
+        std::vector<pending_ack> acks;
         for (size_t i = 0; i < data.size(); i++) {
-            poke32(first_addr + (i * sizeof(uint32_t)),
+            issue_poke32(first_addr + (i * sizeof(uint32_t)),
                 data[i],
                 (i == 0) ? timestamp : uhd::time_spec_t::ASAP,
-                (i == data.size() - 1) ? ack : false);
+                (i == data.size() - 1) ? ack : false,
+                acks);
         }
+        wait_for_acks(acks);
 
         /* TODO: Uncomment when the atomic block poke is implemented in the FPGA
         // Send request and optionally want for an ACK
@@ -115,18 +125,13 @@ public:
     uint32_t peek32(
         uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
     {
-        for (auto it = _custom_register_spaces.begin();
-             it != _custom_register_spaces.end() && addr >= it->first;
-             ++it) {
-            if (addr >= it->first && addr < it->second.end_addr) {
-                UHD_LOG_TRACE("CTRLEP",
-                    "Peeking custom register space at address 0x" << std::hex << addr);
-                return it->second.peek_fn(addr);
-            }
+        if (const custom_register_space* space = find_custom_register_space(addr)) {
+            UHD_LOG_TRACE("CTRLEP",
+                "Peeking custom register space at address 0x" << std::hex << addr);
+            return space->peek_fn(addr);
         }
         // Send request and wait for an ACK
-        boost::optional<ctrl_payload> response;
-        std::tie(std::ignore, response) =
+        const boost::optional<ctrl_payload> response =
             send_request_packet(OP_READ, addr, {uint32_t(0)}, timestamp);
         UHD_ASSERT_THROW(bool(response));
         UHD_ASSERT_THROW(!response.get().data_vtr.empty());
@@ -137,11 +142,18 @@ public:
         size_t length,
         uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
     {
-        std::vector<uint32_t> values;
+        // Send all requests before waiting for any response
+        std::vector<std::future<uint32_t>> responses;
+        responses.reserve(length);
         for (size_t i = 0; i < length; i++) {
-            values.push_back(peek32(first_addr + (i * sizeof(uint32_t)),
+            responses.push_back(peek32_async(first_addr + (i * sizeof(uint32_t)),
                 (i == 0) ? timestamp : uhd::time_spec_t::ASAP));
         }
+        std::vector<uint32_t> values;
+        values.reserve(length);
+        for (auto& response : responses) {
+            values.push_back(response.get());
+        }
         return values;
 
         /* TODO: Uncomment when the atomic block peek is implemented in the FPGA
@@ -156,6 +168,35 @@ public:
         */
     }
 
+    std::future<uint32_t> peek32_async(
+        uint32_t addr, uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
+    {
+        if (const custom_register_space* space = find_custom_register_space(addr)) {
+            std::promise<uint32_t> value;
+            value.set_value(space->peek_fn(addr));
+            return value.get_future();
+        }
+        pending_ack ack = issue_request(OP_READ, addr, {uint32_t(0)}, timestamp, true);
+        return std::async(std::launch::deferred, [ack = std::move(ack)]() mutable {
+            return ack.wait().data_vtr[0];
+        });
+    }
+
+    std::future<void> poke32_async(uint32_t addr,
+        uint32_t data,
+        uhd::time_spec_t timestamp = uhd::time_spec_t::ASAP) override
+    {
+        if (const custom_register_space* space = find_custom_register_space(addr)) {
+            space->poke_fn(addr, data);
+            std::promise<void> done;
+            done.set_value();
+            return done.get_future();
+        }
+        pending_ack ack = issue_request(OP_WRITE, addr, {data}, timestamp, true);
+        return std::async(
+            std::launch::deferred, [ack = std::move(ack)]() mutable { ack.wait(); });
+    }
+
     void poll32(uint32_t addr,
         uint32_t data,
         uint32_t mask,
@@ -269,8 +310,10 @@ public:
             // Peek at the request queue to check the expected sequence number
             std::unique_lock<std::mutex> lock(_mutex);
             if (!_req_queue.empty()) {
-                int8_t seq_num_diff =
-                    int8_t(rx_ctrl.seq_num - _req_queue.front().seq_num);
+                // Sequence numbers are 6 bits wide, sign-extend their difference
+                const int8_t seq_num_diff =
+                    int8_t(uint8_t(rx_ctrl.seq_num - _req_queue.front().seq_num) << 2)
+                    >> 2;
                 if (seq_num_diff == 0) { // No sequence error
                     process_correct_response();
                 } else if (seq_num_diff > 0) { // Packet(s) dropped
@@ -394,6 +437,96 @@ private:
     //! The software status (different from the transaction status) of the response
     enum response_status_t { RESP_VALID, RESP_DROPPED, RESP_RTERR, RESP_SIZEERR };
 
+    //! The ACK for a request that was sent, but not waited for yet
+    //
+    // Keeps the endpoint alive, so that it can be waited for from a future.
+    // If it is destroyed without waiting, the ACK is discarded.
+    class pending_ack
+    {
+    public:
+        //! A request that does not require an ACK
+        pending_ack() = default;
+
+        pending_ack(
+            std::shared_ptr<ctrlport_endpoint_impl> endpoint, const ctrl_payload& request)
+            : _endpoint(std::move(endpoint)), _request(request)
+        {
+        }
+
+        pending_ack(pending_ack&& rhs) = default;
+        pending_ack& operator=(pending_ack&& rhs) = delete;
+
+        ~pending_ack()
+        {
+            if (_endpoint) {
+                std::unique_lock<std::mutex> lock(_endpoint->_mutex);
+                _endpoint->discard_ack(_request);
+            }
+        }
+
+        //! True if there is an ACK to wait for
+        explicit operator bool() const
+        {
+            return bool(_endpoint);
+        }
+
+        //! Waits for and returns the ACK. May only be called once.
+        const ctrl_payload wait()
+        {
+            auto endpoint = std::move(_endpoint);
+            std::unique_lock<std::mutex> lock(endpoint->_mutex);
+            try {
+                return endpoint->wait_for_ack(_request, lock);
+            } catch (const uhd::op_timeout&) {
+                // Don't let the ACK pile up if it arrives after all
+                endpoint->discard_ack(_request);
+                throw;
+            }
+        }
+
+    private:
+        std::shared_ptr<ctrlport_endpoint_impl> _endpoint;
+        ctrl_payload _request;
+    };
+
+    //! Returns the custom register space that contains addr, or nullptr
+    const custom_register_space* find_custom_register_space(uint32_t addr) const
+    {
+        for (auto it = _custom_register_spaces.begin();
+             it != _custom_register_spaces.end() && addr >= it->first;
+             ++it) {
+            if (addr >= it->first && addr < it->second.end_addr) {
+                return &it->second;
+            }
+        }
+        return nullptr;
+    }
+
+    //! Sends a write request, adding its ACK to acks if one is required
+    void issue_poke32(uint32_t addr,
+        uint32_t data,
+        const uhd::time_spec_t& timestamp,
+        bool ack,
+        std::vector<pending_ack>& acks)
+    {
+        if (const custom_register_space* space = find_custom_register_space(addr)) {
+            space->poke_fn(addr, data);
+            return;
+        }
+        pending_ack pending = issue_request(OP_WRITE, addr, {data}, timestamp, ack);
+        if (pending) {
+            acks.push_back(std::move(pending));
+        }
+    }
+
+    //! Waits for all ACKs in order. On error, the remaining ACKs are discarded.
+    static void wait_for_acks(std::vector<pending_ack>& acks)
+    {
+        for (auto& ack : acks) {
+            ack.wait();
+        }
+    }
+
     //! Returns the length of the control payload in 32-bit words
     inline static size_t get_payload_size(const ctrl_payload& payload)
     {
@@ -419,12 +552,27 @@ private:
 
     //! Sends a request control packet to a remote device, optionally waiting
     // for an ACK, and returns any response if applicable
-    const std::pair<ctrl_payload, boost::optional<ctrl_payload>> send_request_packet(
-        ctrl_opcode_t op_code,
+    const boost::optional<ctrl_payload> send_request_packet(ctrl_opcode_t op_code,
         uint32_t address,
         const std::vector<uint32_t>& data_vtr,
         const uhd::time_spec_t& time_spec,
         const bool require_ack = true)
+    {
+        pending_ack ack =
+            issue_request(op_code, address, data_vtr, time_spec, require_ack);
+        if (ack) {
+            return ack.wait();
+        }
+        return boost::none;
+    }
+
+    //! Sends a request control packet to a remote device without waiting for
+    // an ACK, and returns the pending ACK if one is required
+    pending_ack issue_request(ctrl_opcode_t op_code,
+        uint32_t address,
+        const std::vector<uint32_t>& data_vtr,
+        const uhd::time_spec_t& time_spec,
+        const bool require_ack)
     {
         if (!_client_clk.is_running()) {
             throw uhd::system_error("Ctrlport client clock is not running");
@@ -462,8 +610,9 @@ private:
             // Allocate room in the queue for one async response packet
             // If we can fit the current request in the queue then we can proceed
             return (_buff_occupied + pyld_size)
-                   <= (_buff_capacity
-                       - (ASYNC_MESSAGE_SIZE * _max_outstanding_async_msgs));
+                       <= (_buff_capacity
+                           - (ASYNC_MESSAGE_SIZE * _max_outstanding_async_msgs))
+                   && _req_queue.size() < MAX_OUTSTANDING_REQUESTS;
         };
         if (!buff_not_full()) {
             // If there is a timed command in the queue, use the
@@ -479,7 +628,8 @@ private:
         _buff_occupied += pyld_size;
         _req_queue.push_back(tx_ctrl);
 
-        if (require_ack || _policy.force_acks) {
+        const bool wants_ack = require_ack || _policy.force_acks;
+        if (wants_ack) {
             // If the client wants an ACK for this request, make note of its
             // details in a set. This set will be consulted when responses are
             // received.
@@ -491,13 +641,6 @@ private:
             // Send the payload as soon as there is room in the buffer
             _handle_send(tx_ctrl, _policy.timeout);
             _tx_seq_num = (_tx_seq_num + 1) % 64;
-
-            if (require_ack || _policy.force_acks) {
-                auto response = wait_for_ack(tx_ctrl, lock);
-                return {tx_ctrl, response};
-            } else {
-                return {tx_ctrl, {}};
-            }
         } catch (...) {
             // Something went wrong while trying to send the request.
             // Remove the entry from the ACK tracking set.
@@ -505,6 +648,23 @@ private:
             _wanted_acks.erase(ack_key);
             throw;
         }
+        return wants_ack ? pending_ack(shared_from_this(), tx_ctrl) : pending_ack();
+    }
+
+    //! Forgets about the ACK for the specified request, whether it was received
+    // already or not. Must be called with _mutex held.
+    void discard_ack(const ctrl_payload& request)
+    {
+        _wanted_acks.erase(
+            wanted_ack_key{request.seq_num, request.op_code, request.address});
+        for (auto it = _resp_queue.begin(); it != _resp_queue.end(); ++it) {
+            const ctrl_payload& rx_ctrl = std::get<0>(*it);
+            if (rx_ctrl.seq_num == request.seq_num && rx_ctrl.op_code == request.op_code
+                && rx_ctrl.address == request.address) {
+                _resp_queue.erase(it);
+                return;
+            }
+        }
     }
 
     //! Waits for and returns the ACK for the specified request
@@ -0,0 +1,252 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/utils/log.hpp>
+#include <uhdlib/rfnoc/device_clock_model.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace uhd::rfnoc;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr char LOG_ID[] = "CLOCK_MODEL";
+
+//! Time after setting the time at the next PPS for which observations are ignored
+//
+// The PPS edge may occur up to one second after the command has reached the
+// device; the rest is margin for the command latency.
+constexpr auto PPS_HOLD_OFF = 1500ms;
+
+//! The interval of tick rates is never narrowed down beyond this relative width
+//
+// This keeps the model robust against small changes of the frequency offset
+// between host and device clock (e.g., due to temperature).
+constexpr double MIN_REL_RATE_WIDTH = 2e-6;
+
+inline double to_secs(const device_clock_model::clock_t::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+//! Signed difference a - b of two tick counts
+inline double tick_diff(const uint64_t a, const uint64_t b)
+{
+    return static_cast<double>(static_cast<int64_t>(a - b));
+}
+
+} // namespace
+
+constexpr double device_clock_model::DEFAULT_MAX_FREQ_OFFSET;
+
+device_clock_model::device_clock_model(const double max_freq_offset)
+    : _max_freq_offset(max_freq_offset)
+{
+    // nop
+}
+
+void device_clock_model::set_tick_rate(const double tick_rate)
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    _tick_rate = tick_rate;
+    _reset(clock_t::time_point());
+}
+
+double device_clock_model::get_tick_rate() const
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    return _tick_rate;
+}
+
+void device_clock_model::set_tolerance(const double tolerance)
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    _tolerance = std::max(tolerance, 0.0);
+    _enabled   = _tolerance > 0.0;
+}
+
+double device_clock_model::get_tolerance() const
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    return _tolerance;
+}
+
+void device_clock_model::reset()
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    _reset(clock_t::time_point());
+}
+
+void device_clock_model::reset_at_next_pps()
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    _reset(clock_t::now() + PPS_HOLD_OFF);
+}
+
+uint64_t device_clock_model::get_ticks_now(const peek_fn_t& peek)
+{
+    uint64_t epoch;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_tolerance > 0.0) {
+            const auto estimate = _get_estimate(clock_t::now());
+            if (estimate && estimate->error <= _tolerance * _tick_rate) {
+                return estimate->ticks;
+            }
+        }
+        epoch = _epoch;
+    }
+
+    const auto t0      = clock_t::now();
+    const uint64_t now = peek();
+    const auto t1      = clock_t::now();
+
+    std::lock_guard<std::mutex> l(_mutex);
+    // If the model was reset while the read was in flight, we can't tell if
+    // the value predates the change of the device time
+    if (epoch == _epoch) {
+        _add_peek(now, t0, t1);
+    }
+    return now;
+}
+
+void device_clock_model::add_lower_bound(
+    const uint64_t ticks, const clock_t::time_point time)
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    if (!_valid || !_is_usable(time)) {
+        return;
+    }
+    const interval_t interval = _propagate(time);
+    const double bound        = tick_diff(ticks, _anchor_ticks);
+    if (bound > interval.hi) {
+        UHD_LOG_TRACE(LOG_ID, "Timestamp " << ticks << " exceeds model, invalidating");
+        _valid = false;
+        return;
+    }
+    if (bound <= interval.lo) {
+        return;
+    }
+    if (time >= _anchor_time) {
+        _anchor_time     = time;
+        _anchor_interval = {bound, interval.hi};
+    } else {
+        _anchor_interval.lo = std::max(
+            _anchor_interval.lo, bound + _rate_min * to_secs(_anchor_time - time));
+    }
+}
+
+boost::optional<device_clock_model::estimate_t> device_clock_model::get_estimate(
+    const clock_t::time_point time) const
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    return _get_estimate(time);
+}
+
+/******************************************************************************
+ * Private methods (must be called with _mutex held)
+ *****************************************************************************/
+void device_clock_model::_add_peek(
+    const uint64_t ticks, const clock_t::time_point t0, const clock_t::time_point t1)
+{
+    if (_tick_rate <= 0.0 || !_is_usable(t0)) {
+        return;
+    }
+    // The device sampled its tick count somewhere between t0 and t1, so at t1
+    // it is at least ticks, and at most ticks plus the round trip time.
+    const double rtt = to_secs(t1 - t0);
+    if (!_valid) {
+        _init(ticks, t1, _tick_rate * (1.0 + _max_freq_offset) * rtt);
+        return;
+    }
+    const double width = _rate_max * rtt;
+
+    // Narrow down the tick rate using the first read since the last reset
+    double rate_min      = _rate_min;
+    double rate_max      = _rate_max;
+    const double elapsed = to_secs(t1 - _ref_time);
+    if (elapsed > 0.0) {
+        const double delta     = tick_diff(ticks, _ref_ticks);
+        const double min_width = MIN_REL_RATE_WIDTH * _tick_rate;
+        rate_min               = std::max(rate_min, (delta - _ref_width) / elapsed);
+        rate_max               = std::min(rate_max, (delta + width) / elapsed);
+        if (rate_min <= rate_max && rate_max - rate_min < min_width) {
+            const double center = (rate_min + rate_max) / 2;
+            rate_min            = center - min_width / 2;
+            rate_max            = center + min_width / 2;
+        }
+    }
+
+    // Intersect the prediction with the measurement
+    interval_t interval   = _propagate(t1);
+    const double measured = tick_diff(ticks, _anchor_ticks);
+    interval.lo           = std::max(interval.lo, measured);
+    interval.hi           = std::min(interval.hi, measured + width);
+    if (rate_min > rate_max || interval.lo > interval.hi) {
+        // Either the device time was changed behind our back, or the frequency
+        // offset changed. Start over from this read.
+        UHD_LOG_DEBUG(LOG_ID, "Device time " << ticks << " contradicts model, resetting");
+        _init(ticks, t1, _tick_rate * (1.0 + _max_freq_offset) * rtt);
+        return;
+    }
+
+    _rate_min        = rate_min;
+    _rate_max        = rate_max;
+    _anchor_time     = t1;
+    _anchor_ticks    = ticks;
+    _anchor_interval = {interval.lo - measured, interval.hi - measured};
+}
+
+void device_clock_model::_init(
+    const uint64_t ticks, const clock_t::time_point time, const double width)
+{
+    _valid           = true;
+    _anchor_time     = time;
+    _anchor_ticks    = ticks;
+    _anchor_interval = {0.0, width};
+    _rate_min        = _tick_rate * (1.0 - _max_freq_offset);
+    _rate_max        = _tick_rate * (1.0 + _max_freq_offset);
+    _ref_time        = time;
+    _ref_ticks       = ticks;
+    _ref_width       = width;
+}
+
+void device_clock_model::_reset(const clock_t::time_point hold_off_until)
+{
+    _epoch++;
+    _valid          = false;
+    _hold_off_until = std::max(_hold_off_until, hold_off_until);
+}
+
+bool device_clock_model::_is_usable(const clock_t::time_point time) const
+{
+    return time >= _hold_off_until;
+}
+
+device_clock_model::interval_t device_clock_model::_propagate(
+    const clock_t::time_point time) const
+{
+    const double dt = to_secs(time - _anchor_time);
+    if (dt >= 0.0) {
+        return {_anchor_interval.lo + _rate_min * dt,
+            _anchor_interval.hi + _rate_max * dt};
+    }
+    return {_anchor_interval.lo + _rate_max * dt, _anchor_interval.hi + _rate_min * dt};
+}
+
+boost::optional<device_clock_model::estimate_t> device_clock_model::_get_estimate(
+    const clock_t::time_point time) const
+{
+    if (!_valid || !_is_usable(time)) {
+        return boost::none;
+    }
+    const interval_t interval = _propagate(time);
+    const auto offset =
+        static_cast<int64_t>(std::llround((interval.lo + interval.hi) / 2));
+    return estimate_t{
+        _anchor_ticks + static_cast<uint64_t>(offset), (interval.hi - interval.lo) / 2};
+}
@@ -12,6 +12,7 @@
 #include <boost/graph/filtered_graph.hpp>
 #include <boost/graph/topological_sort.hpp>
 #include <limits>
+#include <set>
 #include <utility>
 
 using namespace uhd::rfnoc;
@@ -167,6 +168,7 @@ void graph_t::connect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t edg
     auto edge_descriptor =
         boost::add_edge(src_vertex_desc, dst_vertex_desc, edge_info, _graph);
     UHD_ASSERT_THROW(edge_descriptor.second);
+    _topo_order_valid = false;
 
     // Now make sure we didn't add an unintended cycle
     try {
@@ -213,6 +215,7 @@ void graph_t::disconnect(node_ref_t src_node, node_ref_t dst_node, graph_edge_t
                 boost::get(edge_property_t(), this->_graph, edge_desc), false));
         },
         _graph);
+    _topo_order_valid = false;
 
     if (boost::degree(src_vertex_desc, _graph) == 0) {
         _remove_node(src_node);
@@ -379,10 +382,17 @@ void graph_t::resolve_all_properties(
         return;
     }
 
-    UHD_LOG_TRACE(LOG_ID, "Running forward edge property propagation...");
-    _resolve_all_properties(context, initial_node, true);
-    UHD_LOG_TRACE(LOG_ID, "Running backward edge property propagation...");
-    _resolve_all_properties(context, initial_node, false);
+    try {
+        UHD_LOG_TRACE(LOG_ID, "Running forward edge property propagation...");
+        _resolve_all_properties(context, initial_node, true);
+        UHD_LOG_TRACE(LOG_ID, "Running backward edge property propagation...");
+        _resolve_all_properties(context, initial_node, false);
+    } catch (...) {
+        // Nodes may have been left dirty, the next resolution has to find them
+        _dirty_nodes_unknown = true;
+        throw;
+    }
+    _dirty_nodes_unknown = false;
 }
 
 
@@ -392,47 +402,70 @@ void graph_t::_resolve_all_properties(resolve_context context,
 {
     node_accessor_t node_accessor{};
 
-    // First, find the node on which we'll start.
-    auto initial_dirty_nodes = _find_dirty_nodes();
-    if (initial_dirty_nodes.size() > 1) {
-        UHD_LOGGER_WARNING(LOG_ID)
-            << "Found " << initial_dirty_nodes.size()
-            << " dirty nodes in initial search (expected one or zero). "
-               "Property propagation may resolve this.";
+    // Get all nodes in topologically sorted order. The worklist stores the
+    // positions of the nodes that need resolving within that order.
+    const auto& topo_sorted_nodes = _get_topo_order();
+    const size_t initial_pos      = _topo_index.at(initial_node);
+    std::set<size_t> worklist{initial_pos};
+
+    // Usually, the initial node is the only dirty node. On commit, we visit
+    // all nodes, and if the previous resolution failed, we have to look for
+    // leftover dirty nodes.
+    if (context == resolve_context::INIT || _dirty_nodes_unknown) {
+        auto initial_dirty_nodes = _find_dirty_nodes();
+        if (initial_dirty_nodes.size() > 1) {
+            UHD_LOGGER_WARNING(LOG_ID)
+                << "Found " << initial_dirty_nodes.size()
+                << " dirty nodes in initial search (expected one or zero). "
+                   "Property propagation may resolve this.";
+            for (auto& vertex : initial_dirty_nodes) {
+                node_ref_t node = boost::get(vertex_property_t(), _graph, vertex);
+                UHD_LOG_WARNING(LOG_ID, "Dirty: " << node->get_unique_id());
+            }
+        }
         for (auto& vertex : initial_dirty_nodes) {
-            node_ref_t node = boost::get(vertex_property_t(), _graph, vertex);
-            UHD_LOG_WARNING(LOG_ID, "Dirty: " << node->get_unique_id());
+            worklist.insert(_topo_index.at(vertex));
+        }
+        if (context == resolve_context::INIT) {
+            for (size_t pos = 0; pos < topo_sorted_nodes.size(); pos++) {
+                worklist.insert(pos);
+            }
         }
     }
 
-    // Now get all nodes in topologically sorted order, and the appropriate
-    // iterators.
-    auto topo_sorted_nodes = _get_topo_sorted_nodes();
-    auto node_it           = topo_sorted_nodes.begin();
-    auto begin_it          = topo_sorted_nodes.begin();
-    auto end_it            = topo_sorted_nodes.end();
-    while (*node_it != initial_node) {
-        if (node_it == end_it) {
-            throw uhd::rfnoc_error("Cannot find node in graph!");
+    // Nodes on the worklist are visited in topological order, starting at the
+    // initial node. When there are no more nodes to visit in the current
+    // direction, we flip the direction. Resolving a node can make its
+    // neighbours dirty (this includes blocks creating new dynamic edge
+    // properties, which default to dirty), which then get added to the
+    // worklist. If the graph doesn't converge within MAX_NUM_ITERATIONS sweeps
+    // back and forth through all nodes, we give up.
+    constexpr size_t MAX_NUM_ITERATIONS = 2;
+    const size_t max_num_visits = MAX_NUM_ITERATIONS * 2 * topo_sorted_nodes.size();
+    size_t num_visits           = 0;
+    size_t node_pos             = initial_pos;
+    bool forward_dir            = true;
+    while (!worklist.empty() && num_visits < max_num_visits) {
+        // Figure out who's the next node
+        auto next_it = forward_dir ? worklist.lower_bound(node_pos)
+                                   : worklist.upper_bound(node_pos);
+        if (forward_dir && next_it == worklist.end()) {
+            forward_dir = false;
+            continue;
+        }
+        if (!forward_dir) {
+            if (next_it == worklist.begin()) {
+                forward_dir = true;
+                continue;
+            }
+            --next_it;
         }
-        // We know *node_it must be == initial_node at some point, because
-        // otherwise, initial_dirty_nodes would have been empty
-        node_it++;
-    }
-
-    // Start iterating over nodes
-    bool forward_dir   = true;
-    int num_iterations = 0;
-    // If all edge properties were known at the beginning, a single iteration
-    // would suffice. However, usually during the first time the property
-    // propagation is run, blocks create new (dynamic) edge properties that
-    // default to dirty. If we had a way of knowing when that happens, we could
-    // dynamically increase the number of iterations during the loop. For now,
-    // we simply hard-code the number of iterations to 2 so that we catch that
-    // case without any additional complications.
-    constexpr int MAX_NUM_ITERATIONS = 2;
-    while (true) {
-        node_ref_t current_node = boost::get(vertex_property_t(), _graph, *node_it);
+        node_pos = *next_it;
+        worklist.erase(next_it);
+        num_visits++;
+
+        const auto vertex       = topo_sorted_nodes.at(node_pos);
+        node_ref_t current_node = boost::get(vertex_property_t(), _graph, vertex);
         UHD_LOG_TRACE(
             LOG_ID, "Now resolving next node: " << current_node->get_unique_id());
 
@@ -448,61 +481,40 @@ void graph_t::_resolve_all_properties(resolve_context context,
         //  Forward all edge props in all directions from current node. We only
         //  forward properties across edges that either forward- or back-edges,
         //  depending on `forward`.
-        _forward_edge_props(*node_it, forward);
+        _forward_edge_props(vertex, forward);
 
         // Now mark all properties on this node as clean
         node_accessor.clean_props(current_node);
 
-        // If the property resolution was triggered by a node updating one of
-        // its properties, we can stop anytime there are no more dirty nodes.
-        if (context == resolve_context::NODE_PROP && _find_dirty_nodes().empty()) {
-            UHD_LOG_TRACE(LOG_ID,
-                "Terminating graph resolution early during iteration " << num_iterations);
-            break;
-        }
-
-        // The rest of the code in this loop is to figure out who's the next
-        // node. First, increment (or decrement) iterator:
-        if (forward_dir) {
-            node_it++;
-            // If we're at the end, flip the direction
-            if (node_it == end_it) {
-                forward_dir = false;
-                // Back off from the sentinel:
-                node_it--;
+        // Only the neighbours we forwarded properties to can have become dirty
+        auto add_if_dirty = [&](rfnoc_graph_t::edge_descriptor edge,
+                                rfnoc_graph_t::vertex_descriptor neighbour) {
+            if (boost::get(edge_property_t(), _graph, edge).is_forward_edge == forward
+                && !get_dirty_props(boost::get(vertex_property_t(), _graph, neighbour))
+                        .empty()) {
+                worklist.insert(_topo_index.at(neighbour));
             }
+        };
+        auto in_edge_range = boost::in_edges(vertex, _graph);
+        for (auto it = in_edge_range.first; it != in_edge_range.second; ++it) {
+            add_if_dirty(*it, boost::source(*it, _graph));
         }
-        if (!forward_dir) {
-            if (topo_sorted_nodes.size() > 1) {
-                node_it--;
-                // If we're back at the front, flip direction
-                if (node_it == begin_it) {
-                    forward_dir = true;
-                }
-            } else {
-                forward_dir = true;
-            }
-        }
-        // If we're going forward, and the next node is the initial node,
-        // we've gone full circle (one full iteration).
-        if (forward_dir && (*node_it == initial_node)) {
-            num_iterations++;
-            if (num_iterations == MAX_NUM_ITERATIONS || _find_dirty_nodes().empty()) {
-                UHD_LOG_TRACE(LOG_ID,
-                    "Terminating graph resolution after iteration " << num_iterations);
-                break;
-            }
+        auto out_edge_range = boost::out_edges(vertex, _graph);
+        for (auto it = out_edge_range.first; it != out_edge_range.second; ++it) {
+            add_if_dirty(*it, boost::target(*it, _graph));
         }
     }
+    UHD_LOG_TRACE(LOG_ID,
+        "Terminating graph resolution after visiting " << num_visits << " nodes");
 
     // Post-iteration sanity checks:
     // Make sure that there are no dirty properties left. If there are,
     // that means our algorithm couldn't converge and we have a problem.
-    auto remaining_dirty_nodes = _find_dirty_nodes();
-    if (!remaining_dirty_nodes.empty()) {
+    if (!worklist.empty()) {
         UHD_LOG_ERROR(LOG_ID, "The following properties could not be resolved:");
-        for (auto& vertex : remaining_dirty_nodes) {
-            node_ref_t node           = boost::get(vertex_property_t(), _graph, vertex);
+        for (const size_t pos : worklist) {
+            node_ref_t node =
+                boost::get(vertex_property_t(), _graph, topo_sorted_nodes.at(pos));
             const std::string node_id = node->get_unique_id();
             auto dirty_props          = get_dirty_props(node);
             for (auto& prop : dirty_props) {
@@ -644,6 +656,20 @@ graph_t::vertex_list_t graph_t::_get_topo_sorted_nodes()
     return sorted_nodes;
 }
 
+const std::vector<graph_t::rfnoc_graph_t::vertex_descriptor>& graph_t::_get_topo_order()
+{
+    if (!_topo_order_valid) {
+        const vertex_list_t sorted_nodes = _get_topo_sorted_nodes();
+        _topo_order.assign(sorted_nodes.begin(), sorted_nodes.end());
+        _topo_index.resize(_topo_order.size());
+        for (size_t pos = 0; pos < _topo_order.size(); pos++) {
+            _topo_index.at(_topo_order[pos]) = pos;
+        }
+        _topo_order_valid = true;
+    }
+    return _topo_order;
+}
+
 void graph_t::_add_node(node_ref_t new_node)
 {
     if (_node_map.count(new_node)) {
@@ -651,6 +677,7 @@ void graph_t::_add_node(node_ref_t new_node)
     }
 
     _node_map.emplace(new_node, boost::add_vertex(new_node, _graph));
+    _topo_order_valid = false;
 }
 
 void graph_t::_remove_node(node_ref_t node)
@@ -664,6 +691,7 @@ void graph_t::_remove_node(node_ref_t node)
         // Remove the vertex
         boost::remove_vertex(vertex_desc, _graph);
         _node_map.erase(node);
+        _topo_order_valid = false;
 
         // Removing the vertex changes the vertex descriptors,
         // so update the node map
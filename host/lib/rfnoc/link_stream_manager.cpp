@@ -9,8 +9,10 @@
 #include <uhdlib/rfnoc/chdr_ctrl_endpoint.hpp>
 #include <uhdlib/rfnoc/link_stream_manager.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
+#include <uhdlib/transport/adapter.hpp>
 #include <boost/format.hpp>
 #include <map>
+#include <string>
 
 using namespace uhd;
 using namespace uhd::rfnoc;
@@ -75,12 +77,23 @@ public:
 
         _my_adapter_id = _mb_iface.get_adapter_id(_my_device_id);
 
+        // Discovery results only hold for the same FPGA image, reached through
+        // the same transport adapter. The results are stored across sessions,
+        // so we identify the adapter by its name rather than by its ID.
+        const std::string fpga_sig = _mb_iface.get_fpga_signature();
+        const std::string adapter_name =
+            adapter_ctx::get().get_adapter_name(_my_adapter_id);
+        const std::string topo_cache_key =
+            (fpga_sig.empty() || adapter_name.empty()) ? ""
+                                                       : fpga_sig + "@" + adapter_name;
+
         // Create management portal using one of the child transports. This also
         // runs the topology discovery.
         _mgmt_portal = mgmt_portal::make(*_ctrl_xport,
             _pkt_factory,
             sep_addr_t(_my_device_id, SEP_INST_MGMT_CTRL),
-            _tgraph);
+            _tgraph,
+            topo_cache_key);
     }
 
     void add_unreachable_transport_adapters() override
@@ -287,3 +287,14 @@ void mb_controller::register_sync_source_updater(mb_controller::sync_source_upda
     throw uhd::not_implemented_error(
         "register_sync_source_updater() not supported on this motherboard!");
 }
+
+std::vector<uhd::sensor_value_t> mb_controller::get_sensors(
+    const std::vector<std::string>& names)
+{
+    std::vector<uhd::sensor_value_t> sensor_values;
+    sensor_values.reserve(names.size());
+    for (const auto& name : names) {
+        sensor_values.push_back(get_sensor(name));
+    }
+    return sensor_values;
+}
@@ -12,12 +12,17 @@
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <uhdlib/rfnoc/mgmt_portal.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
+#include <boost/optional.hpp>
+#include <algorithm>
 #include <chrono>
-#include <cmath>
+#include <fstream>
 #include <map>
 #include <mutex>
-#include <queue>
+#include <set>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -84,6 +89,148 @@ constexpr uint32_t STRM_STATUS_FC_ENABLED    = 0x80000000;
 constexpr uint32_t STRM_STATUS_SETUP_ERR     = 0x40000000;
 constexpr uint32_t STRM_STATUS_SETUP_PENDING = 0x20000000;
 
+// Timeout for a single management transaction
+constexpr double MGMT_XACT_TIMEOUT = 0.1;
+// Maximum number of management transactions we keep in flight at once
+constexpr size_t MAX_PENDING_MGMT_XACTS = 32;
+// Every transaction carries a tag in the payload of the NOP operation of its
+// return hop, which the nodes leave untouched. Op payloads are 48 bits wide.
+constexpr mgmt_op_t::payload_t MGMT_XACT_TAG_MASK = (uint64_t(1) << 48) - 1;
+// Stream status polling interval limits
+constexpr double MIN_STRM_STATUS_POLL_INTERVAL = 50e-6;
+constexpr double MAX_STRM_STATUS_POLL_INTERVAL = 1e-3;
+
+// The output ports taken from a software stream endpoint to get to a node
+using path_trail_t     = std::vector<topo_edge_t::port_t>;
+using path_trail_set_t = std::set<path_trail_t>;
+
+//! Storage of topology discovery results
+//
+// Probing a path that leads nowhere costs a full transaction timeout. When
+// the same device (with the same FPGA image) is opened again, also by another
+// process, we skip the paths that were empty the last time. A path only
+// counts as empty if neither the probe nor its retry got a response.
+//
+// The results are stored in a text file in the user's cache directory, with
+// one line per key: The key, a tab, and then the empty paths separated by
+// spaces. The ports of a path are separated by commas. The cache is best
+// effort: If the file can't be read or written, all paths get probed.
+class topo_cache_t
+{
+public:
+    path_trail_set_t get(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto entries = _read_file();
+        auto it            = entries.find(key);
+        return it == entries.end() ? path_trail_set_t() : it->second;
+    }
+
+    void set(const std::string& key, path_trail_set_t empty_paths)
+    {
+        if (key.find_first_of("\t\n") != std::string::npos) {
+            UHD_LOG_DEBUG(LOG_ID, "Not caching topology for invalid key: " << key);
+            return;
+        }
+        // Another process might update the file at the same time, in which case
+        // one of the updates gets lost. That only costs a slower discovery the
+        // next time.
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto entries = _read_file();
+        entries[key] = std::move(empty_paths);
+        _write_file(entries);
+    }
+
+private:
+    using entries_t = std::map<std::string, path_trail_set_t>;
+
+    static boost::filesystem::path _get_file_path()
+    {
+        const auto cache_home = uhd::get_xdg_cache_home();
+        return cache_home.empty() ? cache_home : cache_home / "uhd" / "topo_cache";
+    }
+
+    static entries_t _read_file()
+    {
+        entries_t entries;
+        const auto file_path = _get_file_path();
+        if (file_path.empty()) {
+            return entries;
+        }
+        std::ifstream file(file_path.string());
+        std::string line;
+        while (std::getline(file, line)) {
+            const size_t tab_pos = line.find('\t');
+            if (line.empty() || line[0] == '#' || tab_pos == std::string::npos) {
+                continue;
+            }
+            try {
+                path_trail_set_t empty_paths;
+                std::istringstream paths_stream(line.substr(tab_pos + 1));
+                std::string path_str;
+                while (paths_stream >> path_str) {
+                    path_trail_t trail;
+                    std::istringstream port_stream(path_str);
+                    std::string port_str;
+                    while (std::getline(port_stream, port_str, ',')) {
+                        trail.push_back(std::stoi(port_str));
+                    }
+                    empty_paths.insert(std::move(trail));
+                }
+                entries[line.substr(0, tab_pos)] = std::move(empty_paths);
+            } catch (const std::exception&) {
+                UHD_LOG_DEBUG(LOG_ID, "Ignoring invalid topology cache entry: " << line);
+            }
+        }
+        return entries;
+    }
+
+    static void _write_file(const entries_t& entries)
+    {
+        namespace fs         = boost::filesystem;
+        const auto file_path = _get_file_path();
+        if (file_path.empty()) {
+            return;
+        }
+        // Write to a temporary file first, so readers never see half a file
+        const auto tmp_path =
+            file_path.parent_path() / fs::unique_path("topo_cache-%%%%-%%%%");
+        try {
+            fs::create_directories(file_path.parent_path());
+            {
+                std::ofstream file(tmp_path.string());
+                file << "# RFNoC topology discovery cache, may be deleted at any time\n";
+                for (const auto& entry : entries) {
+                    file << entry.first << '\t';
+                    for (const auto& trail : entry.second) {
+                        for (size_t i = 0; i < trail.size(); i++) {
+                            file << (i == 0 ? "" : ",") << trail[i];
+                        }
+                        file << ' ';
+                    }
+                    file << '\n';
+                }
+                if (!file) {
+                    throw uhd::io_error("Error writing " + tmp_path.string());
+                }
+            }
+            fs::rename(tmp_path, file_path);
+        } catch (const std::exception& ex) {
+            UHD_LOG_DEBUG(LOG_ID, "Unable to store topology cache: " << ex.what());
+            boost::system::error_code ec;
+            fs::remove(tmp_path, ec);
+        }
+    }
+
+    std::mutex _mutex;
+};
+
+topo_cache_t& get_topo_cache()
+{
+    static topo_cache_t topo_cache;
+    return topo_cache;
+}
+
 } // namespace
 
 
@@ -99,7 +246,8 @@ public:
     mgmt_portal_impl(chdr_ctrl_xport& xport,
         const chdr::chdr_packet_factory& pkt_factory,
         sep_addr_t my_sep_addr,
-        topo_graph_t::sptr topo_graph)
+        topo_graph_t::sptr topo_graph,
+        const std::string& topo_cache_key)
         : _protover(pkt_factory.get_protover())
         , _chdr_w(pkt_factory.get_chdr_w())
         , _endianness(pkt_factory.get_endianness())
@@ -110,6 +258,7 @@ public:
         , _send_pkt(pkt_factory.make_mgmt())
         , _recv_pkt(pkt_factory.make_mgmt())
         , _tgraph(topo_graph)
+        , _topo_cache_key(topo_cache_key)
     {
         std::lock_guard<std::recursive_mutex> lock(_mutex);
         if (!_tgraph->add_node(_my_node_id)) {
@@ -628,150 +777,230 @@ public:
 
 private: // Functions
     // Discover all nodes that are reachable from this software stream endpoint
+    //
+    // This is a breadth-first traversal of the dataflow graph. All paths that
+    // are pending at a given depth are probed in a single pipelined batch of
+    // management transactions, followed by a second batch that initializes the
+    // newly found nodes. Paths that lead nowhere therefore only cost a single
+    // timeout per depth (plus one for the retry), rather than one timeout each.
     void _discover_topology(chdr_ctrl_xport& xport)
     {
         using port_t    = topo_edge_t::port_t;
         using node_type = topo_node_t::node_type;
-        // Initialize a queue of pending paths. We will use this for a breadth-first
-        // traversal of the dataflow graph. The queue consists of a previously discovered
-        // node and the next destination to take from that node.
-        std::queue<std::pair<topo_node_t, port_t>> pending_paths;
+        // A pending path consists of a previously discovered node and the next
+        // destination to take from that node. The trail is the list of output
+        // ports taken from this endpoint to get to the destination; it does not
+        // depend on device IDs, so we can use it to identify the path across
+        // sessions.
+        struct pending_path_t
+        {
+            topo_node_t node;
+            port_t port;
+            path_trail_t trail;
+        };
+        std::vector<pending_path_t> pending_paths;
         const auto my_epid = xport.get_epid();
 
-        // Add ourselves to the the pending queue to kick off the search
+        // Paths that were found to be empty the last time we discovered this
+        // topology. Probing them again would only cost us a timeout.
+        const path_trail_set_t known_empty_paths =
+            _topo_cache_key.empty() ? path_trail_set_t()
+                                    : get_topo_cache().get(_topo_cache_key);
+        path_trail_set_t empty_paths;
+
+        // Add ourselves to the pending paths to kick off the search
         UHD_LOG_DEBUG(
             LOG_ID, "Starting topology discovery from " << _my_node_id.to_string());
-        pending_paths.push({_my_node_id, port_t(-1)});
+        pending_paths.push_back({_my_node_id, port_t(-1), {port_t(-1)}});
 
         while (!pending_paths.empty()) {
-            // Pop the next path to discover from the pending queue
-            const auto next_path = pending_paths.front();
-            pending_paths.pop();
-            const auto& next_node = next_path.first;
-
-            // Build a management transaction to first get to our destination so that we
-            // can ask it to identify itself
-            mgmt_payload route_xact;
-            route_xact.set_header(my_epid, _protover, _chdr_w);
-            _traverse_to_node(route_xact, next_node, my_epid, next_path.second);
-
-            // Discover downstream node (we ask the node to identify itself)
-            mgmt_payload disc_req_xact(route_xact);
-            // Push a node discovery hop
-            mgmt_hop_t disc_hop;
-            disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
-            disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
-            disc_req_xact.add_hop(disc_hop);
-            UHD_LOG_TRACE(LOG_ID,
-                "Discovering next node upstream from "
-                    << next_node.to_string() << ", output port " << next_path.second
-                    << " using management transaction: " << disc_req_xact.to_string());
-
-            topo_node_t new_node;
-            try {
-                // Send the discovery transaction
-                const mgmt_payload disc_resp_xact =
-                    _send_recv_mgmt_transaction(xport, disc_req_xact);
-                new_node = _pop_node_discovery_hop(disc_resp_xact);
-            } catch (uhd::io_error& io_err) {
-                // We received an IO error. This could happen if we have a legitimate
-                // error or if there is no node to discover downstream. We can't tell for
-                // sure why but we can guess. If the next_path for this node is -1 then we
-                // expect something to be here, in which case we treat this as a
-                // legitimate error. In all other cases we assume that there was nothing
-                // to discover downstream.
-                if (next_path.second < 0) {
-                    UHD_LOG_ERROR(LOG_ID, io_err.what());
-                    throw io_err;
-                } else {
-                    // Move to the next pending path
+            // Build management transactions to first get to our destinations so
+            // that we can ask the downstream nodes to identify themselves
+            std::vector<mgmt_payload> route_xacts;
+            std::vector<mgmt_payload> disc_req_xacts;
+            std::vector<pending_path_t> probed_paths;
+            for (const auto& next_path : pending_paths) {
+                if (known_empty_paths.count(next_path.trail)) {
                     UHD_LOG_TRACE(LOG_ID,
-                        "Nothing connected on " << next_path.first.to_string() << "->"
-                                                << next_path.second
-                                                << ". Ignoring that path.");
+                        "Nothing was connected on " << next_path.node.to_string()
+                                                    << "->" << next_path.port
+                                                    << " last time. Skipping that path.");
+                    empty_paths.insert(next_path.trail);
                     continue;
                 }
+                mgmt_payload route_xact;
+                route_xact.set_header(my_epid, _protover, _chdr_w);
+                _traverse_to_node(route_xact, next_path.node, my_epid, next_path.port);
+
+                // Discover downstream node (we ask the node to identify itself)
+                mgmt_payload disc_req_xact(route_xact);
+                // Push a node discovery hop
+                mgmt_hop_t disc_hop;
+                disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_REQ));
+                disc_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_RETURN));
+                disc_req_xact.add_hop(disc_hop);
+                UHD_LOG_TRACE(LOG_ID,
+                    "Discovering next node upstream from "
+                        << next_path.node.to_string() << ", output port "
+                        << next_path.port << " using management transaction: "
+                        << disc_req_xact.to_string());
+
+                route_xacts.push_back(std::move(route_xact));
+                disc_req_xacts.push_back(std::move(disc_req_xact));
+                probed_paths.push_back(next_path);
             }
 
-            // We found a node!
-            // Identify destination port number. This only matters on a crossbar.
-            // Crossbars publish the port we're connected on in the 'inst' field.
-            // However, that means we need to manually count the instances of
-            // crossbars to uniquely identify them.
-            port_t dst_port = topo_edge_t::ANY_PORT;
-            if (new_node.type == node_type::XBAR) {
-                dst_port = new_node.inst;
-                // TODO: For now, we assume one xbar per device, so this is easy.
-                // If we want to allow multiple crossbars, we either need to add
-                // some identification, or we identify crossbars by the things
-                // they're connected to (e.g., only one crossbar can be attached
-                // to next_node on this very port).
-                new_node.inst = 0;
+            // Send all discovery transactions at once
+            auto disc_resp_xacts = _send_recv_mgmt_transactions(xport, disc_req_xacts);
+
+            // A lost packet looks just like a path that leads nowhere, and
+            // empty paths get cached. Probe the paths that did not respond once
+            // more before we consider them empty.
+            std::vector<size_t> retry_idxs;
+            std::vector<mgmt_payload> retry_xacts;
+            for (size_t i = 0; i < probed_paths.size(); i++) {
+                if (!disc_resp_xacts[i] && probed_paths[i].port >= 0) {
+                    retry_idxs.push_back(i);
+                    retry_xacts.push_back(disc_req_xacts[i]);
+                }
             }
-
-            topo_edge_t new_edge(next_node, new_node, next_path.second, dst_port);
-
-            // Because next_node was unknown before topo discovery started, we
-            // can safely add a route from next_node to new_node. That doesn't
-            // preclude that new_node was previously detected, so we check for that.
-            // If new_node was already in the graph, we can terminate the discovery
-            // on this path.
-            if (!_tgraph->add_biedge(next_node, new_node, new_edge)) {
-                UHD_LOG_DEBUG(LOG_ID,
-                    "Re-discovered node " << new_node.to_string() << ". Skipping it");
-                continue;
+            if (!retry_xacts.empty()) {
+                auto retry_resp_xacts = _send_recv_mgmt_transactions(xport, retry_xacts);
+                for (size_t j = 0; j < retry_idxs.size(); j++) {
+                    disc_resp_xacts[retry_idxs[j]] = std::move(retry_resp_xacts[j]);
+                }
             }
-            UHD_LOG_DEBUG(LOG_ID, "Discovered node " << new_node.to_string());
 
-            // Initialize the node (first time config)
-            mgmt_payload init_req_xact(route_xact);
-            _push_node_init_hop(init_req_xact, new_node, my_epid, new_edge.dst_port);
-            // Send the transaction and receive a response.
-            // We don't care about the contents of the response.
-            _send_recv_mgmt_transaction(xport, init_req_xact);
-            UHD_LOG_DEBUG(LOG_ID, "Initialized node " << new_node.to_string());
+            std::vector<mgmt_payload> init_req_xacts;
+            std::vector<topo_node_t> init_nodes;
+            std::vector<pending_path_t> new_paths;
+            for (size_t i = 0; i < probed_paths.size(); i++) {
+                const auto& next_path = probed_paths[i];
+                const auto& next_node = next_path.node;
+                if (!disc_resp_xacts[i]) {
+                    // We received no response. This could happen if we have a
+                    // legitimate error or if there is no node to discover
+                    // downstream. We can't tell for sure why but we can guess. If
+                    // the next_path for this node is -1 then we expect something
+                    // to be here, in which case we treat this as a legitimate
+                    // error. In all other cases we assume that there was nothing
+                    // to discover downstream.
+                    if (next_path.port < 0) {
+                        const std::string err_msg =
+                            "Timed out getting recv buff for management transaction";
+                        UHD_LOG_ERROR(LOG_ID, err_msg);
+                        throw uhd::io_error(err_msg);
+                    }
+                    UHD_LOG_TRACE(LOG_ID,
+                        "Nothing connected on " << next_node.to_string() << "->"
+                                                << next_path.port
+                                                << ". Ignoring that path.");
+                    empty_paths.insert(next_path.trail);
+                    continue;
+                }
+                topo_node_t new_node = _pop_node_discovery_hop(*disc_resp_xacts[i]);
+
+                // We found a node!
+                // Identify destination port number. This only matters on a crossbar.
+                // Crossbars publish the port we're connected on in the 'inst' field.
+                // However, that means we need to manually count the instances of
+                // crossbars to uniquely identify them.
+                port_t dst_port = topo_edge_t::ANY_PORT;
+                if (new_node.type == node_type::XBAR) {
+                    dst_port = new_node.inst;
+                    // TODO: For now, we assume one xbar per device, so this is easy.
+                    // If we want to allow multiple crossbars, we either need to add
+                    // some identification, or we identify crossbars by the things
+                    // they're connected to (e.g., only one crossbar can be attached
+                    // to next_node on this very port).
+                    new_node.inst = 0;
+                }
 
-            // If the new node is a stream endpoint then we are done traversing this
-            // path. If not, then check all ports downstream of the new node and add
-            // them to pending_paths for further traversal
-            switch (new_node.type) {
-                case node_type::XBAR: {
-                    // Total ports on this crossbar
-                    const size_t nports =
-                        static_cast<size_t>(new_node.extended_info & 0xFF);
-                    // Total transport ports on this crossbar (the first nports_xport
-                    // ports are transport ports)
-                    const size_t nports_xport =
-                        static_cast<size_t>((new_node.extended_info >> 8) & 0xFF);
-                    // When we allow daisy chaining, we need to recursively check
-                    // other transports
-                    const size_t start_port = ALLOW_DAISY_CHAINING ? 0 : nports_xport;
-                    for (size_t i = start_port; i < nports; i++) {
-                        // Skip the input port
-                        if (i != static_cast<size_t>(dst_port)) {
-                            pending_paths.push(
-                                std::make_pair(new_node, static_cast<port_t>(i)));
+                topo_edge_t new_edge(next_node, new_node, next_path.port, dst_port);
+
+                // Because next_node was unknown before topo discovery started, we
+                // can safely add a route from next_node to new_node. That doesn't
+                // preclude that new_node was previously detected, so we check for
+                // that. If new_node was already in the graph, we can terminate the
+                // discovery on this path.
+                if (!_tgraph->add_biedge(next_node, new_node, new_edge)) {
+                    UHD_LOG_DEBUG(LOG_ID,
+                        "Re-discovered node " << new_node.to_string() << ". Skipping it");
+                    continue;
+                }
+                UHD_LOG_DEBUG(LOG_ID, "Discovered node " << new_node.to_string());
+
+                // Initialize the node (first time config)
+                mgmt_payload init_req_xact(route_xacts[i]);
+                _push_node_init_hop(init_req_xact, new_node, my_epid, new_edge.dst_port);
+                init_req_xacts.push_back(std::move(init_req_xact));
+                init_nodes.push_back(new_node);
+
+                // If the new node is a stream endpoint then we are done traversing
+                // this path. If not, then check all ports downstream of the new node
+                // and add them to the pending paths for further traversal
+                switch (new_node.type) {
+                    case node_type::XBAR: {
+                        // Total ports on this crossbar
+                        const size_t nports =
+                            static_cast<size_t>(new_node.extended_info & 0xFF);
+                        // Total transport ports on this crossbar (the first
+                        // nports_xport ports are transport ports)
+                        const size_t nports_xport =
+                            static_cast<size_t>((new_node.extended_info >> 8) & 0xFF);
+                        // When we allow daisy chaining, we need to recursively check
+                        // other transports
+                        const size_t start_port = ALLOW_DAISY_CHAINING ? 0 : nports_xport;
+                        for (size_t p = start_port; p < nports; p++) {
+                            // Skip the input port
+                            if (p != static_cast<size_t>(dst_port)) {
+                                path_trail_t trail(next_path.trail);
+                                trail.push_back(static_cast<port_t>(p));
+                                new_paths.push_back(
+                                    {new_node, static_cast<port_t>(p), std::move(trail)});
+                            }
                         }
+                        UHD_LOG_TRACE(LOG_ID,
+                            "* " << new_node.to_string() << " has " << nports
+                                 << " ports, " << nports_xport
+                                 << " transports and we are hooked up on port "
+                                 << dst_port);
+                    } break;
+                    case node_type::STRM_EP: {
+                        // Stop searching when we find a stream endpoint
+                    } break;
+                    case node_type::XPORT: {
+                        // A transport has only one output. We don't need to take
+                        // any action to reach the next node.
+                        path_trail_t trail(next_path.trail);
+                        trail.push_back(-1);
+                        new_paths.push_back({new_node, -1, std::move(trail)});
+                    } break;
+                    default: {
+                        UHD_THROW_INVALID_CODE_PATH();
+                        break;
                     }
-                    UHD_LOG_TRACE(LOG_ID,
-                        "* " << new_node.to_string() << " has " << nports << " ports, "
-                             << nports_xport
-                             << " transports and we are hooked up on port " << dst_port);
-                } break;
-                case node_type::STRM_EP: {
-                    // Stop searching when we find a stream endpoint
-                } break;
-                case node_type::XPORT: {
-                    // A transport has only one output. We don't need to take
-                    // any action to reach the next node.
-                    pending_paths.push(std::make_pair(new_node, -1));
-                } break;
-                default: {
-                    UHD_THROW_INVALID_CODE_PATH();
-                    break;
                 }
             }
-            // That's it! Now go check the next path.
+
+            // Initialize all new nodes before we go through them to the next
+            // level. We don't care about the contents of the responses.
+            const auto init_resp_xacts =
+                _send_recv_mgmt_transactions(xport, init_req_xacts);
+            for (size_t i = 0; i < init_nodes.size(); i++) {
+                if (!init_resp_xacts[i]) {
+                    throw uhd::io_error(
+                        "Timed out getting recv buff for management transaction");
+                }
+                UHD_LOG_DEBUG(LOG_ID, "Initialized node " << init_nodes[i].to_string());
+            }
+
+            // That's it! Now go check the next level.
+            pending_paths = std::move(new_paths);
+        }
+
+        if (!_topo_cache_key.empty()) {
+            get_topo_cache().set(_topo_cache_key, std::move(empty_paths));
         }
     }
 
@@ -965,19 +1194,22 @@ private: // Functions
         const double timeout,
         const bool fc_enabled)
     {
-        // Get the status of the output stream
-        uint32_t ostrm_status = 0;
-        double sleep_s        = 0.001;
-        for (size_t i = 0; i < size_t(std::ceil(timeout / sleep_s)); i++) {
-            ostrm_status = std::get<0>(_get_ostrm_status(xport, dst_node));
-            if ((ostrm_status & STRM_STATUS_SETUP_PENDING) != 0) {
-                // Wait and retry
-                std::this_thread::sleep_for(
-                    std::chrono::milliseconds(static_cast<int64_t>(sleep_s * 1000)));
-            } else {
-                // Configuration is done
-                break;
-            }
+        // Poll the status of the output stream until setup is complete. Every
+        // poll is a full round trip to the endpoint, and setup usually completes
+        // within a few of them, so we start polling right away and only back off
+        // if it takes longer.
+        using clock_t = std::chrono::steady_clock;
+        const auto deadline =
+            clock_t::now()
+            + std::chrono::microseconds(static_cast<int64_t>(timeout * 1e6));
+        double poll_interval  = MIN_STRM_STATUS_POLL_INTERVAL;
+        uint32_t ostrm_status = std::get<0>(_get_ostrm_status(xport, dst_node));
+        while ((ostrm_status & STRM_STATUS_SETUP_PENDING) != 0
+               && clock_t::now() < deadline) {
+            std::this_thread::sleep_for(
+                std::chrono::microseconds(static_cast<int64_t>(poll_interval * 1e6)));
+            poll_interval = std::min(2 * poll_interval, MAX_STRM_STATUS_POLL_INTERVAL);
+            ostrm_status  = std::get<0>(_get_ostrm_status(xport, dst_node));
         }
 
         if ((ostrm_status & STRM_STATUS_SETUP_PENDING) != 0) {
@@ -1129,30 +1361,109 @@ private: // Functions
     }
 
     // Send the specified management transaction to the device and receive a response
-    const mgmt_payload _send_recv_mgmt_transaction(
-        chdr_ctrl_xport& xport, const mgmt_payload& transaction, double timeout = 0.1)
+    const mgmt_payload _send_recv_mgmt_transaction(chdr_ctrl_xport& xport,
+        const mgmt_payload& transaction,
+        double timeout = MGMT_XACT_TIMEOUT)
     {
-        auto my_epid = xport.get_epid();
-        mgmt_payload send(transaction);
-        send.set_header(my_epid, _protover, _chdr_w);
-        // If we are expecting to receive a response then we have to add an additional
-        // NO-OP hop for the receive endpoint. All responses will be appended to this hop.
-        mgmt_hop_t nop_hop;
-        nop_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_NOP));
-        send.add_hop(nop_hop);
-        // Send the transaction over the wire
-        _send_mgmt_transaction(xport, send);
-
-        auto mgmt_buff = xport.get_mgmt_buff(static_cast<int32_t>(timeout * 1000));
-        if (not mgmt_buff) {
+        auto responses = _send_recv_mgmt_transactions(xport, {transaction}, timeout);
+        if (!responses.front()) {
             throw uhd::io_error("Timed out getting recv buff for management transaction");
         }
-        _recv_pkt->refresh(mgmt_buff->data());
-        mgmt_payload recv;
-        recv.set_header(my_epid, _protover, _chdr_w);
-        _recv_pkt->fill_payload(recv);
-        xport.release_mgmt_buff(std::move(mgmt_buff));
-        return recv;
+        return std::move(*responses.front());
+    }
+
+    // Send the specified management transactions to the device and receive the
+    // responses
+    //
+    // Up to MAX_PENDING_MGMT_XACTS transactions are in flight at the same time.
+    // Responses are matched to their transactions using the tag in the return
+    // hop, so they may arrive in any order. The response to the n-th
+    // transaction is returned at position n, or is empty if it did not arrive
+    // within \p timeout after the transaction was sent.
+    std::vector<boost::optional<mgmt_payload>> _send_recv_mgmt_transactions(
+        chdr_ctrl_xport& xport,
+        const std::vector<mgmt_payload>& transactions,
+        double timeout = MGMT_XACT_TIMEOUT)
+    {
+        using clock_t = std::chrono::steady_clock;
+        struct pending_xact_t
+        {
+            size_t index;
+            clock_t::time_point deadline;
+        };
+
+        auto my_epid = xport.get_epid();
+        std::vector<boost::optional<mgmt_payload>> responses(transactions.size());
+        std::map<mgmt_op_t::payload_t, pending_xact_t> pending_xacts;
+        size_t num_sent = 0;
+        while (num_sent < transactions.size() || !pending_xacts.empty()) {
+            // Fill up the pipeline
+            while (num_sent < transactions.size()
+                   && pending_xacts.size() < MAX_PENDING_MGMT_XACTS) {
+                _xact_tag = (_xact_tag + 1) & MGMT_XACT_TAG_MASK;
+                mgmt_payload send(transactions[num_sent]);
+                send.set_header(my_epid, _protover, _chdr_w);
+                // If we are expecting to receive a response then we have to add an
+                // additional NO-OP hop for the receive endpoint. All responses will
+                // be appended to this hop.
+                mgmt_hop_t nop_hop;
+                nop_hop.add_op(mgmt_op_t(mgmt_op_t::MGMT_OP_NOP, _xact_tag));
+                send.add_hop(nop_hop);
+                // Send the transaction over the wire
+                _send_mgmt_transaction(xport, send);
+                pending_xacts[_xact_tag] = {num_sent++,
+                    clock_t::now()
+                        + std::chrono::microseconds(
+                            static_cast<int64_t>(timeout * 1e6))};
+            }
+
+            // Wait for the next response, but no longer than the earliest deadline
+            const auto deadline =
+                std::min_element(pending_xacts.cbegin(),
+                    pending_xacts.cend(),
+                    [](const auto& lhs, const auto& rhs) {
+                        return lhs.second.deadline < rhs.second.deadline;
+                    })
+                    ->second.deadline;
+            const auto timeout_ms = std::max<int64_t>(0,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - clock_t::now() + std::chrono::microseconds(999))
+                    .count());
+            auto mgmt_buff = xport.get_mgmt_buff(static_cast<int32_t>(timeout_ms));
+            if (not mgmt_buff) {
+                // Give up on all transactions that are past their deadline
+                const auto now = clock_t::now();
+                for (auto it = pending_xacts.begin(); it != pending_xacts.end();) {
+                    it = (it->second.deadline <= now) ? pending_xacts.erase(it)
+                                                      : std::next(it);
+                }
+                continue;
+            }
+            _recv_pkt->refresh(mgmt_buff->data());
+            mgmt_payload recv;
+            recv.set_header(my_epid, _protover, _chdr_w);
+            _recv_pkt->fill_payload(recv);
+            xport.release_mgmt_buff(std::move(mgmt_buff));
+
+            // Match the response to its transaction. Responses that we already
+            // gave up on are dropped.
+            if (recv.get_num_hops() == 0
+                || recv.get_hop(recv.get_num_hops() - 1).get_num_ops() == 0) {
+                UHD_LOG_WARNING(LOG_ID, "Dropping malformed management response");
+                continue;
+            }
+            const auto tag =
+                recv.get_hop(recv.get_num_hops() - 1).get_op(0).get_op_payload();
+            auto pending_it = pending_xacts.find(tag);
+            if (pending_it == pending_xacts.end()) {
+                UHD_LOG_TRACE(
+                    LOG_ID, "Dropping stale management response: " << recv.to_string());
+                continue;
+            }
+            responses[pending_it->second.index] = std::move(recv);
+            pending_xacts.erase(pending_it);
+        }
+        return responses;
     }
 
 private: // Members
@@ -1174,6 +1485,10 @@ private: // Members
     std::map<uint8_t, xport_cfg_fn_t> _rtcfg_cfg_fns;
     // Reference to the topology graph
     topo_graph_t::sptr _tgraph;
+    // Key for caching topology discovery results (empty means no caching)
+    const std::string _topo_cache_key;
+    // Tag of the last management transaction we sent
+    mgmt_op_t::payload_t _xact_tag = 0;
     // Mutex that protects all state in this class
     mutable std::recursive_mutex _mutex;
 }; // class mgmt_portal_impl
@@ -1182,10 +1497,11 @@ private: // Members
 mgmt_portal::uptr mgmt_portal::make(chdr_ctrl_xport& xport,
     const chdr::chdr_packet_factory& pkt_factory,
     sep_addr_t my_sep_addr,
-    uhd::rfnoc::detail::topo_graph_t::sptr topo_graph)
+    uhd::rfnoc::detail::topo_graph_t::sptr topo_graph,
+    const std::string& topo_cache_key)
 {
     return std::make_unique<mgmt_portal_impl>(
-        xport, pkt_factory, my_sep_addr, topo_graph);
+        xport, pkt_factory, my_sep_addr, topo_graph, topo_cache_key);
 }
 
 }}} // namespace uhd::rfnoc::mgmt
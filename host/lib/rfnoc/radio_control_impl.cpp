@@ -1248,7 +1248,7 @@ void radio_control_impl::async_message_handler(
                         uhd::async_metadata_t::EVENT_CODE_UNDERFLOW, timestamp);
                     post_action(res_source_info{res_source_info::INPUT_EDGE, chan},
                         tx_event_action);
-                    UHD_LOG_FASTPATH("U");
+                    UHD_LOG_FASTPATH_EVENT('U', chan, timestamp);
                     RFNOC_LOG_TRACE("Posting underrun event action message.");
                     break;
                 }
@@ -1257,7 +1257,7 @@ void radio_control_impl::async_message_handler(
                         uhd::async_metadata_t::EVENT_CODE_TIME_ERROR, timestamp);
                     post_action(res_source_info{res_source_info::INPUT_EDGE, chan},
                         tx_event_action);
-                    UHD_LOG_FASTPATH("L");
+                    UHD_LOG_FASTPATH_EVENT('L', chan, timestamp);
                     RFNOC_LOG_TRACE("Posting late data event action message.");
                     break;
                 }
@@ -1280,7 +1280,7 @@ void radio_control_impl::async_message_handler(
             }
             switch (code) {
                 case err_codes::ERR_RX_OVERRUN: {
-                    UHD_LOG_FASTPATH("O");
+                    UHD_LOG_FASTPATH_EVENT('O', chan, timestamp);
                     auto rx_event_action = rx_event_action_info::make(
                         uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
                     const bool cont_mode = _last_stream_cmd.at(chan).stream_mode
@@ -1292,7 +1292,7 @@ void radio_control_impl::async_message_handler(
                     break;
                 }
                 case err_codes::ERR_RX_LATE_CMD:
-                    UHD_LOG_FASTPATH("L");
+                    UHD_LOG_FASTPATH_EVENT('L', chan, timestamp);
                     auto rx_event_action = rx_event_action_info::make(
                         uhd::rx_metadata_t::ERROR_CODE_LATE_COMMAND);
                     RFNOC_LOG_TRACE("Posting RX late command message.");
@@ -5,12 +5,14 @@
 //
 
 #include <uhd/exception.hpp>
+#include <uhd/features/time_model_iface.hpp>
 #include <uhd/rfnoc/constants.hpp>
 #include <uhd/rfnoc/defaults.hpp>
 #include <uhd/rfnoc/mb_controller.hpp>
 #include <uhd/rfnoc/noc_block_make_args.hpp>
 #include <uhd/rfnoc/node.hpp>
 #include <uhd/rfnoc_graph.hpp>
+#include <uhdlib/features/time_model.hpp>
 #include <uhdlib/rfnoc/block_container.hpp>
 #include <uhdlib/rfnoc/factory.hpp>
 #include <uhdlib/rfnoc/graph.hpp>
@@ -380,6 +382,7 @@ public:
             adapter_id,
             rfnoc_streamer->get_stream_args().args,
             rfnoc_streamer->get_unique_id());
+        _connect_time_model(src_blk, *xport);
 
         rfnoc_streamer->connect_channel(strm_port, std::move(xport));
 
@@ -989,6 +992,39 @@ private:
         }
     }
 
+    /*! Let the time model of the source block's motherboard observe the
+     * timestamps received on \p xport
+     *
+     * This is only done on motherboards with a single timekeeper. Otherwise, we
+     * can't tell which timekeeper the timestamps refer to.
+     */
+    void _connect_time_model(const block_id_t& src_blk, chdr_rx_data_xport& xport)
+    {
+        const size_t mb_idx = src_blk.get_device_no();
+        if (mb_idx >= _mb_controllers.size()) {
+            return;
+        }
+        auto mbc = _mb_controllers.at(mb_idx);
+        if (mbc->get_num_timekeepers() != 1
+            || !mbc->has_feature<uhd::features::time_model_iface>()) {
+            return;
+        }
+        auto time_model = dynamic_cast<uhd::features::time_model*>(
+            &mbc->get_feature<uhd::features::time_model_iface>());
+        if (!time_model) {
+            return;
+        }
+        // The tolerance can be changed at any time, so the callback is always
+        // installed, but it does nothing while the model is disabled (which is
+        // the default)
+        auto clock_model = time_model->get_clock_model(0);
+        xport.set_tsf_callback([clock_model](const uint64_t tsf) {
+            if (clock_model->is_enabled()) {
+                clock_model->add_lower_bound(tsf, device_clock_model::clock_t::now());
+            }
+        });
+    }
+
     /*! Find the static edge that matches \p pred
      *
      * \throws uhd::assertion_error if the edge can't be found. So be careful!
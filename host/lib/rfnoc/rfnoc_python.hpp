@@ -11,6 +11,7 @@
 #include <uhd/features/discoverable_feature.hpp>
 #include <uhd/features/gpio_power_iface.hpp>
 #include <uhd/features/gps_iface.hpp>
+#include <uhd/features/time_model_iface.hpp>
 #include <uhd/rfnoc/block_id.hpp>
 #include <uhd/rfnoc/filter_node.hpp>
 #include <uhd/rfnoc/graph_edge.hpp>
@@ -250,6 +251,18 @@ void export_rfnoc(py::module& m)
         .def("get_sensors", &uhd::features::gps_iface::get_sensors)
         .def("send_cmd", &uhd::features::gps_iface::send_cmd);
 
+    py::class_<uhd::features::time_model_iface::time_estimate_t>(m, "time_estimate")
+        .def_readonly("time", &uhd::features::time_model_iface::time_estimate_t::time)
+        .def_readonly(
+            "error", &uhd::features::time_model_iface::time_estimate_t::error);
+
+    py::class_<uhd::features::time_model_iface>(m, "time_model")
+        .def("set_tolerance", &uhd::features::time_model_iface::set_tolerance)
+        .def("get_tolerance", &uhd::features::time_model_iface::get_tolerance)
+        .def("get_time_estimate",
+            &uhd::features::time_model_iface::get_time_estimate,
+            py::arg("tk_idx") = 0);
+
     py::class_<detail::filter_node>(m, "filter_node")
         .def("get_rx_filter_names", &detail::filter_node::get_rx_filter_names)
         .def("get_rx_filter", &detail::filter_node::get_rx_filter)
@@ -280,6 +293,7 @@ void export_rfnoc(py::module& m)
         .def("set_time_source_out", &mb_controller::set_time_source_out)
         .def("get_sensor", &mb_controller::get_sensor)
         .def("get_sensor_names", &mb_controller::get_sensor_names)
+        .def("get_sensors", &mb_controller::get_sensors)
         .def("get_eeprom",
             [](mb_controller& self) {
                 auto eeprom = self.get_eeprom();
@@ -301,6 +315,12 @@ void export_rfnoc(py::module& m)
             [](mb_controller& self) {
                 return &self.get_feature<uhd::features::gps_iface>();
             },
+            py::return_value_policy::reference_internal)
+        .def(
+            "get_time_model",
+            [](mb_controller& self) {
+                return &self.get_feature<uhd::features::time_model_iface>();
+            },
             py::return_value_policy::reference_internal);
 
     py::class_<timekeeper, PyTimekeeper, timekeeper::sptr>(m, "timekeeper")
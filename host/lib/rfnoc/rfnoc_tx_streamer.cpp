@@ -200,6 +200,17 @@ bool rfnoc_tx_streamer::recv_async_msg(
     return _async_msg_queue->recv_async_msg(async_metadata, timeout_ms);
 }
 
+void rfnoc_tx_streamer::register_async_msg_callback(
+    const async_msg_callback_t& callback)
+{
+    _async_msg_queue->register_callback(callback);
+}
+
+int rfnoc_tx_streamer::get_async_msg_fd() const
+{
+    return _async_msg_queue->get_event_fd();
+}
+
 void rfnoc_tx_streamer::_register_props(const size_t chan, const std::string& otw_format)
 {
     // Create actual properties and store them
@@ -4,46 +4,116 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
 #include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
 #include <chrono>
-#include <thread>
+#ifdef UHD_PLATFORM_LINUX
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#    include <cerrno>
+#    include <cstring>
+#endif
 
 using namespace uhd;
 using namespace uhd::rfnoc;
 
-tx_async_msg_queue::tx_async_msg_queue(size_t capacity) : _queue(capacity) {}
+tx_async_msg_queue::tx_async_msg_queue(size_t capacity)
+    : _queue(capacity), _callbacks(std::make_shared<const callback_list_t>())
+{
+#ifdef UHD_PLATFORM_LINUX
+    // Semaphore semantics: Every read decrements the count by one, so the
+    // descriptor stays readable as long as messages are queued.
+    _event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK | EFD_SEMAPHORE);
+    if (_event_fd < 0) {
+        throw uhd::os_error(
+            std::string("tx_async_msg_queue: eventfd() failed: ") + strerror(errno));
+    }
+#endif
+}
+
+tx_async_msg_queue::~tx_async_msg_queue()
+{
+#ifdef UHD_PLATFORM_LINUX
+    close(_event_fd);
+#endif
+}
 
 bool tx_async_msg_queue::recv_async_msg(
     uhd::async_metadata_t& async_metadata, int32_t timeout_ms)
 {
     using namespace std::chrono;
 
-    if (timeout_ms == 0.0) {
-        return _queue.pop(async_metadata);
+    if (timeout_ms <= 0) {
+        return _pop(async_metadata);
     }
 
     const auto end_time = steady_clock::now() + milliseconds(timeout_ms);
 
-    bool last_check = false;
-
-    while (true) {
-        if (_queue.pop(async_metadata)) {
-            return true;
-        }
-
-        if (steady_clock::now() > end_time) {
-            if (last_check) {
-                return false;
-            } else {
-                last_check = true;
-            }
+    // enqueue() acquires the mutex after pushing the message, so a message
+    // can't arrive between a failed _pop() and the wait without waking us up
+    std::unique_lock<std::mutex> lock(_wait_mutex);
+    while (!_pop(async_metadata)) {
+        if (_wait_cond.wait_until(lock, end_time) == std::cv_status::timeout) {
+            return _pop(async_metadata);
         }
-
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
     }
+    return true;
 }
 
 void tx_async_msg_queue::enqueue(const async_metadata_t& async_metadata)
 {
+    // Call the callbacks without holding the mutex, so they may register
+    // further callbacks. Those are called from the next message on.
+    std::shared_ptr<const callback_list_t> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        callbacks = _callbacks;
+    }
+    for (const auto& callback : *callbacks) {
+        callback(async_metadata);
+    }
+
+#ifdef UHD_PLATFORM_LINUX
+    // Count the message before pushing it, so the count is never lower than
+    // the number of queued messages when _pop() decrements it
+    const uint64_t one = 1;
+    if (write(_event_fd, &one, sizeof(one)) != sizeof(one)) {
+        UHD_LOG_WARNING("TX_ASYNC_MSG_QUEUE", "Failed to signal async message");
+    }
+#endif
     _queue.push(async_metadata);
+
+    {
+        std::lock_guard<std::mutex> lock(_wait_mutex);
+    }
+    _wait_cond.notify_all();
+}
+
+void tx_async_msg_queue::register_callback(const callback_t& callback)
+{
+    std::lock_guard<std::mutex> lock(_callback_mutex);
+    // Copy on write, enqueue() may be iterating over the current list
+    auto callbacks = std::make_shared<callback_list_t>(*_callbacks);
+    callbacks->push_back(callback);
+    _callbacks = std::move(callbacks);
+}
+
+bool tx_async_msg_queue::_pop(async_metadata_t& async_metadata)
+{
+    if (!_queue.pop(async_metadata)) {
+        return false;
+    }
+#ifdef UHD_PLATFORM_LINUX
+    // A failed read only leaves the descriptor readable while the queue is
+    // empty, which get_event_fd() allows for. Don't warn about it for every
+    // message, unless the descriptor itself is broken.
+    uint64_t count;
+    if (read(_event_fd, &count, sizeof(count)) < 0 && errno != EAGAIN
+        && errno != EWOULDBLOCK && errno != EINTR) {
+        UHD_LOG_WARNING("TX_ASYNC_MSG_QUEUE",
+            "Failed to clear async message: " << strerror(errno));
+    }
+#endif
+    return true;
 }
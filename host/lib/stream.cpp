@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/stream.hpp>
 
 using namespace uhd;
@@ -14,7 +15,23 @@ rx_streamer::~rx_streamer(void)
     // empty
 }
 
+std::vector<size_t> rx_streamer::get_zero_filled_chans(void) const
+{
+    return {};
+}
+
 tx_streamer::~tx_streamer(void)
 {
     // empty
 }
+
+void tx_streamer::register_async_msg_callback(const async_msg_callback_t&)
+{
+    throw uhd::not_implemented_error(
+        "This TX streamer does not support async message callbacks");
+}
+
+int tx_streamer::get_async_msg_fd(void) const
+{
+    return -1;
+}
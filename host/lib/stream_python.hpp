@@ -157,7 +157,8 @@ void export_stream(py::module& m)
             py::arg("timeout") = 0.1)
         .def("get_num_channels", &uhd::rx_streamer::get_num_channels)
         .def("get_max_num_samps", &uhd::rx_streamer::get_max_num_samps)
-        .def("issue_stream_cmd", &uhd::rx_streamer::issue_stream_cmd);
+        .def("issue_stream_cmd", &uhd::rx_streamer::issue_stream_cmd)
+        .def("get_zero_filled_chans", &uhd::rx_streamer::get_zero_filled_chans);
 
     py::class_<tx_streamer, tx_streamer::sptr>(m, "tx_streamer", "See: uhd::tx_streamer")
         // Methods
@@ -21,3 +21,14 @@ adapter_id_t adapter_ctx::register_adapter(adapter_info& info)
         return id;
     }
 }
+
+std::string adapter_ctx::get_adapter_name(const adapter_id_t id)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& entry : _id_map) {
+        if (entry.second == id) {
+            return entry.first;
+        }
+    }
+    return "";
+}
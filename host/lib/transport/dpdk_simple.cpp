@@ -38,7 +38,7 @@ public:
 
         // Init I/O service
         _port_id    = _link->get_port()->get_port_id();
-        _io_service = ctx->get_io_service(_port_id);
+        _io_service = ctx->get_io_service(_port_id, _link->get_queue_id());
         // This is normally done by the I/O service manager, but with DPDK, this
         // is all it does so we skip that step
         UHD_LOG_TRACE("DPDK::SIMPLE", "Attaching link to I/O service...");
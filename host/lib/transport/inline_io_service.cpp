@@ -6,10 +6,14 @@
 
 #include <uhd/config.hpp>
 #include <uhd/exception.hpp>
+#include <uhd/utils/byteswap.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
 #include <boost/circular_buffer.hpp>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <vector>
 
 namespace uhd { namespace transport {
 
@@ -41,11 +45,29 @@ protected:
     recv_callback_t _recv_cb;
     // pointer to send link used with the callback
     send_link_if* _cb_send_link;
+
+private:
+    friend class inline_recv_mux;
+
+    // Queue for packets that other clients of a shared link received on behalf
+    // of this one, owned by the mux
+    boost::circular_buffer<frame_buff*>* _mux_queue = nullptr;
 };
 
 /*!
  * Mux class that intercepts packets from the link and distributes them to
  * queues for each client that is not the caller of the recv() function
+ *
+ * To avoid offering every packet to every client's callback, the mux reads
+ * the destination EPID from the CHDR header of each packet, and remembers in a
+ * table indexed by EPID which client last accepted a packet for it. That
+ * client's callback is tried first, and the other callbacks are only called
+ * if it rejects the packet (for example, because a control and a management
+ * client share the EPID). Since the callbacks still decide which client gets
+ * a packet, links that do not carry little-endian CHDR work as before, but
+ * fall back to calling all callbacks. The table only covers the low EPIDs
+ * that UHD assigns to its endpoints, so arbitrary header bytes of other
+ * packets can't grow it.
  */
 class inline_recv_mux
 {
@@ -61,13 +83,12 @@ public:
      */
     void connect(inline_recv_cb* cb)
     {
-        UHD_ASSERT_THROW(_queues.count(cb) == 0);
+        UHD_ASSERT_THROW(cb->_mux_queue == nullptr);
         /* Always create queue of max size, since we don't know when there are
          * virtual channels (which share frames)
          */
-        auto queue =
+        cb->_mux_queue =
             new boost::circular_buffer<frame_buff*>(_link->get_num_recv_frames());
-        _queues[cb] = queue;
         _callbacks.push_back(cb);
     }
 
@@ -77,15 +98,18 @@ public:
      */
     void disconnect(inline_recv_cb* cb)
     {
-        auto queue = _queues.at(cb);
+        auto queue = cb->_mux_queue;
+        UHD_ASSERT_THROW(queue);
         while (!queue->empty()) {
             frame_buff* buff = queue->front();
             _link->release_recv_buff(frame_buff::uptr(buff));
             queue->pop_front();
         }
         delete queue;
-        _queues.erase(cb);
-        _callbacks.remove(cb);
+        cb->_mux_queue = nullptr;
+        _callbacks.erase(std::remove(_callbacks.begin(), _callbacks.end(), cb),
+            _callbacks.end());
+        std::replace(_epid_tbl.begin(), _epid_tbl.end(), cb, (inline_recv_cb*)nullptr);
     }
 
     /*!
@@ -106,7 +130,7 @@ public:
      */
     frame_buff::uptr recv(inline_recv_cb* cb, recv_link_if* recv_link, int32_t timeout_ms)
     {
-        auto queue = _queues.at(cb);
+        auto queue = cb->_mux_queue;
         if (!queue->empty()) {
             frame_buff* buff = queue->front();
             queue->pop_front();
@@ -116,28 +140,21 @@ public:
             frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
             /* Process buffer */
             if (buff) {
-                bool rcvr_found = false;
-                for (auto& rcvr : _callbacks) {
-                    if (rcvr->callback(buff, recv_link)) {
-                        rcvr_found = true;
-                        if (buff) {
-                            if (rcvr == cb) {
-                                return frame_buff::uptr(std::move(buff));
-                            } else {
-                                /* NOTE: Should not overflow, by construction
-                                 * Every queue can hold link->get_num_recv_frames()
-                                 */
-                                _queues[rcvr]->push_back(buff.release());
-                            }
-                        }
-                        /* Continue looping if buffer was consumed */
-                        break;
+                inline_recv_cb* rcvr = _dispatch(buff, recv_link);
+                if (rcvr && buff) {
+                    if (rcvr == cb) {
+                        return frame_buff::uptr(std::move(buff));
+                    } else {
+                        /* NOTE: Should not overflow, by construction
+                         * Every queue can hold link->get_num_recv_frames()
+                         */
+                        rcvr->_mux_queue->push_back(buff.release());
                     }
-                }
-                if (not rcvr_found) {
+                } else if (!rcvr) {
                     UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
                     recv_link->release_recv_buff(std::move(buff));
                 }
+                /* Continue looping if buffer was consumed */
             } else { /* Timeout */
                 return frame_buff::uptr();
             }
@@ -150,29 +167,21 @@ public:
             frame_buff::uptr buff = recv_link->get_recv_buff(timeout_ms);
             /* Process buffer */
             if (buff) {
-                bool rcvr_found = false;
-                for (auto& rcvr : _callbacks) {
-                    if (rcvr->callback(buff, recv_link)) {
-                        rcvr_found = true;
-                        if (rcvr == cb) {
-                            assert(!buff);
-                            return true;
-                        } else if (buff) {
-                            /* NOTE: Should not overflow, by construction
-                             * Every queue can hold link->get_num_recv_frames()
-                             */
-                            _queues[rcvr]->push_back(buff.release());
-                        } else {
-                            /* Continue looping if buffer was consumed and
-                               receiver is not the requested one */
-                            break;
-                        }
-                    }
-                }
-                if (not rcvr_found) {
+                inline_recv_cb* rcvr = _dispatch(buff, recv_link);
+                if (rcvr == cb) {
+                    assert(!buff);
+                    return true;
+                } else if (rcvr && buff) {
+                    /* NOTE: Should not overflow, by construction
+                     * Every queue can hold link->get_num_recv_frames()
+                     */
+                    rcvr->_mux_queue->push_back(buff.release());
+                } else if (!rcvr) {
                     UHD_LOG_DEBUG("IO_SRV", "Dropping packet with no receiver");
                     recv_link->release_recv_buff(std::move(buff));
                 }
+                /* Continue looping if buffer was consumed and receiver is not
+                 * the requested one */
             } else { /* Timeout */
                 return false;
             }
@@ -180,9 +189,61 @@ public:
     }
 
 private:
+    //! Number of bytes needed to read the destination EPID from a packet
+    static constexpr size_t CHDR_HDR_BYTES = sizeof(uint64_t);
+
+    //! EPID value used for packets too short to hold a CHDR header
+    static constexpr size_t NO_EPID = ~size_t(0);
+
+    //! Number of EPIDs the table can cache, packets to higher EPIDs (or
+    //  packets that aren't CHDR) are offered to all callbacks
+    static constexpr size_t MAX_CACHED_EPIDS = 1024;
+
+    /*!
+     * Find the receiver of a packet and let its callback process it
+     *
+     * \param buff the packet, which the callback may consume
+     * \param recv_link the link the packet was received on
+     * \return the receiver that accepted the packet, or nullptr if none did
+     */
+    UHD_FORCE_INLINE inline_recv_cb* _dispatch(
+        frame_buff::uptr& buff, recv_link_if* recv_link)
+    {
+        // Read the destination EPID, which is in the lowest 16 bits of the
+        // first (little-endian) header word
+        size_t epid = NO_EPID;
+        if (buff->packet_size() >= CHDR_HDR_BYTES) {
+            uint64_t hdr;
+            std::memcpy(&hdr, buff->data(), sizeof(hdr));
+            epid = uhd::wtohx<uint64_t>(hdr) & 0xFFFF;
+        }
+
+        inline_recv_cb* cached = nullptr;
+        if (epid < _epid_tbl.size()) {
+            cached = _epid_tbl[epid];
+            if (cached && cached->callback(buff, recv_link)) {
+                return cached;
+            }
+        }
+
+        for (auto rcvr : _callbacks) {
+            if (rcvr != cached && rcvr->callback(buff, recv_link)) {
+                if (epid < MAX_CACHED_EPIDS) {
+                    if (epid >= _epid_tbl.size()) {
+                        _epid_tbl.resize(epid + 1, nullptr);
+                    }
+                    _epid_tbl[epid] = rcvr;
+                }
+                return rcvr;
+            }
+        }
+        return nullptr;
+    }
+
     recv_link_if* _link;
-    std::list<inline_recv_cb*> _callbacks;
-    std::unordered_map<inline_recv_cb*, boost::circular_buffer<frame_buff*>*> _queues;
+    std::vector<inline_recv_cb*> _callbacks;
+    //! Receiver that last accepted a packet, indexed by destination EPID
+    std::vector<inline_recv_cb*> _epid_tbl;
 };
 
 class inline_recv_io : public virtual recv_io_if, public virtual inline_recv_cb
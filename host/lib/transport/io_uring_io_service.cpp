@@ -0,0 +1,115 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/transport/io_uring_io_service.hpp>
+#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <algorithm>
+#include <list>
+
+namespace uhd { namespace transport {
+
+namespace {
+
+const std::string LOG_ID = "IO_URING";
+
+} // namespace
+
+class io_uring_io_service_impl : public io_uring_io_service
+{
+public:
+    io_uring_io_service_impl() : _inline_io_srv(inline_io_service::make()) {}
+
+    ~io_uring_io_service_impl() override
+    {
+        for (auto& link : _uring_links) {
+            link->disable_io_uring();
+        }
+    }
+
+    void attach_recv_link(recv_link_if::sptr link) override
+    {
+        auto udp_link = std::dynamic_pointer_cast<udp_boost_asio_link>(link);
+        if (udp_link) {
+            try {
+                udp_link->enable_io_uring();
+                _uring_links.push_back(udp_link);
+            } catch (const uhd::exception& ex) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "Cannot receive through io_uring, using regular receives: "
+                        << ex.what());
+            }
+        } else {
+            UHD_LOG_DEBUG(LOG_ID,
+                "Link does not support io_uring, using regular receives");
+        }
+        _inline_io_srv->attach_recv_link(link);
+    }
+
+    void attach_send_link(send_link_if::sptr link) override
+    {
+        _inline_io_srv->attach_send_link(link);
+    }
+
+    void detach_recv_link(recv_link_if::sptr link) override
+    {
+        _inline_io_srv->detach_recv_link(link);
+        auto it = std::find(_uring_links.begin(), _uring_links.end(), link);
+        if (it != _uring_links.end()) {
+            (*it)->disable_io_uring();
+            _uring_links.erase(it);
+        }
+    }
+
+    void detach_send_link(send_link_if::sptr link) override
+    {
+        _inline_io_srv->detach_send_link(link);
+    }
+
+    recv_io_if::sptr make_recv_client(recv_link_if::sptr data_link,
+        size_t num_recv_frames,
+        recv_callback_t cb,
+        send_link_if::sptr fc_link,
+        size_t num_send_frames,
+        recv_io_if::fc_callback_t fc_cb) override
+    {
+        return _inline_io_srv->make_recv_client(
+            data_link, num_recv_frames, cb, fc_link, num_send_frames, fc_cb);
+    }
+
+    send_io_if::sptr make_send_client(send_link_if::sptr send_link,
+        size_t num_send_frames,
+        send_io_if::send_callback_t send_cb,
+        recv_link_if::sptr recv_link,
+        size_t num_recv_frames,
+        recv_callback_t recv_cb,
+        send_io_if::fc_callback_t fc_cb) override
+    {
+        return _inline_io_srv->make_send_client(send_link,
+            num_send_frames,
+            send_cb,
+            recv_link,
+            num_recv_frames,
+            recv_cb,
+            fc_cb);
+    }
+
+private:
+    //! Does the actual scheduling
+    inline_io_service::sptr _inline_io_srv;
+
+    //! Links that were switched to io_uring when they were attached
+    std::list<udp_boost_asio_link::sptr> _uring_links;
+};
+
+io_uring_io_service::sptr io_uring_io_service::make()
+{
+    return std::make_shared<io_uring_io_service_impl>();
+}
+
+}} // namespace uhd::transport
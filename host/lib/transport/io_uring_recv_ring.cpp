@@ -0,0 +1,340 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/io_uring_recv_ring.hpp>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+using namespace uhd::transport;
+
+namespace {
+
+//! user_data of cancel requests. Blocks never live at address 0.
+constexpr uint64_t CANCEL_TAG = 0;
+
+//! Max. time to wait for the kernel to give up cancelled reads
+constexpr auto CANCEL_TIMEOUT = std::chrono::seconds(1);
+
+int sys_io_uring_setup(uint32_t entries, io_uring_params* p)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+int sys_io_uring_enter(int fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags)
+{
+    return static_cast<int>(
+        ::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int sys_io_uring_register(int fd, uint32_t opcode, const void* arg, uint32_t nr_args)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+std::string errno_str(int err)
+{
+    return std::string(strerror(err));
+}
+
+} // namespace
+
+io_uring_recv_ring::io_uring_recv_ring(int sock_fd,
+    size_t block_size,
+    const std::vector<iovec>& regions,
+    const std::vector<void*>& blocks,
+    size_t num_posted)
+    : _sock_fd(sock_fd), _block_size(block_size), _blocks(blocks)
+{
+    UHD_ASSERT_THROW(num_posted <= blocks.size());
+    UHD_ASSERT_THROW(!blocks.empty());
+
+    // The completion queue is twice the size of the submission queue, so it
+    // holds a completion for every block even if all of them are in flight.
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    _ring_fd = sys_io_uring_setup(static_cast<uint32_t>(blocks.size()), &params);
+    if (_ring_fd < 0) {
+        throw uhd::os_error("io_uring_setup() failed: " + errno_str(errno));
+    }
+
+    try {
+        _sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        _cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            _sq_size = _cq_size = std::max(_sq_size, _cq_size);
+        }
+        _sq_ptr = ::mmap(nullptr,
+            _sq_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            _ring_fd,
+            IORING_OFF_SQ_RING);
+        if (_sq_ptr == MAP_FAILED) {
+            _sq_ptr = nullptr;
+            throw uhd::os_error("Failed to map io_uring SQ ring: " + errno_str(errno));
+        }
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+            _cq_ptr = _sq_ptr;
+        } else {
+            _cq_ptr = ::mmap(nullptr,
+                _cq_size,
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE,
+                _ring_fd,
+                IORING_OFF_CQ_RING);
+            if (_cq_ptr == MAP_FAILED) {
+                _cq_ptr = nullptr;
+                throw uhd::os_error(
+                    "Failed to map io_uring CQ ring: " + errno_str(errno));
+            }
+        }
+        _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr,
+            _sqes_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            _ring_fd,
+            IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            throw uhd::os_error("Failed to map io_uring SQEs: " + errno_str(errno));
+        }
+        _sqes = static_cast<io_uring_sqe*>(sqes);
+    } catch (...) {
+        _release();
+        throw;
+    }
+
+    uint8_t* sq = static_cast<uint8_t*>(_sq_ptr);
+    _sq_tail    = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    _sq_array   = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    _sq_mask    = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    _sq_entries = params.sq_entries;
+    uint8_t* cq = static_cast<uint8_t*>(_cq_ptr);
+    _cq_head    = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    _cq_tail    = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    _cq_mask    = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    _cqes       = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    // Registering is an optimization, so failures are not fatal
+    if (sys_io_uring_register(_ring_fd,
+            IORING_REGISTER_BUFFERS,
+            regions.data(),
+            static_cast<uint32_t>(regions.size()))
+        == 0) {
+        _regions = regions;
+    } else {
+        UHD_LOG_DEBUG("IO_URING",
+            "Could not register receive buffers (" << errno_str(errno)
+                                                   << "), using plain reads");
+    }
+    if (sys_io_uring_register(_ring_fd, IORING_REGISTER_FILES, &_sock_fd, 1) == 0) {
+        _fixed_file = 0;
+    }
+
+    _completed.reserve(blocks.size());
+    for (size_t i = 0; i < num_posted; i++) {
+        post(blocks[i]);
+    }
+    _submit();
+}
+
+io_uring_recv_ring::~io_uring_recv_ring()
+{
+    if (_num_in_flight > 0) {
+        try {
+            _cancel_all();
+        } catch (const uhd::exception& ex) {
+            UHD_LOG_ERROR("IO_URING", "Error cancelling receives: " << ex.what());
+        }
+    }
+    _release();
+}
+
+void io_uring_recv_ring::_release()
+{
+    if (_sqes) {
+        ::munmap(_sqes, _sqes_size);
+        _sqes = nullptr;
+    }
+    if (_cq_ptr && _cq_ptr != _sq_ptr) {
+        ::munmap(_cq_ptr, _cq_size);
+    }
+    _cq_ptr = nullptr;
+    if (_sq_ptr) {
+        ::munmap(_sq_ptr, _sq_size);
+        _sq_ptr = nullptr;
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+        _ring_fd = -1;
+    }
+}
+
+size_t io_uring_recv_ring::recv(void*& mem, int32_t timeout_ms)
+{
+    if (_completed_idx == _completed.size()) {
+        _completed.clear();
+        _completed_idx = 0;
+
+        // Out of completions, so this is the time to go to the kernel: Hand it
+        // all the blocks that were reposted since the last call, and pick up
+        // whatever completed in the meantime.
+        _submit();
+        _reap();
+        if (_completed.empty()) {
+            if (timeout_ms == 0) {
+                return 0;
+            }
+            pollfd pfd;
+            pfd.fd     = _ring_fd;
+            pfd.events = POLLIN;
+            const int ret = TEMP_FAILURE_RETRY(::poll(&pfd, 1, timeout_ms));
+            if (ret < 0) {
+                throw uhd::io_error("poll() on io_uring failed: " + errno_str(errno));
+            }
+            _reap();
+            if (_completed.empty()) {
+                return 0; // timeout
+            }
+        }
+    }
+
+    const completion_t completion = _completed[_completed_idx++];
+    if (completion.res <= 0) {
+        post(completion.mem);
+        if (completion.res == 0) {
+            throw uhd::io_error("socket closed");
+        }
+        throw uhd::io_error(str(
+            boost::format("recv error on socket: %s") % errno_str(-completion.res)));
+    }
+    mem = completion.mem;
+    return static_cast<size_t>(completion.res);
+}
+
+void io_uring_recv_ring::post(void* mem)
+{
+    io_uring_sqe* sqe = _get_sqe();
+
+    sqe->opcode    = IORING_OP_READ;
+    sqe->fd        = (_fixed_file >= 0) ? _fixed_file : _sock_fd;
+    sqe->flags     = (_fixed_file >= 0) ? IOSQE_FIXED_FILE : 0;
+    sqe->addr      = reinterpret_cast<uint64_t>(mem);
+    sqe->len       = static_cast<uint32_t>(_block_size);
+    sqe->user_data = reinterpret_cast<uint64_t>(mem);
+    for (size_t i = 0; i < _regions.size(); i++) {
+        const uint8_t* base = static_cast<const uint8_t*>(_regions[i].iov_base);
+        if (mem >= base && static_cast<uint8_t*>(mem) < base + _regions[i].iov_len) {
+            sqe->opcode    = IORING_OP_READ_FIXED;
+            sqe->buf_index = static_cast<uint16_t>(i);
+            break;
+        }
+    }
+
+    _push_sqe();
+    _num_in_flight++;
+}
+
+io_uring_sqe* io_uring_recv_ring::_get_sqe()
+{
+    if (_num_unsubmitted == _sq_entries) {
+        _submit();
+    }
+    io_uring_sqe* sqe = &_sqes[*_sq_tail & _sq_mask];
+    std::memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+void io_uring_recv_ring::_push_sqe()
+{
+    // The kernel only looks at the tail on io_uring_enter(), but the release
+    // store is what the io_uring ABI asks for
+    const uint32_t tail        = *_sq_tail;
+    _sq_array[tail & _sq_mask] = tail & _sq_mask;
+    __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    _num_unsubmitted++;
+}
+
+void io_uring_recv_ring::_submit()
+{
+    while (_num_unsubmitted > 0) {
+        const int ret = sys_io_uring_enter(_ring_fd, _num_unsubmitted, 0, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EBUSY) {
+                // The kernel is short on resources or completion queue space,
+                // make room and try again
+                _reap();
+                continue;
+            }
+            throw uhd::io_error("io_uring_enter() failed: " + errno_str(errno));
+        }
+        _num_unsubmitted -= static_cast<uint32_t>(ret);
+    }
+}
+
+void io_uring_recv_ring::_reap()
+{
+    uint32_t head       = *_cq_head;
+    const uint32_t tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+        const io_uring_cqe& cqe = _cqes[head & _cq_mask];
+        if (cqe.user_data == CANCEL_TAG) {
+            continue;
+        }
+        _num_in_flight--;
+        _completed.push_back({reinterpret_cast<void*>(cqe.user_data), cqe.res});
+    }
+    __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+}
+
+void io_uring_recv_ring::_cancel_all()
+{
+    // The posted reads point into memory owned by the caller, so we must not
+    // return before the kernel has given up on all of them. Cancel every block
+    // individually; cancelling blocks which are not in flight is harmless, and
+    // this works on all kernels (IORING_ASYNC_CANCEL_ALL requires 5.19).
+    _submit();
+    for (void* mem : _blocks) {
+        io_uring_sqe* sqe = _get_sqe();
+
+        sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+        sqe->fd        = -1;
+        sqe->addr      = reinterpret_cast<uint64_t>(mem);
+        sqe->user_data = CANCEL_TAG;
+        _push_sqe();
+    }
+    _submit();
+
+    const auto deadline = std::chrono::steady_clock::now() + CANCEL_TIMEOUT;
+    _reap();
+    while (_num_in_flight > 0) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            throw uhd::io_error(str(boost::format("%d receives still in flight after "
+                                                  "cancelling")
+                                    % _num_in_flight));
+        }
+        pollfd pfd;
+        pfd.fd     = _ring_fd;
+        pfd.events = POLLIN;
+        TEMP_FAILURE_RETRY(::poll(&pfd, 1, 10));
+        _reap();
+    }
+    _completed.clear();
+    _completed_idx = 0;
+}
@@ -10,15 +10,22 @@
 #include <uhdlib/transport/frame_reservation_mgr.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <uhdlib/transport/offload_io_service_client.hpp>
-#include <uhdlib/utils/semaphore.hpp>
 #include <condition_variable>
 #include <boost/lockfree/queue.hpp>
 #include <atomic>
+#include <cassert>
 #include <chrono>
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <thread>
+#ifdef UHD_PLATFORM_LINUX
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <ctime>
+#endif
 
 namespace uhd { namespace transport {
 
@@ -26,12 +33,41 @@ namespace {
 
 constexpr int32_t blocking_timeout_ms = 10;
 
-// Fixed-size queue that supports blocking semantics
+// Size of a cache line, used to keep the indices written by the producer and
+// the consumer of a queue apart
+constexpr size_t cache_line_size = 64;
+
+// Hint to the CPU that the calling thread is polling
+UHD_FORCE_INLINE void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+// Fixed-size, lock-free single-producer single-consumer queue that supports
+// blocking semantics
+//
+// The producer and the consumer each own one index, which lives on a cache
+// line of its own, so handing over an item only moves the cache line with the
+// producer's index and the item itself between cores. A consumer that waits
+// for items polls the queue first, and then spins, yields, or sleeps on a
+// futex as determined by the wait policy.
 template <typename queue_item_t>
 class offload_thread_queue
 {
 public:
-    offload_thread_queue(size_t size) : _buffer(new queue_item_t[size]), _capacity(size)
+    using wait_policy_t = offload_io_service::queue_wait_policy_t;
+
+    offload_thread_queue(
+        size_t size, const wait_policy_t wait_policy, const size_t spin_count)
+        : _capacity(round_up_to_pow2(size))
+        , _mask(_capacity - 1)
+        , _buffer(new queue_item_t[_capacity])
+        , _wait_policy(wait_policy)
+        , _spin_count(spin_count)
     {
     }
 
@@ -40,59 +76,180 @@ public:
         delete[] _buffer;
     }
 
+    // Producer methods
+
     void push(const queue_item_t& item)
     {
-        _buffer[_write_index++] = item;
-        _write_index %= _capacity;
-        _item_sem.notify();
+        const uint32_t write_index = _write_index.load(std::memory_order_relaxed);
+        // Queues are sized to fit all frames of a client, so they never fill up
+        assert(write_index - _read_index.load(std::memory_order_relaxed) < _capacity);
+        _buffer[write_index & _mask] = item;
+        _write_index.store(write_index + 1, std::memory_order_release);
+
+        if (_wait_policy == offload_io_service::SPIN_FUTEX) {
+            // Pairs with the fence in _sleep(), so either the consumer sees
+            // the new write index, or this thread sees that it is asleep
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_consumer_sleeping.load(std::memory_order_relaxed)) {
+                _wake();
+            }
+        }
     }
 
+    // Consumer methods
+
     bool peek(queue_item_t& item)
     {
-        if (_item_sem.count()) {
-            item = _buffer[_read_index];
-            return true;
-        } else {
+        const uint32_t read_index = _read_index.load(std::memory_order_relaxed);
+        if (read_index == _write_index.load(std::memory_order_acquire)) {
             return false;
         }
+        item = _buffer[read_index & _mask];
+        return true;
     }
 
     bool pop(queue_item_t& item)
     {
-        if (_item_sem.try_wait()) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
+        const uint32_t read_index = _read_index.load(std::memory_order_relaxed);
+        if (read_index == _write_index.load(std::memory_order_acquire)) {
             return false;
         }
+        item = _buffer[read_index & _mask];
+        _read_index.store(read_index + 1, std::memory_order_release);
+        return true;
     }
 
+    // Waits for an item for up to timeout_ms, or indefinitely if timeout_ms is
+    // negative
     bool pop(queue_item_t& item, int32_t timeout_ms)
     {
-        if (_item_sem.wait_for(timeout_ms)) {
-            item = _buffer[_read_index++];
-            _read_index %= _capacity;
-            return true;
-        } else {
-            return false;
+        if (timeout_ms == 0) {
+            return pop(item);
+        }
+        for (size_t i = 0; i < _spin_count; i++) {
+            if (pop(item)) {
+                return true;
+            }
+            cpu_relax();
+        }
+
+        const auto end_time = std::chrono::steady_clock::now()
+                              + std::chrono::milliseconds(timeout_ms);
+        while (true) {
+            if (pop(item)) {
+                return true;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (timeout_ms > 0 && now >= end_time) {
+                return pop(item);
+            }
+            switch (_wait_policy) {
+                case offload_io_service::SPIN:
+                    cpu_relax();
+                    break;
+                case offload_io_service::SPIN_YIELD:
+                    std::this_thread::yield();
+                    break;
+                case offload_io_service::SPIN_FUTEX:
+                    // Without a timeout, wake up periodically anyway, like
+                    // a blocking offload thread does
+                    _sleep(timeout_ms > 0
+                               ? end_time - now
+                               : std::chrono::milliseconds(blocking_timeout_ms));
+                    break;
+            }
         }
     }
 
+    // May be called from either thread
     size_t read_available()
     {
-        return _item_sem.count();
+        return _write_index.load(std::memory_order_acquire)
+               - _read_index.load(std::memory_order_acquire);
     }
 
 private:
-    queue_item_t* _buffer;
+    static size_t round_up_to_pow2(const size_t size)
+    {
+        size_t capacity = 1;
+        while (capacity < size) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    // Sleeps until the write index moves or the timeout expires
+    void _sleep(const std::chrono::steady_clock::duration timeout)
+    {
+        const uint32_t read_index = _read_index.load(std::memory_order_relaxed);
+        _consumer_sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint32_t write_index = _write_index.load(std::memory_order_relaxed);
+        if (write_index == read_index) {
+#ifdef UHD_PLATFORM_LINUX
+            const auto ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+            const struct timespec ts = {static_cast<time_t>(ns / 1000000000),
+                static_cast<long>(ns % 1000000000)};
+            // Returns immediately if the write index is no longer the one read
+            // above, so a push between the check and the wait is not missed
+            ::syscall(SYS_futex,
+                reinterpret_cast<uint32_t*>(&_write_index),
+                FUTEX_WAIT_PRIVATE,
+                write_index,
+                &ts,
+                nullptr,
+                0);
+#else
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+            _sleep_cv.wait_for(lock, timeout, [this, write_index]() {
+                return _write_index.load(std::memory_order_relaxed) != write_index;
+            });
+#endif
+        }
+        _consumer_sleeping.store(false, std::memory_order_relaxed);
+    }
+
+    void _wake()
+    {
+#ifdef UHD_PLATFORM_LINUX
+        ::syscall(SYS_futex,
+            reinterpret_cast<uint32_t*>(&_write_index),
+            FUTEX_WAKE_PRIVATE,
+            1,
+            nullptr,
+            nullptr,
+            0);
+#else
+        // Taking the lock ensures the consumer is either waiting on the
+        // condition variable, or has not checked the write index yet
+        { std::lock_guard<std::mutex> lock(_sleep_mutex); }
+        _sleep_cv.notify_one();
+#endif
+    }
+
     const size_t _capacity;
+    const size_t _mask;
+    queue_item_t* _buffer;
+    const wait_policy_t _wait_policy;
+    const size_t _spin_count;
 
-    size_t _read_index  = 0;
-    size_t _write_index = 0;
+    // Written by the producer only. Indices run freely and wrap around, the
+    // item slot is index & _mask.
+    alignas(cache_line_size) std::atomic<uint32_t> _write_index{0};
 
-    // Semaphore gating number of items available to read
-    semaphore _item_sem;
+    // Written by the consumer only
+    alignas(cache_line_size) std::atomic<uint32_t> _read_index{0};
+
+    // Set by the consumer while it sleeps, which is rare, so it gets a cache
+    // line of its own to keep the producer's checks from hitting the line
+    // with the read index
+    alignas(cache_line_size) std::atomic<bool> _consumer_sleeping{false};
+
+#ifndef UHD_PLATFORM_LINUX
+    std::mutex _sleep_mutex;
+    std::condition_variable _sleep_cv;
+#endif
 };
 
 // Object that implements the communication between client and offload thread
@@ -101,22 +258,18 @@ struct client_port_impl_t
 public:
     using sptr = std::shared_ptr<client_port_impl_t>;
 
-    client_port_impl_t(size_t size)
-        : _from_offload_thread(size)
-        , _to_offload_thread(size + 1) // add one for disconnect command
+    client_port_impl_t(size_t size,
+        const offload_io_service::queue_wait_policy_t wait_policy,
+        const size_t spin_count)
+        : _from_offload_thread(size, wait_policy, spin_count)
+        // add one for disconnect command
+        , _to_offload_thread(size + 1, wait_policy, spin_count)
     {
     }
 
     //
     // Client methods
     //
-    frame_buff* client_pop()
-    {
-        from_offload_thread_t queue_element;
-        _from_offload_thread.pop(queue_element);
-        return queue_element.buff;
-    }
-
     frame_buff* client_pop(int32_t timeout_ms)
     {
         from_offload_thread_t queue_element;
@@ -403,6 +556,14 @@ offload_io_service_impl::~offload_io_service_impl()
         _offload_thread->join();
     }
 
+    // Requests that the offload thread did not get to, e.g., detaching the last
+    // link right before the I/O service is released, still hold their links
+    client_req_t client_req;
+    while (_client_connect_queue.pop(client_req)) {
+        (*client_req.req)();
+        delete client_req.req;
+    }
+
     assert(_recv_clients.empty());
     assert(_send_clients.empty());
 }
@@ -469,7 +630,9 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
         throw uhd::runtime_error("Recv client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_recv_frames);
+    auto port = std::make_shared<client_port_t>(num_recv_frames,
+        _offload_thread_params.queue_wait_policy,
+        _offload_thread_params.queue_spin_count);
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn =
@@ -496,13 +659,8 @@ recv_io_if::sptr offload_io_service_impl::make_recv_client(recv_link_if::sptr re
     port->client_wait_until_connected();
 
     // Return a new recv client to the caller that just operates on the queues
-    if (_offload_thread_params.wait_mode == POLL) {
-        return std::make_shared<offload_recv_io<offload_io_service_impl, true>>(
-            shared_from_this(), num_recv_frames, num_send_frames, port);
-    } else {
-        return std::make_shared<offload_recv_io<offload_io_service_impl, false>>(
-            shared_from_this(), num_recv_frames, num_send_frames, port);
-    }
+    return std::make_shared<offload_recv_io<offload_io_service_impl>>(
+        shared_from_this(), num_recv_frames, num_send_frames, port);
 }
 
 send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr send_link,
@@ -519,7 +677,9 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
         throw uhd::runtime_error("Send client not supported by this I/O service");
     }
 
-    auto port = std::make_shared<client_port_t>(num_send_frames);
+    auto port = std::make_shared<client_port_t>(num_send_frames,
+        _offload_thread_params.queue_wait_policy,
+        _offload_thread_params.queue_spin_count);
 
     // Create a request to create a new receiver in the offload thread
     auto req_fn = [this,
@@ -562,14 +722,9 @@ send_io_if::sptr offload_io_service_impl::make_send_client(send_link_if::sptr se
         std::this_thread::sleep_for(std::chrono::microseconds(100));
     }
 
-    // Return a new recv client to the caller that just operates on the queues
-    if (_offload_thread_params.wait_mode == POLL) {
-        return std::make_shared<offload_send_io<offload_io_service_impl, true>>(
-            shared_from_this(), num_recv_frames, num_send_frames, port);
-    } else {
-        return std::make_shared<offload_send_io<offload_io_service_impl, false>>(
-            shared_from_this(), num_recv_frames, num_send_frames, port);
-    }
+    // Return a new send client to the caller that just operates on the queues
+    return std::make_shared<offload_send_io<offload_io_service_impl>>(
+        shared_from_this(), num_recv_frames, num_send_frames, port);
 }
 
 void offload_io_service_impl::_queue_client_req(std::function<void()> fn)
@@ -648,7 +648,7 @@ private:
                         rx_metadata_t metadata = curr_info.metadata;
                         _props[index].handle_overflow();
                         curr_info.metadata = metadata;
-                        UHD_LOG_FASTPATH("O");
+                        UHD_LOG_FASTPATH_EVENT('O', index);
                     }
                     next_info[index].buff.reset(); // No data, so release the buffer
                     next_info[index].copy_buff = nullptr;
@@ -675,7 +675,7 @@ private:
                             _samp_rate);
                     curr_info.metadata.out_of_sequence = true;
                     curr_info.metadata.error_code = rx_metadata_t::ERROR_CODE_OVERFLOW;
-                    UHD_LOG_FASTPATH("D");
+                    UHD_LOG_FASTPATH_EVENT('D', index);
                     return;
             }
 
@@ -4,10 +4,18 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
+#include <uhd/exception.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/adapter.hpp>
 #include <uhdlib/transport/udp_boost_asio_link.hpp>
+#ifdef HAVE_IO_URING
+#    include <uhdlib/transport/io_uring_recv_ring.hpp>
+#endif
 #include <boost/format.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <unordered_set>
 
 using namespace uhd::transport;
 
@@ -19,6 +27,7 @@ udp_boost_asio_link::udp_boost_asio_link(
     , send_link_base_t(params.num_send_frames, params.send_frame_size)
     , _recv_memory_pool(buffer_pool::make(params.num_recv_frames, params.recv_frame_size))
     , _send_memory_pool(buffer_pool::make(params.num_send_frames, params.send_frame_size))
+    , _recv_batch_size(std::max<size_t>(params.recv_batch_size, 1))
 {
     for (size_t i = 0; i < params.num_recv_frames; i++) {
         _recv_buffs.push_back(udp_boost_asio_frame_buff(_recv_memory_pool->at(i)));
@@ -32,6 +41,34 @@ udp_boost_asio_link::udp_boost_asio_link(
         recv_link_base_t::preload_free_buff(&buff);
     }
 
+#ifdef UHD_PLATFORM_LINUX
+    if (_recv_batch_size > 1) {
+        // One datagram of each batch goes into the frame passed in by the
+        // caller, the rest go into spare memory blocks.
+        const size_t num_spare = _recv_batch_size - 1;
+        _recv_batch_pool = buffer_pool::make(num_spare, params.recv_frame_size);
+        for (size_t i = 0; i < num_spare; i++) {
+            _recv_spare_mem.push_back(_recv_batch_pool->at(i));
+        }
+        _recv_staged.reserve(num_spare);
+        _recv_msgs.resize(_recv_batch_size);
+        _recv_iovs.resize(_recv_batch_size);
+        for (size_t i = 0; i < _recv_batch_size; i++) {
+            std::memset(&_recv_msgs[i], 0, sizeof(mmsghdr));
+            _recv_iovs[i].iov_len             = params.recv_frame_size;
+            _recv_msgs[i].msg_hdr.msg_iov    = &_recv_iovs[i];
+            _recv_msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+#else
+    if (_recv_batch_size > 1) {
+        UHD_LOG_WARNING("UDP",
+            "Batched receive (recv_batch_size) is not supported on this platform, "
+            "ignoring.");
+        _recv_batch_size = 1;
+    }
+#endif
+
     for (auto& buff : _send_buffs) {
         send_link_base_t::preload_free_buff(&buff);
     }
@@ -45,10 +82,129 @@ udp_boost_asio_link::udp_boost_asio_link(
     _adapter_id = ctx.register_adapter(info);
 
     UHD_LOGGER_TRACE("UDP") << boost::format("Created UDP link to %s:%s") % addr % port;
+    if (_recv_batch_size > 1) {
+        UHD_LOGGER_TRACE("UDP") << "Receiving up to " << _recv_batch_size
+                                << " datagrams per call";
+    }
     UHD_LOGGER_TRACE("UDP") << boost::format("Local UDP socket endpoint: %s:%s")
                                    % get_local_addr() % get_local_port();
 }
 
+#ifdef UHD_PLATFORM_LINUX
+size_t udp_boost_asio_link::get_recv_buff_batched(
+    udp_boost_asio_frame_buff& buff, int32_t timeout_ms)
+{
+    // Hand out a datagram from the previous batch, if we have one. The memory
+    // of the frame that was passed in becomes a spare block.
+    if (_recv_staged_idx < _recv_staged.size()) {
+        const staged_datagram_t& staged = _recv_staged[_recv_staged_idx++];
+        _recv_spare_mem.push_back(buff.data());
+        buff.set_data(staged.mem);
+        return staged.len;
+    }
+
+    // Nothing staged, so all spare blocks are available for a new batch
+    _recv_staged.clear();
+    _recv_staged_idx = 0;
+    assert(_recv_spare_mem.size() == _recv_batch_size - 1);
+    _recv_iovs[0].iov_base = buff.data();
+    for (size_t i = 1; i < _recv_batch_size; i++) {
+        _recv_iovs[i].iov_base = _recv_spare_mem[i - 1];
+    }
+
+    const size_t num_recvd =
+        recv_udp_packets(_sock_fd, _recv_msgs.data(), _recv_batch_size, timeout_ms);
+    if (num_recvd == 0) {
+        return 0;
+    }
+
+    // Datagrams 1..N-1 landed in the first N-1 spare blocks, move them from
+    // the spare list to the staging list.
+    for (size_t i = 1; i < num_recvd; i++) {
+        _recv_staged.push_back({_recv_iovs[i].iov_base, _recv_msgs[i].msg_len});
+    }
+    _recv_spare_mem.erase(
+        _recv_spare_mem.begin(), _recv_spare_mem.begin() + (num_recvd - 1));
+
+    return _recv_msgs[0].msg_len;
+}
+#endif
+
+void udp_boost_asio_link::enable_io_uring()
+{
+#ifdef HAVE_IO_URING
+    if (_recv_uring) {
+        return;
+    }
+
+    const size_t frame_size = get_recv_frame_size();
+    if (!_recv_uring_pool) {
+        _recv_uring_pool = buffer_pool::make(get_num_recv_frames(), frame_size);
+    }
+
+    // Collect all receive memory. Blocks attached to frames go to the end of
+    // the list, they are posted when the frames come back.
+    std::vector<iovec> regions;
+    std::vector<void*> blocks;
+    auto add_pool = [&](buffer_pool::sptr pool) {
+        const size_t n = pool->size();
+        regions.push_back({pool->at(0),
+            static_cast<size_t>(static_cast<char*>(pool->at(n - 1))
+                                - static_cast<char*>(pool->at(0)))
+                + frame_size});
+        for (size_t i = 0; i < n; i++) {
+            blocks.push_back(pool->at(i));
+        }
+    };
+    add_pool(_recv_memory_pool);
+    add_pool(_recv_uring_pool);
+    if (_recv_batch_pool) {
+        add_pool(_recv_batch_pool);
+        _recv_batch_size = 1;
+        _recv_staged.clear();
+        _recv_staged_idx = 0;
+    }
+
+    std::unordered_set<void*> attached;
+    for (auto& buff : _recv_buffs) {
+        attached.insert(buff.data());
+    }
+    const auto first_attached = std::stable_partition(blocks.begin(),
+        blocks.end(),
+        [&attached](void* mem) { return attached.count(mem) == 0; });
+    const size_t num_posted = first_attached - blocks.begin();
+
+    _recv_uring = std::make_shared<io_uring_recv_ring>(
+        _sock_fd, frame_size, regions, blocks, num_posted);
+    UHD_LOGGER_TRACE("UDP") << "Receiving through io_uring, " << num_posted
+                            << " reads posted";
+#else
+    throw uhd::not_implemented_error("UHD was built without io_uring support");
+#endif
+}
+
+void udp_boost_asio_link::disable_io_uring()
+{
+    // Frames may still point into the io_uring memory, so only drop the ring
+    _recv_uring.reset();
+}
+
+size_t udp_boost_asio_link::get_recv_buff_uring(
+    udp_boost_asio_frame_buff& UHD_UNUSED(buff), int32_t UHD_UNUSED(timeout_ms))
+{
+#ifdef HAVE_IO_URING
+    void* mem;
+    const size_t len = _recv_uring->recv(mem, timeout_ms);
+    if (len > 0) {
+        _recv_uring->post(buff.data());
+        buff.set_data(mem);
+    }
+    return len;
+#else
+    UHD_THROW_INVALID_CODE_PATH();
+#endif
+}
+
 uint16_t udp_boost_asio_link::get_local_port() const
 {
     return _socket->local_endpoint().port();
@@ -64,6 +64,8 @@ udp_dpdk_link::udp_dpdk_link(dpdk::port_id_t port_id,
 
     // Get an unused UDP port for listening
     _local_port = _port->alloc_udp_port(convert_port(local_port, "local"));
+    // Pick the DMA queue (and thus, the I/O service) for this link
+    _queue = _port->steer_udp_port(_local_port);
 
     // Validate params
     const size_t max_frame_size = _port->get_mtu() - dpdk::HDR_SIZE_UDP_IPV4;
@@ -91,6 +93,11 @@ udp_dpdk_link::udp_dpdk_link(dpdk::port_id_t port_id,
                % params.send_frame_size;
 }
 
+udp_dpdk_link::~udp_dpdk_link()
+{
+    _port->unsteer_udp_port(_local_port);
+}
+
 udp_dpdk_link::sptr udp_dpdk_link::make(const std::string& remote_addr,
     const std::string& remote_port,
     const link_params_t& params)
@@ -0,0 +1,336 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/cast.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/adapter.hpp>
+#include <uhdlib/transport/udp_xdp_link.hpp>
+#include <uhdlib/utils/narrow.hpp>
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+//! How long to wait for the kernel to resolve the remote MAC address
+constexpr auto ARP_TIMEOUT = std::chrono::seconds(1);
+
+//! Port of the datagram that makes the kernel resolve a MAC address (discard)
+constexpr uint16_t ARP_TRIGGER_PORT = 9;
+
+link_params_t cap_frame_sizes(const link_params_t& params)
+{
+    link_params_t capped = params;
+    if (capped.recv_frame_size > xdp::MAX_PAYLOAD_SIZE
+        || capped.send_frame_size > xdp::MAX_PAYLOAD_SIZE) {
+        UHD_LOG_DEBUG("XDP",
+            "Reducing frame sizes to the AF_XDP maximum of " << xdp::MAX_PAYLOAD_SIZE
+                                                             << " bytes");
+        capped.recv_frame_size = std::min(capped.recv_frame_size, xdp::MAX_PAYLOAD_SIZE);
+        capped.send_frame_size = std::min(capped.send_frame_size, xdp::MAX_PAYLOAD_SIZE);
+    }
+    return capped;
+}
+
+//! Find the name of the interface that owns the given IPv4 address
+std::string get_iface_name(const uint32_t ipv4_addr)
+{
+    ifaddrs* ifa_list = nullptr;
+    if (getifaddrs(&ifa_list) != 0) {
+        throw uhd::os_error(
+            std::string("XDP: Failed to list network interfaces: ") + strerror(errno));
+    }
+    std::string name;
+    for (ifaddrs* ifa = ifa_list; ifa != nullptr; ifa = ifa->ifa_next) {
+        if (ifa->ifa_addr && ifa->ifa_addr->sa_family == AF_INET
+            && reinterpret_cast<sockaddr_in*>(ifa->ifa_addr)->sin_addr.s_addr
+                   == ipv4_addr) {
+            name = ifa->ifa_name;
+            break;
+        }
+    }
+    freeifaddrs(ifa_list);
+    return name;
+}
+
+//! Look up an IPv4 address in the kernel's neighbor table
+bool lookup_arp_cache(
+    const std::string& iface, const std::string& ip_addr, uint8_t (&mac)[6])
+{
+    std::ifstream arp_table("/proc/net/arp");
+    std::string line;
+    std::getline(arp_table, line); // Skip header
+    while (std::getline(arp_table, line)) {
+        std::istringstream fields(line);
+        std::string ip, hw_type, flags, mac_str, mask, device;
+        fields >> ip >> hw_type >> flags >> mac_str >> mask >> device;
+        // Flags 0x0 means the entry is incomplete
+        if (ip != ip_addr || device != iface || flags == "0x0") {
+            continue;
+        }
+        unsigned int bytes[6];
+        if (std::sscanf(mac_str.c_str(),
+                "%x:%x:%x:%x:%x:%x",
+                &bytes[0],
+                &bytes[1],
+                &bytes[2],
+                &bytes[3],
+                &bytes[4],
+                &bytes[5])
+            != 6) {
+            continue;
+        }
+        for (size_t i = 0; i < 6; i++) {
+            mac[i] = static_cast<uint8_t>(bytes[i]);
+        }
+        return true;
+    }
+    return false;
+}
+
+//! Ones' complement checksum of an IPv4 header without options
+uint16_t ipv4_hdr_checksum(const uint8_t* hdr)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < 20; i += 2) {
+        sum += (uint32_t(hdr[i]) << 8) | hdr[i + 1];
+    }
+    while (sum >> 16) {
+        sum = (sum & 0xFFFF) + (sum >> 16);
+    }
+    return htons(static_cast<uint16_t>(~sum));
+}
+
+} // namespace
+
+udp_xdp_link::udp_xdp_link(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const uhd::device_addr_t& link_args)
+    : recv_link_base_t(params.num_recv_frames, params.recv_frame_size)
+    , send_link_base_t(params.num_send_frames, params.send_frame_size)
+    , _recv_buffs(params.num_recv_frames)
+    , _send_buffs(params.num_send_frames)
+{
+    if (inet_pton(AF_INET, addr.c_str(), &_remote_ipv4) != 1) {
+        throw uhd::value_error(std::string("XDP: Invalid destination address ") + addr);
+    }
+    _remote_port = htons(uhd::narrow<uint16_t>(uhd::cast::from_str<size_t>(port)));
+
+    // Let the kernel pick the local address and port. The socket stays open
+    // so the kernel doesn't hand out the same port to anyone else.
+    _kernel_sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_kernel_sock < 0) {
+        throw uhd::os_error(std::string("XDP: Failed to open socket: ") + strerror(errno));
+    }
+    sockaddr_in remote_sa;
+    std::memset(&remote_sa, 0, sizeof(remote_sa));
+    remote_sa.sin_family      = AF_INET;
+    remote_sa.sin_addr.s_addr = _remote_ipv4;
+    remote_sa.sin_port        = _remote_port;
+    sockaddr_in local_sa;
+    socklen_t local_sa_len = sizeof(local_sa);
+    if (connect(_kernel_sock, reinterpret_cast<sockaddr*>(&remote_sa), sizeof(remote_sa))
+            != 0
+        || getsockname(_kernel_sock, reinterpret_cast<sockaddr*>(&local_sa), &local_sa_len)
+               != 0) {
+        const std::string err = strerror(errno);
+        close(_kernel_sock);
+        throw uhd::os_error("XDP: No route to " + addr + ": " + err);
+    }
+    _local_port = local_sa.sin_port;
+
+    xdp::iface_info_t iface;
+    iface.ipv4_addr = local_sa.sin_addr.s_addr;
+    iface.name      = link_args.get("xdp_iface", get_iface_name(iface.ipv4_addr));
+    if (iface.name.empty() || iface.name.size() >= IFNAMSIZ) {
+        close(_kernel_sock);
+        throw uhd::runtime_error(
+            "XDP: Could not determine the network interface for " + addr);
+    }
+    ifreq ifr;
+    std::memset(&ifr, 0, sizeof(ifr));
+    std::strncpy(ifr.ifr_name, iface.name.c_str(), IFNAMSIZ - 1);
+    if (ioctl(_kernel_sock, SIOCGIFHWADDR, &ifr) != 0) {
+        const std::string err = strerror(errno);
+        close(_kernel_sock);
+        throw uhd::os_error("XDP: Failed to get MAC address of " + iface.name + ": " + err);
+    }
+    std::memcpy(iface.mac_addr, ifr.ifr_hwaddr.sa_data, 6);
+
+    // We write the Ethernet headers ourselves, so we need the remote MAC
+    // address. ARP stays with the kernel (the XDP program passes it on), so
+    // ask the kernel's neighbor table, and make it resolve the address first
+    // if needed.
+    if (!lookup_arp_cache(iface.name, addr, _remote_mac)) {
+        remote_sa.sin_port = htons(ARP_TRIGGER_PORT);
+        sendto(_kernel_sock,
+            nullptr,
+            0,
+            MSG_DONTWAIT,
+            reinterpret_cast<sockaddr*>(&remote_sa),
+            sizeof(remote_sa));
+        const auto deadline = std::chrono::steady_clock::now() + ARP_TIMEOUT;
+        while (!lookup_arp_cache(iface.name, addr, _remote_mac)) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                close(_kernel_sock);
+                throw uhd::runtime_error("XDP: Could not resolve MAC address of " + addr
+                                         + " on " + iface.name);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    // There is no sensible default queue: packets for this link only reach
+    // the socket if they arrive on its queue, which depends on the NIC's
+    // flow steering.
+    if (!link_args.has_key("xdp_queue")) {
+        close(_kernel_sock);
+        throw uhd::value_error("XDP: The xdp_queue argument is required, it must "
+                               "name the NIC queue the device's packets are steered to");
+    }
+    try {
+        _port = xdp::xsk_port::get(iface,
+            link_args.cast<uint32_t>("xdp_queue", 0),
+            link_args.cast<size_t>("xdp_num_frames", xdp::DEFAULT_NUM_CHUNKS));
+        _port->add_endpoint(_local_port, _remote_ipv4, params.num_recv_frames);
+    } catch (...) {
+        close(_kernel_sock);
+        throw;
+    }
+
+    for (auto& buff : _recv_buffs) {
+        recv_link_base_t::preload_free_buff(&buff);
+    }
+    for (auto& buff : _send_buffs) {
+        send_link_base_t::preload_free_buff(&buff);
+    }
+
+    auto info   = udp_xdp_adapter_info(_port->to_string());
+    auto& ctx   = adapter_ctx::get();
+    _adapter_id = ctx.register_adapter(info);
+
+    UHD_LOGGER_TRACE("XDP") << boost::format("Created AF_XDP link to %s:%s via %s, "
+                                             "local UDP port %d")
+                                   % addr % port % _port->to_string()
+                                   % ntohs(_local_port);
+}
+
+udp_xdp_link::~udp_xdp_link()
+{
+    // Send frames that were released without sending still hold a chunk
+    for (auto& buff : _send_buffs) {
+        if (buff.get_chunk() != udp_xdp_frame_buff::NO_CHUNK) {
+            _port->release_send_chunk(buff.get_chunk());
+        }
+    }
+    _port->remove_endpoint(_local_port);
+    close(_kernel_sock);
+}
+
+udp_xdp_link::sptr udp_xdp_link::make(const std::string& addr,
+    const std::string& port,
+    const link_params_t& params,
+    const uhd::device_addr_t& link_args)
+{
+    UHD_ASSERT_THROW(params.num_recv_frames != 0);
+    UHD_ASSERT_THROW(params.num_send_frames != 0);
+    UHD_ASSERT_THROW(params.recv_frame_size != 0);
+    UHD_ASSERT_THROW(params.send_frame_size != 0);
+
+    return sptr(new udp_xdp_link(addr, port, cap_frame_sizes(params), link_args));
+}
+
+size_t udp_xdp_link::get_recv_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    xdp::rx_desc_t desc;
+    if (!_port->recv(_local_port, desc, timeout_ms)) {
+        return 0;
+    }
+    static_cast<udp_xdp_frame_buff&>(buff).set_chunk(desc.addr, desc.payload);
+    return desc.payload_size;
+}
+
+void udp_xdp_link::release_recv_buff_derived(frame_buff& buff)
+{
+    auto& xdp_buff = static_cast<udp_xdp_frame_buff&>(buff);
+    _port->release_recv(xdp_buff.get_chunk());
+    xdp_buff.set_chunk(udp_xdp_frame_buff::NO_CHUNK, nullptr);
+}
+
+bool udp_xdp_link::get_send_buff_derived(frame_buff& buff, int32_t timeout_ms)
+{
+    auto& xdp_buff = static_cast<udp_xdp_frame_buff&>(buff);
+    // A frame that was released empty keeps its chunk
+    if (xdp_buff.get_chunk() != udp_xdp_frame_buff::NO_CHUNK) {
+        return true;
+    }
+    uint64_t addr;
+    if (!_port->get_send_chunk(addr, timeout_ms)) {
+        return false;
+    }
+    xdp_buff.set_chunk(addr, _port->get_chunk_data(addr) + xdp::HDR_SIZE_UDP_IPV4);
+    return true;
+}
+
+void udp_xdp_link::release_send_buff_derived(frame_buff& buff)
+{
+    auto& xdp_buff      = static_cast<udp_xdp_frame_buff&>(buff);
+    const uint64_t addr = xdp_buff.get_chunk();
+    _write_headers(_port->get_chunk_data(addr), buff.packet_size());
+    _port->send(addr, xdp::HDR_SIZE_UDP_IPV4 + buff.packet_size());
+    xdp_buff.set_chunk(udp_xdp_frame_buff::NO_CHUNK, nullptr);
+}
+
+void udp_xdp_link::_write_headers(uint8_t* frame, const size_t payload_size)
+{
+    const xdp::iface_info_t& iface = _port->get_iface();
+
+    // Ethernet
+    std::memcpy(frame, _remote_mac, 6);
+    std::memcpy(frame + 6, iface.mac_addr, 6);
+    frame[12] = 0x08;
+    frame[13] = 0x00;
+
+    // IPv4, no options, don't fragment
+    uint8_t* ip            = frame + 14;
+    const uint16_t ip_len  = htons(static_cast<uint16_t>(20 + 8 + payload_size));
+    const uint16_t ip_frag = htons(0x4000);
+    const uint16_t zero    = 0;
+    ip[0]                  = 0x45;
+    ip[1]                  = 0;
+    std::memcpy(ip + 2, &ip_len, 2);
+    std::memcpy(ip + 4, &zero, 2);
+    std::memcpy(ip + 6, &ip_frag, 2);
+    ip[8] = 64; // TTL
+    ip[9] = 17; // UDP
+    std::memcpy(ip + 10, &zero, 2);
+    std::memcpy(ip + 12, &iface.ipv4_addr, 4);
+    std::memcpy(ip + 16, &_remote_ipv4, 4);
+    const uint16_t ip_csum = ipv4_hdr_checksum(ip);
+    std::memcpy(ip + 10, &ip_csum, 2);
+
+    // UDP, checksum is optional for IPv4
+    uint8_t* udp           = ip + 20;
+    const uint16_t udp_len = htons(static_cast<uint16_t>(8 + payload_size));
+    std::memcpy(udp, &_local_port, 2);
+    std::memcpy(udp + 2, &_remote_port, 2);
+    std::memcpy(udp + 4, &udp_len, 2);
+    std::memcpy(udp + 6, &zero, 2);
+}
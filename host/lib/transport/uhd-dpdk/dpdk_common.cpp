@@ -5,6 +5,7 @@
 //
 
 #include <uhd/utils/algorithm.hpp>
+#include <uhd/utils/cast.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/dpdk/arp.hpp>
 #include <uhdlib/transport/dpdk/common.hpp>
@@ -27,6 +28,7 @@ constexpr int DEFAULT_MBUF_CACHE_SIZE = 315;
 constexpr uint16_t DPDK_DEFAULT_RING_SIZE    = 512;
 constexpr int DEFAULT_DPDK_LINK_INIT_TIMEOUT = 1000;
 constexpr int LINK_STATUS_INTERVAL           = 250;
+constexpr size_t DEFAULT_BURST_SIZE          = 16;
 
 inline char* eal_add_opt(
     std::vector<const char*>& argv, size_t n, char* dst, const char* opt, const char* arg)
@@ -43,6 +45,15 @@ inline char* eal_add_opt(
     return ptr;
 }
 
+inline char* eal_add_flag(
+    std::vector<const char*>& argv, size_t n, char* dst, const char* flag)
+{
+    UHD_LOG_TRACE("DPDK", flag);
+    strncpy(dst, flag, n);
+    argv.push_back(dst);
+    return dst + strlen(flag) + 1;
+}
+
 inline void separate_rte_ipv4_addr(
     const std::string ipv4, uint32_t& rte_ipv4_addr, uint32_t& netmask)
 {
@@ -54,6 +65,93 @@ inline void separate_rte_ipv4_addr(
     int netbits   = std::atoi(result[1].c_str());
     netmask       = htonl(0xffffffff << (32 - netbits));
 }
+
+//! Return the lcores of a NIC, given as a comma-separated list in dpdk_lcore
+inline std::vector<size_t> get_nic_lcores(const device_addr_t& nic)
+{
+    std::vector<std::string> tokens;
+    boost::algorithm::split(tokens,
+        nic.get("dpdk_lcore"),
+        [](const char& in) { return in == ','; },
+        boost::token_compress_on);
+    std::vector<size_t> lcores;
+    for (auto& token : tokens) {
+        boost::algorithm::trim(token);
+        if (token.empty()) {
+            continue;
+        }
+        const size_t lcore = std::stoul(token);
+        if (uhd::has(lcores, lcore)) {
+            UHD_LOG_THROW(uhd::value_error,
+                "DPDK",
+                "CONFIG: NIC " << nic.get("dpdk_mac", "") << " lists dpdk_lcore " << lcore
+                               << " more than once!");
+        }
+        lcores.push_back(lcore);
+    }
+    UHD_ASSERT_THROW(!lcores.empty());
+    return lcores;
+}
+
+/*! Validate or create a flow rule which steers UDP packets to a queue
+ *
+ * \param port The port ID
+ * \param ipv4 The destination IPv4 address (in network order)
+ * \param udp_port The destination UDP port (in network order)
+ * \param queue The queue to steer the packets to
+ * \param flow If not NULL, create the flow rule and store it here. Otherwise,
+ *             only check if the NIC supports it.
+ * \return 0 on success, else a negative error code
+ */
+int udp_flow_rule(port_id_t port,
+    rte_ipv4_addr ipv4,
+    uint16_t udp_port,
+    queue_id_t queue,
+    struct rte_flow** flow)
+{
+    struct rte_flow_attr attr = {};
+    attr.ingress              = 1;
+
+    struct rte_flow_item_ipv4 ipv4_spec = {};
+    struct rte_flow_item_ipv4 ipv4_mask = {};
+    ipv4_spec.hdr.dst_addr              = ipv4;
+    ipv4_mask.hdr.dst_addr              = 0xffffffff;
+    struct rte_flow_item_udp udp_spec   = {};
+    struct rte_flow_item_udp udp_mask   = {};
+    udp_spec.hdr.dst_port               = udp_port;
+    udp_mask.hdr.dst_port               = 0xffff;
+
+    struct rte_flow_item pattern[4] = {};
+    pattern[0].type                 = RTE_FLOW_ITEM_TYPE_ETH;
+    pattern[1].type                 = RTE_FLOW_ITEM_TYPE_IPV4;
+    pattern[1].spec                 = &ipv4_spec;
+    pattern[1].mask                 = &ipv4_mask;
+    pattern[2].type                 = RTE_FLOW_ITEM_TYPE_UDP;
+    pattern[2].spec                 = &udp_spec;
+    pattern[2].mask                 = &udp_mask;
+    pattern[3].type                 = RTE_FLOW_ITEM_TYPE_END;
+
+    struct rte_flow_action_queue queue_conf = {};
+    queue_conf.index                        = queue;
+    struct rte_flow_action actions[2]       = {};
+    actions[0].type                         = RTE_FLOW_ACTION_TYPE_QUEUE;
+    actions[0].conf                         = &queue_conf;
+    actions[1].type                         = RTE_FLOW_ACTION_TYPE_END;
+
+    struct rte_flow_error error = {};
+    const int retval = rte_flow_validate(port, &attr, pattern, actions, &error);
+    if (retval || !flow) {
+        return retval;
+    }
+    *flow = rte_flow_create(port, &attr, pattern, actions, &error);
+    if (!*flow) {
+        UHD_LOG_WARNING("DPDK",
+            "Port " << port << ": Could not create flow rule: "
+                    << (error.message ? error.message : "unknown error"));
+        return -rte_errno;
+    }
+    return 0;
+}
 } // namespace
 
 dpdk_port::uptr dpdk_port::make(port_id_t port,
@@ -106,15 +204,16 @@ dpdk_port::dpdk_port(port_id_t port,
     uint64_t rx_offloads            = DEV_RX_OFFLOAD_IPV4_CKSUM;
     uint64_t tx_offloads            = DEV_TX_OFFLOAD_IPV4_CKSUM;
 #endif
-    if ((dev_info.rx_offload_capa & rx_offloads) != rx_offloads) {
-        UHD_LOGGER_ERROR("DPDK") << boost::format("%d: Only supports RX offloads 0x%0llx")
-                                        % _port % dev_info.rx_offload_capa;
-        throw uhd::runtime_error("DPDK: Missing required RX offloads");
-    }
-    if ((dev_info.tx_offload_capa & tx_offloads) != tx_offloads) {
-        UHD_LOGGER_ERROR("DPDK") << boost::format("%d: Only supports TX offloads 0x%0llx")
-                                        % _port % dev_info.tx_offload_capa;
-        throw uhd::runtime_error("DPDK: Missing required TX offloads");
+    if ((dev_info.rx_offload_capa & rx_offloads) != rx_offloads
+        || (dev_info.tx_offload_capa & tx_offloads) != tx_offloads) {
+        // Virtual devices (e.g., net_ring) don't offload anything
+        UHD_LOGGER_WARNING("DPDK")
+            << boost::format("%d: Only supports RX offloads 0x%0llx, TX offloads "
+                             "0x%0llx. Computing IPv4 checksums in software.")
+                   % _port % dev_info.rx_offload_capa % dev_info.tx_offload_capa;
+        _hw_cksum   = false;
+        rx_offloads = 0;
+        tx_offloads = 0;
     }
 
     // Check number of available queues
@@ -128,7 +227,8 @@ dpdk_port::dpdk_port(port_id_t port,
 
     struct rte_eth_conf port_conf = {};
 #ifdef DEV_RX_OFFLOAD_JUMBO_FRAME
-    port_conf.rxmode.offloads = rx_offloads | DEV_RX_OFFLOAD_JUMBO_FRAME;
+    port_conf.rxmode.offloads =
+        rx_offloads | (dev_info.rx_offload_capa & DEV_RX_OFFLOAD_JUMBO_FRAME);
 #else
     port_conf.rxmode.offloads       = rx_offloads;
 #endif
@@ -138,7 +238,9 @@ dpdk_port::dpdk_port(port_id_t port,
     port_conf.rxmode.max_rx_pkt_len = _mtu;
 #endif
     port_conf.txmode.offloads = tx_offloads;
-    port_conf.intr_conf.lsc   = 1;
+    // Virtual devices don't support link status interrupts
+    port_conf.intr_conf.lsc =
+        (dev_info.dev_flags && (*dev_info.dev_flags & RTE_ETH_DEV_INTR_LSC)) ? 1 : 0;
 
     retval = rte_eth_dev_configure(_port, _num_queues, _num_queues, &port_conf);
     if (retval != 0) {
@@ -203,11 +305,7 @@ dpdk_port::dpdk_port(port_id_t port,
         }
 
         struct rte_eth_txconf txconf = dev_info.default_txconf;
-#ifdef RTE_ETH_TX_OFFLOAD_IPV4_CKSUM
-        txconf.offloads = RTE_ETH_TX_OFFLOAD_IPV4_CKSUM;
-#else
-        txconf.offloads = DEV_TX_OFFLOAD_IPV4_CKSUM;
-#endif
+        txconf.offloads              = tx_offloads;
         retval = rte_eth_tx_queue_setup(_port, i, tx_desc, cpu_socket, &txconf);
         if (retval < 0) {
             UHD_LOGGER_ERROR("DPDK")
@@ -216,8 +314,6 @@ dpdk_port::dpdk_port(port_id_t port,
         }
     }
 
-    /* TODO: Enable multiple queues (only support 1 right now) */
-
     /* Start the Ethernet device */
     retval = rte_eth_dev_start(_port);
     if (retval < 0) {
@@ -226,6 +322,25 @@ dpdk_port::dpdk_port(port_id_t port,
         throw uhd::runtime_error("DPDK: Failure to start device");
     }
 
+    /* Check how packets can be steered to the DMA queues */
+    _queue_users.resize(_num_queues, 0);
+    if (_num_queues > 1) {
+        if (std::string(dev_info.driver_name) == "net_ring") {
+            // The queues of a net_ring device are loopback pairs: What is sent
+            // on TX queue N is received on RX queue N, so the packets end up
+            // on the queue of the link that sent them.
+            _steering = true;
+        } else if (udp_flow_rule(_port, _ipv4, 0xffff, _num_queues - 1, NULL) == 0) {
+            _steering   = true;
+            _flow_rules = true;
+        } else {
+            UHD_LOGGER_WARNING("DPDK")
+                << boost::format("Port %d: Flow rules are not supported, only using "
+                                 "DMA queue 0 of %d")
+                       % _port % _num_queues;
+        }
+    }
+
     /* Grab and display the port MAC address. */
     rte_eth_macaddr_get(_port, &_mac_addr);
     UHD_LOGGER_TRACE("DPDK") << "Port " << _port
@@ -234,8 +349,12 @@ dpdk_port::dpdk_port(port_id_t port,
 
 dpdk_port::~dpdk_port()
 {
+    if (_flow_rules) {
+        struct rte_flow_error error;
+        rte_flow_flush(_port, &error);
+    }
     rte_eth_dev_stop(_port);
-    rte_spinlock_lock(&_spinlock);
+    std::lock_guard<std::mutex> lock(_mutex);
     for (auto kv : _arp_table) {
         for (auto req : kv.second->reqs) {
             req->cond.notify_one();
@@ -243,7 +362,6 @@ dpdk_port::~dpdk_port()
         rte_free(kv.second);
     }
     _arp_table.clear();
-    rte_spinlock_unlock(&_spinlock);
 }
 
 uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
@@ -279,6 +397,46 @@ uint16_t dpdk_port::alloc_udp_port(uint16_t udp_port)
     return rte_cpu_to_be_16(port_selected);
 }
 
+queue_id_t dpdk_port::steer_udp_port(uint16_t udp_port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_udp_queues.count(udp_port)) {
+        return _udp_queues.at(udp_port).first;
+    }
+    queue_id_t queue = 0;
+    if (_steering) {
+        queue = static_cast<queue_id_t>(
+            std::min_element(_queue_users.begin(), _queue_users.end())
+            - _queue_users.begin());
+    }
+    struct rte_flow* flow = nullptr;
+    if (_flow_rules && udp_flow_rule(_port, _ipv4, udp_port, queue, &flow)) {
+        // Can't steer this one, so it goes where unmatched packets go
+        queue = 0;
+    }
+    UHD_LOG_TRACE("DPDK",
+        "Port " << _port << ": Steering UDP port " << rte_be_to_cpu_16(udp_port)
+                << " to queue " << queue);
+    _queue_users.at(queue)++;
+    _udp_queues[udp_port] = {queue, flow};
+    return queue;
+}
+
+void dpdk_port::unsteer_udp_port(uint16_t udp_port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_udp_queues.count(udp_port)) {
+        return;
+    }
+    const auto queue_flow = _udp_queues.at(udp_port);
+    if (queue_flow.second) {
+        struct rte_flow_error error;
+        rte_flow_destroy(_port, queue_flow.second, &error);
+    }
+    _queue_users.at(queue_flow.first)--;
+    _udp_queues.erase(udp_port);
+}
+
 int dpdk_port::_arp_reply(queue_id_t queue_id, struct rte_arp_hdr* arp_req)
 {
     struct rte_mbuf* mbuf;
@@ -411,8 +569,26 @@ void dpdk_ctx::_eal_init(const device_addr_t& eal_args)
             opt = eal_add_opt(argv, end - opt, opt, "--huge-dir", val.c_str());
         } else if (key == "dpdk_file_prefix") {
             opt = eal_add_opt(argv, end - opt, opt, "--file-prefix", val.c_str());
+        } else if (key == "dpdk_no_huge") {
+            /* Only sensible for virtual devices, NICs need hugepages for DMA */
+            if (uhd::cast::from_str<bool>(val)) {
+                opt = eal_add_flag(argv, end - opt, opt, "--no-huge");
+            }
         } else if (key == "dpdk_driver") {
             opt = eal_add_opt(argv, end - opt, opt, "-d", val.c_str());
+        } else if (key == "dpdk_vdev") {
+            /* NOTE: vdev args may have commas, so multiple vdevs are separated
+             * by spaces */
+            std::vector<std::string> vdevs;
+            boost::algorithm::split(vdevs,
+                val,
+                [](const char& in) { return in == ' '; },
+                boost::token_compress_on);
+            for (const auto& vdev : vdevs) {
+                if (!vdev.empty()) {
+                    opt = eal_add_opt(argv, end - opt, opt, "--vdev", vdev.c_str());
+                }
+            }
         }
         /* TODO: Change where log goes?
            int rte_openlog_stream( FILE * f)
@@ -472,6 +648,19 @@ void dpdk_ctx::init(const device_addr_t& user_args)
         _link_init_timeout =
             dpdk_args.cast<int>("dpdk_link_timeout", DEFAULT_DPDK_LINK_INIT_TIMEOUT);
 
+        _rx_burst_size = dpdk_args.cast<size_t>("dpdk_rx_burst", DEFAULT_BURST_SIZE);
+        _tx_burst_size = dpdk_args.cast<size_t>("dpdk_tx_burst", DEFAULT_BURST_SIZE);
+        for (const size_t burst_size : {_rx_burst_size, _tx_burst_size}) {
+            if (burst_size == 0 || burst_size > dpdk_io_service::MAX_BURST_SIZE) {
+                UHD_LOG_THROW(uhd::value_error,
+                    "DPDK",
+                    "CONFIG: Burst sizes must be within [1, "
+                        << dpdk_io_service::MAX_BURST_SIZE << "], got " << burst_size);
+            }
+        }
+        UHD_LOG_TRACE("DPDK",
+            "rx_burst: " << _rx_burst_size << " tx_burst: " << _tx_burst_size);
+
         /* Get device info for all the NIC ports */
         int num_dpdk_ports = rte_eth_dev_count_avail();
         if (num_dpdk_ports == 0) {
@@ -484,6 +673,12 @@ void dpdk_ctx::init(const device_addr_t& user_args)
             struct rte_ether_addr mac_addr;
             rte_eth_macaddr_get(i, &mac_addr);
             nics[i]["dpdk_mac"] = eth_addr_to_string(mac_addr);
+            /* Virtual devices may have random MAC addresses, so they can also
+             * be configured by name */
+            char name[RTE_ETH_NAME_MAX_LEN];
+            if (rte_eth_dev_get_name_by_port(i, name) == 0) {
+                nics[i]["dpdk_name"] = name;
+            }
         }
 
         /* Get user configuration for each NIC port */
@@ -493,8 +688,11 @@ void dpdk_ctx::init(const device_addr_t& user_args)
         {
             auto& nic = nics.at(i);
             for (const auto& arg : args) {
-                /* Match DPDK-discovered NICs and user config via MAC addr */
-                if (arg.has_key("dpdk_mac") && nic["dpdk_mac"] == arg["dpdk_mac"]) {
+                /* Match DPDK-discovered NICs and user config via MAC addr
+                 * or device name */
+                if ((arg.has_key("dpdk_mac") && nic["dpdk_mac"] == arg["dpdk_mac"])
+                    || (arg.has_key("dpdk_name") && nic.has_key("dpdk_name")
+                        && nic["dpdk_name"] == arg["dpdk_name"])) {
                     /* Copy user args for discovered NICs */
                     nic.update(arg, false);
                     break;
@@ -502,14 +700,15 @@ void dpdk_ctx::init(const device_addr_t& user_args)
             }
             /* Now combine user args with conf file */
             auto conf = uhd::prefs::get_dpdk_nic_args(nic);
-            // TODO: Enable the use of multiple DMA queues
-            conf["dpdk_num_queues"] = "1";
 
             /* Update config, and remove ports that aren't fully configured */
             if (conf.has_key("dpdk_ipv4")) {
-                nics[i] = conf;
+                UHD_ASSERT_THROW(conf.has_key("dpdk_lcore"));
+                /* One DMA queue per lcore */
+                conf["dpdk_num_queues"] = std::to_string(get_nic_lcores(conf).size());
+                nics[i]                 = conf;
                 /* Update queue count, to generate a large enough mempool */
-                queue_count += conf.cast<uint16_t>("dpdk_num_queues", rte_lcore_count());
+                queue_count += conf.cast<uint16_t>("dpdk_num_queues", 1);
             } else {
                 nics[i] = device_addr_t();
             }
@@ -526,30 +725,29 @@ void dpdk_ctx::init(const device_addr_t& user_args)
             {
                 auto& nic = nics.at(i);
                 if (nic.has_key("dpdk_lcore")) {
-                    auto nic_args_lcore_value = nic.get("dpdk_lcore");
-                    if (!uhd::has(uhd::device_addr_t(dpdk_args_corelists_value).keys(),
-                            nic.get("dpdk_lcore"))) {
-                        UHD_LOG_THROW(uhd::runtime_error,
-                            "DPDK",
-                            "CONFIG: NIC(" << i << ") references dpdk_lcore value ["
-                                           << nic_args_lcore_value
-                                           << "] which is not found in dpdk_corelist ["
-                                           << dpdk_args_corelists_value << "] !");
+                    for (const size_t lcore : get_nic_lcores(nic)) {
+                        if (!uhd::has(
+                                uhd::device_addr_t(dpdk_args_corelists_value).keys(),
+                                std::to_string(lcore))) {
+                            UHD_LOG_THROW(uhd::runtime_error,
+                                "DPDK",
+                                "CONFIG: NIC("
+                                    << i << ") references dpdk_lcore value [" << lcore
+                                    << "] which is not found in dpdk_corelist ["
+                                    << dpdk_args_corelists_value << "] !");
+                        }
                     }
                 }
             }
         }
 
-        std::map<size_t, std::vector<size_t>> lcore_to_port_id_map;
+        std::map<size_t, std::vector<std::pair<size_t, queue_id_t>>>
+            lcore_to_port_id_map;
         RTE_ETH_FOREACH_DEV(i)
         {
             auto& conf = nics.at(i);
             if (conf.has_key("dpdk_ipv4")) {
-                UHD_ASSERT_THROW(conf.has_key("dpdk_lcore"));
-                const size_t lcore_id = conf.cast<size_t>("dpdk_lcore", 0);
-                if (!lcore_to_port_id_map.count(lcore_id)) {
-                    lcore_to_port_id_map.insert({lcore_id, {}});
-                }
+                const auto lcores = get_nic_lcores(conf);
 
                 // Allocating enough buffers for all DMA queues for each CPU socket
                 // (or alternative for each NIC if there are no restrictions
@@ -577,14 +775,19 @@ void dpdk_ctx::init(const device_addr_t& user_args)
                                         << conf.to_pp_string());
                 _ports[i] = dpdk_port::make(i,
                     _mtu,
-                    conf.cast<uint16_t>("dpdk_num_queues", rte_lcore_count()),
+                    conf.cast<uint16_t>("dpdk_num_queues", 1),
                     conf.cast<uint16_t>("dpdk_num_desc", DPDK_DEFAULT_RING_SIZE),
                     rx_pool,
                     tx_pool,
                     conf["dpdk_ipv4"]);
 
-                // Remember all port IDs that map to an lcore
-                lcore_to_port_id_map.at(lcore_id).push_back(i);
+                // Remember all port IDs (and their queue) that map to an lcore. If
+                // the NIC has fewer queues than lcores, the extra lcores are unused.
+                const size_t num_queues = _ports[i]->get_queue_count();
+                for (size_t queue = 0; queue < num_queues; queue++) {
+                    lcore_to_port_id_map[lcores.at(queue)].push_back(
+                        {i, static_cast<queue_id_t>(queue)});
+                }
             }
         }
 
@@ -626,9 +829,12 @@ void dpdk_ctx::init(const device_addr_t& user_args)
         for (auto& lcore_portids_pair : lcore_to_port_id_map) {
             const size_t lcore_id = lcore_portids_pair.first;
             std::vector<dpdk_port*> dpdk_ports;
+            std::vector<queue_id_t> dpdk_queues;
             dpdk_ports.reserve(lcore_portids_pair.second.size());
-            for (const size_t port_id : lcore_portids_pair.second) {
-                dpdk_ports.push_back(get_port(port_id));
+            dpdk_queues.reserve(lcore_portids_pair.second.size());
+            for (const auto& port_queue : lcore_portids_pair.second) {
+                dpdk_ports.push_back(get_port(port_queue.first));
+                dpdk_queues.push_back(port_queue.second);
             }
             const size_t servq_depth = 32; // FIXME
             UHD_LOG_TRACE("DPDK",
@@ -636,7 +842,12 @@ void dpdk_ctx::init(const device_addr_t& user_args)
                     << lcore_id << ", servicing " << dpdk_ports.size()
                     << " ports, service queue depth " << servq_depth);
             _io_srv_portid_map.insert(
-                {uhd::transport::dpdk_io_service::make(lcore_id, dpdk_ports, servq_depth),
+                {uhd::transport::dpdk_io_service::make(lcore_id,
+                     dpdk_ports,
+                     dpdk_queues,
+                     servq_depth,
+                     _rx_burst_size,
+                     _tx_burst_size),
                     lcore_portids_pair.second});
         }
     }
@@ -714,16 +925,18 @@ bool dpdk_ctx::is_init_done(void) const
     return _init_done.load();
 }
 
-uhd::transport::dpdk_io_service::sptr dpdk_ctx::get_io_service(const size_t port_id)
+uhd::transport::dpdk_io_service::sptr dpdk_ctx::get_io_service(
+    const size_t port_id, const queue_id_t queue_id)
 {
     for (auto& io_srv_portid_pair : _io_srv_portid_map) {
-        if (uhd::has(io_srv_portid_pair.second, port_id)) {
+        if (uhd::has(io_srv_portid_pair.second, std::make_pair(port_id, queue_id))) {
             return io_srv_portid_pair.first;
         }
     }
 
     std::string err_msg = std::string("Cannot look up I/O service for port ID: ")
-                          + std::to_string(port_id) + ". No such port ID!";
+                          + std::to_string(port_id) + ", queue "
+                          + std::to_string(queue_id) + ". No such port ID or queue!";
     UHD_LOG_ERROR("DPDK", err_msg);
     throw uhd::lookup_error(err_msg);
 }
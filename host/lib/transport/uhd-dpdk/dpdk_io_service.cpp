@@ -10,6 +10,7 @@
 #include <uhdlib/transport/dpdk/udp.hpp>
 #include <uhdlib/transport/dpdk_io_service_client.hpp>
 #include <uhdlib/utils/narrow.hpp>
+#include <algorithm>
 #include <cmath>
 
 /*
@@ -49,17 +50,68 @@
 
 using namespace uhd::transport;
 
-dpdk_io_service::dpdk_io_service(
-    unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth)
+namespace {
+
+//! Return whether the IPv4 header checksum of a received packet is valid
+inline bool ipv4_cksum_ok(const dpdk::dpdk_port* port,
+    const struct rte_mbuf* mbuf,
+    const struct rte_ipv4_hdr* pkt)
+{
+    if (!port->has_hw_cksum()) {
+        // The one's complement sum over a valid header, including the checksum,
+        // is all ones
+        if (rte_raw_cksum(pkt, sizeof(struct rte_ipv4_hdr)) != 0xffff) {
+            UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad IP cksum");
+            return false;
+        }
+        return true;
+    }
+#if RTE_VER_YEAR > 21 || (RTE_VER_YEAR == 21 && RTE_VER_MONTH == 11)
+    const uint64_t cksum_flags = mbuf->ol_flags & RTE_MBUF_F_RX_IP_CKSUM_MASK;
+    if (cksum_flags == RTE_MBUF_F_RX_IP_CKSUM_BAD) {
+        UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad IP cksum");
+        return false;
+    } else if (cksum_flags == RTE_MBUF_F_RX_IP_CKSUM_NONE) {
+#else
+    const uint64_t cksum_flags = mbuf->ol_flags & PKT_RX_IP_CKSUM_MASK;
+    if (cksum_flags == PKT_RX_IP_CKSUM_BAD) {
+        UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad IP cksum");
+        return false;
+    } else if (cksum_flags == PKT_RX_IP_CKSUM_NONE) {
+#endif
+        UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet missing IP cksum");
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+constexpr size_t dpdk_io_service::MAX_BURST_SIZE;
+
+dpdk_io_service::dpdk_io_service(unsigned int lcore_id,
+    std::vector<dpdk::dpdk_port*> ports,
+    std::vector<dpdk::queue_id_t> queues,
+    size_t servq_depth,
+    size_t rx_burst_size,
+    size_t tx_burst_size)
     : _ctx(dpdk::dpdk_ctx::get())
     , _lcore_id(lcore_id)
     , _ports(ports)
+    , _queues(queues)
+    , _rx_burst_size(rx_burst_size)
+    , _tx_burst_size(tx_burst_size)
     , _servq(servq_depth, lcore_id)
 {
+    UHD_ASSERT_THROW(_ports.size() == _queues.size());
+    UHD_ASSERT_THROW(_rx_burst_size > 0 && _rx_burst_size <= MAX_BURST_SIZE);
+    UHD_ASSERT_THROW(_tx_burst_size > 0 && _tx_burst_size <= MAX_BURST_SIZE);
     UHD_LOG_TRACE("DPDK::IO_SERVICE", "Launching I/O service for lcore " << lcore_id);
-    for (auto port : _ports) {
+    for (size_t i = 0; i < _ports.size(); i++) {
+        auto port = _ports[i];
         UHD_LOG_TRACE("DPDK::IO_SERVICE",
-            "lcore_id " << lcore_id << ": Adding port index " << port->get_port_id());
+            "lcore_id " << lcore_id << ": Adding port index " << port->get_port_id()
+                        << ", queue " << _queues[i]);
         _tx_queues[port->get_port_id()]      = std::list<dpdk_send_io*>();
         _recv_xport_map[port->get_port_id()] = std::list<dpdk_recv_io*>();
     }
@@ -69,10 +121,15 @@ dpdk_io_service::dpdk_io_service(
     }
 }
 
-dpdk_io_service::sptr dpdk_io_service::make(
-    unsigned int lcore_id, std::vector<dpdk::dpdk_port*> ports, size_t servq_depth)
+dpdk_io_service::sptr dpdk_io_service::make(unsigned int lcore_id,
+    std::vector<dpdk::dpdk_port*> ports,
+    std::vector<dpdk::queue_id_t> queues,
+    size_t servq_depth,
+    size_t rx_burst_size,
+    size_t tx_burst_size)
 {
-    return dpdk_io_service::sptr(new dpdk_io_service(lcore_id, ports, servq_depth));
+    return dpdk_io_service::sptr(new dpdk_io_service(
+        lcore_id, ports, queues, servq_depth, rx_burst_size, tx_burst_size));
 }
 
 dpdk_io_service::~dpdk_io_service()
@@ -294,8 +351,8 @@ int dpdk_io_service::_io_worker(void* arg)
     int status = 0;
     while (!status) {
         /* For each port, attempt to receive packets and process */
-        for (auto port : srv->_ports) {
-            srv->_rx_burst(port, 0);
+        for (size_t i = 0; i < srv->_ports.size(); i++) {
+            srv->_rx_burst(srv->_ports[i], srv->_queues[i]);
         }
         /* For each port's TX queues, do TX */
         for (auto port : srv->_ports) {
@@ -320,6 +377,10 @@ int dpdk_io_service::_io_worker(void* arg)
                 }
             }
         }
+        /* Retry completing ARP requests */
+        if (!srv->_arp_completions.empty()) {
+            srv->_complete_arp_requests();
+        }
         /* Check for open()/close()/term() requests and service 1 at a time
          * Leave this last so we immediately terminate if requested
          */
@@ -369,7 +430,7 @@ int dpdk_io_service::_service_requests()
                 break;
             }
             case dpdk::wait_type::WAIT_LCORE_TERM:
-                rte_free(_rx_table);
+                rte_hash_free(_rx_table);
                 while (_servq.complete(req) == -ENOBUFS)
                     ;
                 // Return a positive value to indicate we should terminate
@@ -397,7 +458,7 @@ void dpdk_io_service::_service_flow_open(dpdk::wait_req* req)
             .src_port = 0,
             .dst_port = flow_req_data->link->get_local_port()};
         // Check the UDP port isn't in use
-        if (rte_hash_lookup(_rx_table, &ht_key) > 0) {
+        if (rte_hash_lookup(_rx_table, &ht_key) >= 0) {
             req->retval = -EADDRINUSE;
             UHD_LOG_ERROR("DPDK::IO_SERVICE", "Cannot add to RX table");
             while (_servq.complete(req) == -ENOBUFS)
@@ -432,7 +493,7 @@ void dpdk_io_service::_service_flow_close(dpdk::wait_req* req)
             .dst_port = flow_req_data->link->get_local_port()};
         std::list<dpdk_io_if*>* xport_list;
 
-        if (rte_hash_lookup_data(_rx_table, &ht_key, (void**)&xport_list) > 0) {
+        if (rte_hash_lookup_data(_rx_table, &ht_key, (void**)&xport_list) >= 0) {
             UHD_ASSERT_THROW(xport_list->empty());
             delete xport_list;
             rte_hash_del_key(_rx_table, &ht_key);
@@ -543,6 +604,10 @@ void dpdk_io_service::_service_xport_disconnect(dpdk::wait_req* req)
         // Remove from xport list for this NIC port
         auto& xport_list = _tx_queues.at(port->get_port_id());
         xport_list.remove(send_client);
+        while (send_client->_next_staged < send_client->_num_staged) {
+            frame_buff* buff_ptr = send_client->_staged[send_client->_next_staged++];
+            dpdk_io->link->release_send_buff(frame_buff::uptr(buff_ptr));
+        }
         while (!rte_ring_empty(send_client->_send_queue)) {
             frame_buff* buff_ptr = nullptr;
             rte_ring_dequeue(send_client->_send_queue, (void**)&buff_ptr);
@@ -574,7 +639,6 @@ void dpdk_io_service::_service_xport_disconnect(dpdk::wait_req* req)
 
 int dpdk_io_service::_service_arp_request(dpdk::wait_req* req)
 {
-    int status                   = 0;
     auto arp_req_data            = (struct dpdk::arp_request*)req->data;
     dpdk::rte_ipv4_addr dst_addr = arp_req_data->tpa;
     auto ctx_sptr                = _ctx.lock();
@@ -583,37 +647,36 @@ int dpdk_io_service::_service_arp_request(dpdk::wait_req* req)
     UHD_LOG_TRACE("DPDK::IO_SERVICE",
         "ARP: Requesting address for " << dpdk::ipv4_num_to_str(dst_addr));
 
-    rte_spinlock_lock(&port->_spinlock);
-    struct dpdk::arp_entry* entry = NULL;
-    if (port->_arp_table.count(dst_addr) == 0) {
-        entry = (struct dpdk::arp_entry*)rte_zmalloc(NULL, sizeof(*entry), 0);
-        if (!entry) {
-            status = -ENOMEM;
-            goto arp_end;
-        }
-        entry = new (entry) dpdk::arp_entry();
-        entry->reqs.push_back(req);
-        port->_arp_table[dst_addr] = entry;
-        status                     = -EAGAIN;
-        UHD_LOG_TRACE("DPDK::IO_SERVICE", "Address not in table. Sending ARP request.");
-        _send_arp_request(port, 0, arp_req_data->tpa);
-    } else {
-        entry = port->_arp_table.at(dst_addr);
-        if (rte_is_zero_ether_addr(&entry->mac_addr)) {
+    {
+        // All I/O services of the port share its ARP table
+        std::lock_guard<std::mutex> lock(port->_mutex);
+        struct dpdk::arp_entry* entry = NULL;
+        if (port->_arp_table.count(dst_addr) == 0) {
+            entry = (struct dpdk::arp_entry*)rte_zmalloc(NULL, sizeof(*entry), 0);
+            if (!entry) {
+                return -ENOMEM;
+            }
+            entry = new (entry) dpdk::arp_entry();
+            entry->reqs.push_back(req);
+            port->_arp_table[dst_addr] = entry;
+            UHD_LOG_TRACE(
+                "DPDK::IO_SERVICE", "Address not in table. Sending ARP request.");
+        } else {
+            entry = port->_arp_table.at(dst_addr);
+            if (!rte_is_zero_ether_addr(&entry->mac_addr)) {
+                UHD_LOG_TRACE("DPDK::IO_SERVICE", "ARP: Address in table.");
+                rte_ether_addr_copy(&entry->mac_addr, &arp_req_data->tha);
+                return 0;
+            }
             UHD_LOG_TRACE("DPDK::IO_SERVICE",
                 "ARP: Address in table, but not populated yet. Resending ARP request.");
-            port->_arp_table.at(dst_addr)->reqs.push_back(req);
-            status = -EAGAIN;
-            _send_arp_request(port, 0, arp_req_data->tpa);
-        } else {
-            UHD_LOG_TRACE("DPDK::IO_SERVICE", "ARP: Address in table.");
-            rte_ether_addr_copy(&entry->mac_addr, &arp_req_data->tha);
-            status = 0;
+            entry->reqs.push_back(req);
         }
     }
-arp_end:
-    rte_spinlock_unlock(&port->_spinlock);
-    return status;
+    // Once the lock is released, any I/O service of the port may process the
+    // reply and complete req, so don't access it anymore
+    _send_arp_request(port, _get_queue(port), dst_addr);
+    return -EAGAIN;
 }
 
 int dpdk_io_service::_send_arp_request(
@@ -668,38 +731,34 @@ int dpdk_io_service::_rx_burst(dpdk::dpdk_port* port, dpdk::queue_id_t queue)
 {
     struct rte_ether_hdr* hdr;
     char* l2_data;
-    struct rte_mbuf* bufs[RX_BURST_SIZE];
-    const uint16_t num_rx =
-        rte_eth_rx_burst(port->get_port_id(), queue, bufs, RX_BURST_SIZE);
+    struct rte_mbuf* bufs[MAX_BURST_SIZE];
+    const uint16_t num_rx = rte_eth_rx_burst(
+        port->get_port_id(), queue, bufs, static_cast<uint16_t>(_rx_burst_size));
     if (unlikely(num_rx == 0)) {
         return 0;
     }
 
+    // UDP packets are collected, so their flows can be looked up together
+    struct rte_mbuf* udp_bufs[MAX_BURST_SIZE];
+    struct dpdk::ipv4_5tuple udp_keys[MAX_BURST_SIZE];
+    unsigned int num_udp = 0;
     for (int buf = 0; buf < num_rx; buf++) {
-        uint64_t ol_flags = bufs[buf]->ol_flags;
-        hdr               = rte_pktmbuf_mtod(bufs[buf], struct rte_ether_hdr*);
-        l2_data           = (char*)&hdr[1];
+        hdr     = rte_pktmbuf_mtod(bufs[buf], struct rte_ether_hdr*);
+        l2_data = (char*)&hdr[1];
         switch (rte_be_to_cpu_16(hdr->ether_type)) {
             case RTE_ETHER_TYPE_ARP:
                 _process_arp(port, queue, (struct rte_arp_hdr*)l2_data);
                 rte_pktmbuf_free(bufs[buf]);
                 break;
             case RTE_ETHER_TYPE_IPV4:
-
-#if RTE_VER_YEAR > 21 || (RTE_VER_YEAR == 21 && RTE_VER_MONTH == 11)
-                if ((ol_flags & RTE_MBUF_F_RX_IP_CKSUM_MASK)
-                    == RTE_MBUF_F_RX_IP_CKSUM_BAD) {
-                    UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad IP cksum");
-                } else if ((ol_flags & RTE_MBUF_F_RX_IP_CKSUM_MASK)
-                           == RTE_MBUF_F_RX_IP_CKSUM_NONE) {
-#else
-                if ((ol_flags & PKT_RX_IP_CKSUM_MASK) == PKT_RX_IP_CKSUM_BAD) {
-                    UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet has bad IP cksum");
-                } else if ((ol_flags & PKT_RX_IP_CKSUM_MASK) == PKT_RX_IP_CKSUM_NONE) {
-#endif
-                    UHD_LOG_WARNING("DPDK::IO_SERVICE", "RX packet missing IP cksum");
-                } else {
-                    _process_ipv4(port, bufs[buf], (struct rte_ipv4_hdr*)l2_data);
+                if (!ipv4_cksum_ok(port, bufs[buf], (struct rte_ipv4_hdr*)l2_data)) {
+                    rte_pktmbuf_free(bufs[buf]);
+                } else if (_process_ipv4(port,
+                               bufs[buf],
+                               (struct rte_ipv4_hdr*)l2_data,
+                               &udp_keys[num_udp])
+                           == 0) {
+                    udp_bufs[num_udp++] = bufs[buf];
                 }
                 break;
             default:
@@ -707,6 +766,7 @@ int dpdk_io_service::_rx_burst(dpdk::dpdk_port* port, dpdk::queue_id_t queue)
                 break;
         }
     }
+    _process_udp(udp_bufs, udp_keys, num_udp);
     return num_rx;
 }
 
@@ -718,29 +778,37 @@ int dpdk_io_service::_process_arp(
     UHD_LOG_TRACE("DPDK::IO_SERVICE",
         "Processing ARP packet: " << dpdk::ipv4_num_to_str(dest_ip) << " -> "
                                   << dpdk::eth_addr_to_string(dest_addr));
-    /* Add entry to ARP table */
-    rte_spinlock_lock(&port->_spinlock);
-    struct dpdk::arp_entry* entry = NULL;
-    if (port->_arp_table.count(dest_ip) == 0) {
-        entry = (struct dpdk::arp_entry*)rte_zmalloc(NULL, sizeof(*entry), 0);
-        if (!entry) {
-            return -ENOMEM;
-        }
-        entry = new (entry) dpdk::arp_entry();
-        rte_ether_addr_copy(&dest_addr, &entry->mac_addr);
-        port->_arp_table[dest_ip] = entry;
-    } else {
-        entry = port->_arp_table.at(dest_ip);
-        rte_ether_addr_copy(&dest_addr, &entry->mac_addr);
-        for (auto req : entry->reqs) {
-            auto arp_data = (struct dpdk::arp_request*)req->data;
-            rte_ether_addr_copy(&dest_addr, &arp_data->tha);
-            while (_servq.complete(req) == -ENOBUFS)
-                ;
+    /* Add entry to ARP table, which all I/O services of the port share, and
+     * take its waiting requests */
+    std::vector<dpdk::wait_req*> reqs;
+    {
+        std::lock_guard<std::mutex> lock(port->_mutex);
+        struct dpdk::arp_entry* entry = NULL;
+        if (port->_arp_table.count(dest_ip) == 0) {
+            entry = (struct dpdk::arp_entry*)rte_zmalloc(NULL, sizeof(*entry), 0);
+            if (!entry) {
+                return -ENOMEM;
+            }
+            entry = new (entry) dpdk::arp_entry();
+            rte_ether_addr_copy(&dest_addr, &entry->mac_addr);
+            port->_arp_table[dest_ip] = entry;
+        } else {
+            entry = port->_arp_table.at(dest_ip);
+            rte_ether_addr_copy(&dest_addr, &entry->mac_addr);
+            reqs.swap(entry->reqs);
+        }
+    }
+
+    /* Complete the requests without holding the lock. They may have been
+     * submitted to other I/O services, but complete() only requeues them to
+     * ours. If our service queue is full, retry in the next iteration. */
+    for (auto req : reqs) {
+        auto arp_data = (struct dpdk::arp_request*)req->data;
+        rte_ether_addr_copy(&dest_addr, &arp_data->tha);
+        if (_servq.complete(req) == -ENOBUFS) {
+            _arp_completions.push_back(req);
         }
-        entry->reqs.clear();
     }
-    rte_spinlock_unlock(&port->_spinlock);
 
     /* Respond if this was an ARP request */
     if (arp_frame->arp_opcode == rte_cpu_to_be_16(RTE_ARP_OP_REQUEST)
@@ -752,8 +820,21 @@ int dpdk_io_service::_process_arp(
     return 0;
 }
 
-int dpdk_io_service::_process_ipv4(
-    dpdk::dpdk_port* port, struct rte_mbuf* mbuf, struct rte_ipv4_hdr* pkt)
+void dpdk_io_service::_complete_arp_requests()
+{
+    std::vector<dpdk::wait_req*> reqs;
+    reqs.swap(_arp_completions);
+    for (auto req : reqs) {
+        if (_servq.complete(req) == -ENOBUFS) {
+            _arp_completions.push_back(req);
+        }
+    }
+}
+
+int dpdk_io_service::_process_ipv4(dpdk::dpdk_port* port,
+    struct rte_mbuf* mbuf,
+    struct rte_ipv4_hdr* pkt,
+    struct dpdk::ipv4_5tuple* key)
 {
     bool bcast = port->dst_is_broadcast(pkt->dst_addr);
     if (pkt->dst_addr != port->get_ipv4() && !bcast) {
@@ -761,68 +842,112 @@ int dpdk_io_service::_process_ipv4(
         return -ENODEV;
     }
     if (pkt->next_proto_id == IPPROTO_UDP) {
-        return _process_udp(port, mbuf, (struct rte_udp_hdr*)&pkt[1], bcast);
+        auto udp_hdr   = (struct rte_udp_hdr*)&pkt[1];
+        key->flow_type = dpdk::flow_type::FLOW_TYPE_UDP;
+        key->src_ip    = 0;
+        key->dst_ip    = port->get_ipv4();
+        key->src_port  = 0;
+        key->dst_port  = udp_hdr->dst_port;
+        return 0;
     }
     rte_pktmbuf_free(mbuf);
     return -EINVAL;
 }
 
 
-int dpdk_io_service::_process_udp(
-    dpdk::dpdk_port* port, struct rte_mbuf* mbuf, struct rte_udp_hdr* pkt, bool /*bcast*/)
+void dpdk_io_service::_process_udp(struct rte_mbuf** mbufs,
+    const struct dpdk::ipv4_5tuple* keys,
+    unsigned int num_pkts)
 {
-    // Get the link
-    struct dpdk::ipv4_5tuple ht_key = {.flow_type = dpdk::flow_type::FLOW_TYPE_UDP,
-        .src_ip                                   = 0,
-        .dst_ip                                   = port->get_ipv4(),
-        .src_port                                 = 0,
-        .dst_port                                 = pkt->dst_port};
-    void* hash_data;
-    if (rte_hash_lookup_data(_rx_table, &ht_key, &hash_data) < 0) {
-        UHD_LOG_WARNING("DPDK::IO_SERVICE", "Dropping packet: No link entry in rx table");
-        rte_pktmbuf_free(mbuf);
-        return -ENOENT;
-    }
-    // Get xport list for this UDP port
-    auto rx_entry = (std::list<dpdk_io_if*>*)(hash_data);
-    if (rx_entry->empty()) {
-        UHD_LOG_WARNING("DPDK::IO_SERVICE", "Dropping packet: No xports for link");
-        rte_pktmbuf_free(mbuf);
-        return -ENOENT;
-    }
-    // Turn rte_mbuf -> dpdk_frame_buff
-    auto link = rx_entry->front()->link;
-    link->enqueue_recv_mbuf(mbuf);
-    auto buff       = link->get_recv_buff(0);
-    bool rcvr_found = false;
-    for (auto client_if : *rx_entry) {
-        // Check all the muxed receivers...
-        if (client_if->recv_cb(buff, link, link)) {
-            rcvr_found = true;
-            if (buff) {
-                assert(client_if->is_recv);
-                auto recv_io  = (dpdk_recv_io*)client_if->io_client;
-                auto buff_ptr = (dpdk::dpdk_frame_buff*)buff.release();
-                if (rte_ring_enqueue(recv_io->_recv_queue, buff_ptr)) {
-                    rte_pktmbuf_free(buff_ptr->get_pktmbuf());
-                    UHD_LOG_WARNING(
-                        "DPDK::IO_SERVICE", "Dropping packet: No space in recv queue");
-                } else {
-                    recv_io->_num_frames_in_use++;
-                    assert(recv_io->_num_frames_in_use <= recv_io->_num_recv_frames);
-                    _wake_client(client_if);
+    // Frames for the same client are enqueued together, until a frame for
+    // another client comes along
+    dpdk_recv_io* pending_io = nullptr;
+    dpdk::dpdk_frame_buff* pending_buffs[MAX_BURST_SIZE];
+    unsigned int num_pending = 0;
+
+    const void* key_ptrs[RTE_HASH_LOOKUP_BULK_MAX];
+    void* hash_data[RTE_HASH_LOOKUP_BULK_MAX];
+    for (unsigned int offset = 0; offset < num_pkts; offset += RTE_HASH_LOOKUP_BULK_MAX) {
+        const unsigned int num_keys =
+            std::min<unsigned int>(num_pkts - offset, RTE_HASH_LOOKUP_BULK_MAX);
+        for (unsigned int i = 0; i < num_keys; i++) {
+            key_ptrs[i] = &keys[offset + i];
+        }
+        uint64_t hit_mask = 0;
+        rte_hash_lookup_bulk_data(_rx_table, key_ptrs, num_keys, &hit_mask, hash_data);
+
+        for (unsigned int i = 0; i < num_keys; i++) {
+            struct rte_mbuf* mbuf = mbufs[offset + i];
+            // Get the link
+            if (!(hit_mask & (1ULL << i))) {
+                UHD_LOG_WARNING(
+                    "DPDK::IO_SERVICE", "Dropping packet: No link entry in rx table");
+                rte_pktmbuf_free(mbuf);
+                continue;
+            }
+            // Get xport list for this UDP port
+            auto rx_entry = (std::list<dpdk_io_if*>*)(hash_data[i]);
+            if (rx_entry->empty()) {
+                UHD_LOG_WARNING(
+                    "DPDK::IO_SERVICE", "Dropping packet: No xports for link");
+                rte_pktmbuf_free(mbuf);
+                continue;
+            }
+            // Turn rte_mbuf -> dpdk_frame_buff
+            auto link = rx_entry->front()->link;
+            link->enqueue_recv_mbuf(mbuf);
+            auto buff       = link->get_recv_buff(0);
+            bool rcvr_found = false;
+            for (auto client_if : *rx_entry) {
+                // Check all the muxed receivers...
+                if (client_if->recv_cb(buff, link, link)) {
+                    rcvr_found = true;
+                    if (buff) {
+                        assert(client_if->is_recv);
+                        auto recv_io = (dpdk_recv_io*)client_if->io_client;
+                        if (recv_io != pending_io) {
+                            _enqueue_recv(pending_io, pending_buffs, num_pending);
+                            pending_io  = recv_io;
+                            num_pending = 0;
+                        }
+                        pending_buffs[num_pending++] =
+                            (dpdk::dpdk_frame_buff*)buff.release();
+                    }
+                    break;
                 }
             }
-            break;
+            if (!rcvr_found) {
+                UHD_LOG_WARNING(
+                    "DPDK::IO_SERVICE", "Dropping packet: No receiver xport found");
+                // Release the buffer if no receiver found
+                link->release_recv_buff(std::move(buff));
+            }
         }
     }
-    if (!rcvr_found) {
-        UHD_LOG_WARNING("DPDK::IO_SERVICE", "Dropping packet: No receiver xport found");
-        // Release the buffer if no receiver found
-        link->release_recv_buff(std::move(buff));
-        return -ENOENT;
+    _enqueue_recv(pending_io, pending_buffs, num_pending);
+}
+
+void dpdk_io_service::_enqueue_recv(
+    dpdk_recv_io* recv_io, dpdk::dpdk_frame_buff** buffs, unsigned int num_buffs)
+{
+    if (num_buffs == 0) {
+        return;
+    }
+    const unsigned int num_enq =
+        rte_ring_enqueue_burst(recv_io->_recv_queue, (void**)buffs, num_buffs, NULL);
+    if (num_enq < num_buffs) {
+        UHD_LOG_WARNING("DPDK::IO_SERVICE",
+            "Dropping " << (num_buffs - num_enq)
+                        << " packets: No space in recv queue");
+        for (unsigned int i = num_enq; i < num_buffs; i++) {
+            rte_pktmbuf_free(buffs[i]->get_pktmbuf());
+        }
+    }
+    if (num_enq > 0) {
+        recv_io->_num_frames_in_use += num_enq;
+        assert(recv_io->_num_frames_in_use <= recv_io->_num_recv_frames);
+        _wake_client(&recv_io->_dpdk_io_if);
     }
-    return 0;
 }
 
 /* Do a burst of TX on port's tx queues */
@@ -832,39 +957,46 @@ int dpdk_io_service::_tx_burst(dpdk::dpdk_port* port)
     auto& queues          = _tx_queues.at(port->get_port_id());
 
     for (auto& send_io : queues) {
-        unsigned int num_tx   = rte_ring_count(send_io->_send_queue);
-        num_tx                = (num_tx < TX_BURST_SIZE) ? num_tx : TX_BURST_SIZE;
-        bool replaced_buffers = false;
-        for (unsigned int i = 0; i < num_tx; i++) {
-            size_t frame_size = send_io->_dpdk_io_if.link->get_send_frame_size();
+        auto link = send_io->_dpdk_io_if.link;
+        // Frames held back by flow control in the last iteration go first
+        if (send_io->_next_staged == send_io->_num_staged) {
+            send_io->_next_staged = 0;
+            send_io->_num_staged  = rte_ring_dequeue_burst(send_io->_send_queue,
+                (void**)send_io->_staged,
+                static_cast<unsigned int>(_tx_burst_size),
+                NULL);
+        }
+        const size_t frame_size = link->get_send_frame_size();
+        dpdk::dpdk_frame_buff* new_buffs[MAX_BURST_SIZE];
+        unsigned int num_new = 0;
+        while (send_io->_next_staged < send_io->_num_staged) {
             if (send_io->_fc_cb && !send_io->_fc_cb(frame_size)) {
                 break;
             }
-            dpdk::dpdk_frame_buff* buff_ptr;
-            int status = rte_ring_dequeue(send_io->_send_queue, (void**)&buff_ptr);
-            if (status) {
-                UHD_LOG_ERROR("DPDK::IO_SERVICE", "TX Q Count doesn't match actual");
-                break;
-            }
-            send_io->_send_cb(frame_buff::uptr(buff_ptr), send_io->_dpdk_io_if.link);
+            frame_buff* buff_ptr = send_io->_staged[send_io->_next_staged++];
+            send_io->_send_cb(frame_buff::uptr(buff_ptr), link);
+            total_tx++;
             // Attempt to replace buffer
-            buff_ptr = (dpdk::dpdk_frame_buff*)send_io->_dpdk_io_if.link->get_send_buff(0)
-                           .release();
-            if (!buff_ptr) {
+            auto new_buff = (dpdk::dpdk_frame_buff*)link->get_send_buff(0).release();
+            if (!new_buff) {
                 UHD_LOG_ERROR("DPDK::IO_SERVICE",
                     "TX mempool out of memory. Please increase dpdk_num_mbufs.");
                 send_io->_num_frames_in_use--;
-            } else if (rte_ring_enqueue(send_io->_buffer_queue, buff_ptr)) {
-                rte_pktmbuf_free(buff_ptr->get_pktmbuf());
-                send_io->_num_frames_in_use--;
             } else {
-                replaced_buffers = true;
+                new_buffs[num_new++] = new_buff;
             }
         }
-        if (replaced_buffers) {
-            _wake_client(&send_io->_dpdk_io_if);
+        if (num_new > 0) {
+            const unsigned int num_enq = rte_ring_enqueue_burst(
+                send_io->_buffer_queue, (void**)new_buffs, num_new, NULL);
+            for (unsigned int i = num_enq; i < num_new; i++) {
+                rte_pktmbuf_free(new_buffs[i]->get_pktmbuf());
+                send_io->_num_frames_in_use--;
+            }
+            if (num_enq > 0) {
+                _wake_client(&send_io->_dpdk_io_if);
+            }
         }
-        total_tx += num_tx;
     }
 
     return total_tx;
@@ -876,26 +1008,35 @@ int dpdk_io_service::_rx_release(dpdk::dpdk_port* port)
     auto& queues            = _recv_xport_map.at(port->get_port_id());
 
     for (auto& recv_io : queues) {
-        unsigned int num_buf = rte_ring_count(recv_io->_release_queue);
-        num_buf              = (num_buf < RX_BURST_SIZE) ? num_buf : RX_BURST_SIZE;
+        frame_buff* buffs[MAX_BURST_SIZE];
+        const unsigned int num_buf = rte_ring_dequeue_burst(recv_io->_release_queue,
+            (void**)buffs,
+            static_cast<unsigned int>(_rx_burst_size),
+            NULL);
         for (unsigned int i = 0; i < num_buf; i++) {
-            dpdk::dpdk_frame_buff* buff_ptr;
-            int status = rte_ring_dequeue(recv_io->_release_queue, (void**)&buff_ptr);
-            if (status) {
-                UHD_LOG_ERROR("DPDK::IO_SERVICE", "RX Q Count doesn't match actual");
-                break;
-            }
-            recv_io->_fc_cb(frame_buff::uptr(buff_ptr),
+            recv_io->_fc_cb(frame_buff::uptr(buffs[i]),
                 recv_io->_dpdk_io_if.link,
                 recv_io->_dpdk_io_if.link);
-            recv_io->_num_frames_in_use--;
         }
+        recv_io->_num_frames_in_use -= num_buf;
         total_bufs += num_buf;
     }
 
     return total_bufs;
 }
 
+dpdk::queue_id_t dpdk_io_service::_get_queue(const dpdk::dpdk_port* port) const
+{
+    for (size_t i = 0; i < _ports.size(); i++) {
+        if (_ports[i] == port) {
+            return _queues[i];
+        }
+    }
+    UHD_LOG_ERROR("DPDK::IO_SERVICE",
+        "Port " << port->get_port_id() << " is not served by lcore " << _lcore_id);
+    return 0;
+}
+
 uint16_t dpdk_io_service::_get_unique_client_id()
 {
     std::lock_guard<std::mutex> lock(_mutex);
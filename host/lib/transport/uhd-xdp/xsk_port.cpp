@@ -0,0 +1,894 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhdlib/transport/xdp/xsk_port.hpp>
+#include <arpa/inet.h>
+#include <linux/bpf.h>
+#include <linux/if_ether.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <thread>
+
+using namespace uhd::transport::xdp;
+
+#ifndef SOL_XDP
+#    define SOL_XDP 283
+#endif
+
+namespace {
+
+//! Max. number of descriptors to pull off the RX ring at a time
+constexpr uint32_t RX_BATCH_SIZE = 64;
+
+constexpr uint16_t ETHER_TYPE_IPV4 = 0x0800;
+constexpr uint8_t IP_PROTO_UDP     = 17;
+
+//! Max. number of UDP ports the XDP program redirects per interface
+constexpr uint32_t MAX_NUM_PORTS = 1024;
+
+int sys_bpf(const int cmd, bpf_attr& attr)
+{
+    return static_cast<int>(syscall(__NR_bpf, cmd, &attr, sizeof(attr)));
+}
+
+bpf_insn make_insn(const uint8_t code,
+    const uint8_t dst_reg,
+    const uint8_t src_reg,
+    const int16_t off,
+    const int32_t imm)
+{
+    bpf_insn insn;
+    std::memset(&insn, 0, sizeof(insn));
+    insn.code    = code;
+    insn.dst_reg = dst_reg;
+    insn.src_reg = src_reg;
+    insn.off     = off;
+    insn.imm     = imm;
+    return insn;
+}
+
+//! dst = src
+bpf_insn insn_mov(const uint8_t dst, const uint8_t src)
+{
+    return make_insn(BPF_ALU64 | BPF_MOV | BPF_X, dst, src, 0, 0);
+}
+
+//! dst = dst <op> imm
+bpf_insn insn_alu(const uint8_t op, const uint8_t dst, const int32_t imm)
+{
+    return make_insn(BPF_ALU64 | op | BPF_K, dst, 0, 0, imm);
+}
+
+//! dst = *(size*)(src + off)
+bpf_insn insn_load(
+    const uint8_t size, const uint8_t dst, const uint8_t src, const int16_t off)
+{
+    return make_insn(BPF_LDX | BPF_MEM | size, dst, src, off, 0);
+}
+
+//! *(size*)(dst + off) = src
+bpf_insn insn_store(
+    const uint8_t size, const uint8_t dst, const uint8_t src, const int16_t off)
+{
+    return make_insn(BPF_STX | BPF_MEM | size, dst, src, off, 0);
+}
+
+bpf_insn insn_call(const int32_t func)
+{
+    return make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, func);
+}
+
+bpf_insn insn_exit()
+{
+    return make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0);
+}
+
+/*! Build the XDP program
+ *
+ * In C, the program reads:
+ *
+ *     if (data + 42 > data_end || eth->h_proto != htons(ETH_P_IP)
+ *         || ip->version_ihl != 0x45 || ip->protocol != IPPROTO_UDP
+ *         || (ip->frag_off & htons(0x3FFF)) != 0
+ *         || !bpf_map_lookup_elem(&ports, &udp->dest)) {
+ *         return XDP_PASS;
+ *     }
+ *     return bpf_redirect_map(&xsks, ctx->rx_queue_index, XDP_PASS);
+ *
+ * Multi-byte fields are compared in network byte order, as they were loaded
+ * on a little-endian host. The map keys are in network byte order, too.
+ */
+std::vector<bpf_insn> make_xdp_prog(const int ports_map_fd, const int xsks_map_fd)
+{
+    std::vector<bpf_insn> prog;
+    std::vector<size_t> jumps_to_pass;
+    // if (reg <op> imm) goto pass
+    auto jump_to_pass = [&](const uint8_t op, const uint8_t reg, const int32_t imm) {
+        jumps_to_pass.push_back(prog.size());
+        prog.push_back(make_insn(BPF_JMP | op | BPF_K, reg, 0, 0, imm));
+    };
+    // reg = map (a 16-byte instruction)
+    auto load_map = [&](const uint8_t reg, const int map_fd) {
+        prog.push_back(
+            make_insn(BPF_LD | BPF_DW | BPF_IMM, reg, BPF_PSEUDO_MAP_FD, 0, map_fd));
+        prog.push_back(make_insn(0, 0, 0, 0, 0));
+    };
+
+    // r6 = ctx, r2 = data, r3 = data_end
+    prog.push_back(insn_mov(BPF_REG_6, BPF_REG_1));
+    prog.push_back(insn_load(BPF_W, BPF_REG_2, BPF_REG_6, offsetof(xdp_md, data)));
+    prog.push_back(insn_load(BPF_W, BPF_REG_3, BPF_REG_6, offsetof(xdp_md, data_end)));
+    // if (data + HDR_SIZE_UDP_IPV4 > data_end) goto pass
+    prog.push_back(insn_mov(BPF_REG_4, BPF_REG_2));
+    prog.push_back(insn_alu(BPF_ADD, BPF_REG_4, HDR_SIZE_UDP_IPV4));
+    jumps_to_pass.push_back(prog.size());
+    prog.push_back(make_insn(BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 0, 0));
+    // Ethertype
+    prog.push_back(insn_load(BPF_H, BPF_REG_4, BPF_REG_2, 12));
+    jump_to_pass(BPF_JNE, BPF_REG_4, htons(ETHER_TYPE_IPV4));
+    // IPv4 without options
+    prog.push_back(insn_load(BPF_B, BPF_REG_4, BPF_REG_2, 14));
+    jump_to_pass(BPF_JNE, BPF_REG_4, 0x45);
+    // UDP
+    prog.push_back(insn_load(BPF_B, BPF_REG_4, BPF_REG_2, 23));
+    jump_to_pass(BPF_JNE, BPF_REG_4, IP_PROTO_UDP);
+    // Not a fragment
+    prog.push_back(insn_load(BPF_H, BPF_REG_4, BPF_REG_2, 20));
+    prog.push_back(insn_alu(BPF_AND, BPF_REG_4, htons(0x3FFF)));
+    jump_to_pass(BPF_JNE, BPF_REG_4, 0);
+    // Look up the UDP destination port, the key is put on the stack
+    prog.push_back(insn_load(BPF_H, BPF_REG_4, BPF_REG_2, 36));
+    prog.push_back(insn_store(BPF_H, BPF_REG_10, BPF_REG_4, -2));
+    load_map(BPF_REG_1, ports_map_fd);
+    prog.push_back(insn_mov(BPF_REG_2, BPF_REG_10));
+    prog.push_back(insn_alu(BPF_ADD, BPF_REG_2, -2));
+    prog.push_back(insn_call(BPF_FUNC_map_lookup_elem));
+    jump_to_pass(BPF_JEQ, BPF_REG_0, 0);
+    // Redirect to the socket of this queue. If there is none, the lower bits
+    // of the flags are returned instead, so the packet goes to the kernel.
+    prog.push_back(
+        insn_load(BPF_W, BPF_REG_2, BPF_REG_6, offsetof(xdp_md, rx_queue_index)));
+    load_map(BPF_REG_1, xsks_map_fd);
+    prog.push_back(make_insn(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS));
+    prog.push_back(insn_call(BPF_FUNC_redirect_map));
+    prog.push_back(insn_exit());
+    // pass:
+    const size_t pass = prog.size();
+    prog.push_back(make_insn(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS));
+    prog.push_back(insn_exit());
+
+    for (const size_t jump : jumps_to_pass) {
+        prog[jump].off = static_cast<int16_t>(pass - jump - 1);
+    }
+    return prog;
+}
+
+} // namespace
+
+namespace uhd { namespace transport { namespace xdp {
+
+/*!
+ * The XDP program of one network interface, and its maps
+ *
+ * The program is shared by the xsk_ports of all queues of the interface. It
+ * is attached through a BPF link, so it is detached when the last port closes,
+ * even if the process dies.
+ */
+class xdp_filter : uhd::noncopyable
+{
+public:
+    using sptr = std::shared_ptr<xdp_filter>;
+
+    //! Get the program of an interface, loading and attaching it if needed
+    static sptr get(const std::string& iface)
+    {
+        static std::mutex registry_mutex;
+        static std::map<std::string, std::weak_ptr<xdp_filter>> registry;
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        sptr filter = registry[iface].lock();
+        if (!filter) {
+            filter          = sptr(new xdp_filter(iface));
+            registry[iface] = filter;
+        }
+        return filter;
+    }
+
+    ~xdp_filter()
+    {
+        _close();
+    }
+
+    unsigned int get_ifindex() const
+    {
+        return _ifindex;
+    }
+
+    //! Redirect packets arriving on queue_id to the AF_XDP socket xsk_fd
+    void add_socket(const uint32_t queue_id, const int xsk_fd)
+    {
+        _update(_xsks_map_fd, &queue_id, &xsk_fd, "socket");
+    }
+
+    void remove_socket(const uint32_t queue_id)
+    {
+        _delete(_xsks_map_fd, &queue_id);
+    }
+
+    //! Redirect packets for the UDP port (in network byte order)
+    void add_port(const uint16_t udp_port)
+    {
+        const uint8_t value = 1;
+        _update(_ports_map_fd, &udp_port, &value, "UDP port");
+    }
+
+    void remove_port(const uint16_t udp_port)
+    {
+        _delete(_ports_map_fd, &udp_port);
+    }
+
+private:
+    xdp_filter(const std::string& iface) : _iface(iface)
+    {
+        _ifindex = if_nametoindex(iface.c_str());
+        if (_ifindex == 0) {
+            throw uhd::os_error("XDP: Unknown network interface " + iface);
+        }
+        try {
+            _ports_map_fd = _create_map(BPF_MAP_TYPE_HASH,
+                sizeof(uint16_t),
+                sizeof(uint8_t),
+                MAX_NUM_PORTS,
+                "uhd_ports");
+            _xsks_map_fd = _create_map(BPF_MAP_TYPE_XSKMAP,
+                sizeof(uint32_t),
+                sizeof(int),
+                MAX_NUM_QUEUES,
+                "uhd_xsks");
+            _load_prog();
+            _attach();
+        } catch (...) {
+            _close();
+            throw;
+        }
+    }
+
+    int _create_map(const bpf_map_type type,
+        const uint32_t key_size,
+        const uint32_t value_size,
+        const uint32_t max_entries,
+        const char* name)
+    {
+        bpf_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.map_type    = type;
+        attr.key_size    = key_size;
+        attr.value_size  = value_size;
+        attr.max_entries = max_entries;
+        std::strncpy(attr.map_name, name, BPF_OBJ_NAME_LEN - 1);
+        const int fd = sys_bpf(BPF_MAP_CREATE, attr);
+        if (fd < 0) {
+            throw uhd::os_error(str(boost::format("XDP: Failed to create BPF map %s: %s")
+                                    % name % strerror(errno)));
+        }
+        return fd;
+    }
+
+    void _load_prog()
+    {
+        const auto prog = make_xdp_prog(_ports_map_fd, _xsks_map_fd);
+        std::vector<char> log(65536, '\0');
+        bpf_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.prog_type = BPF_PROG_TYPE_XDP;
+        attr.insns     = reinterpret_cast<uint64_t>(prog.data());
+        attr.insn_cnt  = static_cast<uint32_t>(prog.size());
+        attr.license   = reinterpret_cast<uint64_t>("GPL");
+        attr.log_buf   = reinterpret_cast<uint64_t>(log.data());
+        attr.log_size  = static_cast<uint32_t>(log.size());
+        attr.log_level = 1;
+        std::strncpy(attr.prog_name, "uhd_xdp", BPF_OBJ_NAME_LEN - 1);
+        _prog_fd = sys_bpf(BPF_PROG_LOAD, attr);
+        if (_prog_fd < 0) {
+            const std::string err = strerror(errno);
+            UHD_LOG_DEBUG("XDP", "BPF verifier log:\n" << log.data());
+            throw uhd::os_error("XDP: Failed to load the XDP program: " + err);
+        }
+    }
+
+    //! Attach the program in native mode, or in generic mode if the driver
+    //! doesn't support XDP
+    void _attach()
+    {
+        for (const uint32_t mode : {XDP_FLAGS_DRV_MODE, XDP_FLAGS_SKB_MODE}) {
+            bpf_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.link_create.prog_fd        = static_cast<uint32_t>(_prog_fd);
+            attr.link_create.target_ifindex = _ifindex;
+            attr.link_create.attach_type    = BPF_XDP;
+            attr.link_create.flags          = mode;
+            _link_fd                        = sys_bpf(BPF_LINK_CREATE, attr);
+            if (_link_fd >= 0) {
+                UHD_LOG_DEBUG("XDP",
+                    "Attached XDP program to " << _iface << " in "
+                                               << (mode == XDP_FLAGS_DRV_MODE ? "native"
+                                                                              : "generic")
+                                               << " mode");
+                return;
+            }
+            if (errno == EBUSY || errno == EEXIST) {
+                throw uhd::os_error(
+                    "XDP: Another XDP program is already attached to " + _iface);
+            }
+        }
+        throw uhd::os_error(
+            str(boost::format("XDP: Failed to attach XDP program to %s: %s") % _iface
+                % strerror(errno)));
+    }
+
+    void _update(const int map_fd, const void* key, const void* value, const char* what)
+    {
+        bpf_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.map_fd = static_cast<uint32_t>(map_fd);
+        attr.key    = reinterpret_cast<uint64_t>(key);
+        attr.value  = reinterpret_cast<uint64_t>(value);
+        attr.flags  = BPF_ANY;
+        if (sys_bpf(BPF_MAP_UPDATE_ELEM, attr) != 0) {
+            throw uhd::os_error(str(boost::format("XDP: Failed to add %s to the XDP "
+                                                  "program of %s: %s")
+                                    % what % _iface % strerror(errno)));
+        }
+    }
+
+    void _delete(const int map_fd, const void* key)
+    {
+        bpf_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.map_fd = static_cast<uint32_t>(map_fd);
+        attr.key    = reinterpret_cast<uint64_t>(key);
+        sys_bpf(BPF_MAP_DELETE_ELEM, attr);
+    }
+
+    void _close()
+    {
+        for (const int fd : {_link_fd, _prog_fd, _xsks_map_fd, _ports_map_fd}) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    std::string _iface;
+    unsigned int _ifindex = 0;
+    int _ports_map_fd     = -1;
+    int _xsks_map_fd      = -1;
+    int _prog_fd          = -1;
+    int _link_fd          = -1;
+};
+
+}}} // namespace uhd::transport::xdp
+
+namespace {
+
+//! Make the producer index of a ring visible to the kernel
+void ring_submit(xsk_ring_t& ring)
+{
+    __atomic_store_n(ring.producer, ring.cached_prod, __ATOMIC_RELEASE);
+}
+
+//! Reserve up to n entries of a producer ring, returns the number reserved
+uint32_t ring_reserve(xsk_ring_t& ring, const uint32_t n, uint32_t& idx)
+{
+    const uint32_t cons = __atomic_load_n(ring.consumer, __ATOMIC_ACQUIRE);
+    const uint32_t nb   = std::min(n, ring.size - (ring.cached_prod - cons));
+    idx                 = ring.cached_prod;
+    ring.cached_prod += nb;
+    return nb;
+}
+
+//! Get up to n entries of a consumer ring, returns the number available
+uint32_t ring_peek(xsk_ring_t& ring, const uint32_t n, uint32_t& idx)
+{
+    const uint32_t prod = __atomic_load_n(ring.producer, __ATOMIC_ACQUIRE);
+    const uint32_t nb   = std::min(n, prod - ring.cached_cons);
+    idx                 = ring.cached_cons;
+    ring.cached_cons += nb;
+    return nb;
+}
+
+//! Hand entries that were peeked back to the kernel
+void ring_release(xsk_ring_t& ring)
+{
+    __atomic_store_n(ring.consumer, ring.cached_cons, __ATOMIC_RELEASE);
+}
+
+bool ring_needs_wakeup(const xsk_ring_t& ring)
+{
+    return __atomic_load_n(ring.flags, __ATOMIC_RELAXED) & XDP_RING_NEED_WAKEUP;
+}
+
+uint64_t& ring_addr(xsk_ring_t& ring, const uint32_t idx)
+{
+    return static_cast<uint64_t*>(ring.descs)[idx & (ring.size - 1)];
+}
+
+xdp_desc& ring_desc(xsk_ring_t& ring, const uint32_t idx)
+{
+    return static_cast<xdp_desc*>(ring.descs)[idx & (ring.size - 1)];
+}
+
+std::mutex& get_registry_mutex()
+{
+    static std::mutex registry_mutex;
+    return registry_mutex;
+}
+
+std::map<std::string, std::weak_ptr<xsk_port>>& get_registry()
+{
+    static std::map<std::string, std::weak_ptr<xsk_port>> registry;
+    return registry;
+}
+
+std::string make_key(const std::string& iface, const uint32_t queue_id)
+{
+    return iface + ":" + std::to_string(queue_id);
+}
+
+} // namespace
+
+xsk_port::sptr xsk_port::get(
+    const iface_info_t& iface, const uint32_t queue_id, const size_t num_chunks)
+{
+    std::lock_guard<std::mutex> lock(get_registry_mutex());
+    auto& registry    = get_registry();
+    const auto key    = make_key(iface.name, queue_id);
+    xsk_port::sptr port = registry[key].lock();
+    if (!port) {
+        port          = sptr(new xsk_port(iface, queue_id, num_chunks));
+        registry[key] = port;
+    }
+    return port;
+}
+
+xsk_port::xsk_port(
+    const iface_info_t& iface, const uint32_t queue_id, const size_t num_chunks)
+    : _iface(iface), _queue_id(queue_id)
+{
+    if (queue_id >= MAX_NUM_QUEUES) {
+        throw uhd::value_error(str(boost::format("XDP: Queue %d is out of range, the "
+                                                 "maximum is %d")
+                                   % queue_id % (MAX_NUM_QUEUES - 1)));
+    }
+
+    // Each half of the UMEM gets a power-of-two number of chunks, which is
+    // also the size of the rings it cycles through.
+    uint32_t chunks_per_dir = 1;
+    while (chunks_per_dir * 2 <= std::max<size_t>(num_chunks / 2, 64)) {
+        chunks_per_dir *= 2;
+    }
+
+    _umem_size = 2 * chunks_per_dir * CHUNK_SIZE;
+    _umem_area = mmap(nullptr,
+        _umem_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+        -1,
+        0);
+    if (_umem_area == MAP_FAILED) {
+        _umem_area = nullptr;
+        throw uhd::os_error(
+            str(boost::format("XDP: Failed to allocate UMEM: %s") % strerror(errno)));
+    }
+
+    try {
+        _filter = xdp_filter::get(_iface.name);
+
+        _fd = socket(AF_XDP, SOCK_RAW, 0);
+        if (_fd < 0) {
+            throw uhd::os_error(std::string("XDP: Failed to open AF_XDP socket: ")
+                                + strerror(errno));
+        }
+        xdp_umem_reg umem_reg;
+        std::memset(&umem_reg, 0, sizeof(umem_reg));
+        umem_reg.addr       = reinterpret_cast<uint64_t>(_umem_area);
+        umem_reg.len        = _umem_size;
+        umem_reg.chunk_size = CHUNK_SIZE;
+        umem_reg.headroom   = 0;
+        if (setsockopt(_fd, SOL_XDP, XDP_UMEM_REG, &umem_reg, sizeof(umem_reg)) != 0
+            || setsockopt(_fd,
+                   SOL_XDP,
+                   XDP_UMEM_FILL_RING,
+                   &chunks_per_dir,
+                   sizeof(chunks_per_dir))
+                   != 0
+            || setsockopt(_fd,
+                   SOL_XDP,
+                   XDP_UMEM_COMPLETION_RING,
+                   &chunks_per_dir,
+                   sizeof(chunks_per_dir))
+                   != 0
+            || setsockopt(
+                   _fd, SOL_XDP, XDP_RX_RING, &chunks_per_dir, sizeof(chunks_per_dir))
+                   != 0
+            || setsockopt(
+                   _fd, SOL_XDP, XDP_TX_RING, &chunks_per_dir, sizeof(chunks_per_dir))
+                   != 0) {
+            throw uhd::os_error(
+                str(boost::format("XDP: Failed to set up UMEM: %s") % strerror(errno)));
+        }
+
+        xdp_mmap_offsets offsets;
+        socklen_t offsets_len = sizeof(offsets);
+        if (getsockopt(_fd, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &offsets_len) != 0) {
+            throw uhd::os_error(str(
+                boost::format("XDP: Failed to get ring offsets: %s") % strerror(errno)));
+        }
+        _map_ring(_fill,
+            offsets.fr,
+            chunks_per_dir,
+            sizeof(uint64_t),
+            XDP_UMEM_PGOFF_FILL_RING);
+        _map_ring(_comp,
+            offsets.cr,
+            chunks_per_dir,
+            sizeof(uint64_t),
+            XDP_UMEM_PGOFF_COMPLETION_RING);
+        _map_ring(_rx, offsets.rx, chunks_per_dir, sizeof(xdp_desc), XDP_PGOFF_RX_RING);
+        _map_ring(_tx, offsets.tx, chunks_per_dir, sizeof(xdp_desc), XDP_PGOFF_TX_RING);
+        // The kernel consumes the fill and TX rings, it must see them as empty
+        _fill.cached_cons = 0;
+        _tx.cached_cons   = 0;
+
+        _bind(_filter->get_ifindex());
+        _filter->add_socket(_queue_id, _fd);
+    } catch (...) {
+        _close();
+        throw;
+    }
+
+    // The first half of the UMEM is for RX, the second half for TX
+    _free_rx_chunks.reserve(chunks_per_dir);
+    _free_tx_chunks.reserve(chunks_per_dir);
+    for (size_t i = 0; i < chunks_per_dir; i++) {
+        _free_rx_chunks.push_back(i * CHUNK_SIZE);
+        _free_tx_chunks.push_back((chunks_per_dir + i) * CHUNK_SIZE);
+    }
+    _refill_locked();
+
+    UHD_LOG_INFO("XDP",
+        "Opened AF_XDP socket on " << to_string() << " with " << 2 * chunks_per_dir
+                                   << " UMEM chunks");
+}
+
+xsk_port::~xsk_port()
+{
+    _filter->remove_socket(_queue_id);
+    _close();
+}
+
+void xsk_port::_map_ring(xsk_ring_t& ring,
+    const xdp_ring_offset& offsets,
+    const uint32_t size,
+    const size_t desc_size,
+    const off_t pgoff)
+{
+    ring.map_size = offsets.desc + size * desc_size;
+    ring.map      = mmap(nullptr,
+        ring.map_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        _fd,
+        pgoff);
+    if (ring.map == MAP_FAILED) {
+        ring.map = nullptr;
+        throw uhd::os_error(
+            str(boost::format("XDP: Failed to map ring: %s") % strerror(errno)));
+    }
+    auto* base    = static_cast<uint8_t*>(ring.map);
+    ring.producer = reinterpret_cast<uint32_t*>(base + offsets.producer);
+    ring.consumer = reinterpret_cast<uint32_t*>(base + offsets.consumer);
+    ring.flags    = reinterpret_cast<uint32_t*>(base + offsets.flags);
+    ring.descs    = base + offsets.desc;
+    ring.size     = size;
+    ring.cached_prod = __atomic_load_n(ring.producer, __ATOMIC_ACQUIRE);
+    ring.cached_cons = __atomic_load_n(ring.consumer, __ATOMIC_ACQUIRE);
+}
+
+void xsk_port::_bind(const unsigned int ifindex)
+{
+    // Try zero-copy mode first, then fall back to copy mode for drivers that
+    // don't support it (e.g., veth or generic XDP).
+    sockaddr_xdp sxdp;
+    std::memset(&sxdp, 0, sizeof(sxdp));
+    sxdp.sxdp_family   = AF_XDP;
+    sxdp.sxdp_ifindex  = ifindex;
+    sxdp.sxdp_queue_id = _queue_id;
+    sxdp.sxdp_flags    = XDP_USE_NEED_WAKEUP | XDP_ZEROCOPY;
+    if (bind(_fd, reinterpret_cast<sockaddr*>(&sxdp), sizeof(sxdp)) == 0) {
+        return;
+    }
+    UHD_LOG_DEBUG("XDP",
+        "Zero-copy mode not available on " << to_string() << " (" << strerror(errno)
+                                           << "), using copy mode");
+    sxdp.sxdp_flags = XDP_USE_NEED_WAKEUP | XDP_COPY;
+    if (bind(_fd, reinterpret_cast<sockaddr*>(&sxdp), sizeof(sxdp)) != 0) {
+        throw uhd::os_error(str(boost::format("XDP: Failed to bind AF_XDP socket to %s: "
+                                              "%s")
+                                % to_string() % strerror(errno)));
+    }
+}
+
+void xsk_port::_close()
+{
+    for (xsk_ring_t* ring : {&_fill, &_comp, &_rx, &_tx}) {
+        if (ring->map) {
+            munmap(ring->map, ring->map_size);
+            ring->map = nullptr;
+        }
+    }
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+    if (_umem_area) {
+        munmap(_umem_area, _umem_size);
+        _umem_area = nullptr;
+    }
+}
+
+std::string xsk_port::to_string() const
+{
+    return make_key(_iface.name, _queue_id);
+}
+
+void xsk_port::add_endpoint(
+    const uint16_t udp_port, const uint32_t remote_ipv4, const size_t max_queued)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_endpoints.count(udp_port)) {
+        throw uhd::key_error(str(boost::format("XDP: UDP port %d already in use on %s")
+                                 % ntohs(udp_port) % to_string()));
+    }
+    _filter->add_port(udp_port);
+    endpoint_t& ep = _endpoints[udp_port];
+    ep.remote_ipv4 = remote_ipv4;
+    ep.max_queued  = max_queued;
+}
+
+void xsk_port::remove_endpoint(const uint16_t udp_port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _endpoints.find(udp_port);
+    if (it == _endpoints.end()) {
+        return;
+    }
+    _filter->remove_port(udp_port);
+    for (const auto& desc : it->second.queue) {
+        _free_rx_chunks.push_back(desc.addr);
+    }
+    _endpoints.erase(it);
+    _refill_locked();
+}
+
+bool xsk_port::recv(const uint16_t udp_port, rx_desc_t& desc, const int32_t timeout_ms)
+{
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    std::unique_lock<std::mutex> lock(_mutex);
+    endpoint_t& ep = _endpoints.at(udp_port);
+
+    while (true) {
+        if (ep.queue.empty()) {
+            _drain_rx_locked();
+        }
+        if (!ep.queue.empty()) {
+            desc = ep.queue.front();
+            ep.queue.pop_front();
+            return true;
+        }
+
+        int32_t remaining_ms = -1;
+        if (timeout_ms >= 0) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return false;
+            }
+            remaining_ms = static_cast<int32_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)
+                    .count());
+            remaining_ms = std::max<int32_t>(remaining_ms, 1);
+        }
+
+        if (_rx_poller_active) {
+            // Another thread is waiting on the socket, it will wake us up when
+            // it sorted packets into the endpoint queues.
+            if (timeout_ms < 0) {
+                _rx_cond.wait(lock);
+            } else {
+                _rx_cond.wait_until(lock, deadline);
+            }
+            continue;
+        }
+
+        _rx_poller_active = true;
+        lock.unlock();
+        pollfd pfd;
+        pfd.fd     = _fd;
+        pfd.events = POLLIN;
+        ::poll(&pfd, 1, remaining_ms);
+        lock.lock();
+        _rx_poller_active = false;
+        _drain_rx_locked();
+        _rx_cond.notify_all();
+    }
+}
+
+void xsk_port::release_recv(const uint64_t addr)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _free_rx_chunks.push_back(addr);
+    _refill_locked();
+}
+
+bool xsk_port::get_send_chunk(uint64_t& addr, const int32_t timeout_ms)
+{
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true) {
+        _reap_tx_locked();
+        if (!_free_tx_chunks.empty()) {
+            addr = _free_tx_chunks.back();
+            _free_tx_chunks.pop_back();
+            return true;
+        }
+        if (timeout_ms == 0
+            || (timeout_ms > 0 && std::chrono::steady_clock::now() >= deadline)) {
+            return false;
+        }
+        // Completions are not signaled through poll(), so give the kernel a
+        // push and try again.
+        _kick_tx_locked();
+        lock.unlock();
+        std::this_thread::yield();
+        lock.lock();
+    }
+}
+
+void xsk_port::send(const uint64_t addr, const size_t len)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _send_locked(addr, len);
+}
+
+void xsk_port::release_send_chunk(const uint64_t addr)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _free_tx_chunks.push_back(addr);
+}
+
+void xsk_port::_refill_locked()
+{
+    if (_free_rx_chunks.empty()) {
+        return;
+    }
+    uint32_t idx      = 0;
+    const uint32_t nb =
+        ring_reserve(_fill, static_cast<uint32_t>(_free_rx_chunks.size()), idx);
+    for (uint32_t i = 0; i < nb; i++) {
+        ring_addr(_fill, idx + i) = _free_rx_chunks.back();
+        _free_rx_chunks.pop_back();
+    }
+    ring_submit(_fill);
+}
+
+void xsk_port::_drain_rx_locked()
+{
+    uint32_t idx      = 0;
+    const uint32_t nb = ring_peek(_rx, RX_BATCH_SIZE, idx);
+    if (nb == 0) {
+        if (ring_needs_wakeup(_fill)) {
+            recvfrom(_fd, nullptr, 0, MSG_DONTWAIT, nullptr, nullptr);
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < nb; i++) {
+        const xdp_desc& rx_desc = ring_desc(_rx, idx + i);
+        const uint64_t addr     = rx_desc.addr;
+        const uint64_t chunk    = addr - (addr % CHUNK_SIZE);
+        uint8_t* frame          = get_chunk_data(addr);
+        const size_t len        = rx_desc.len;
+
+        // The XDP program only redirects IPv4/UDP to our ports, but it is
+        // shared by all queues of the interface, so check the endpoint again.
+        const auto* eth          = reinterpret_cast<const ethhdr*>(frame);
+        const uint16_t ethertype = (len >= sizeof(ethhdr)) ? ntohs(eth->h_proto) : 0;
+        if (ethertype == ETHER_TYPE_IPV4 && len >= HDR_SIZE_UDP_IPV4) {
+            const uint8_t* ip   = frame + sizeof(ethhdr);
+            const uint8_t* udp  = ip + 20;
+            uint16_t dst_port   = 0;
+            uint32_t src_ip     = 0;
+            uint16_t udp_len    = 0;
+            std::memcpy(&dst_port, udp + 2, sizeof(dst_port));
+            std::memcpy(&src_ip, ip + 12, sizeof(src_ip));
+            std::memcpy(&udp_len, udp + 4, sizeof(udp_len));
+            udp_len = ntohs(udp_len);
+            // Only option-less IPv4 headers, which is all a USRP sends
+            auto ep = _endpoints.find(dst_port);
+            if (ip[0] == 0x45 && ip[9] == IP_PROTO_UDP && ep != _endpoints.end()
+                && ep->second.remote_ipv4 == src_ip && udp_len >= 8
+                && HDR_SIZE_UDP_IPV4 - 8 + udp_len <= len) {
+                // If the endpoint is full, drop the packet rather than running
+                // the fill ring dry for everyone. The streamer will see the
+                // sequence error.
+                if (ep->second.queue.size() < ep->second.max_queued) {
+                    ep->second.queue.push_back(
+                        {chunk, frame + HDR_SIZE_UDP_IPV4, size_t(udp_len - 8)});
+                    continue;
+                }
+            }
+        }
+        // Not for us, recycle
+        _free_rx_chunks.push_back(chunk);
+    }
+    ring_release(_rx);
+    _refill_locked();
+}
+
+void xsk_port::_reap_tx_locked()
+{
+    uint32_t idx      = 0;
+    const uint32_t nb = ring_peek(_comp, _comp.size, idx);
+    for (uint32_t i = 0; i < nb; i++) {
+        _free_tx_chunks.push_back(ring_addr(_comp, idx + i));
+    }
+    ring_release(_comp);
+}
+
+void xsk_port::_kick_tx_locked()
+{
+    if (!ring_needs_wakeup(_tx)) {
+        return;
+    }
+    const ssize_t ret = sendto(_fd, nullptr, 0, MSG_DONTWAIT, nullptr, 0);
+    if (ret < 0 && errno != ENOBUFS && errno != EAGAIN && errno != EBUSY
+        && errno != ENETDOWN) {
+        throw uhd::io_error(
+            str(boost::format("XDP: TX wakeup failed: %s") % strerror(errno)));
+    }
+}
+
+void xsk_port::_send_locked(const uint64_t addr, const size_t len)
+{
+    // The TX ring has as many slots as there are TX chunks, so there is always
+    // space for a chunk we handed out.
+    uint32_t idx = 0;
+    if (ring_reserve(_tx, 1, idx) != 1) {
+        throw uhd::io_error("XDP: TX ring overflow");
+    }
+    xdp_desc& tx_desc = ring_desc(_tx, idx);
+    tx_desc.addr      = addr;
+    tx_desc.len       = static_cast<uint32_t>(len);
+    tx_desc.options   = 0;
+    ring_submit(_tx);
+    _kick_tx_locked();
+}
@@ -612,6 +612,7 @@ b200_impl::b200_impl(
     while (_data_transport->get_recv_buff(0.0)) {
     } // flush ctrl xport
     _demux = recv_packet_demuxer_3000::make(_data_transport);
+    _io_srv_mgr = io_service_mgr::make(device_addr);
 
     ////////////////////////////////////////////////////////////////////
     // create time and clock control objects
@@ -26,6 +26,7 @@
 #include <uhdlib/usrp/common/ad9361_ctrl.hpp>
 #include <uhdlib/usrp/common/ad936x_manager.hpp>
 #include <uhdlib/usrp/common/adf4001_ctrl.hpp>
+#include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/usrp/common/pwr_cal_mgr.hpp>
 #include <uhdlib/usrp/common/recv_packet_demuxer_3000.hpp>
 #include <uhdlib/usrp/cores/gpio_atr_3000.hpp>
@@ -156,6 +157,10 @@ private:
     uhd::transport::zero_copy_if::sptr _data_transport;
     uhd::transport::zero_copy_if::sptr _ctrl_transport;
     uhd::usrp::recv_packet_demuxer_3000::sptr _demux;
+    //! Connects the data links of the streamers to I/O services
+    uhd::usrp::io_service_mgr::sptr _io_srv_mgr;
+    //! Number of streamers created, to give each one a unique ID
+    size_t _num_streamers = 0;
 
     std::weak_ptr<uhd::rx_streamer> _rx_streamer;
     std::weak_ptr<uhd::tx_streamer> _tx_streamer;
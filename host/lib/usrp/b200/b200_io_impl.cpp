@@ -5,11 +5,16 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 //
 
-#include "../../transport/super_recv_packet_handler.hpp"
-#include "../../transport/super_send_packet_handler.hpp"
 #include "b200_impl.hpp"
 #include "b200_regs.hpp"
+#include <uhd/convert.hpp>
+#include <uhd/transport/vrt_if_packet.hpp>
+#include <uhd/utils/log.hpp>
 #include <uhd/utils/math.hpp>
+#include <uhdlib/transport/rx_streamer_impl.hpp>
+#include <uhdlib/transport/tx_streamer_impl.hpp>
+#include <uhdlib/transport/vrt_data_xport.hpp>
+#include <uhdlib/transport/zero_copy_link.hpp>
 #include <uhdlib/usrp/common/async_packet_handler.hpp>
 #include <uhdlib/usrp/common/validate_subdev_spec.hpp>
 #include <functional>
@@ -21,6 +26,222 @@ using namespace uhd;
 using namespace uhd::usrp;
 using namespace uhd::transport;
 
+namespace {
+
+//! The data packets are little-endian CHDR (the VRT flavor, not RFNoC CHDR)
+constexpr auto B200_LINK_TYPE  = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+constexpr auto B200_ENDIANNESS = uhd::ENDIANNESS_LITTLE;
+//! Suffix of the OTW formats of the converters
+constexpr char B200_OTW_SUFFIX[] = "_item32_le";
+
+uhd::usrp::io_service_args_t get_default_io_srv_args()
+{
+    // The I/O runs in the streamer threads unless the user asks for offload
+    uhd::usrp::io_service_args_t args;
+    args.recv_offload = false;
+    args.send_offload = false;
+    return args;
+}
+
+/***********************************************************************
+ * Streamers
+ **********************************************************************/
+class b200_rx_streamer : public rx_streamer_impl<vrt_rx_data_xport>
+{
+public:
+    using issue_stream_cmd_t = std::function<void(const stream_cmd_t&)>;
+    using overflow_handler_t = std::function<void(const size_t radio_index)>;
+
+    b200_rx_streamer(const stream_args_t& args, overflow_handler_t overflow_handler)
+        : rx_streamer_impl<vrt_rx_data_xport>(
+            args.channels.size(), args, B200_OTW_SUFFIX)
+        , _xports(args.channels.size(), nullptr)
+        , _issue_stream_cmd(args.channels.size())
+        , _overflow_handler(std::move(overflow_handler))
+    {
+        set_overrun_handler([this]() { this->_handle_overrun(); });
+    }
+
+    /*! Connect a channel to the data stream of a radio
+     *
+     * \param chan The channel of the streamer
+     * \param radio_index The radio that produces the stream
+     * \param io_srv The I/O service the link is attached to
+     * \param link The link of the stream (on a demuxer proxy)
+     * \param disconnect Function to disconnect the link from the I/O service
+     * \param issue_stream_cmd Function to send stream commands to the radio
+     */
+    void connect_radio(const size_t chan,
+        const size_t radio_index,
+        io_service::sptr io_srv,
+        recv_link_if::sptr link,
+        vrt_rx_data_xport::disconnect_callback_t disconnect,
+        issue_stream_cmd_t issue_stream_cmd)
+    {
+        auto vrt_xport = std::make_unique<vrt_rx_data_xport>(std::move(io_srv),
+            std::move(link),
+            B200_LINK_TYPE,
+            B200_ENDIANNESS,
+            [this, radio_index](const rx_metadata_t::error_code_t error_code) {
+                this->_handle_msg(radio_index, error_code);
+            },
+            std::move(disconnect));
+        _xports.at(chan)           = vrt_xport.get();
+        _issue_stream_cmd.at(chan) = std::move(issue_stream_cmd);
+        connect_channel(chan, std::move(vrt_xport));
+    }
+
+    void issue_stream_cmd(const stream_cmd_t& stream_cmd) override
+    {
+        if (get_num_channels() > 1 and stream_cmd.stream_now
+            and stream_cmd.stream_mode != stream_cmd_t::STREAM_MODE_STOP_CONTINUOUS) {
+            throw uhd::runtime_error(
+                "Invalid recv stream command - stream now on multiple channels in a "
+                "single streamer will fail to time align.");
+        }
+        for (const auto& issue_stream_cmd : _issue_stream_cmd) {
+            if (issue_stream_cmd) {
+                issue_stream_cmd(stream_cmd);
+            }
+        }
+    }
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+        throw uhd::not_implemented_error("post_input_action is not implemented here!");
+    }
+
+    void set_tick_rate(const double rate)
+    {
+        rx_streamer_impl::set_tick_rate(rate);
+    }
+
+    void set_samp_rate(const double rate)
+    {
+        rx_streamer_impl::set_samp_rate(rate);
+    }
+
+    void set_scale_factor(const size_t chan, const double scale_factor)
+    {
+        rx_streamer_impl::set_scale_factor(chan, scale_factor);
+    }
+
+    void set_max_num_samps(const size_t spp)
+    {
+        rx_streamer_impl::set_max_num_samps(spp);
+    }
+
+private:
+    //! Called by the transports for inline messages, from within recv()
+    void _handle_msg(const size_t radio_index, const rx_metadata_t::error_code_t code)
+    {
+        switch (code) {
+            case rx_metadata_t::ERROR_CODE_NONE:
+                break;
+            case rx_metadata_t::ERROR_CODE_OVERFLOW:
+                // The streamer returns the overflow after the buffered packets
+                // were read, and then calls the overrun handler
+                _overflow_radio = radio_index;
+                UHD_LOG_FASTPATH_EVENT('O', radio_index);
+                set_stopped_due_to_overrun();
+                break;
+            case rx_metadata_t::ERROR_CODE_LATE_COMMAND:
+                set_stopped_due_to_late_command();
+                break;
+            default:
+                UHD_LOG_WARNING("B200",
+                    "Radio " << radio_index << " reported error code 0x" << std::hex
+                             << code << std::dec);
+        }
+    }
+
+    void _handle_overrun()
+    {
+        if (_overflow_handler) {
+            _overflow_handler(_overflow_radio);
+        }
+        // The overflow handler flushes packets without the transports seeing them
+        for (vrt_rx_data_xport* xport : _xports) {
+            xport->resync();
+        }
+    }
+
+    //! Transports of the channels, owned by the base class
+    std::vector<vrt_rx_data_xport*> _xports;
+    std::vector<issue_stream_cmd_t> _issue_stream_cmd;
+    overflow_handler_t _overflow_handler;
+    //! Radio that reported the last overflow
+    size_t _overflow_radio = 0;
+};
+
+class b200_tx_streamer : public tx_streamer_impl<vrt_tx_data_xport>
+{
+public:
+    using async_receiver_t = std::function<bool(async_metadata_t&, const double)>;
+
+    b200_tx_streamer(const stream_args_t& args, async_receiver_t async_receiver)
+        : tx_streamer_impl<vrt_tx_data_xport>(
+            args.channels.size(), args, B200_OTW_SUFFIX)
+        , _async_receiver(std::move(async_receiver))
+    {
+    }
+
+    /*! Connect a channel to the data stream of a radio
+     *
+     * \param chan The channel of the streamer
+     * \param io_srv The I/O service the link is attached to
+     * \param link The link to send the packets on
+     * \param disconnect Function to disconnect the link from the I/O service
+     * \param sid The stream ID of the radio
+     */
+    void connect_radio(const size_t chan,
+        io_service::sptr io_srv,
+        send_link_if::sptr link,
+        vrt_tx_data_xport::disconnect_callback_t disconnect,
+        const uint32_t sid)
+    {
+        connect_channel(chan,
+            std::make_unique<vrt_tx_data_xport>(std::move(io_srv),
+                std::move(link),
+                sid,
+                B200_LINK_TYPE,
+                B200_ENDIANNESS,
+                std::move(disconnect)));
+    }
+
+    bool recv_async_msg(async_metadata_t& async_metadata, double timeout) override
+    {
+        return _async_receiver(async_metadata, timeout);
+    }
+
+    void post_output_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+        throw uhd::not_implemented_error("post_output_action is not implemented here!");
+    }
+
+    void set_tick_rate(const double rate)
+    {
+        tx_streamer_impl::set_tick_rate(rate);
+    }
+
+    void set_samp_rate(const double rate)
+    {
+        tx_streamer_impl::set_samp_rate(rate);
+    }
+
+    void set_scale_factor(const size_t chan, const double scale_factor)
+    {
+        tx_streamer_impl::set_scale_factor(chan, scale_factor);
+    }
+
+private:
+    async_receiver_t _async_receiver;
+};
+
+} // namespace
+
 /***********************************************************************
  * update streamer rates
  **********************************************************************/
@@ -37,16 +258,12 @@ size_t b200_impl::max_chan_count(const std::string& direction /* = "" */)
     size_t max_count = 0;
     for (radio_perifs_t& perif : _radio_perifs) {
         if (direction == "RX" or direction.empty()) {
-            if (auto p = perif.rx_streamer.lock()) {
-                auto rx_streamer =
-                    std::dynamic_pointer_cast<sph::recv_packet_streamer>(p);
+            if (auto rx_streamer = perif.rx_streamer.lock()) {
                 max_count = std::max(max_count, rx_streamer->get_num_channels());
             }
         }
         if (direction == "TX" or direction.empty()) {
-            if (auto p = perif.tx_streamer.lock()) {
-                auto tx_streamer =
-                    std::dynamic_pointer_cast<sph::send_packet_streamer>(p);
+            if (auto tx_streamer = perif.tx_streamer.lock()) {
                 max_count = std::max(max_count, tx_streamer->get_num_channels());
             }
         }
@@ -143,17 +360,15 @@ void b200_impl::update_tick_rate(const double new_tick_rate)
     check_tick_rate_with_current_streamers(new_tick_rate);
 
     for (radio_perifs_t& perif : _radio_perifs) {
-        std::shared_ptr<sph::recv_packet_streamer> my_streamer =
-            std::dynamic_pointer_cast<sph::recv_packet_streamer>(
-                perif.rx_streamer.lock());
+        std::shared_ptr<b200_rx_streamer> my_streamer =
+            std::dynamic_pointer_cast<b200_rx_streamer>(perif.rx_streamer.lock());
         if (my_streamer)
             my_streamer->set_tick_rate(new_tick_rate);
         perif.framer->set_tick_rate(new_tick_rate);
     }
     for (radio_perifs_t& perif : _radio_perifs) {
-        std::shared_ptr<sph::send_packet_streamer> my_streamer =
-            std::dynamic_pointer_cast<sph::send_packet_streamer>(
-                perif.tx_streamer.lock());
+        std::shared_ptr<b200_tx_streamer> my_streamer =
+            std::dynamic_pointer_cast<b200_tx_streamer>(perif.tx_streamer.lock());
         if (my_streamer)
             my_streamer->set_tick_rate(new_tick_rate);
     }
@@ -205,14 +420,16 @@ double b200_impl::coerce_rx_samp_rate(
 
 void b200_impl::update_rx_samp_rate(const size_t dspno, const double rate)
 {
-    std::shared_ptr<sph::recv_packet_streamer> my_streamer =
-        std::dynamic_pointer_cast<sph::recv_packet_streamer>(
+    std::shared_ptr<b200_rx_streamer> my_streamer =
+        std::dynamic_pointer_cast<b200_rx_streamer>(
             _radio_perifs[dspno].rx_streamer.lock());
     if (not my_streamer)
         return;
     my_streamer->set_samp_rate(rate);
     const double adj = _radio_perifs[dspno].ddc->get_scaling_adjustment();
-    my_streamer->set_scale_factor(adj);
+    for (size_t chan = 0; chan < my_streamer->get_num_channels(); chan++) {
+        my_streamer->set_scale_factor(chan, adj);
+    }
     _codec_mgr->check_bandwidth(rate, "Rx");
 }
 
@@ -232,14 +449,16 @@ double b200_impl::coerce_tx_samp_rate(
 
 void b200_impl::update_tx_samp_rate(const size_t dspno, const double rate)
 {
-    std::shared_ptr<sph::send_packet_streamer> my_streamer =
-        std::dynamic_pointer_cast<sph::send_packet_streamer>(
+    std::shared_ptr<b200_tx_streamer> my_streamer =
+        std::dynamic_pointer_cast<b200_tx_streamer>(
             _radio_perifs[dspno].tx_streamer.lock());
     if (not my_streamer)
         return;
     my_streamer->set_samp_rate(rate);
     const double adj = _radio_perifs[dspno].duc->get_scaling_adjustment();
-    my_streamer->set_scale_factor(adj);
+    for (size_t chan = 0; chan < my_streamer->get_num_channels(); chan++) {
+        my_streamer->set_scale_factor(chan, adj);
+    }
     _codec_mgr->check_bandwidth(rate, "Tx");
 }
 
@@ -290,13 +509,6 @@ static void b200_if_hdr_unpack_le(
     return vrt::if_hdr_unpack_le(packet_buff, if_packet_info);
 }
 
-static void b200_if_hdr_pack_le(
-    uint32_t* packet_buff, vrt::if_packet_info_t& if_packet_info)
-{
-    if_packet_info.link_type = vrt::if_packet_info_t::LINK_TYPE_CHDR;
-    return vrt::if_hdr_pack_le(packet_buff, if_packet_info);
-}
-
 /***********************************************************************
  * Async Data
  **********************************************************************/
@@ -408,7 +620,12 @@ rx_streamer::sptr b200_impl::get_rx_stream(const uhd::stream_args_t& args_)
     }
     check_streamer_args(args, this->get_tick_rate(), "RX");
 
-    std::shared_ptr<sph::recv_packet_streamer> my_streamer;
+    auto my_streamer = std::make_shared<b200_rx_streamer>(args,
+        std::bind(&b200_impl::handle_overflow, this, std::placeholders::_1));
+    const std::string streamer_id = "RxStreamer#" + std::to_string(_num_streamers++);
+    // The channels share the frames of the data transport
+    const size_t num_recv_frames = std::max<size_t>(
+        1, _data_transport->get_num_recv_frames() / args.channels.size());
     for (size_t stream_i = 0; stream_i < args.channels.size(); stream_i++) {
         const size_t radio_index =
             _tree->access<std::vector<size_t>>("/mboards/0/rx_chan_dsp_mapping")
@@ -438,40 +655,38 @@ rx_streamer::sptr b200_impl::get_rx_stream(const uhd::stream_args_t& args_)
         size_t spp       = unsigned(args.args.cast<double>("spp", bpp / bpi));
         spp = std::min<size_t>(4092, spp); // FPGA FIFO maximum for framing at full rate
 
-        // make the new streamer given the samples per packet
-        if (not my_streamer)
-            my_streamer = std::make_shared<sph::recv_packet_streamer>(spp);
-        my_streamer->resize(args.channels.size());
-
-        // init some streamer stuff
-        my_streamer->set_vrt_unpacker(&b200_if_hdr_unpack_le);
-
-        // set the converter
-        uhd::convert::id_type id;
-        id.input_format  = args.otw_format + "_item32_le";
-        id.num_inputs    = 1;
-        id.output_format = args.cpu_format;
-        id.num_outputs   = 1;
-        my_streamer->set_converter(id);
-
         perif.framer->clear();
         perif.framer->set_nsamps_per_packet(spp);
         perif.framer->set_sid(sid);
         perif.framer->setup(args);
         perif.ddc->setup(args);
-        _demux->realloc_sid(sid);
-        my_streamer->set_xport_chan_get_buff(stream_i,
-            std::bind(&recv_packet_demuxer_3000::get_recv_buff,
-                _demux,
-                sid,
-                std::placeholders::_1),
-            true /*flush*/);
-        my_streamer->set_overflow_handler(
-            stream_i, std::bind(&b200_impl::handle_overflow, this, radio_index));
-        my_streamer->set_issue_stream_cmd(stream_i,
+
+        // The proxy clears the demuxer queue of this SID, then flush whatever
+        // is still in flight
+        zero_copy_if::sptr xport = _demux->make_proxy(sid);
+        while (xport->get_recv_buff(0.0)) {
+        }
+        // Each channel gets its own link on its demuxer proxy, so the links
+        // are not muxed and can use any I/O service
+        recv_link_if::sptr link = zero_copy_link::make(xport, num_recv_frames, 0);
+
+        auto io_srv = _io_srv_mgr->connect_links(link,
+            nullptr,
+            link_type_t::RX_DATA,
+            get_default_io_srv_args(),
+            args.args,
+            streamer_id);
+        my_streamer->connect_radio(stream_i,
+            radio_index,
+            io_srv,
+            link,
+            [io_srv_mgr = _io_srv_mgr, link]() {
+                io_srv_mgr->disconnect_links(link, nullptr);
+            },
             std::bind(&rx_vita_core_3000::issue_stream_command,
                 perif.framer,
                 std::placeholders::_1));
+        my_streamer->set_max_num_samps(spp);
         perif.rx_streamer = my_streamer; // store weak pointer
 
         // sets all tick and samp rates on this streamer
@@ -488,9 +703,7 @@ rx_streamer::sptr b200_impl::get_rx_stream(const uhd::stream_args_t& args_)
 
 void b200_impl::handle_overflow(const size_t radio_index)
 {
-    std::shared_ptr<sph::recv_packet_streamer> my_streamer =
-        std::dynamic_pointer_cast<sph::recv_packet_streamer>(
-            _radio_perifs[radio_index].rx_streamer.lock());
+    rx_streamer::sptr my_streamer = _radio_perifs[radio_index].rx_streamer.lock();
     if (my_streamer->get_num_channels() == 2) // MIMO time
     {
         // find out if we were in continuous mode before stopping
@@ -540,7 +753,15 @@ tx_streamer::sptr b200_impl::get_tx_stream(const uhd::stream_args_t& args_)
     }
     check_streamer_args(args, this->get_tick_rate(), "TX");
 
-    std::shared_ptr<sph::send_packet_streamer> my_streamer;
+    auto my_streamer = std::make_shared<b200_tx_streamer>(args,
+        std::bind(&async_md_type::pop_with_timed_wait,
+            _async_task_data->async_md,
+            std::placeholders::_1,
+            std::placeholders::_2));
+    const std::string streamer_id = "TxStreamer#" + std::to_string(_num_streamers++);
+    // The channels share the frames of the data transport
+    const size_t num_send_frames = std::max<size_t>(
+        1, _data_transport->get_num_send_frames() / args.channels.size());
     for (size_t stream_i = 0; stream_i < args.channels.size(); stream_i++) {
         const size_t radio_index =
             _tree->access<std::vector<size_t>>("/mboards/0/tx_chan_dsp_mapping")
@@ -556,48 +777,28 @@ tx_streamer::sptr b200_impl::get_tx_stream(const uhd::stream_args_t& args_)
         if (args.otw_format == "sc8")
             perif.ctrl->poke32(TOREG(SR_TX_FMT), 3);
 
-        // calculate packet size
-        static const size_t hdr_size =
-            0
-            + vrt::max_if_hdr_words32 * sizeof(uint32_t)
-            //+ sizeof(vrt::if_packet_info_t().tlr) //forced to have trailer
-            - sizeof(vrt::if_packet_info_t().cid) // no class id ever used
-            - sizeof(vrt::if_packet_info_t().tsi) // no int time ever used
-            ;
-        static const size_t bpp = _data_transport->get_send_frame_size() - hdr_size;
-        const size_t spp        = bpp / convert::get_bytes_per_item(args.otw_format);
-
-        // make the new streamer given the samples per packet
-        if (not my_streamer)
-            my_streamer = std::make_shared<sph::send_packet_streamer>(spp);
-        my_streamer->resize(args.channels.size());
-
-        // init some streamer stuff
-        my_streamer->set_vrt_packer(&b200_if_hdr_pack_le);
-
-        // set the converter
-        uhd::convert::id_type id;
-        id.input_format  = args.cpu_format;
-        id.num_inputs    = 1;
-        id.output_format = args.otw_format + "_item32_le";
-        id.num_outputs   = 1;
-        my_streamer->set_converter(id);
-
         perif.deframer->clear();
         perif.deframer->setup(args);
         perif.duc->setup(args);
 
-        my_streamer->set_xport_chan_get_buff(stream_i,
-            std::bind(
-                &zero_copy_if::get_send_buff, _data_transport, std::placeholders::_1));
-        my_streamer->set_async_receiver(std::bind(&async_md_type::pop_with_timed_wait,
-            _async_task_data->async_md,
-            std::placeholders::_1,
-            std::placeholders::_2));
-        my_streamer->set_xport_chan_sid(
-            stream_i, true, radio_index ? B200_TX_DATA1_SID : B200_TX_DATA0_SID);
-        my_streamer->set_enable_trailer(false); // TODO not implemented trailer support
-                                                // yet
+        // The packet size follows from the send frame size of the transport.
+        // Each channel gets its own link, so the links are not muxed.
+        send_link_if::sptr link =
+            zero_copy_link::make(_data_transport, 0, num_send_frames);
+
+        auto io_srv = _io_srv_mgr->connect_links(nullptr,
+            link,
+            link_type_t::TX_DATA,
+            get_default_io_srv_args(),
+            args.args,
+            streamer_id);
+        my_streamer->connect_radio(stream_i,
+            io_srv,
+            link,
+            [io_srv_mgr = _io_srv_mgr, link]() {
+                io_srv_mgr->disconnect_links(nullptr, link);
+            },
+            radio_index ? B200_TX_DATA1_SID : B200_TX_DATA0_SID);
         perif.tx_streamer = my_streamer; // store weak pointer
 
         // sets all tick and samp rates on this streamer
@@ -18,7 +18,9 @@ static const char* recv_offload_str             = "recv_offload";
 static const char* send_offload_str             = "send_offload";
 static const char* recv_offload_wait_mode_str   = "recv_offload_wait_mode";
 static const char* send_offload_wait_mode_str   = "send_offload_wait_mode";
+static const char* offload_queue_wait_str       = "offload_queue_wait";
 static const char* num_poll_offload_threads_str = "num_poll_offload_threads";
+static const char* recv_io_uring_str            = "recv_io_uring";
 
 static const std::regex recv_offload_thread_cpu_expr("^recv_offload_thread_(\\d+)_cpu");
 static const std::regex send_offload_thread_cpu_expr("^send_offload_thread_(\\d+)_cpu");
@@ -51,6 +53,23 @@ io_service_args_t::wait_mode_t get_wait_mode_arg(const device_addr_t& args,
     return arg.get();
 }
 
+io_service_args_t::queue_wait_policy_t get_queue_wait_policy_arg(
+    const device_addr_t& args,
+    const std::string& key,
+    const io_service_args_t::queue_wait_policy_t def)
+{
+    constrained_device_args_t::enum_arg<io_service_args_t::queue_wait_policy_t> arg(key,
+        def,
+        {{"spin", io_service_args_t::SPIN},
+            {"yield", io_service_args_t::SPIN_YIELD},
+            {"futex", io_service_args_t::SPIN_FUTEX}});
+
+    if (args.has_key(key)) {
+        arg.parse(args[key]);
+    }
+    return arg.get();
+}
+
 }; // namespace
 
 io_service_args_t read_io_service_args(
@@ -69,6 +88,9 @@ io_service_args_t read_io_service_args(
     io_srv_args.send_offload_wait_mode = get_wait_mode_arg(
         args, send_offload_wait_mode_str, defaults.send_offload_wait_mode);
 
+    io_srv_args.offload_queue_wait_policy = get_queue_wait_policy_arg(
+        args, offload_queue_wait_str, defaults.offload_queue_wait_policy);
+
     io_srv_args.num_poll_offload_threads = args.cast<size_t>(
         num_poll_offload_threads_str, defaults.num_poll_offload_threads);
     if (io_srv_args.num_poll_offload_threads == 0) {
@@ -97,6 +119,9 @@ io_service_args_t read_io_service_args(
     read_thread_args(send_offload_thread_cpu_expr, io_srv_args.send_offload_thread_cpu);
     read_thread_args(poll_offload_thread_cpu_expr, io_srv_args.poll_offload_thread_cpu);
 
+    io_srv_args.recv_io_uring =
+        get_bool_arg(args, recv_io_uring_str, defaults.recv_io_uring);
+
     return io_srv_args;
 }
 
@@ -119,7 +144,9 @@ device_addr_t merge_io_service_dev_args(
     merge_args(dev_args, args, send_offload_str);
     merge_args(dev_args, args, recv_offload_wait_mode_str);
     merge_args(dev_args, args, send_offload_wait_mode_str);
+    merge_args(dev_args, args, offload_queue_wait_str);
     merge_args(dev_args, args, num_poll_offload_threads_str);
+    merge_args(dev_args, args, recv_io_uring_str);
 
     auto merge_thread_args = [&merge_args](const device_addr_t& dev_args,
                                  device_addr_t& stream_args,
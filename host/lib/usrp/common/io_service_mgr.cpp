@@ -5,16 +5,19 @@
 //
 
 #include <uhd/config.hpp>
+#include <uhd/exception.hpp>
 #include <uhd/transport/adapter_id.hpp>
 #include <uhd/utils/algorithm.hpp>
 #include <uhd/utils/log.hpp>
 #include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/transport/io_uring_io_service.hpp>
 #include <uhdlib/transport/offload_io_service.hpp>
 #ifdef HAVE_DPDK
 #    include <uhdlib/usrp/common/dpdk_io_service_mgr.hpp>
 #endif
 #include <uhdlib/usrp/common/io_service_mgr.hpp>
 #include <uhdlib/usrp/constrained_device_args.hpp>
+#include <functional>
 #include <map>
 #include <vector>
 
@@ -31,15 +34,52 @@ namespace uhd { namespace usrp {
  * object selects which one to invoke based on the provided stream args.
  */
 
+/* Creates the I/O service that does the actual work, either in the caller
+ * thread, or inside of an offload thread.
+ */
+static io_service::sptr make_worker_io_service(const bool use_io_uring)
+{
+    if (use_io_uring) {
+        return io_uring_io_service::make();
+    }
+    return inline_io_service::make();
+}
+
+/* Translates the queue wait policy from the I/O service args to the one of
+ * the offload I/O service.
+ */
+static offload_io_service::queue_wait_policy_t get_queue_wait_policy(
+    const io_service_args_t& args)
+{
+    switch (args.offload_queue_wait_policy) {
+        case io_service_args_t::SPIN:
+            return offload_io_service::SPIN;
+        case io_service_args_t::SPIN_YIELD:
+            return offload_io_service::SPIN_YIELD;
+        case io_service_args_t::SPIN_FUTEX:
+            return offload_io_service::SPIN_FUTEX;
+    }
+    UHD_THROW_INVALID_CODE_PATH();
+}
+
 /* Inline I/O service manager
  *
- * I/O service manager for inline I/O services. Creates a new inline_io_service
- * for every new pair of links, unless they are already attached to an I/O
- * service (muxed links).
+ * I/O service manager for I/O services running in the caller thread. Creates a
+ * new inline_io_service (or whatever I/O service the factory passed to the
+ * constructor creates) for every new pair of links, unless they are already
+ * attached to an I/O service (muxed links).
  */
 class inline_io_service_mgr
 {
 public:
+    using io_service_factory_t = std::function<io_service::sptr()>;
+
+    inline_io_service_mgr(
+        io_service_factory_t make_io_srv = [] { return make_worker_io_service(false); })
+        : _make_io_srv(make_io_srv)
+    {
+    }
+
     io_service::sptr connect_links(
         recv_link_if::sptr recv_link, send_link_if::sptr send_link);
 
@@ -54,6 +94,8 @@ private:
 
     using link_pair_t = std::pair<recv_link_if::sptr, send_link_if::sptr>;
     std::map<link_pair_t, link_info_t> _link_info_map;
+
+    io_service_factory_t _make_io_srv;
 };
 
 io_service::sptr inline_io_service_mgr::connect_links(
@@ -70,7 +112,7 @@ io_service::sptr inline_io_service_mgr::connect_links(
     }
 
     // Links are not muxed, create a new inline I/O service
-    auto io_srv = inline_io_service::make();
+    auto io_srv = _make_io_srv();
 
     if (recv_link) {
         io_srv->attach_recv_link(recv_link);
@@ -246,10 +288,11 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
     const io_service_args_t& args, const link_type_t link_type, const size_t thread_index)
 {
     offload_io_service::params_t params;
-    params.wait_mode   = offload_io_service::BLOCK;
-    params.client_type = (link_type == link_type_t::RX_DATA)
-                             ? offload_io_service::RECV_ONLY
-                             : offload_io_service::SEND_ONLY;
+    params.wait_mode         = offload_io_service::BLOCK;
+    params.client_type       = (link_type == link_type_t::RX_DATA)
+                                   ? offload_io_service::RECV_ONLY
+                                   : offload_io_service::SEND_ONLY;
+    params.queue_wait_policy = get_queue_wait_policy(args);
 
     const auto& cpu_map = (link_type == link_type_t::RX_DATA)
                               ? args.recv_offload_thread_cpu
@@ -267,10 +310,13 @@ io_service::sptr blocking_io_service_mgr::_create_new_io_service(
     std::string link_type_str = (link_type == link_type_t::RX_DATA) ? "RX data"
                                                                     : "TX data";
 
+    const bool use_io_uring = (link_type == link_type_t::RX_DATA) && args.recv_io_uring;
+
     UHD_LOG_INFO(LOG_ID,
-        "Creating new blocking I/O service for " << link_type_str << cpu_affinity_str);
+        "Creating new blocking I/O service for "
+            << link_type_str << cpu_affinity_str << (use_io_uring ? ", io_uring" : ""));
 
-    return offload_io_service::make(inline_io_service::make(), params);
+    return offload_io_service::make(make_worker_io_service(use_io_uring), params);
 }
 
 /* Polling I/O service manager
@@ -382,8 +428,9 @@ io_service::sptr polling_io_service_mgr::_create_new_io_service(
     const io_service_args_t& args, const size_t thread_index)
 {
     offload_io_service::params_t params;
-    params.client_type = offload_io_service::BOTH_SEND_AND_RECV;
-    params.wait_mode   = offload_io_service::POLL;
+    params.client_type       = offload_io_service::BOTH_SEND_AND_RECV;
+    params.wait_mode         = offload_io_service::POLL;
+    params.queue_wait_policy = get_queue_wait_policy(args);
 
     const auto& cpu_map = args.poll_offload_thread_cpu;
 
@@ -396,9 +443,11 @@ io_service::sptr polling_io_service_mgr::_create_new_io_service(
         cpu_affinity_str = ", cpu affinity: none";
     }
 
-    UHD_LOG_INFO(LOG_ID, "Creating new polling I/O service" << cpu_affinity_str);
+    UHD_LOG_INFO(LOG_ID,
+        "Creating new polling I/O service"
+            << cpu_affinity_str << (args.recv_io_uring ? ", io_uring" : ""));
 
-    return offload_io_service::make(inline_io_service::make(), params);
+    return offload_io_service::make(make_worker_io_service(args.recv_io_uring), params);
 }
 
 /* Main I/O service manager implementation class
@@ -422,7 +471,12 @@ public:
         recv_link_if::sptr recv_link, send_link_if::sptr send_link) override;
 
 private:
-    enum io_service_type_t { INLINE_IO_SRV, BLOCKING_IO_SRV, POLLING_IO_SRV };
+    enum io_service_type_t {
+        INLINE_IO_SRV,
+        IO_URING_IO_SRV,
+        BLOCKING_IO_SRV,
+        POLLING_IO_SRV
+    };
     struct xport_args_t
     {
         bool offload                              = false;
@@ -441,6 +495,8 @@ private:
     const uhd::device_addr_t _args;
 
     inline_io_service_mgr _inline_io_srv_mgr;
+    inline_io_service_mgr _io_uring_io_srv_mgr{
+        [] { return make_worker_io_service(true); }};
     blocking_io_service_mgr _blocking_io_srv_mgr;
     polling_io_service_mgr _polling_io_srv_mgr;
 
@@ -515,6 +571,8 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
                 } else {
                     io_srv_type = BLOCKING_IO_SRV;
                 }
+            } else if (link_type == link_type_t::RX_DATA && args.recv_io_uring) {
+                io_srv_type = IO_URING_IO_SRV;
             } else {
                 io_srv_type = INLINE_IO_SRV;
             }
@@ -522,19 +580,23 @@ io_service::sptr io_service_mgr_impl::connect_links(recv_link_if::sptr recv_link
     }
 
     // If the link doesn't support buffers out of order, then we can only use
-    // the inline I/O service. Warn if a different one was requested.
+    // an I/O service running in the caller thread. Warn if a different one was
+    // requested.
     if (!_out_of_order_supported(recv_link, send_link)) {
-        if (io_srv_type != INLINE_IO_SRV) {
+        if (io_srv_type != INLINE_IO_SRV && io_srv_type != IO_URING_IO_SRV) {
             UHD_LOG_WARNING(
                 LOG_ID, "Link type does not support send/recv offload, ignoring");
+            io_srv_type = INLINE_IO_SRV;
         }
-        io_srv_type = INLINE_IO_SRV;
     }
 
     switch (io_srv_type) {
         case INLINE_IO_SRV:
             io_srv = _inline_io_srv_mgr.connect_links(recv_link, send_link);
             break;
+        case IO_URING_IO_SRV:
+            io_srv = _io_uring_io_srv_mgr.connect_links(recv_link, send_link);
+            break;
         case BLOCKING_IO_SRV:
             io_srv = _blocking_io_srv_mgr.connect_links(
                 recv_link, send_link, link_type, args, streamer_id);
@@ -561,6 +623,9 @@ void io_service_mgr_impl::disconnect_links(
         case INLINE_IO_SRV:
             _inline_io_srv_mgr.disconnect_links(recv_link, send_link);
             break;
+        case IO_URING_IO_SRV:
+            _io_uring_io_srv_mgr.disconnect_links(recv_link, send_link);
+            break;
         case BLOCKING_IO_SRV:
             _blocking_io_srv_mgr.disconnect_links(recv_link, send_link);
             break;
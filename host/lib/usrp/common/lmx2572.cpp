@@ -61,18 +61,27 @@ public:
     void commit() override
     {
         UHD_LOG_TRACE(LOG_ID, "Storing register cache to LMX2572...");
-        const auto changed_addrs = _regs.get_changed_addrs<uint8_t>();
-        for (const auto addr : changed_addrs) {
+        const auto writes = commit_to_burst();
+        for (const auto& write : writes) {
+            _poke16(write.first, write.second);
+        }
+        UHD_LOG_TRACE(
+            LOG_ID, "Storing cache complete: Updated " << writes.size() << " registers.");
+    }
+
+    std::vector<reg_write_t> commit_to_burst() override
+    {
+        std::vector<reg_write_t> writes;
+        for (const auto addr : _regs.get_changed_addrs<uint8_t>()) {
             // We write R0 last, for double-buffering
             if (addr == 0) {
                 continue;
             }
-            _poke16(addr, _regs.get_reg(addr));
+            writes.emplace_back(addr, _regs.get_reg(addr));
         }
-        _poke16(0, _regs.get_reg(0));
+        writes.emplace_back(0, _regs.get_reg(0));
         _regs.save_state();
-        UHD_LOG_TRACE(LOG_ID,
-            "Storing cache complete: Updated " << changed_addrs.size() << " registers.");
+        return writes;
     }
 
     bool get_enabled() override
@@ -372,6 +381,55 @@ public:
         return actual_freq;
     }
 
+    freq_image_t compute_frequency_image(
+        const double target_freq, const double fOSC, const bool spur_dodging) override
+    {
+        // Run the regular calculations on the register cache, then restore it.
+        // Both outputs are enabled for the calculations, so that the image has
+        // the output mux and power settings for this frequency for either of
+        // them.
+        const std::vector<uint16_t> prev_regs = _get_reg_image();
+        freq_image_t image;
+        try {
+            set_output_enable_all(true);
+            image.freq = set_frequency(target_freq, fOSC, spur_dodging);
+        } catch (...) {
+            _set_reg_image(prev_regs);
+            throw;
+        }
+        image.regs = _get_reg_image();
+        _set_reg_image(prev_regs);
+        return image;
+    }
+
+    double set_frequency_image(const freq_image_t& image) override
+    {
+        UHD_ASSERT_THROW(image.regs.size() == size_t(_regs.get_num_regs()));
+        // Power-down and output enables are not taken from the image. Like
+        // set_frequency(), the image only sets the output mux and power of
+        // enabled outputs.
+        const auto powerdown = _regs.powerdown;
+        const auto outa_pd   = _regs.outa_pd;
+        const auto outb_pd   = _regs.outb_pd;
+        const auto outa_mux  = _regs.outa_mux;
+        const auto outb_mux  = _regs.outb_mux;
+        const auto outa_pwr  = _regs.outa_pwr;
+        const auto outb_pwr  = _regs.outb_pwr;
+        _set_reg_image(image.regs);
+        _regs.powerdown = powerdown;
+        _regs.outa_pd   = outa_pd;
+        _regs.outb_pd   = outb_pd;
+        if (!_get_output_enabled(RF_OUTPUT_A)) {
+            _regs.outa_mux = outa_mux;
+            _regs.outa_pwr = outa_pwr;
+        }
+        if (!_get_output_enabled(RF_OUTPUT_B)) {
+            _regs.outb_mux = outb_mux;
+            _regs.outb_pwr = outb_pwr;
+        }
+        return image.freq;
+    }
+
 private:
     /**************************************************************************
      * Attributes
@@ -447,6 +505,28 @@ private:
         return CAT1A;
     }
 
+    //! Return the contents of the register cache, indexed by address
+    std::vector<uint16_t> _get_reg_image()
+    {
+        std::vector<uint16_t> image(_regs.get_num_regs());
+        for (size_t addr = 0; addr < image.size(); addr++) {
+            image[addr] = _regs.get_reg(uhd::narrow_cast<int>(addr));
+        }
+        return image;
+    }
+
+    //! Load the register cache from an image (read-only registers are skipped)
+    void _set_reg_image(const std::vector<uint16_t>& image)
+    {
+        const auto ro_regs = _regs.get_ro_regs();
+        for (size_t addr = 0; addr < image.size(); addr++) {
+            if (ro_regs.count(uhd::narrow_cast<uint8_t>(addr))) {
+                continue;
+            }
+            _regs.set_reg(uhd::narrow_cast<int>(addr), image[addr]);
+        }
+    }
+
     //! Enable/disable register readback mode enabled
     // SPI MISO is multiplexed to lock detect and register readback. Reading
     // any register when the mux is set to lock detect will return just the
@@ -655,6 +655,15 @@ void zbx_cpld_ctrl::lo_poke16(const zbx_lo_t lo, const uint8_t addr, const uint1
     // to throttle.
 }
 
+void zbx_cpld_ctrl::lo_poke16_burst(const std::vector<lo_spi_write_t>& writes)
+{
+    for (size_t i = 0; i < writes.size(); i++) {
+        const bool last = (i + 1 == writes.size());
+        _lo_spi_transact(
+            writes[i].lo, writes[i].addr, writes[i].data, spi_xact_t::WRITE, !last);
+    }
+}
+
 uint16_t zbx_cpld_ctrl::lo_peek16(const zbx_lo_t lo, const uint8_t addr)
 {
     _lo_spi_transact(lo, addr, 0, spi_xact_t::READ, true);
@@ -786,6 +795,8 @@ void zbx_cpld_ctrl::pulse_lo_sync(const size_t ref_chan, const std::vector<zbx_l
         UHD_LOG_ERROR(_log_id, err_msg);
         throw uhd::runtime_error(_log_id + err_msg);
     }
+    // The LOs must have received their last register write before the pulse
+    _finish_lo_spi_throttle();
     // Assert a 1 for all LOs to be sync'd
     static const std::unordered_map<zbx_lo_t, zbx_cpld_regs_t::zbx_cpld_field_t>
         lo_pulse_map{{
@@ -858,6 +869,7 @@ void zbx_cpld_ctrl::_lo_spi_transact(const zbx_lo_t lo,
                             || lo == zbx_lo_t::RX0_LO1 || lo == zbx_lo_t::RX0_LO2)
                             ? CHAN0
                             : CHAN1;
+    _finish_lo_spi_throttle();
     // Note: For SPI transactions, we can't also be lugging around other
     // registers. This means that we assume that the state of _regs is clean.
     _regs.ADDRESS   = addr;
@@ -873,6 +885,16 @@ void zbx_cpld_ctrl::_lo_spi_transact(const zbx_lo_t lo,
     // transactions:
     if (throttle) {
         _sleep(SPI_THROTTLE_TIME);
+    } else {
+        _lo_spi_throttle_pending = true;
+    }
+}
+
+void zbx_cpld_ctrl::_finish_lo_spi_throttle()
+{
+    if (_lo_spi_throttle_pending) {
+        _sleep(SPI_THROTTLE_TIME);
+        _lo_spi_throttle_pending = false;
     }
 }
 
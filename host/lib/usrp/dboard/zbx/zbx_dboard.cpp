@@ -503,6 +503,167 @@ double zbx_dboard_impl::get_tx_lo_freq(const std::string& name, const size_t cha
     return _tree->access<double>(fe_path / "los" / name / "freq" / "value").get();
 }
 
+void zbx_dboard_impl::_set_tune_plan_freqs(
+    const direction_t trx, const size_t chan, const std::vector<double>& freqs)
+{
+    RFNOC_LOG_TRACE("Planning " << freqs.size() << " frequencies for "
+                                << (trx == TX_DIRECTION ? "TX" : "RX") << chan);
+    const fs_path fe_path = _get_frontend_path(trx, chan);
+    const auto tune_table =
+        _tree->access<std::vector<zbx_tune_map_item_t>>(fe_path / "tune_table").get();
+    const freq_range_t lo_freq_range =
+        _get_quantized_lo_range(_prc_rate / ZBX_RELATIVE_LO_STEP_SIZE);
+
+    // The LO experts request exactly the frequencies calculated here, so the
+    // LO controls can match them against their plans.
+    std::vector<double> lo1_freqs;
+    std::vector<double> lo2_freqs;
+    auto& plans = _tune_plan_hops.at(fe_path).plans;
+    plans.clear();
+    for (const double freq : freqs) {
+        const zbx_tune_plan_t plan =
+            calc_tune_plan(trx, chan, freq, tune_table, lo_freq_range, _rfdc_rate);
+        if (plan.lo1_enabled) {
+            lo1_freqs.push_back(plan.lo1_freq);
+        }
+        lo2_freqs.push_back(plan.lo2_freq);
+        plans.emplace(freq, plan);
+    }
+    _lo_ctrl_map.at(zbx_lo_ctrl::lo_string_to_enum(trx, chan, ZBX_LO1))
+        ->set_planned_lo_freqs(lo1_freqs);
+    _lo_ctrl_map.at(zbx_lo_ctrl::lo_string_to_enum(trx, chan, ZBX_LO2))
+        ->set_planned_lo_freqs(lo2_freqs);
+}
+
+void zbx_dboard_impl::_hop_to_tune_plan(
+    const direction_t trx, const size_t chan, const double freq)
+{
+    const fs_path fe_path = _get_frontend_path(trx, chan);
+    auto& hop             = _tune_plan_hops.at(fe_path);
+    const auto plan_it    = hop.plans.find(freq);
+    if (plan_it == hop.plans.end()) {
+        throw uhd::key_error("No tune plan for " + std::to_string(freq / 1e6)
+                             + " MHz on " + fe_path);
+    }
+    const zbx_tune_plan_t& plan          = plan_it->second;
+    const zbx_tune_map_item_t& tune_item = plan.tune_settings;
+    RFNOC_LOG_TRACE("Hopping to " << freq / 1e6 << " MHz on " << fe_path);
+
+    // LOs: Both LOs are written in one SPI burst
+    const zbx_lo_t lo1 = zbx_lo_ctrl::lo_string_to_enum(trx, chan, ZBX_LO1);
+    const zbx_lo_t lo2 = zbx_lo_ctrl::lo_string_to_enum(trx, chan, ZBX_LO2);
+    if (_lo_ctrl_map.at(lo1)->get_lo_port_enabled() != plan.lo1_enabled) {
+        _lo_ctrl_map.at(lo1)->set_lo_port_enabled(plan.lo1_enabled);
+    }
+    std::vector<zbx_cpld_ctrl::lo_spi_write_t> lo_writes;
+    std::vector<zbx_lo_t> written_los;
+    auto add_lo_writes = [&](const zbx_lo_t lo, const double lo_freq) {
+        const auto writes = _lo_ctrl_map.at(lo)->get_tune_plan_writes(lo_freq);
+        for (const auto& write : writes) {
+            lo_writes.push_back({lo, write.first, write.second});
+        }
+        if (!writes.empty()) {
+            written_los.push_back(lo);
+        }
+    };
+    if (plan.lo1_enabled) {
+        add_lo_writes(lo1, plan.lo1_freq);
+    }
+    add_lo_writes(lo2, plan.lo2_freq);
+    _cpld->lo_poke16_burst(lo_writes);
+
+    // Same calculation as zbx_freq_be_expert
+    const double coerced_if1_freq =
+        _lo_ctrl_map.at(lo2)->get_lo_freq()
+        + plan.if2_freq * static_cast<double>(tune_item.lo2_inj_side);
+    const double coerced_freq =
+        plan.is_highband
+            ? coerced_if1_freq
+            : std::abs(coerced_if1_freq - _lo_ctrl_map.at(lo1)->get_lo_freq());
+
+    // CPLD: Filters and, like the gain experts, DSAs for the current gain. The
+    // CPLD control caches its registers, so only changes are written.
+    for (const size_t idx : ATR_ADDRS) {
+        if (trx == TX_DIRECTION) {
+            _cpld->set_tx_rf_filter(chan, idx, tune_item.rf_fltr);
+            _cpld->set_tx_if1_filter(chan, idx, tune_item.if1_fltr);
+            _cpld->set_tx_if2_filter(chan, idx, tune_item.if2_fltr);
+        } else {
+            _cpld->set_rx_rf_filter(chan, idx, tune_item.rf_fltr);
+            _cpld->set_rx_if1_filter(chan, idx, tune_item.if1_fltr);
+            _cpld->set_rx_if2_filter(chan, idx, tune_item.if2_fltr);
+        }
+    }
+    if (hop.gain_profile->get() == ZBX_GAIN_PROFILE_DEFAULT) {
+        const double dsa_freq = ZBX_FREQ_RANGE.clip(coerced_freq);
+        if (trx == TX_DIRECTION) {
+            const double gain = ZBX_TX_GAIN_RANGE.clip(hop.desired_gain->get(), true);
+            const auto dsa_settings =
+                _tx_dsa_cal->get_dsa_setting(dsa_freq, gain / TX_GAIN_STEP);
+            const zbx_cpld_ctrl::tx_dsa_type dsa_steps = {
+                dsa_settings[0], dsa_settings[1]};
+            const tx_amp amp = static_cast<tx_amp>(dsa_settings[2]);
+            for (const uint8_t idx : {ATR_ADDR_TX, ATR_ADDR_XX}) {
+                _cpld->set_tx_gain_switches(chan, idx, dsa_steps);
+                _cpld->set_tx_antenna_switches(chan, idx, hop.antenna->get(), amp);
+            }
+        } else {
+            const double gain =
+                (coerced_freq <= RX_LOW_FREQ_MAX_GAIN_CUTOFF)
+                    ? ZBX_RX_LOW_FREQ_GAIN_RANGE.clip(hop.desired_gain->get(), true)
+                    : ZBX_RX_GAIN_RANGE.clip(hop.desired_gain->get(), true);
+            const auto dsa_settings =
+                _rx_dsa_cal->get_dsa_setting(dsa_freq, gain / RX_GAIN_STEP);
+            const zbx_cpld_ctrl::rx_dsa_type dsa_steps = {
+                dsa_settings[0], dsa_settings[1], dsa_settings[2], dsa_settings[3]};
+            for (const uint8_t idx : {ATR_ADDR_RX, ATR_ADDR_XX}) {
+                _cpld->set_rx_gain_switches(chan, idx, dsa_steps);
+            }
+        }
+    }
+
+    // NCO and IQ swap: These are RPC calls, so skip them unless they change.
+    // Until the expert graph has caught up with a previous hop, the graph
+    // doesn't know the current values.
+    const std::string trx_str = (trx == TX_DIRECTION) ? "tx" : "rx";
+    const bool hop_pending    = hop.desired_freq->is_dirty();
+    const double nco_freq =
+        hop_pending ? hop.nco_desired_freq : hop.desired_if2_freq->get();
+    const bool nco_changed = !uhd::math::frequencies_are_equal(nco_freq, plan.if2_freq);
+    if (nco_changed) {
+        hop.nco_coerced_freq =
+            _mb_rpcc->rfdc_set_nco_freq(trx_str, _db_idx, chan, plan.if2_freq);
+    } else if (!hop_pending) {
+        hop.nco_coerced_freq = hop.coerced_if2_freq->get();
+    }
+    hop.nco_desired_freq = plan.if2_freq;
+    const bool iq_swapped = hop_pending ? hop.iq_swapped : hop.band_inverted->get();
+    if (iq_swapped != plan.band_inverted) {
+        _rpcc->enable_iq_swap(plan.band_inverted, trx_str, chan);
+    }
+    hop.iq_swapped = plan.band_inverted;
+
+    // With a command time, synchronize what changed, like zbx_sync_expert
+    const uhd::time_spec_t cmd_time = _time_accessor(chan);
+    if (cmd_time != uhd::time_spec_t::ASAP) {
+        if (!written_los.empty()) {
+            _cpld->pulse_lo_sync(chan, written_los);
+        }
+        if (nco_changed) {
+            const auto nco = (trx == TX_DIRECTION)
+                                 ? (chan == 0 ? rfdc_control::rfdc_type::TX0
+                                              : rfdc_control::rfdc_type::TX1)
+                                 : (chan == 0 ? rfdc_control::rfdc_type::RX0
+                                              : rfdc_control::rfdc_type::RX1);
+            _rfdcc->reset_ncos({nco}, cmd_time);
+        }
+    }
+
+    // Let the expert graph catch up on its next resolve
+    hop.desired_freq->set(freq);
+    hop.coerced_freq->set(coerced_freq);
+}
+
 freq_range_t zbx_dboard_impl::_get_lo_freq_range(
     const std::string& name, const size_t /*chan*/) const
 {
@@ -283,6 +283,35 @@ uhd::usrp::pwr_cal_mgr::sptr zbx_dboard_impl::_init_power_cal(
         ggroup);
 }
 
+void zbx_dboard_impl::_init_tune_plan_hop(expert_container::sptr expert,
+    const uhd::direction_t trx,
+    const size_t chan_idx,
+    const fs_path fe_path)
+{
+    const auto& db = expert->node_retriever();
+    tune_plan_hop_state_t hop;
+    hop.desired_freq =
+        std::make_shared<data_writer_t<double>>(db, fe_path / "freq" / "desired");
+    hop.coerced_freq =
+        std::make_shared<data_writer_t<double>>(db, fe_path / "freq" / "coerced");
+    hop.desired_if2_freq =
+        std::make_shared<data_reader_t<double>>(db, fe_path / "if_freq" / "desired");
+    hop.coerced_if2_freq =
+        std::make_shared<data_reader_t<double>>(db, fe_path / "if_freq" / "coerced");
+    hop.band_inverted =
+        std::make_shared<data_reader_t<bool>>(db, fe_path / "band_inverted");
+    hop.desired_gain = std::make_shared<data_reader_t<double>>(
+        db, fe_path / "gains" / ZBX_GAIN_STAGE_ALL / "value" / "desired");
+    hop.gain_profile = std::make_shared<data_reader_t<std::string>>(
+        db, fe_path / "gains" / "all" / "profile");
+    // The TX antenna switches also select the TX amp
+    if (trx == TX_DIRECTION) {
+        hop.antenna = std::make_shared<data_reader_t<std::string>>(
+            db, fe_path / "antenna" / "value");
+    }
+    _tune_plan_hops.emplace(_get_frontend_path(trx, chan_idx), std::move(hop));
+}
+
 void zbx_dboard_impl::_init_experts(uhd::property_tree::sptr subtree,
     expert_container::sptr expert,
     const uhd::direction_t trx,
@@ -626,6 +655,20 @@ void zbx_dboard_impl::_init_lo_prop_tree(uhd::property_tree::sptr subtree,
             });
     }
 
+    // Frequencies for which the LO settings are calculated ahead of time
+    _init_tune_plan_hop(expert, trx, chan_idx, fe_path);
+    subtree->create<std::vector<double>>(fe_path / "tune_plan" / "freqs")
+        .set(std::vector<double>())
+        .add_coerced_subscriber(
+            [this, trx, chan_idx](const std::vector<double>& freqs) {
+                this->_set_tune_plan_freqs(trx, chan_idx, freqs);
+            });
+    // Writing one of those frequencies here retunes without the expert graph
+    subtree->create<double>(fe_path / "tune_plan" / "hop")
+        .add_coerced_subscriber([this, trx, chan_idx](const double freq) {
+            this->_hop_to_tune_plan(trx, chan_idx, freq);
+        });
+
     // The NCO gets a sub-node called 'reset'. It is read/write: Write will
     // perform a reset, and read will return the reset status. The latter is
     // also returned in the 'locked' sensor for the NCO, but the 'nco_locked'
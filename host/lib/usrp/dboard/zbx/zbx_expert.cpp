@@ -130,64 +130,52 @@ double _calc_ideal_if2_freq(
 
 } // namespace
 
-/*!---------------------------------------------------------
- * EXPERT RESOLVE FUNCTIONS
- *
- * This sections contains all expert resolve functions.
- * These methods are triggered by any of the bound accessors becoming "dirty",
- * or changing value
- * --------------------------------------------------------
- */
-void zbx_scheduling_expert::resolve()
+zbx_tune_plan_t calc_tune_plan(const uhd::direction_t trx,
+    const size_t chan,
+    const double freq,
+    const std::vector<zbx_tune_map_item_t>& tune_table,
+    const uhd::freq_range_t& lo_freq_range,
+    const double rfdc_rate)
 {
-    // We currently have no fancy scheduling, but here is where we'd add it if
-    // we need to do that (e.g., plan out SYNC pulse timing vs. NCO timing etc.)
-    _frontend_time = _command_time;
-}
+    zbx_tune_plan_t plan;
+    const double tune_freq = ZBX_FREQ_RANGE.clip(freq);
+    plan.tune_settings     = _get_tune_settings(tune_freq, tune_table);
+    const zbx_tune_map_item_t& tune_settings = plan.tune_settings;
 
-void zbx_freq_fe_expert::resolve()
-{
-    const double tune_freq = ZBX_FREQ_RANGE.clip(_desired_frequency);
-    _tune_settings         = _get_tune_settings(tune_freq, _tune_table.get());
-
-    // Set mixer values so the backend expert knows how to calculate final frequency
-    _lo1_inj_side = _tune_settings.lo1_inj_side;
-    _lo2_inj_side = _tune_settings.lo2_inj_side;
-
-    _is_highband = _is_band_highband(_tune_settings);
-    _lo1_enabled = !_is_highband.get();
+    plan.is_highband = _is_band_highband(tune_settings);
+    plan.lo1_enabled = !plan.is_highband;
+    plan.lo1_freq    = 0.0;
 
     double if1_freq      = tune_freq;
-    const double lo_step = _lo_freq_range.step();
+    const double lo_step = lo_freq_range.step();
     // If we need to apply an offset to avoid injection locking, we need to
     // offset in different directions for different channels on the same zbx
-    const double lo_offset_sign = (_chan == 0) ? -1 : 1;
+    const double lo_offset_sign = (chan == 0) ? -1 : 1;
     // In high band, LO1 is not needed (the signal is already at a high enough
     // frequency for the second stage)
-    if (_lo1_enabled) {
+    if (plan.lo1_enabled) {
         // Calculate the ideal IF1:
-        if1_freq = _calc_if1_freq(tune_freq, _tune_settings);
+        if1_freq = _calc_if1_freq(tune_freq, tune_settings);
         // We calculate the LO1 frequency by first shifting the tune frequency to the
         // desired IF, and then applying an offset such that CH0 and CH1 tune to distinct
         // LO1 frequencies: This is done to prevent the LO's from interfering with each
         // other in a phenomenon known as injection locking.
         const double lo1_freq =
-            if1_freq - (static_cast<double>(_tune_settings.lo1_inj_side) * tune_freq)
+            if1_freq - (static_cast<double>(tune_settings.lo1_inj_side) * tune_freq)
             + (lo_offset_sign * lo_step);
         // Now, quantize the LO frequency to the nearest valid value:
-        _desired_lo1_frequency = _lo_freq_range.clip(lo1_freq, true);
+        plan.lo1_freq = lo_freq_range.clip(lo1_freq, true);
         // Because LO1 frequency probably changed during quantization, we simply
         // re-calculate the now-valid IF1 (the following equation is the same as
         // the LO1 frequency calculation, but solved for if1_freq):
-        if1_freq = _desired_lo1_frequency
-                   + static_cast<double>(_tune_settings.lo1_inj_side) * tune_freq;
+        if1_freq =
+            plan.lo1_freq + static_cast<double>(tune_settings.lo1_inj_side) * tune_freq;
     }
 
-    _lo2_enabled = true;
     // Calculate ideal IF2 frequency:
-    const double if2_freq = _calc_ideal_if2_freq(tune_freq, _tune_settings);
+    const double if2_freq = _calc_ideal_if2_freq(tune_freq, tune_settings);
     // Calculate LO2 frequency from that:
-    _desired_lo2_frequency = _calc_lo2_freq(if1_freq, if2_freq, _lo2_inj_side);
+    double lo2_freq = _calc_lo2_freq(if1_freq, if2_freq, tune_settings.lo2_inj_side);
     // Similar to LO1, apply an offset such that CH0 and CH1 tune to distinct LO2
     // frequencies to prevent potential interference between CH0 and CH1 LO2's from
     // injection locking: In highband (LO1 disabled), this must explicitly be done below.
@@ -197,20 +185,57 @@ void zbx_freq_fe_expert::resolve()
     // CH1; however, they will be offset in opposite direction such that the NCO frequency
     // will be the same between CH0 and CH1. This is not the case for highband (only LO2
     // and they must be offset).
-    if (!_lo1_enabled) {
-        _desired_lo2_frequency = _desired_lo2_frequency + (lo_offset_sign * lo_step);
+    if (!plan.lo1_enabled) {
+        lo2_freq = lo2_freq + (lo_offset_sign * lo_step);
     }
     // Now, quantize the LO frequency to the nearest valid value:
-    _desired_lo2_frequency = _lo_freq_range.clip(_desired_lo2_frequency, true);
+    plan.lo2_freq = lo_freq_range.clip(lo2_freq, true);
     // Calculate actual IF2 frequency from LO2 and IF1 frequencies:
-    _desired_if2_frequency = _calc_if2_freq(if1_freq, _desired_lo2_frequency);
+    plan.if2_freq = _calc_if2_freq(if1_freq, plan.lo2_freq);
+
+    plan.band_inverted = _is_band_inverted(trx, plan.if2_freq, rfdc_rate, tune_settings);
+    return plan;
+}
+
+/*!---------------------------------------------------------
+ * EXPERT RESOLVE FUNCTIONS
+ *
+ * This sections contains all expert resolve functions.
+ * These methods are triggered by any of the bound accessors becoming "dirty",
+ * or changing value
+ * --------------------------------------------------------
+ */
+void zbx_scheduling_expert::resolve()
+{
+    // We currently have no fancy scheduling, but here is where we'd add it if
+    // we need to do that (e.g., plan out SYNC pulse timing vs. NCO timing etc.)
+    _frontend_time = _command_time;
+}
+
+void zbx_freq_fe_expert::resolve()
+{
+    const zbx_tune_plan_t plan = calc_tune_plan(
+        _trx, _chan, _desired_frequency, _tune_table.get(), _lo_freq_range, _rfdc_rate);
+    _tune_settings = plan.tune_settings;
+
+    // Set mixer values so the backend expert knows how to calculate final frequency
+    _lo1_inj_side = _tune_settings.lo1_inj_side;
+    _lo2_inj_side = _tune_settings.lo2_inj_side;
+
+    _is_highband = plan.is_highband;
+    _lo1_enabled = plan.lo1_enabled;
+    if (plan.lo1_enabled) {
+        _desired_lo1_frequency = plan.lo1_freq;
+    }
+    _lo2_enabled           = true;
+    _desired_lo2_frequency = plan.lo2_freq;
+    _desired_if2_frequency = plan.if2_freq;
 
     // If the frequency is in a different tuning band, we need to switch filters
-    _rf_filter  = _tune_settings.rf_fltr;
-    _if1_filter = _tune_settings.if1_fltr;
-    _if2_filter = _tune_settings.if2_fltr;
-    _band_inverted =
-        _is_band_inverted(_trx, _desired_if2_frequency, _rfdc_rate, _tune_settings);
+    _rf_filter     = _tune_settings.rf_fltr;
+    _if1_filter    = _tune_settings.if1_fltr;
+    _if2_filter    = _tune_settings.if2_fltr;
+    _band_inverted = plan.band_inverted;
 }
 
 
@@ -243,7 +268,9 @@ void zbx_lo_expert::resolve()
         _lo_ctrl->set_lo_test_mode_enabled(_test_mode_enabled);
     }
 
-    if (_set_is_enabled.is_dirty()) {
+    // A tune plan hop may already have switched the LO port
+    if (_set_is_enabled.is_dirty()
+        && _set_is_enabled != _lo_ctrl->get_lo_port_enabled()) {
         _lo_ctrl->set_lo_port_enabled(_set_is_enabled);
     }
 
@@ -41,7 +41,19 @@ double zbx_lo_ctrl::set_lo_freq(const double freq)
     UHD_ASSERT_THROW(_lmx);
     UHD_LOG_TRACE(_log_id, "Setting LO frequency " << freq / 1e6 << " MHz");
 
-    _freq = _lmx->set_frequency(freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/);
+    const auto plan = _tune_plans.find(freq);
+    if (plan != _tune_plans.end()) {
+        if (_plan_freq == freq) {
+            UHD_LOG_TRACE(_log_id, "Tune plan already loaded, skipping");
+            return _freq;
+        }
+        _freq      = _lmx->set_frequency_image(plan->second);
+        _plan_freq = freq;
+    } else {
+        _freq =
+            _lmx->set_frequency(freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/);
+        _plan_freq.reset();
+    }
     _lmx->commit();
     return _freq;
 }
@@ -51,6 +63,30 @@ double zbx_lo_ctrl::get_lo_freq()
     return _freq;
 }
 
+void zbx_lo_ctrl::set_planned_lo_freqs(const std::vector<double>& freqs)
+{
+    UHD_LOG_TRACE(_log_id, "Planning " << freqs.size() << " LO frequencies");
+    _planned_freqs = freqs;
+    _plan_freq.reset();
+    _update_tune_plans();
+}
+
+std::vector<lmx2572_iface::reg_write_t> zbx_lo_ctrl::get_tune_plan_writes(
+    const double freq)
+{
+    const auto plan = _tune_plans.find(freq);
+    if (plan == _tune_plans.end()) {
+        throw uhd::key_error(
+            _log_id + ": No tune plan for " + std::to_string(freq / 1e6) + " MHz");
+    }
+    if (_plan_freq == freq) {
+        return {};
+    }
+    _freq      = _lmx->set_frequency_image(plan->second);
+    _plan_freq = freq;
+    return _lmx->commit_to_burst();
+}
+
 void zbx_lo_ctrl::wait_for_lo_lock()
 {
     UHD_LOG_TRACE(_log_id, "Waiting for LO lock,  " << ZBX_LO_LOCK_TIMEOUT_MS << " ms");
@@ -90,6 +126,8 @@ void zbx_lo_ctrl::set_lo_port_enabled(bool enable)
 
     _lmx->set_enabled(enable);
     _lmx->commit();
+    // Make the next set_lo_freq() commit again, so the LO recalibrates
+    _plan_freq.reset();
 }
 
 bool zbx_lo_ctrl::get_lo_port_enabled()
@@ -143,6 +181,18 @@ zbx_lo_t zbx_lo_ctrl::lo_string_to_enum(
     UHD_THROW_INVALID_CODE_PATH();
 }
 
+void zbx_lo_ctrl::_update_tune_plans()
+{
+    _tune_plans.clear();
+    for (const double freq : _planned_freqs) {
+        if (!_tune_plans.count(freq)) {
+            _tune_plans.emplace(freq,
+                _lmx->compute_frequency_image(
+                    freq, _db_prc_rate, false /*TODO: get_spur_dodging()*/));
+        }
+    }
+}
+
 lmx2572_iface::output_t zbx_lo_ctrl::_get_output_port(bool testing_mode)
 {
     // Note: The LO output ports here are dependent to the LO and zbx hardware
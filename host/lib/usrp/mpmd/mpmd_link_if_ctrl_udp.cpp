@@ -22,6 +22,9 @@
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_XDP
+#    include <uhdlib/transport/udp_xdp_link.hpp>
+#endif
 
 using namespace uhd;
 using namespace uhd::transport;
@@ -378,6 +381,7 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
     const bool lossy_xport = enable_fc;
     const bool use_dpdk =
         _mb_args.has_key("use_dpdk"); // FIXME use constrained device args
+    const bool use_xdp = _mb_args.has_key("use_xdp");
     link_params_t default_link_params;
     default_link_params.num_send_frames = MPMD_ETH_NUM_FRAMES;
     default_link_params.num_recv_frames = MPMD_ETH_NUM_FRAMES;
@@ -424,6 +428,23 @@ uhd::transport::both_links_t mpmd_link_if_ctrl_udp::get_link(const size_t link_i
             enable_fc);
 #else
         UHD_LOG_WARNING("MPMD", "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (use_xdp) {
+#ifdef HAVE_XDP
+        // Like DPDK, there are no socket buffers, so the only buffering is
+        // the frames themselves and we need packet-based flow control.
+        auto link = uhd::transport::udp_xdp_link::make(
+            ip_addr, udp_port, link_params, _mb_args);
+        return std::make_tuple(link,
+            link->get_num_send_frames() * link->get_send_frame_size(),
+            link,
+            link->get_num_recv_frames() * link->get_recv_frame_size(),
+            lossy_xport,
+            true,
+            enable_fc);
+#else
+        UHD_LOG_WARNING("MPMD", "Cannot create AF_XDP transport, falling back to UDP");
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(ip_addr,
@@ -119,9 +119,14 @@ mpmd_mb_controller::mpmd_mb_controller(
     : _rpc(rpcc), _device_info(device_info)
 {
     const size_t num_tks = _rpc->get_num_timekeepers();
+    _time_model          = std::make_shared<uhd::features::time_model>();
     for (size_t tk_idx = 0; tk_idx < num_tks; tk_idx++) {
-        register_timekeeper(tk_idx, std::make_shared<mpmd_timekeeper>(tk_idx, _rpc));
+        auto clock_model = std::make_shared<device_clock_model>();
+        auto tk = std::make_shared<mpmd_timekeeper>(tk_idx, _rpc, clock_model);
+        register_timekeeper(tk_idx, tk);
+        _time_model->add_timekeeper(tk, clock_model);
     }
+    register_feature(_time_model);
 
     // Enumerate sensors
     auto sensor_list = _rpc->get_mb_sensors();
@@ -129,9 +134,10 @@ mpmd_mb_controller::mpmd_mb_controller(
     _sensor_names.insert(sensor_list.cbegin(), sensor_list.cend());
 
     // Enumerate GPIO banks that are under mb_controller control
-    _gpio_banks = _rpc->get_gpio_banks();
-    for (const auto& bank : _gpio_banks) {
-        _gpio_srcs.insert({bank, _rpc->get_gpio_srcs(bank)});
+    _gpio_banks          = _rpc->get_gpio_banks();
+    const auto gpio_srcs = _rpc->get_gpio_srcs_batch(_gpio_banks);
+    for (size_t i = 0; i < _gpio_banks.size(); i++) {
+        _gpio_srcs.insert({_gpio_banks.at(i), gpio_srcs.at(i)});
     }
 
     _fpga_onload = std::make_shared<fpga_onload>();
@@ -159,7 +165,8 @@ mpmd_mb_controller::mpmd_mb_controller(
  *****************************************************************************/
 uint64_t mpmd_mb_controller::mpmd_timekeeper::get_ticks_now()
 {
-    return _rpc->get_timekeeper_time(_tk_idx, false);
+    return _clock_model->get_ticks_now(
+        [this]() { return _rpc->get_timekeeper_time(_tk_idx, false); });
 }
 
 uint64_t mpmd_mb_controller::mpmd_timekeeper::get_ticks_last_pps()
@@ -170,16 +177,19 @@ uint64_t mpmd_mb_controller::mpmd_timekeeper::get_ticks_last_pps()
 void mpmd_mb_controller::mpmd_timekeeper::set_ticks_now(const uint64_t ticks)
 {
     _rpc->set_timekeeper_time(_tk_idx, ticks, false);
+    _clock_model->reset();
 }
 
 void mpmd_mb_controller::mpmd_timekeeper::set_ticks_next_pps(const uint64_t ticks)
 {
     _rpc->set_timekeeper_time(_tk_idx, ticks, true);
+    _clock_model->reset_at_next_pps();
 }
 
 void mpmd_mb_controller::mpmd_timekeeper::set_period(const uint64_t period_ns)
 {
     _rpc->set_tick_period(_tk_idx, period_ns);
+    _clock_model->set_tick_rate(get_tick_rate());
 }
 
 void mpmd_mb_controller::mpmd_timekeeper::update_tick_rate(const double tick_rate)
@@ -305,6 +315,22 @@ sensor_value_t mpmd_mb_controller::get_sensor(const std::string& name)
     return sensor_value_t(_rpc->get_mb_sensor(name));
 }
 
+std::vector<sensor_value_t> mpmd_mb_controller::get_sensors(
+    const std::vector<std::string>& names)
+{
+    for (const auto& name : names) {
+        if (!_sensor_names.count(name)) {
+            throw uhd::key_error(std::string("Invalid motherboard sensor name: ") + name);
+        }
+    }
+    std::vector<sensor_value_t> sensor_values;
+    sensor_values.reserve(names.size());
+    for (const auto& sensor_map : _rpc->get_mb_sensor_batch(names)) {
+        sensor_values.push_back(sensor_value_t(sensor_map));
+    }
+    return sensor_values;
+}
+
 std::vector<std::string> mpmd_mb_controller::get_sensor_names()
 {
     std::vector<std::string> sensor_names(_sensor_names.cbegin(), _sensor_names.cend());
@@ -32,9 +32,13 @@ static uhd::usrp::io_service_args_t get_default_io_srv_args()
     return args;
 }
 
-mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(
-    const uhd::device_addr_t& mb_args, uhd::rpc_client::sptr rpc)
-    : _mb_args(mb_args), _rpc(rpc), _link_if_mgr(xport::mpmd_link_if_mgr::make(mb_args))
+mpmd_mboard_impl::mpmd_mb_iface::mpmd_mb_iface(const uhd::device_addr_t& mb_args,
+    uhd::rpc_client::sptr rpc,
+    const std::string& fpga_signature)
+    : _mb_args(mb_args)
+    , _rpc(rpc)
+    , _fpga_signature(fpga_signature)
+    , _link_if_mgr(xport::mpmd_link_if_mgr::make(mb_args))
 {
     _remote_device_id = allocate_device_id();
     UHD_LOG_TRACE("MPMD::MB_IFACE", "Assigning device_id " << _remote_device_id);
@@ -156,6 +160,11 @@ void mpmd_mboard_impl::mpmd_mb_iface::reset_network()
     // FIXME
 }
 
+std::string mpmd_mboard_impl::mpmd_mb_iface::get_fpga_signature()
+{
+    return _fpga_signature;
+}
+
 uhd::rfnoc::clock_iface::sptr mpmd_mboard_impl::mpmd_mb_iface::get_clock_iface(
     const std::string& clock_name, const uint8_t clock_idx)
 {
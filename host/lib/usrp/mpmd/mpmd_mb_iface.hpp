@@ -22,7 +22,9 @@ class mpmd_mboard_impl::mpmd_mb_iface : public uhd::rfnoc::mb_iface
 public:
     using uptr               = std::unique_ptr<mpmd_mb_iface>;
     using clock_iface_list_t = std::vector<std::map<std::string, std::string>>;
-    mpmd_mb_iface(const uhd::device_addr_t& mb_args, uhd::rpc_client::sptr rpc);
+    mpmd_mb_iface(const uhd::device_addr_t& mb_args,
+        uhd::rpc_client::sptr rpc,
+        const std::string& fpga_signature = "");
     ~mpmd_mb_iface() override = default;
 
     /*** mpmd_mb_iface API calls *****************************************/
@@ -39,6 +41,7 @@ public:
     uhd::transport::adapter_id_t get_adapter_id(
         const uhd::rfnoc::device_id_t local_device_id) override;
     void reset_network() override;
+    std::string get_fpga_signature() override;
     uhd::rfnoc::clock_iface::sptr get_clock_iface(
         const std::string& clock_name, const uint8_t clock_idx) override;
     uhd::rfnoc::chdr_ctrl_xport::sptr make_ctrl_transport(
@@ -68,6 +71,7 @@ public:
 private:
     uhd::device_addr_t _mb_args;
     uhd::rpc_client::sptr _rpc;
+    const std::string _fpga_signature;
     xport::mpmd_link_if_mgr::uptr _link_if_mgr;
     uhd::rfnoc::device_id_t _remote_device_id;
     std::map<uhd::rfnoc::device_id_t, size_t> _local_device_id_map;
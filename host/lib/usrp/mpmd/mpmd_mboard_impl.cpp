@@ -286,14 +286,18 @@ mpmd_mboard_impl::mpmd_mboard_impl(
         measure_rpc_latency(rpc, MPMD_MEAS_LATENCY_DURATION);
     }
 
-    /// Get device info
-    const auto device_info_dict = rpc->request<dev_info>("get_device_info");
+    /// Get device info. Both info requests are independent, so they are issued
+    /// back-to-back rather than waiting for one response before sending the next.
+    auto device_info_future = rpc->request_async<dev_info>("get_device_info");
+    auto dboards_info_future =
+        rpc->request_async<std::vector<dev_info>>("get_dboard_info");
+    const auto device_info_dict = device_info_future.get();
     for (const auto& info_pair : device_info_dict) {
         device_info[info_pair.first] = info_pair.second;
     }
     UHD_LOG_DEBUG("MPMD", "MPM reports device info: " << device_info.to_string());
     /// Get dboard info
-    const auto dboards_info = rpc->request<std::vector<dev_info>>("get_dboard_info");
+    const auto dboards_info = dboards_info_future.get();
     UHD_ASSERT_THROW(this->dboard_info.empty());
     for (const auto& dboard_info_dict : dboards_info) {
         uhd::device_addr_t this_db_info;
@@ -307,8 +311,18 @@ mpmd_mboard_impl::mpmd_mboard_impl(
     }
 
     if (!mb_args.has_key("skip_init")) {
+        // Topology discovery results may only be reused when we are sure to talk
+        // to the same device, running the same (clean) FPGA image.
+        std::string fpga_signature;
+        const std::string fpga_hash = device_info.get("fpga_version_hash", "");
+        if (mb_args.has_key("cache_topology") && !device_info.get("serial", "").empty()
+            && !fpga_hash.empty() && fpga_hash.find("dirty") == std::string::npos) {
+            fpga_signature = device_info.get("product", "mpmd") + ":"
+                             + device_info["serial"] + ":"
+                             + device_info.get("fpga_version", "") + ":" + fpga_hash;
+        }
         // Initialize mb_iface and mb_controller
-        mb_iface = std::make_unique<mpmd_mb_iface>(mb_args, rpc);
+        mb_iface = std::make_unique<mpmd_mb_iface>(mb_args, rpc, fpga_signature);
         mb_ctrl  = std::make_shared<rfnoc::mpmd_mb_controller>(
             std::make_shared<uhd::usrp::mpmd_rpc>(rpc), device_info);
     } // Note -- when skip_init is used, these are not initialized, and trying
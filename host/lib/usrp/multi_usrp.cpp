@@ -25,12 +25,15 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <chrono>
 #include <cmath>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 namespace uhd { namespace rfnoc {
 
@@ -88,27 +91,14 @@ static void do_samp_rate_warning_message(
 /***********************************************************************
  * Gain helper functions
  **********************************************************************/
-static double get_gain_value(property_tree::sptr subtree)
-{
-    return subtree->access<double>("value").get();
-}
-
-static void set_gain_value(property_tree::sptr subtree, const double gain)
-{
-    subtree->access<double>("value").set(gain);
-}
-
-static meta_range_t get_gain_range(property_tree::sptr subtree)
-{
-    return subtree->access<meta_range_t>("range").get();
-}
-
 static gain_fcns_t make_gain_fcns_from_subtree(property_tree::sptr subtree)
 {
+    const auto range = subtree->get_handle<meta_range_t>("range");
+    const auto value = subtree->get_handle<double>("value");
     gain_fcns_t gain_fcns;
-    gain_fcns.get_range = std::bind(&get_gain_range, subtree);
-    gain_fcns.get_value = std::bind(&get_gain_value, subtree);
-    gain_fcns.set_value = std::bind(&set_gain_value, subtree, std::placeholders::_1);
+    gain_fcns.get_range = [range]() { return range.get(); };
+    gain_fcns.get_value = [value]() { return value.get(); };
+    gain_fcns.set_value = [value](const double gain) { value.set(gain); };
     return gain_fcns;
 }
 
@@ -118,22 +108,56 @@ static gain_fcns_t make_gain_fcns_from_subtree(property_tree::sptr subtree)
 static const double RX_SIGN = +1.0;
 static const double TX_SIGN = -1.0;
 
+//! Properties of the DSP and RF frontend of one channel which are used for tuning
+struct tune_props_t
+{
+    property_handle<meta_range_t> rf_freq_range;
+    property_handle<meta_range_t> dsp_freq_range;
+    property_handle<double> rf_freq;
+    property_handle<double> dsp_freq;
+    property_handle<double> rf_bandwidth;
+    property_handle<double> dsp_rate;
+    // Optional, these are not bound if the frontend does not have them
+    property_handle<bool> use_lo_offset;
+    property_handle<double> lo_offset;
+    property_handle<device_addr_t> tune_args;
+};
+
+template <typename T>
+static property_handle<T> get_handle_if_exists(
+    property_tree::sptr subtree, const fs_path& path)
+{
+    return subtree->exists(path) ? subtree->get_handle<T>(path) : property_handle<T>();
+}
+
+static tune_props_t make_tune_props(
+    property_tree::sptr dsp_subtree, property_tree::sptr rf_fe_subtree)
+{
+    tune_props_t props;
+    props.rf_freq_range  = rf_fe_subtree->get_handle<meta_range_t>("freq/range");
+    props.dsp_freq_range = dsp_subtree->get_handle<meta_range_t>("freq/range");
+    props.rf_freq        = rf_fe_subtree->get_handle<double>("freq/value");
+    props.dsp_freq       = dsp_subtree->get_handle<double>("freq/value");
+    props.rf_bandwidth   = rf_fe_subtree->get_handle<double>("bandwidth/value");
+    props.dsp_rate       = dsp_subtree->get_handle<double>("rate/value");
+    props.use_lo_offset  = get_handle_if_exists<bool>(rf_fe_subtree, "use_lo_offset");
+    props.lo_offset      = get_handle_if_exists<double>(rf_fe_subtree, "lo_offset/value");
+    props.tune_args = get_handle_if_exists<device_addr_t>(rf_fe_subtree, "tune_args");
+    return props;
+}
+
 static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
-    property_tree::sptr dsp_subtree,
-    property_tree::sptr rf_fe_subtree,
+    const tune_props_t& props,
     const tune_request_t& tune_request)
 {
     //------------------------------------------------------------------
     //-- calculate the tunable frequency ranges of the system
     //-- 计算系统的可调频率范围
     //------------------------------------------------------------------
+    freq_range_t dsp_range = props.dsp_freq_range.get();
+    freq_range_t rf_range  = props.rf_freq_range.get();
     freq_range_t tune_range =
-        make_overall_tune_range(rf_fe_subtree->access<meta_range_t>("freq/range").get(),
-            dsp_subtree->access<meta_range_t>("freq/range").get(),
-            rf_fe_subtree->access<double>("bandwidth/value").get());
-
-    freq_range_t dsp_range = dsp_subtree->access<meta_range_t>("freq/range").get();
-    freq_range_t rf_range  = rf_fe_subtree->access<meta_range_t>("freq/range").get();
+        make_overall_tune_range(rf_range, dsp_range, props.rf_bandwidth.get());
 
     // 安全地限制用户请求的 target_freq，避免设置不支持的频率。
     double clipped_requested_freq = tune_range.clip(tune_request.target_freq);
@@ -155,12 +179,11 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
      * 此处的 lo_offset 基于前端（FE）需求设定，不反映用户主动请求的本振偏移 （后者会在后续流程中处理）。
      */
     double lo_offset = 0.0;
-    if (rf_fe_subtree->exists("use_lo_offset")
-        and rf_fe_subtree->access<bool>("use_lo_offset").get()) {
+    if (props.use_lo_offset and props.use_lo_offset.get()) {
         // If the frontend has lo_offset value and range properties, trust it
         // for lo_offset
-        if (rf_fe_subtree->exists("lo_offset/value")) {
-            lo_offset = rf_fe_subtree->access<double>("lo_offset/value").get();
+        if (props.lo_offset) {
+            lo_offset = props.lo_offset.get();
         }
 
         // If the local oscillator will be in the passband, use an offset.
@@ -180,8 +203,8 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
          * ------*------(LO 6M偏移)
          * 信号处于滤波器之外
          */
-        const double rate = dsp_subtree->access<double>("rate/value").get();
-        const double bw   = rf_fe_subtree->access<double>("bandwidth/value").get();
+        const double rate = props.dsp_rate.get();
+        const double bw   = props.rf_bandwidth.get();
         if (bw > rate)
             lo_offset = std::min((bw - rate) / 2, rate / 2);
     }
@@ -189,8 +212,8 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
     //------------------------------------------------------------------
     //-- poke the tune request args into the dboard
     //------------------------------------------------------------------
-    if (rf_fe_subtree->exists("tune_args")) {
-        rf_fe_subtree->access<device_addr_t>("tune_args").set(tune_request.args);
+    if (props.tune_args) {
+        props.tune_args.set(tune_request.args);
     }
 
     //------------------------------------------------------------------
@@ -218,9 +241,8 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
              * rf_freq     是 RF 前端实际要调的频率（本地振荡器调谐频率）
              * 这两个参数均在 rx_samples_to_file.cpp 中设定完毕
              */
-            if (rf_fe_subtree->exists("lo_offset/value")) {
-                rf_fe_subtree->access<double>("lo_offset/value")
-                    .set(tune_request.rf_freq - tune_request.target_freq);
+            if (props.lo_offset) {
+                props.lo_offset.set(tune_request.rf_freq - tune_request.target_freq);
             }
 
             // 裁剪射频频率使其落入 RF 支持的频率范围。
@@ -236,9 +258,9 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
     //-- RF前端频率调谐
     //------------------------------------------------------------------
     if (tune_request.rf_freq_policy != tune_request_t::POLICY_NONE) {
-        rf_fe_subtree->access<double>("freq/value").set(target_rf_freq);
+        props.rf_freq.set(target_rf_freq);
     }
-    const double actual_rf_freq = rf_fe_subtree->access<double>("freq/value").get();
+    const double actual_rf_freq = props.rf_freq.get();
 
     //------------------------------------------------------------------
     //-- Set the DSP frequency depending upon the DSP frequency policy.
@@ -275,9 +297,9 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
     //-- Tune the DSP
     //------------------------------------------------------------------
     if (tune_request.dsp_freq_policy != tune_request_t::POLICY_NONE) {
-        dsp_subtree->access<double>("freq/value").set(target_dsp_freq);
+        props.dsp_freq.set(target_dsp_freq);
     }
-    const double actual_dsp_freq = dsp_subtree->access<double>("freq/value").get();
+    const double actual_dsp_freq = props.dsp_freq.get();
 
     //------------------------------------------------------------------
     //-- Load and return the tune result
@@ -291,13 +313,12 @@ static tune_result_t tune_xx_subdev_and_dsp(const double xx_sign,
     return tune_result;
 }
 
-static double derive_freq_from_xx_subdev_and_dsp(const double xx_sign,
-    property_tree::sptr dsp_subtree,
-    property_tree::sptr rf_fe_subtree)
+static double derive_freq_from_xx_subdev_and_dsp(
+    const double xx_sign, const tune_props_t& props)
 {
     // extract actual dsp and IF frequencies
-    const double actual_rf_freq  = rf_fe_subtree->access<double>("freq/value").get();
-    const double actual_dsp_freq = dsp_subtree->access<double>("freq/value").get();
+    const double actual_rf_freq  = props.rf_freq.get();
+    const double actual_dsp_freq = props.dsp_freq.get();
 
     // invert the sign on the dsp freq for transmit
     return actual_rf_freq - actual_dsp_freq * xx_sign;
@@ -312,6 +333,42 @@ public:
     multi_usrp_impl(device::sptr dev) : _dev(dev)
     {
         _tree = _dev->get_tree();   // UHD的属性树，是将参数作为文件，利用挂载文件系统读写，类似 Linux 路径的参数访问系统
+
+        // The cached channel properties depend on the mapping of channels to
+        // frontends and DSPs, so drop them whenever that mapping changes
+        std::weak_ptr<std::atomic<size_t>> chan_map_generation = _chan_map_generation;
+        auto invalidate_chan_props = [chan_map_generation]() {
+            if (auto generation = chan_map_generation.lock()) {
+                (*generation)++;
+            }
+        };
+        for (size_t mboard = 0; mboard < get_num_mboards(); mboard++) {
+            const fs_path root = mb_root(mboard);
+            for (const std::string name : {"rx_subdev_spec", "tx_subdev_spec"}) {
+                if (_tree->exists(root / name)) {
+                    _tree->access<subdev_spec_t>(root / name)
+                        .add_coerced_subscriber(
+                            [invalidate_chan_props](
+                                const subdev_spec_t&) { invalidate_chan_props(); });
+                }
+            }
+            for (const std::string name :
+                {"rx_chan_dsp_mapping", "tx_chan_dsp_mapping"}) {
+                if (_tree->exists(root / name)) {
+                    _tree->access<std::vector<size_t>>(root / name)
+                        .add_coerced_subscriber(
+                            [invalidate_chan_props](const std::vector<size_t>&) {
+                                invalidate_chan_props();
+                            });
+                }
+            }
+
+            mboard_props_t props;
+            props.time_now = get_handle_if_exists<time_spec_t>(_tree, root / "time/now");
+            props.time_pps = get_handle_if_exists<time_spec_t>(_tree, root / "time/pps");
+            props.time_cmd = get_handle_if_exists<time_spec_t>(_tree, root / "time/cmd");
+            _mboard_props.push_back(props);
+        }
     }
 
     device::sptr get_device(void) override
@@ -530,18 +587,19 @@ public:
 
     time_spec_t get_time_now(size_t mboard = 0) override
     {
-        return _tree->access<time_spec_t>(mb_root(mboard) / "time/now").get();
+        return mboard_time_prop(mboard, &mboard_props_t::time_now, "time/now").get();
     }
 
     time_spec_t get_time_last_pps(size_t mboard = 0) override
     {
-        return _tree->access<time_spec_t>(mb_root(mboard) / "time/pps").get();
+        return mboard_time_prop(mboard, &mboard_props_t::time_pps, "time/pps").get();
     }
 
     void set_time_now(const time_spec_t& time_spec, size_t mboard) override
     {
         if (mboard != ALL_MBOARDS) {
-            _tree->access<time_spec_t>(mb_root(mboard) / "time/now").set(time_spec);
+            mboard_time_prop(mboard, &mboard_props_t::time_now, "time/now")
+                .set(time_spec);
             return;
         }
         for (size_t m = 0; m < get_num_mboards(); m++) {
@@ -552,7 +610,8 @@ public:
     void set_time_next_pps(const time_spec_t& time_spec, size_t mboard) override
     {
         if (mboard != ALL_MBOARDS) {
-            _tree->access<time_spec_t>(mb_root(mboard) / "time/pps").set(time_spec);
+            mboard_time_prop(mboard, &mboard_props_t::time_pps, "time/pps")
+                .set(time_spec);
             return;
         }
         for (size_t m = 0; m < get_num_mboards(); m++) {
@@ -610,11 +669,13 @@ public:
     void set_command_time(const time_spec_t& time_spec, size_t mboard) override
     {
         if (mboard != ALL_MBOARDS) {
-            if (not _tree->exists(mb_root(mboard) / "time/cmd")) {
+            if (not mboard_props(mboard).time_cmd
+                and not _tree->exists(mb_root(mboard) / "time/cmd")) {
                 throw uhd::not_implemented_error(
                     "timed command feature not implemented on this hardware");
             }
-            _tree->access<time_spec_t>(mb_root(mboard) / "time/cmd").set(time_spec);
+            mboard_time_prop(mboard, &mboard_props_t::time_cmd, "time/cmd")
+                .set(time_spec);
             return;
         }
         for (size_t m = 0; m < get_num_mboards(); m++) {
@@ -625,7 +686,7 @@ public:
     void clear_command_time(size_t mboard) override
     {
         if (mboard != ALL_MBOARDS) {
-            _tree->access<time_spec_t>(mb_root(mboard) / "time/cmd")
+            mboard_time_prop(mboard, &mboard_props_t::time_cmd, "time/cmd")
                 .set(time_spec_t(0.0));
             return;
         }
@@ -1022,12 +1083,13 @@ public:
          * 由于 LO 可能来自另一个子板（该子板通常会应用 CORDIC 校正），
          * 此时应使用手动 DSP 调谐策略，以确保各子板的配置一致。
          */
+        const auto props = rx_chan_props(chan);
         if (tune_request.dsp_freq_policy == tune_request.POLICY_AUTO
-            and tune_request.rf_freq_policy == tune_request.POLICY_AUTO) {
+            and tune_request.rf_freq_policy == tune_request.POLICY_AUTO
+            and props->has_all_los) {
             for (size_t c = 0; c < get_rx_num_channels(); c++) {
                 const bool external_all_los =                                   // 判断是否有任意一个本振是外部提供的
-                    _tree->exists(rx_rf_fe_root(chan) / "los" / ALL_LOS)
-                    && get_rx_lo_source(ALL_LOS, c) == "external";
+                    get_rx_lo_source(ALL_LOS, c) == "external";
                 if (external_all_los) {
                     UHD_LOGGER_WARNING("MULTI_USRP")
                         << "At least one channel is using an external LO."
@@ -1039,19 +1101,14 @@ public:
         }
 
         // 调谐函数
-        tune_result_t result = tune_xx_subdev_and_dsp(RX_SIGN,
-            _tree->subtree(rx_dsp_root(chan)),
-            _tree->subtree(rx_rf_fe_root(chan)),
-            tune_request);
+        tune_result_t result = tune_xx_subdev_and_dsp(RX_SIGN, props->tune, tune_request);
         // do_tune_freq_results_message(tune_request, result, get_rx_freq(chan), "RX");
         return result;  // 包含有RF频率、DSP频率和中心频率
     }
 
     double get_rx_freq(size_t chan) override
     {
-        return derive_freq_from_xx_subdev_and_dsp(RX_SIGN,
-            _tree->subtree(rx_dsp_root(chan)),
-            _tree->subtree(rx_rf_fe_root(chan)));
+        return derive_freq_from_xx_subdev_and_dsp(RX_SIGN, rx_chan_props(chan)->tune);
     }
 
     freq_range_t get_rx_freq_range(size_t chan) override
@@ -1532,23 +1589,20 @@ public:
     void set_rx_gain(double gain, const std::string& name, size_t chan) override
     {
         /* Check if any AGC mode is enabled and if so warn the user */
-        for (size_t c = 0; c < get_rx_num_channels(); c++) {
+        const size_t num_chans = get_rx_num_channels();
+        for (size_t c = 0; c < num_chans; c++) {
             if (chan != ALL_CHANS && c != chan) {
                 continue;
             }
-            if (_tree->exists(rx_rf_fe_root(c) / "gain" / "agc")) {
-                bool agc =
-                    _tree->access<bool>(rx_rf_fe_root(c) / "gain" / "agc" / "enable")
-                        .get();
-                if (agc) {
-                    UHD_LOGGER_WARNING("MULTI_USRP") << "AGC enabled for channel " << c
-                                                     << ". Setting will be ignored.";
-                }
+            const auto props = rx_chan_props(c);
+            if (props->agc_enable and props->agc_enable.get()) {
+                UHD_LOGGER_WARNING("MULTI_USRP")
+                    << "AGC enabled for channel " << c << ". Setting will be ignored.";
             }
             /* Apply gain settings to all channels.
              * If device is in AGC mode it will ignore the setting. */
             try {
-                rx_gain_group(c)->set_value(gain, name);
+                props->gains->set_value(gain, name);
             } catch (uhd::key_error&) {
                 THROW_GAIN_NAME_ERROR(name, c, rx);
             }
@@ -2050,19 +2104,15 @@ public:
     tune_result_t set_tx_freq(const tune_request_t& tune_request, size_t chan) override
     {
         // \todo:研究 set_tx_freq 为何不需要和 set_rx_freq 一样判断调谐方式是 "全自动" 还是 "半自动"?
-        tune_result_t result = tune_xx_subdev_and_dsp(TX_SIGN,
-            _tree->subtree(tx_dsp_root(chan)),
-            _tree->subtree(tx_rf_fe_root(chan)),
-            tune_request);
+        tune_result_t result =
+            tune_xx_subdev_and_dsp(TX_SIGN, tx_chan_props(chan)->tune, tune_request);
         // do_tune_freq_results_message(tune_request, result, get_tx_freq(chan), "TX");
         return result;
     }
 
     double get_tx_freq(size_t chan) override
     {
-        return derive_freq_from_xx_subdev_and_dsp(TX_SIGN,
-            _tree->subtree(tx_dsp_root(chan)),
-            _tree->subtree(tx_rf_fe_root(chan)));
+        return derive_freq_from_xx_subdev_and_dsp(TX_SIGN, tx_chan_props(chan)->tune);
     }
 
     freq_range_t get_tx_freq_range(size_t chan) override
@@ -2554,6 +2604,113 @@ private:
     //! Container for spp values set in set_rx_spp()
     std::unordered_map<size_t, size_t> _rx_spp;
 
+    //! Properties of one motherboard, resolved when multi_usrp is created
+    struct mboard_props_t
+    {
+        property_handle<time_spec_t> time_now;
+        property_handle<time_spec_t> time_pps;
+        property_handle<time_spec_t> time_cmd;
+    };
+
+    //! Properties of one RX or TX channel, resolved when they are first used
+    struct chan_props_t
+    {
+        tune_props_t tune;
+        gain_group::sptr gains;
+        // RX only
+        bool has_all_los = false;
+        property_handle<bool> agc_enable;
+    };
+    using chan_props_map_t =
+        std::unordered_map<size_t, std::shared_ptr<const chan_props_t>>;
+
+    std::vector<mboard_props_t> _mboard_props;
+
+    //! Incremented whenever the mapping of channels to frontends or DSPs changes
+    std::shared_ptr<std::atomic<size_t>> _chan_map_generation =
+        std::make_shared<std::atomic<size_t>>(0);
+
+    //! Cached channel properties, valid for _chan_props_generation
+    std::mutex _chan_props_mutex;
+    size_t _chan_props_generation = 0;
+    chan_props_map_t _rx_chan_props;
+    chan_props_map_t _tx_chan_props;
+
+    const mboard_props_t& mboard_props(const size_t mboard)
+    {
+        if (mboard >= _mboard_props.size()) {
+            mb_root(mboard); // Throws if the motherboard does not exist
+            throw uhd::index_error(str(
+                boost::format("multi_usrp: motherboard %u out of range") % mboard));
+        }
+        return _mboard_props[mboard];
+    }
+
+    /*!
+     * Get the handle of a time property of a motherboard
+     *
+     * Falls back to resolving the path in the tree if the property did not
+     * exist when multi_usrp was created, or was replaced since.
+     */
+    property_handle<time_spec_t> mboard_time_prop(const size_t mboard,
+        property_handle<time_spec_t> mboard_props_t::*prop,
+        const std::string& path)
+    {
+        const property_handle<time_spec_t>& handle = mboard_props(mboard).*prop;
+        if (handle) {
+            return handle;
+        }
+        return _tree->get_handle<time_spec_t>(mb_root(mboard) / path);
+    }
+
+    std::shared_ptr<const chan_props_t> rx_chan_props(const size_t chan)
+    {
+        return get_chan_props(chan, false);
+    }
+
+    std::shared_ptr<const chan_props_t> tx_chan_props(const size_t chan)
+    {
+        return get_chan_props(chan, true);
+    }
+
+    std::shared_ptr<const chan_props_t> get_chan_props(
+        const size_t chan, const bool is_tx)
+    {
+        std::lock_guard<std::mutex> lock(_chan_props_mutex);
+        const size_t generation = _chan_map_generation->load();
+        if (generation != _chan_props_generation) {
+            _rx_chan_props.clear();
+            _tx_chan_props.clear();
+            _chan_props_generation = generation;
+        }
+
+        chan_props_map_t& chan_props = is_tx ? _tx_chan_props : _rx_chan_props;
+        auto it                      = chan_props.find(chan);
+        // The frontend or DSP may have been replaced in the tree
+        if (it != chan_props.end() and it->second->tune.rf_freq
+            and it->second->tune.dsp_freq) {
+            return it->second;
+        }
+
+        auto props = std::make_shared<chan_props_t>();
+        if (is_tx) {
+            props->tune  = make_tune_props(_tree->subtree(tx_dsp_root(chan)),
+                _tree->subtree(tx_rf_fe_root(chan)));
+            props->gains = make_tx_gain_group(chan);
+        } else {
+            props->tune        = make_tune_props(_tree->subtree(rx_dsp_root(chan)),
+                _tree->subtree(rx_rf_fe_root(chan)));
+            props->gains       = make_rx_gain_group(chan);
+            props->has_all_los = _tree->exists(rx_rf_fe_root(chan) / "los" / ALL_LOS);
+            if (_tree->exists(rx_rf_fe_root(chan) / "gain" / "agc")) {
+                props->agc_enable =
+                    _tree->get_handle<bool>(rx_rf_fe_root(chan) / "gain/agc/enable");
+            }
+        }
+        chan_props[chan] = props;
+        return props;
+    }
+
     struct mboard_chan_pair
     {
         size_t mboard, chan;
@@ -2756,6 +2913,16 @@ private:
     }
 
     gain_group::sptr rx_gain_group(size_t chan)
+    {
+        return rx_chan_props(chan)->gains;
+    }
+
+    gain_group::sptr tx_gain_group(size_t chan)
+    {
+        return tx_chan_props(chan)->gains;
+    }
+
+    gain_group::sptr make_rx_gain_group(size_t chan)
     {
         mboard_chan_pair mcp          = rx_chan_to_mcp(chan);
         const subdev_spec_pair_t spec = get_rx_subdev_spec(mcp.mboard).at(mcp.chan);
@@ -2776,7 +2943,7 @@ private:
         return gg;
     }
 
-    gain_group::sptr tx_gain_group(size_t chan)
+    gain_group::sptr make_tx_gain_group(size_t chan)
     {
         mboard_chan_pair mcp          = tx_chan_to_mcp(chan);
         const subdev_spec_pair_t spec = get_tx_subdev_spec(mcp.mboard).at(mcp.chan);
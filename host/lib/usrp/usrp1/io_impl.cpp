@@ -308,13 +308,14 @@ void usrp1_impl::vandal_conquest_loop(std::atomic<bool>& exit_loop)
             if (_tx_enabled and underflow) {
                 async_metadata.time_spec = _soft_time_ctrl->get_time();
                 _soft_time_ctrl->get_async_queue().push_with_pop_on_full(async_metadata);
-                UHD_LOG_FASTPATH("U")
+                UHD_LOG_FASTPATH_EVENT('U', async_metadata.channel)
             }
             if (_rx_enabled and overflow) {
                 inline_metadata.time_spec = _soft_time_ctrl->get_time();
                 _soft_time_ctrl->get_inline_queue().push_with_pop_on_full(
                     inline_metadata);
-                UHD_LOG_FASTPATH("O")
+                // The overrun flag covers all RX channels
+                UHD_LOG_FASTPATH_EVENT('O')
             }
 
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
@@ -36,7 +36,9 @@ public:
         , _fw_file("fw", "")
         , _blank_eeprom("blank_eeprom", false)
         , _enable_tx_dual_eth("enable_tx_dual_eth", false)
+        , _cache_topology("cache_topology", false)
         , _use_dpdk("use_dpdk", false)
+        , _use_xdp("use_xdp", false)
         , _fpga_option("fpga", "")
         , _download_fpga("download-fpga", false)
         , _recv_frame_size("recv_frame_size", DATA_FRAME_MAX_SIZE)
@@ -121,10 +123,18 @@ public:
     {
         return _enable_tx_dual_eth.get();
     }
+    bool get_cache_topology() const
+    {
+        return _cache_topology.get();
+    }
     bool get_use_dpdk() const
     {
         return _use_dpdk.get();
     }
+    bool get_use_xdp() const
+    {
+        return _use_xdp.get();
+    }
     std::string get_fpga_option() const
     {
         return _fpga_option.get();
@@ -180,6 +190,7 @@ public:
                + (_has_fw_file.get() ? _fw_file.to_string() + ", " : "")
                + (_enable_tx_dual_eth.get() ? (_enable_tx_dual_eth.to_string() + ", ")
                                             : "")
+               + (_cache_topology.get() ? (_cache_topology.to_string() + ", ") : "")
                + (_fpga_option.get().empty() ? "" : _fpga_option.to_string() + ", ")
                + (_download_fpga.get() ? _download_fpga.to_string() + ", " : "");
     }
@@ -252,12 +263,21 @@ private:
         if (dev_args.has_key("enable_tx_dual_eth")) {
             _enable_tx_dual_eth.set(true);
         }
+        PARSE_DEFAULT(_cache_topology)
         if (dev_args.has_key("use_dpdk")) {
 #ifdef HAVE_DPDK
             _use_dpdk.set(true);
 #else
             UHD_LOG_WARNING(
                 "DPDK", "Detected use_dpdk argument, but DPDK support not built in.");
+#endif
+        }
+        if (dev_args.has_key("use_xdp")) {
+#ifdef HAVE_XDP
+            _use_xdp.set(true);
+#else
+            UHD_LOG_WARNING(
+                "XDP", "Detected use_xdp argument, but AF_XDP support not built in.");
 #endif
         }
         PARSE_DEFAULT(_recv_frame_size)
@@ -289,7 +309,9 @@ private:
     constrained_device_args_t::str_arg<true> _fw_file;
     constrained_device_args_t::bool_arg _blank_eeprom;
     constrained_device_args_t::bool_arg _enable_tx_dual_eth;
+    constrained_device_args_t::bool_arg _cache_topology;
     constrained_device_args_t::bool_arg _use_dpdk;
+    constrained_device_args_t::bool_arg _use_xdp;
     constrained_device_args_t::str_arg<true> _fpga_option;
     constrained_device_args_t::bool_arg _download_fpga;
     constrained_device_args_t::num_arg<size_t> _recv_frame_size;
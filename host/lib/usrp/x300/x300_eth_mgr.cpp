@@ -29,6 +29,9 @@
 #    include <uhdlib/transport/dpdk_simple.hpp>
 #    include <uhdlib/transport/udp_dpdk_link.hpp>
 #endif
+#ifdef HAVE_XDP
+#    include <uhdlib/transport/udp_xdp_link.hpp>
+#endif
 #include <boost/asio.hpp>
 #include <string>
 
@@ -283,6 +286,21 @@ both_links_t eth_manager::get_links(link_type_t link_type,
             enable_fc);
 #else
         UHD_LOG_WARNING("X300", "Cannot create DPDK transport, falling back to UDP");
+#endif
+    }
+    if (_args.get_use_xdp()) {
+#ifdef HAVE_XDP
+        auto link = uhd::transport::udp_xdp_link::make(conn.addr,
+            BOOST_STRINGIZE(X300_VITA_UDP_PORT),
+            link_params,
+            _args.get_orig_args());
+        return std::make_tuple(link,
+            link->get_num_send_frames() * link->get_send_frame_size(),
+            link,
+            link->get_num_recv_frames() * link->get_recv_frame_size(),
+            lossy_xport,
+            true,
+            enable_fc);
 #endif
     }
     auto link = uhd::transport::udp_boost_asio_link::make(conn.addr,
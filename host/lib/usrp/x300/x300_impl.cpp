@@ -437,6 +437,17 @@ void x300_impl::setup_mb(const size_t mb_i, const uhd::device_addr_t& dev_addr)
     // Peek to finish transaction
     mb.zpu_ctrl->peek32(0);
 
+    // Topology discovery results may only be reused when we are sure to talk to
+    // the same device, running the same (clean) FPGA image.
+    std::string fpga_signature;
+    const std::string fpga_hash =
+        _tree->access<std::string>(mb_path / "fpga_version_hash").get();
+    if (mb.args.get_cache_topology() && !dev_addr.get("serial", "").empty()
+        && fpga_hash.find("dirty") == std::string::npos) {
+        fpga_signature = "x300:" + dev_addr["serial"] + ":" + fpga_compat.to_string()
+                         + ":" + fpga_hash;
+    }
+
     { // Need to lock access to _mb_ifaces, so we can run setup_mb() in
       // parallel
         std::lock_guard<std::mutex> l(_mb_iface_mutex);
@@ -446,7 +457,8 @@ void x300_impl::setup_mb(const size_t mb_i, const uhd::device_addr_t& dev_addr)
                 mb.clock->get_master_clock_rate(),
                 mb.device_id,
                 fpga_compat,
-                fw_compat)});
+                fw_compat,
+                fpga_signature)});
         UHD_LOG_DEBUG("X300", "Motherboard " << mb_i << " has local device IDs: ");
         for (const auto local_dev_id : _mb_ifaces.at(mb_i).get_local_device_ids()) {
             UHD_LOG_DEBUG("X300", "* " << local_dev_id);
@@ -106,7 +106,8 @@ private:
             const double radio_clk_freq,
             const uhd::rfnoc::device_id_t remote_dev_id,
             const uhd::compat_num32 fpga_compat,
-            const uhd::compat_num32 fw_compat);
+            const uhd::compat_num32 fw_compat,
+            const std::string& fpga_signature);
 
         ~x300_mb_iface() override;
         uint16_t get_proto_ver() override;
@@ -118,6 +119,7 @@ private:
         uhd::transport::adapter_id_t get_adapter_id(
             const uhd::rfnoc::device_id_t local_device_id) override;
         void reset_network() override;
+        std::string get_fpga_signature() override;
         uhd::rfnoc::clock_iface::sptr get_clock_iface(
             const std::string& clock_name, const uint8_t) override;
         uhd::rfnoc::chdr_ctrl_xport::sptr make_ctrl_transport(
@@ -154,6 +156,7 @@ private:
         const uhd::rfnoc::device_id_t _remote_dev_id;
         uhd::compat_num32 _fpga_compat;
         uhd::compat_num32 _fw_compat;
+        const std::string _fpga_signature;
         std::unordered_map<uhd::rfnoc::device_id_t, uhd::transport::adapter_id_t>
             _adapter_map;
         uhd::rfnoc::clock_iface::sptr _bus_clk;
@@ -79,11 +79,15 @@ x300_mb_controller::x300_mb_controller(const size_t hw_rev,
     x300_mb_controller::set_time_source(args.get_time_source());
 
     const size_t num_tks = _zpu_ctrl->peek32(SR_ADDR(SET0_BASE, TK_NUM_TIMEKEEPERS));
+    _time_model          = std::make_shared<uhd::features::time_model>();
     for (size_t i = 0; i < num_tks; i++) {
-        register_timekeeper(i,
-            std::make_shared<x300_timekeeper>(
-                i, _zpu_ctrl, clock_ctrl->get_master_clock_rate()));
+        auto clock_model = std::make_shared<device_clock_model>();
+        auto tk          = std::make_shared<x300_timekeeper>(
+            i, _zpu_ctrl, clock_ctrl->get_master_clock_rate(), clock_model);
+        register_timekeeper(i, tk);
+        _time_model->add_timekeeper(tk, clock_model);
     }
+    register_feature(_time_model);
 
     init_gps();
     _radio_refs.reserve(2);
@@ -96,9 +100,11 @@ x300_mb_controller::~x300_mb_controller() {}
  *****************************************************************************/
 uint64_t x300_mb_controller::x300_timekeeper::get_ticks_now()
 {
-    uint32_t ticks_lo = _zpu_ctrl->peek32(get_tk_addr(TK_REG_TICKS_NOW_LO));
-    uint32_t ticks_hi = _zpu_ctrl->peek32(get_tk_addr(TK_REG_TICKS_NOW_HI));
-    return uint64_t(ticks_lo) | (uint64_t(ticks_hi) << 32);
+    return _clock_model->get_ticks_now([this]() {
+        uint32_t ticks_lo = _zpu_ctrl->peek32(get_tk_addr(TK_REG_TICKS_NOW_LO));
+        uint32_t ticks_hi = _zpu_ctrl->peek32(get_tk_addr(TK_REG_TICKS_NOW_HI));
+        return uint64_t(ticks_lo) | (uint64_t(ticks_hi) << 32);
+    });
 }
 
 uint64_t x300_mb_controller::x300_timekeeper::get_ticks_last_pps()
@@ -115,6 +121,7 @@ void x300_mb_controller::x300_timekeeper::set_ticks_now(const uint64_t ticks)
     _zpu_ctrl->poke32(
         get_tk_addr(TK_REG_TICKS_EVENT_HI), narrow_cast<uint32_t>(ticks >> 32));
     _zpu_ctrl->poke32(get_tk_addr(TK_REG_TICKS_CTRL), narrow_cast<uint32_t>(0x1));
+    _clock_model->reset();
 }
 
 void x300_mb_controller::x300_timekeeper::set_ticks_next_pps(const uint64_t ticks)
@@ -124,6 +131,7 @@ void x300_mb_controller::x300_timekeeper::set_ticks_next_pps(const uint64_t tick
     _zpu_ctrl->poke32(
         get_tk_addr(TK_REG_TICKS_EVENT_HI), narrow_cast<uint32_t>(ticks >> 32));
     _zpu_ctrl->poke32(get_tk_addr(TK_REG_TICKS_CTRL), narrow_cast<uint32_t>(0x2));
+    _clock_model->reset_at_next_pps();
 }
 
 void x300_mb_controller::x300_timekeeper::set_period(const uint64_t period_ns)
@@ -132,6 +140,7 @@ void x300_mb_controller::x300_timekeeper::set_period(const uint64_t period_ns)
         narrow_cast<uint32_t>(period_ns & 0xFFFFFFFF));
     _zpu_ctrl->poke32(
         get_tk_addr(TK_REG_TICKS_PERIOD_HI), narrow_cast<uint32_t>(period_ns >> 32));
+    _clock_model->set_tick_rate(get_tick_rate());
 }
 
 uint32_t x300_mb_controller::x300_timekeeper::get_tk_addr(const uint32_t tk_addr)
@@ -16,6 +16,8 @@
 #include <uhd/types/sensors.hpp>
 #include <uhd/types/wb_iface.hpp>
 #include <uhdlib/features/discoverable_feature_registry.hpp>
+#include <uhdlib/features/time_model.hpp>
+#include <uhdlib/rfnoc/device_clock_model.hpp>
 #include <uhdlib/usrp/gps_ctrl.hpp>
 #include <unordered_set>
 #include <memory>
@@ -90,13 +92,16 @@ public:
      *************************************************************************/
     //! X300-specific version of the timekeeper controls
     //
-    // The X300 controls timekeepers via the ZPU
+    // The X300 controls timekeepers via the ZPU. Reads of the current time are
+    // served by the clock model if it is accurate enough.
     class x300_timekeeper : public mb_controller::timekeeper
     {
     public:
-        x300_timekeeper(
-            const size_t tk_idx, uhd::wb_iface::sptr zpu_ctrl, const double tick_rate)
-            : _tk_idx(tk_idx), _zpu_ctrl(zpu_ctrl)
+        x300_timekeeper(const size_t tk_idx,
+            uhd::wb_iface::sptr zpu_ctrl,
+            const double tick_rate,
+            device_clock_model::sptr clock_model)
+            : _tk_idx(tk_idx), _zpu_ctrl(zpu_ctrl), _clock_model(clock_model)
         {
             set_tick_rate(tick_rate);
         }
@@ -110,6 +115,7 @@ public:
         uint32_t get_tk_addr(const uint32_t tk_addr);
         const size_t _tk_idx;
         uhd::wb_iface::sptr _zpu_ctrl;
+        device_clock_model::sptr _clock_model;
     }; /* x300_timekeeper */
 
     /**************************************************************************
@@ -241,6 +247,9 @@ private:
     //! GPS interface for public feature
     uhd::features::gps_iface::sptr _gps_iface;
 
+    //! Time model feature, tracks the time of all timekeepers
+    uhd::features::time_model::sptr _time_model;
+
     //! Reference to all callbacks to reset the ADCs/DACs
     std::vector<std::function<void(void)>> _reset_cbs;
 
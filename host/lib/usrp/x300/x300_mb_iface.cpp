@@ -32,10 +32,12 @@ x300_impl::x300_mb_iface::x300_mb_iface(uhd::usrp::x300::conn_manager::sptr conn
     const double radio_clk_freq,
     const uhd::rfnoc::device_id_t remote_dev_id,
     const uhd::compat_num32 fpga_compat,
-    const uhd::compat_num32 fw_compat)
+    const uhd::compat_num32 fw_compat,
+    const std::string& fpga_signature)
     : _remote_dev_id(remote_dev_id)
     , _fpga_compat(fpga_compat)
     , _fw_compat(fw_compat)
+    , _fpga_signature(fpga_signature)
     , _bus_clk(std::make_shared<uhd::rfnoc::clock_iface>(
           "bus_clk", uhd::usrp::x300::BUS_CLOCK_RATE, false))
     , _radio_clk(
@@ -127,6 +129,11 @@ void x300_impl::x300_mb_iface::reset_network()
     // FIXME
 }
 
+std::string x300_impl::x300_mb_iface::get_fpga_signature()
+{
+    return _fpga_signature;
+}
+
 uhd::rfnoc::clock_iface::sptr x300_impl::x300_mb_iface::get_clock_iface(
     const std::string& clock_name, const uint8_t)
 {
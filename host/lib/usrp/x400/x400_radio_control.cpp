@@ -384,12 +384,17 @@ void x400_radio_control_impl::_validate_master_clock_rate_args()
 
 void x400_radio_control_impl::_init_mpm()
 {
-    // Init sensors
-    for (const auto& dir : std::vector<direction_t>{RX_DIRECTION, TX_DIRECTION}) {
+    // Init sensors. The RX and TX sensor lists are fetched in one batch, they
+    // are the same for all channels.
+    const std::vector<direction_t> dirs{RX_DIRECTION, TX_DIRECTION};
+    const auto sensor_lists = _db_rpcc->get_sensors_batch(
+        {_get_trx_string(RX_DIRECTION), _get_trx_string(TX_DIRECTION)});
+    for (size_t dir_idx = 0; dir_idx < dirs.size(); dir_idx++) {
+        const direction_t dir  = dirs.at(dir_idx);
         const size_t num_chans = (dir == RX_DIRECTION) ? get_num_input_ports()
                                                        : get_num_output_ports();
         for (size_t chan_idx = 0; chan_idx < num_chans; chan_idx++) {
-            _init_mpm_sensors(dir, chan_idx);
+            _init_mpm_sensors(dir, chan_idx, sensor_lists.at(dir_idx));
         }
     }
 }
@@ -408,8 +413,9 @@ std::string x400_radio_control_impl::_get_trx_string(const direction_t dir) cons
 }
 
 
-void x400_radio_control_impl::_init_mpm_sensors(
-    const direction_t dir, const size_t chan_idx)
+void x400_radio_control_impl::_init_mpm_sensors(const direction_t dir,
+    const size_t chan_idx,
+    const std::vector<std::string>& sensor_list)
 {
     UHD_ASSERT_THROW(dir == RX_DIRECTION || dir == TX_DIRECTION);
     const size_t num_chans = (dir == RX_DIRECTION) ? get_num_input_ports()
@@ -419,7 +425,6 @@ void x400_radio_control_impl::_init_mpm_sensors(
     const fs_path fe_path = fs_path("dboard")
                             / (dir == RX_DIRECTION ? "rx_frontends" : "tx_frontends")
                             / chan_idx;
-    auto sensor_list = _db_rpcc->get_sensors(trx);
     RFNOC_LOG_TRACE("Chan " << chan_idx << ": Found " << sensor_list.size() << " " << trx
                             << " sensors.");
     for (const auto& sensor_name : sensor_list) {
@@ -175,7 +175,9 @@ private:
 
     void _validate_master_clock_rate_args();
     void _init_mpm();
-    void _init_mpm_sensors(const direction_t dir, const size_t chan_idx);
+    void _init_mpm_sensors(const direction_t dir,
+        const size_t chan_idx,
+        const std::vector<std::string>& sensor_list);
     void _init_prop_tree();
     fs_path _get_db_fe_path(const size_t chan, const uhd::direction_t dir) const;
 
@@ -0,0 +1,238 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/fastpath_tracer.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define UHD_HAVE_RDTSC
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    include <x86intrin.h>
+#    define UHD_HAVE_RDTSC
+#endif
+
+using namespace uhd::log;
+
+namespace {
+
+inline uint64_t get_host_tsc()
+{
+#ifdef UHD_HAVE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+//! Source of unique tracer IDs. 0 is never used.
+std::atomic<uint64_t> next_tracer_id{1};
+
+} // namespace
+
+constexpr size_t fastpath_tracer::RING_SIZE;
+
+/*! Event ring of a single thread
+ *
+ * The thread which owns the ring is the only one to write head, cached_tail,
+ * and the counters. The tracer is the only one to write tail.
+ */
+struct fastpath_tracer::ring
+{
+    ring(const uint64_t tracer_id_, const uint32_t thread_index_)
+        : tracer_id(tracer_id_), thread_index(thread_index_)
+    {
+    }
+
+    const uint64_t tracer_id;
+    const uint32_t thread_index;
+    std::array<fastpath_event_t, RING_SIZE> events;
+
+    // Producer side
+    alignas(64) std::atomic<uint64_t> head{0};
+    uint64_t cached_tail = 0;
+    std::array<std::atomic<uint64_t>, 256> num_events{};
+    std::atomic<uint64_t> num_dropped{0};
+    //! Set when the thread exits. No more events will be recorded after that.
+    std::atomic<bool> orphaned{false};
+
+    // Consumer side
+    alignas(64) std::atomic<uint64_t> tail{0};
+    //! Set when the tracer is destroyed. The thread may then free the ring.
+    std::atomic<bool> detached{false};
+};
+
+//! The rings of a thread, one per tracer that the thread has used
+struct fastpath_tracer::thread_rings
+{
+    ~thread_rings()
+    {
+        for (auto& r : rings) {
+            r->orphaned.store(true, std::memory_order_release);
+        }
+    }
+
+    //! The most recently used ring, to skip the lookup in the common case
+    ring* last = nullptr;
+    std::vector<std::shared_ptr<ring>> rings;
+};
+
+fastpath_tracer::fastpath_tracer(const size_t history_size)
+    : _id(next_tracer_id.fetch_add(1)), _history_size(history_size)
+{
+}
+
+fastpath_tracer::~fastpath_tracer()
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    for (auto& r : _rings) {
+        r->detached.store(true, std::memory_order_release);
+    }
+}
+
+void fastpath_tracer::record(const char code,
+    const uint32_t channel,
+    const boost::optional<uint64_t>& device_ticks)
+{
+    ring& r = _get_ring();
+    // Only this thread writes the counters, so there is no need for an atomic
+    // read-modify-write
+    auto& num_events = r.num_events[static_cast<unsigned char>(code)];
+    num_events.store(
+        num_events.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    const uint64_t head = r.head.load(std::memory_order_relaxed);
+    if (head - r.cached_tail >= RING_SIZE) {
+        r.cached_tail = r.tail.load(std::memory_order_acquire);
+        if (head - r.cached_tail >= RING_SIZE) {
+            r.num_dropped.store(r.num_dropped.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    fastpath_event_t& event = r.events[head % RING_SIZE];
+    event.host_tsc          = get_host_tsc();
+    event.device_ticks      = device_ticks.get_value_or(0);
+    event.channel           = channel;
+    event.thread_index      = r.thread_index;
+    event.code              = code;
+    event.has_device_ticks  = bool(device_ticks);
+    r.head.store(head + 1, std::memory_order_release);
+}
+
+size_t fastpath_tracer::drain(const drain_fn_t& fn)
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    _batch.clear();
+    for (auto it = _rings.begin(); it != _rings.end();) {
+        ring& r = **it;
+        // Check this first: If the thread has exited, head is final
+        const bool orphaned = r.orphaned.load(std::memory_order_acquire);
+        const uint64_t head = r.head.load(std::memory_order_acquire);
+        for (uint64_t tail = r.tail.load(std::memory_order_relaxed); tail != head;
+             tail++) {
+            _batch.push_back(r.events[tail % RING_SIZE]);
+        }
+        r.tail.store(head, std::memory_order_release);
+
+        if (orphaned) {
+            for (size_t i = 0; i < _retired_num_events.size(); i++) {
+                _retired_num_events[i] += r.num_events[i].load(std::memory_order_relaxed);
+            }
+            _retired_num_dropped += r.num_dropped.load(std::memory_order_relaxed);
+            it = _rings.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Every ring is in order, but the rings are interleaved
+    std::stable_sort(_batch.begin(),
+        _batch.end(),
+        [](const fastpath_event_t& lhs, const fastpath_event_t& rhs) {
+            return lhs.host_tsc < rhs.host_tsc;
+        });
+    for (const auto& event : _batch) {
+        if (fn) {
+            fn(event);
+        }
+        if (_history_size == 0) {
+            continue;
+        }
+        if (_history.size() == _history_size) {
+            _history.pop_front();
+        }
+        _history.push_back(event);
+    }
+    return _batch.size();
+}
+
+std::vector<fastpath_event_t> fastpath_tracer::read_events()
+{
+    drain();
+    std::lock_guard<std::mutex> l(_mutex);
+    std::vector<fastpath_event_t> events(_history.begin(), _history.end());
+    _history.clear();
+    return events;
+}
+
+fastpath_counters_t fastpath_tracer::get_counters()
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    std::array<uint64_t, 256> num_events = _retired_num_events;
+    fastpath_counters_t counters;
+    counters.num_dropped = _retired_num_dropped;
+    for (const auto& r : _rings) {
+        for (size_t i = 0; i < num_events.size(); i++) {
+            num_events[i] += r->num_events[i].load(std::memory_order_relaxed);
+        }
+        counters.num_dropped += r->num_dropped.load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < num_events.size(); i++) {
+        if (num_events[i]) {
+            counters.num_events[static_cast<char>(i)] = num_events[i];
+        }
+    }
+    return counters;
+}
+
+fastpath_tracer::ring& fastpath_tracer::_get_ring()
+{
+    static thread_local thread_rings tls;
+    if (tls.last && tls.last->tracer_id == _id) {
+        return *tls.last;
+    }
+
+    // Forget the rings of tracers that no longer exist, then look for ours
+    auto& rings = tls.rings;
+    rings.erase(std::remove_if(rings.begin(),
+                    rings.end(),
+                    [](const std::shared_ptr<ring>& r) {
+                        return r->detached.load(std::memory_order_acquire);
+                    }),
+        rings.end());
+    auto it = std::find_if(
+        rings.begin(), rings.end(), [this](const std::shared_ptr<ring>& r) {
+            return r->tracer_id == _id;
+        });
+    if (it == rings.end()) {
+        rings.push_back(_make_ring());
+        it = std::prev(rings.end());
+    }
+    tls.last = it->get();
+    return *tls.last;
+}
+
+std::shared_ptr<fastpath_tracer::ring> fastpath_tracer::_make_ring()
+{
+    std::lock_guard<std::mutex> l(_mutex);
+    auto r = std::make_shared<ring>(_id, _next_thread_index++);
+    _rings.push_back(r);
+    return r;
+}
@@ -13,10 +13,13 @@
 #include <uhd/utils/static.hpp>
 #include <uhd/utils/thread.hpp>
 #include <uhd/version.hpp>
+#include <uhdlib/utils/fastpath_tracer.hpp>
 #include <uhdlib/utils/isatty.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <atomic>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <memory>
 #include <mutex>
@@ -47,9 +50,13 @@ namespace {
 constexpr double READ_TIMEOUT = 0.5; // Waiting time to read from the queue
 #endif
 
-constexpr char LOG_THREAD_NAME[]          = "uhd_log";
-constexpr char LOG_THREAD_NAME_FP[]       = "uhd_log_fastpath";
-constexpr char LOG_THREAD_NAME_FP_DUMMY[] = "uhd_log_fp_dummy";
+constexpr char LOG_THREAD_NAME[]    = "uhd_log";
+constexpr char LOG_THREAD_NAME_FP[] = "uhd_log_fastpath";
+
+//! Interval at which the fastpath events are drained
+constexpr auto FASTPATH_DRAIN_INTERVAL = std::chrono::milliseconds(20);
+//! Max. number of fastpath events detailed in a single log message
+constexpr size_t FASTPATH_MAX_EVENTS_PER_MSG = 16;
 
 std::string verbosity_color(const uhd::log::severity_level& level)
 {
@@ -217,15 +224,7 @@ class log_resource
 public:
     uhd::log::severity_level global_level;
 
-    log_resource(void)
-        : global_level(uhd::log::off)
-        , _exit(false)
-        ,
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        _fastpath_queue(10)
-        ,
-#endif
-        _log_queue(10)
+    log_resource(void) : global_level(uhd::log::off), _exit(false), _log_queue(10)
     {
         // allow override from macro definition
 #ifdef UHD_LOG_MIN_LEVEL
@@ -270,14 +269,13 @@ public:
             return true;
         }();
 
-        if (enable_fastpath) {
-            _pop_fastpath_task = std::make_shared<std::thread>(
-                std::thread([this]() { this->pop_fastpath_task(); }));
-            uhd::set_thread_name(_pop_fastpath_task.get(), LOG_THREAD_NAME_FP);
-        } else {
-            _pop_fastpath_task = std::make_shared<std::thread>(
-                std::thread([this]() { this->pop_fastpath_dummy_task(); }));
-            uhd::set_thread_name(_pop_fastpath_task.get(), LOG_THREAD_NAME_FP_DUMMY);
+        // Events are still recorded and drained when printing is disabled, so
+        // they can be read with read_fastpath_events()
+        _print_fastpath    = enable_fastpath;
+        _pop_fastpath_task = std::make_shared<std::thread>(
+            std::thread([this]() { this->pop_fastpath_task(); }));
+        uhd::set_thread_name(_pop_fastpath_task.get(), LOG_THREAD_NAME_FP);
+        if (!enable_fastpath) {
             _publish_log_msg("Fastpath logging disabled at runtime.");
         }
 #else
@@ -291,6 +289,16 @@ public:
     {
         _exit = true;
 
+#ifndef UHD_LOG_FASTPATH_DISABLE
+        // Stop the fastpath task first, its final drain may still log
+        {
+            std::lock_guard<std::mutex> l(_fastpath_mutex);
+        }
+        _fastpath_cond.notify_all();
+        _pop_fastpath_task->join();
+        _pop_fastpath_task.reset();
+#endif
+
 #ifndef BOOST_MSVC // push a final message is required, since the pop_with_wait() function
                    // will be used.
         // We push a final message to kick the pop task out of it's wait state.
@@ -304,9 +312,6 @@ public:
             std::this_thread::get_id());
         final_message.message = "";
         push(final_message);
-#    ifndef UHD_LOG_FASTPATH_DISABLE
-        push_fastpath("");
-#    endif
 #endif // BOOST_MSVC
 
         _pop_task->join();
@@ -315,10 +320,6 @@ public:
             _loggers.clear();
         }
         _pop_task.reset();
-#ifndef UHD_LOG_FASTPATH_DISABLE
-        _pop_fastpath_task->join();
-        _pop_fastpath_task.reset();
-#endif
     }
 
     void push(const uhd::log::logging_info& log_info)
@@ -328,11 +329,13 @@ public:
     }
 
 #ifndef UHD_LOG_FASTPATH_DISABLE
-    void push_fastpath(const std::string& message)
+    void push_fastpath(const char code,
+        const uint32_t channel,
+        const boost::optional<uint64_t>& device_ticks = boost::none)
     {
-        // Never wait. If the buffer is full, we just don't see the message.
-        // Too bad.
-        _fastpath_queue.push_with_haste(message);
+        // Never wait. If the thread's ring is full, the event is dropped (but
+        // still counted).
+        tracer.record(code, channel, device_ticks);
     }
 #endif
 
@@ -381,45 +384,23 @@ public:
     void pop_fastpath_task()
     {
 #ifndef UHD_LOG_FASTPATH_DISABLE
-        std::string msg;
-        while (!_exit) {
-#    ifdef BOOST_MSVC
-            // Some versions of MSVC will hang if threads are being joined after main has
-            // completed, so we need to guarantee a timeout here
-            if (_fastpath_queue.pop_with_timed_wait(msg, READ_TIMEOUT)) {
-                std::cerr << msg << std::flush;
-            }
-#    else
-            _fastpath_queue.pop_with_wait(msg);
-            std::cerr << msg << std::flush;
-#    endif // BOOST_MSVC
-        }
-
-        // Exit procedure: Clear the queue
-        while (_fastpath_queue.pop_with_haste(msg)) {
-            std::cerr << msg << std::flush;
+        std::unique_lock<std::mutex> lock(_fastpath_mutex);
+        bool exit = false;
+        while (!exit) {
+            exit = _fastpath_cond.wait_for(
+                lock, FASTPATH_DRAIN_INTERVAL, [this]() { return _exit.load(); });
+            _drain_fastpath();
         }
 #endif
     }
 
-    void pop_fastpath_dummy_task()
+    std::vector<uhd::log::fastpath_event_t> read_fastpath_events()
     {
 #ifndef UHD_LOG_FASTPATH_DISABLE
-        std::string msg;
-        while (!_exit) {
-#    ifdef BOOST_MSVC
-            // Some versions of MSVC will hang if threads are being joined after main has
-            // completed, so we need to guarantee a timeout here
-            _fastpath_queue.pop_with_timed_wait(msg, READ_TIMEOUT);
-#    else
-            _fastpath_queue.pop_with_wait(msg);
-#    endif // BOOST_MSVC
-        }
-
-        // Exit procedure: Clear the queue
-        while (_fastpath_queue.pop_with_haste(msg))
-            ;
+        // Don't let the reader swallow events before they were printed
+        _drain_fastpath();
 #endif
+        return tracer.read_events();
     }
 
     void add_logger(const std::string& key, uhd::log::log_fn_t logger_fn)
@@ -434,6 +415,8 @@ public:
         _loggers[key].first = level;
     }
 
+    uhd::log::fastpath_tracer tracer;
+
 private:
     std::shared_ptr<std::thread> _pop_task;
 #ifndef UHD_LOG_FASTPATH_DISABLE
@@ -509,12 +492,49 @@ private:
         _log_queue.push_with_timed_wait(log_msg, 0.25);
     }
 
+#ifndef UHD_LOG_FASTPATH_DISABLE
+    //! Print the codes of all recorded fastpath events, and log their details
+    void _drain_fastpath()
+    {
+        const bool log_details = uhd::log::trace >= global_level;
+        std::string codes;
+        std::ostringstream details;
+        size_t num_events = 0;
+        tracer.drain([&](const uhd::log::fastpath_event_t& event) {
+            if (_print_fastpath) {
+                codes.push_back(event.code);
+            }
+            if (log_details && num_events++ < FASTPATH_MAX_EVENTS_PER_MSG) {
+                details << (num_events > 1 ? "; " : " ") << event.code;
+                if (event.channel != uhd::log::fastpath_event_t::NO_CHANNEL) {
+                    details << " chan=" << event.channel;
+                }
+                if (event.has_device_ticks) {
+                    details << " ticks=" << event.device_ticks;
+                }
+            }
+        });
+        if (!codes.empty()) {
+            std::cerr << codes << std::flush;
+        }
+        if (num_events > FASTPATH_MAX_EVENTS_PER_MSG) {
+            details << " (" << (num_events - FASTPATH_MAX_EVENTS_PER_MSG)
+                    << " more)";
+        }
+        if (num_events) {
+            _publish_log_msg("Events:" + details.str(), uhd::log::trace, "FASTPATH");
+        }
+    }
+#endif
+
     std::mutex _logmap_mutex;
     std::atomic<bool> _exit;
     using level_logfn_pair = std::pair<uhd::log::severity_level, uhd::log::log_fn_t>;
     std::map<std::string, level_logfn_pair> _loggers;
 #ifndef UHD_LOG_FASTPATH_DISABLE
-    uhd::transport::bounded_buffer<std::string> _fastpath_queue;
+    std::mutex _fastpath_mutex;
+    std::condition_variable _fastpath_cond;
+    bool _print_fastpath = true;
 #endif
     uhd::transport::bounded_buffer<uhd::log::logging_info> _log_queue;
 };
@@ -555,13 +575,40 @@ uhd::_log::log::~log(void)
 #ifndef UHD_LOG_FASTPATH_DISABLE
 void uhd::_log::log_fastpath(const std::string& msg)
 {
-    log_rs().push_fastpath(msg);
+    for (const char code : msg) {
+        log_rs().push_fastpath(code, uhd::log::fastpath_event_t::NO_CHANNEL);
+    }
+}
+
+void uhd::_log::log_fastpath(const char* msg)
+{
+    for (; *msg != '\0'; msg++) {
+        log_rs().push_fastpath(*msg, uhd::log::fastpath_event_t::NO_CHANNEL);
+    }
+}
+
+void uhd::_log::log_fastpath_event(const char code,
+    const size_t channel,
+    const boost::optional<uint64_t>& device_ticks)
+{
+    log_rs().push_fastpath(code, static_cast<uint32_t>(channel), device_ticks);
 }
 #else
 void uhd::_log::log_fastpath(const std::string&)
 {
     // nop
 }
+
+void uhd::_log::log_fastpath(const char*)
+{
+    // nop
+}
+
+void uhd::_log::log_fastpath_event(
+    const char, const size_t, const boost::optional<uint64_t>&)
+{
+    // nop
+}
 #endif
 
 /***********************************************************************
@@ -591,3 +638,13 @@ void uhd::log::set_file_level(uhd::log::severity_level level)
 {
     set_logger_level(UHD_FILE_LOGGER_KEY, level);
 }
+
+std::vector<uhd::log::fastpath_event_t> uhd::log::read_fastpath_events()
+{
+    return log_rs().read_fastpath_events();
+}
+
+uhd::log::fastpath_counters_t uhd::log::get_fastpath_counters()
+{
+    return log_rs().tracer.get_counters();
+}
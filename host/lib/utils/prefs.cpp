@@ -154,6 +154,6 @@ device_addr_t uhd::prefs::get_dpdk_args(const uhd::device_addr_t& user_args)
 
 device_addr_t uhd::prefs::get_dpdk_nic_args(const uhd::device_addr_t& user_args)
 {
-    const std::vector<std::string> keys_to_update_from = {"dpdk_mac"};
+    const std::vector<std::string> keys_to_update_from = {"dpdk_mac", "dpdk_name"};
     return get_args(user_args, keys_to_update_from);
 }
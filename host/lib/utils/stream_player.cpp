@@ -0,0 +1,339 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/stream_player.hpp>
+#include <uhd/utils/thread.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#ifndef UHD_PLATFORM_WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+using namespace uhd;
+using namespace uhd::utils;
+
+stream_player::~stream_player() = default;
+
+#ifdef UHD_PLATFORM_WIN32
+
+stream_player::sptr stream_player::make(tx_streamer::sptr,
+    const std::string&,
+    const std::vector<std::string>&,
+    const uhd::device_addr_t&)
+{
+    throw uhd::not_implemented_error("stream_player requires POSIX file I/O");
+}
+
+#else
+
+namespace {
+
+constexpr char LOG_ID[] = "STREAM_PLAYER";
+
+constexpr size_t DEFAULT_SAMPS_PER_SEND = 256 * 1024;
+
+//! Timeout of the send() calls, determines how quickly stop() returns
+constexpr double SEND_TIMEOUT = 0.1;
+
+std::string errno_str(const std::string& what, const std::string& filename)
+{
+    return str(boost::format("%s %s: %s") % what % filename % strerror(errno));
+}
+
+//! Read-only memory mapping of an input file
+class input_file
+{
+public:
+    input_file(const std::string& filename)
+    {
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw uhd::os_error(errno_str("Failed to open", filename));
+        }
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) < 0) {
+            close(fd);
+            throw uhd::os_error(errno_str("Failed to get size of", filename));
+        }
+        _size = static_cast<size_t>(file_stat.st_size);
+        if (_size == 0) {
+            close(fd);
+            throw uhd::value_error("stream_player: " + filename + " is empty");
+        }
+        _mem = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+        // The mapping keeps the file open
+        close(fd);
+        if (_mem == MAP_FAILED) {
+            throw uhd::os_error(errno_str("Failed to map", filename));
+        }
+        madvise(_mem, _size, MADV_SEQUENTIAL);
+    }
+
+    ~input_file()
+    {
+        munmap(_mem, _size);
+    }
+
+    const uint8_t* data() const
+    {
+        return static_cast<const uint8_t*>(_mem);
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    //! Ask the kernel to read the given range of the file ahead of time
+    void prefetch(const size_t offset, const size_t len) const
+    {
+        // madvise() needs a page-aligned address
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t start = std::min(offset, _size) / page_size * page_size;
+        const size_t end   = std::min(offset + len, _size);
+        if (end > start) {
+            madvise(static_cast<uint8_t*>(_mem) + start, end - start, MADV_WILLNEED);
+        }
+    }
+
+private:
+    void* _mem;
+    size_t _size;
+};
+
+class stream_player_impl : public stream_player
+{
+public:
+    stream_player_impl(tx_streamer::sptr tx_stream,
+        const std::string& cpu_format,
+        const std::vector<std::string>& filenames,
+        const uhd::device_addr_t& args)
+        : _tx_stream(tx_stream)
+        , _bpi(convert::get_bytes_per_item(cpu_format))
+        , _samps_per_send(args.cast<size_t>("samps_per_send", DEFAULT_SAMPS_PER_SEND))
+        , _repeat(args.cast<bool>("repeat", false))
+    {
+        if (filenames.size() != _tx_stream->get_num_channels()) {
+            throw uhd::value_error(
+                str(boost::format("stream_player: Got %d files for %d channels")
+                    % filenames.size() % _tx_stream->get_num_channels()));
+        }
+        if (_samps_per_send == 0) {
+            throw uhd::value_error("stream_player: samps_per_send must not be zero");
+        }
+
+        _num_samps = std::numeric_limits<size_t>::max();
+        for (const auto& filename : filenames) {
+            _files.emplace_back(new input_file(filename));
+            _num_samps = std::min(_num_samps, _files.back()->size() / _bpi);
+        }
+        if (_num_samps == 0) {
+            throw uhd::value_error("stream_player: Files contain no complete sample");
+        }
+        for (const auto& file : _files) {
+            if (file->size() != _num_samps * _bpi) {
+                UHD_LOG_WARNING(LOG_ID,
+                    "Files have different sizes, playing the first "
+                        << _num_samps << " samples of each");
+                break;
+            }
+        }
+    }
+
+    ~stream_player_impl() override
+    {
+        try {
+            stop();
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR(LOG_ID, "Error while stopping: " << ex.what());
+        }
+    }
+
+    void start(const uhd::tx_metadata_t& metadata) override
+    {
+        std::lock_guard<std::mutex> lock(_control_mutex);
+        if (_send_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> done_lock(_done_mutex);
+                if (!_done) {
+                    throw uhd::runtime_error("stream_player: Already started");
+                }
+            }
+            _send_thread.join();
+            _rethrow_send_error();
+        }
+        _running = true;
+        {
+            std::lock_guard<std::mutex> done_lock(_done_mutex);
+            _done = false;
+        }
+        _send_thread = std::thread([this, metadata]() { _send_loop(metadata); });
+        uhd::set_thread_name(&_send_thread, "player_tx");
+    }
+
+    bool wait_done(const double timeout) override
+    {
+        {
+            std::unique_lock<std::mutex> lock(_done_mutex);
+            if (!_done_cond.wait_for(lock,
+                    std::chrono::duration<double>(timeout),
+                    [this]() { return _done; })) {
+                return false;
+            }
+        }
+        _rethrow_send_error();
+        return true;
+    }
+
+    void stop() override
+    {
+        std::lock_guard<std::mutex> lock(_control_mutex);
+        if (!_send_thread.joinable()) {
+            return;
+        }
+        _running = false;
+        _send_thread.join();
+        _rethrow_send_error();
+    }
+
+    stats_t get_stats() const override
+    {
+        stats_t stats;
+        stats.num_samps_sent  = _num_samps_sent;
+        stats.num_repetitions = _num_repetitions;
+        return stats;
+    }
+
+private:
+    void _send_loop(const uhd::tx_metadata_t& md)
+    {
+        // Nothing can catch exceptions on this thread, so they are handed to
+        // the next call to wait_done(), stop() or start()
+        std::exception_ptr error;
+        try {
+            _send_samples(md);
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR(LOG_ID, "Error while sending: " << ex.what());
+            error = std::current_exception();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_done_mutex);
+            _send_error = error;
+            _done       = true;
+        }
+        _done_cond.notify_all();
+    }
+
+    //! Throw the exception of the send thread once, if there was one
+    void _rethrow_send_error()
+    {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(_done_mutex);
+            std::swap(error, _send_error);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void _send_samples(uhd::tx_metadata_t md)
+    {
+        std::vector<const void*> buffs(_files.size());
+        md.start_of_burst = true;
+        size_t pos        = 0;
+        bool in_burst     = false;
+
+        while (_running) {
+            const size_t nsamps = std::min(_samps_per_send, _num_samps - pos);
+            for (size_t chan = 0; chan < _files.size(); chan++) {
+                buffs[chan] = _files[chan]->data() + pos * _bpi;
+                // Have the kernel read the next chunk while this one is sent
+                _files[chan]->prefetch((pos + nsamps) * _bpi, _samps_per_send * _bpi);
+            }
+            md.end_of_burst = !_repeat && (pos + nsamps == _num_samps);
+
+            const size_t num_tx = _tx_stream->send(buffs, nsamps, md, SEND_TIMEOUT);
+            _num_samps_sent += num_tx;
+            pos += num_tx;
+            if (num_tx) {
+                md.start_of_burst = false;
+                md.has_time_spec  = false;
+                in_burst          = true;
+            }
+
+            if (pos == _num_samps) {
+                _num_repetitions++;
+                if (!_repeat) {
+                    in_burst = false;
+                    break;
+                }
+                pos = 0;
+            }
+        }
+
+        // Stopped in the middle of the burst
+        if (in_burst) {
+            md.end_of_burst = true;
+            _tx_stream->send(buffs, 0, md, SEND_TIMEOUT);
+        }
+    }
+
+    tx_streamer::sptr _tx_stream;
+
+    //! Bytes per sample
+    const size_t _bpi;
+    const size_t _samps_per_send;
+    const bool _repeat;
+
+    //! One file per channel
+    std::vector<std::unique_ptr<input_file>> _files;
+    //! Number of samples played per channel
+    size_t _num_samps;
+
+    std::atomic<size_t> _num_samps_sent{0};
+    std::atomic<size_t> _num_repetitions{0};
+
+    std::mutex _done_mutex;
+    std::condition_variable _done_cond;
+    bool _done = false;
+    //! Exception thrown on the send thread, protected by _done_mutex
+    std::exception_ptr _send_error;
+
+    std::mutex _control_mutex;
+    std::atomic<bool> _running{false};
+    std::thread _send_thread;
+};
+
+} // namespace
+
+stream_player::sptr stream_player::make(tx_streamer::sptr tx_stream,
+    const std::string& cpu_format,
+    const std::vector<std::string>& filenames,
+    const uhd::device_addr_t& args)
+{
+    return std::make_shared<stream_player_impl>(tx_stream, cpu_format, filenames, args);
+}
+
+#endif // UHD_PLATFORM_WIN32
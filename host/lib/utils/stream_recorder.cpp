@@ -0,0 +1,469 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/stream_recorder.hpp>
+#include <uhd/utils/thread.hpp>
+#include <boost/format.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#ifndef UHD_PLATFORM_WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+using namespace uhd;
+using namespace uhd::utils;
+
+stream_recorder::~stream_recorder() = default;
+
+#ifdef UHD_PLATFORM_WIN32
+
+stream_recorder::sptr stream_recorder::make(rx_streamer::sptr,
+    const std::string&,
+    const std::vector<std::string>&,
+    const uhd::device_addr_t&)
+{
+    throw uhd::not_implemented_error("stream_recorder requires POSIX file I/O");
+}
+
+#else
+
+namespace {
+
+constexpr char LOG_ID[] = "STREAM_RECORDER";
+
+//! Alignment of file offsets, sizes and buffers required by O_DIRECT
+constexpr size_t DIRECT_IO_ALIGN = 4096;
+
+constexpr size_t DEFAULT_RING_SIZE  = 256 * 1024 * 1024;
+constexpr size_t DEFAULT_BLOCK_SIZE = 4 * 1024 * 1024;
+
+//! Timeout of the recv() calls, determines how quickly stop() returns
+constexpr double RECV_TIMEOUT = 0.1;
+
+std::string errno_str(const std::string& what, const std::string& filename)
+{
+    return str(boost::format("%s %s: %s") % what % filename % strerror(errno));
+}
+
+//! Anonymous memory mapping, page aligned and prefaulted
+class ring_memory
+{
+public:
+    ring_memory(const size_t size) : _size(size)
+    {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#    ifdef MAP_POPULATE
+        flags |= MAP_POPULATE;
+#    endif
+        _mem = mmap(nullptr, _size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (_mem == MAP_FAILED) {
+            throw uhd::os_error(errno_str("Failed to allocate", "recorder ring"));
+        }
+#    ifndef MAP_POPULATE
+        std::memset(_mem, 0, _size);
+#    endif
+    }
+
+    ~ring_memory()
+    {
+        munmap(_mem, _size);
+    }
+
+    uint8_t* data() const
+    {
+        return static_cast<uint8_t*>(_mem);
+    }
+
+private:
+    const size_t _size;
+    void* _mem;
+};
+
+//! Output file of one channel
+class output_file
+{
+public:
+    output_file(const std::string& filename, const bool direct) : _filename(filename)
+    {
+        constexpr int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#    ifdef O_DIRECT
+        if (direct) {
+            _fd = open(filename.c_str(), flags | O_DIRECT, 0644);
+            if (_fd < 0 && errno == EINVAL) {
+                UHD_LOG_INFO(LOG_ID,
+                    "O_DIRECT is not supported for " << filename
+                                                     << ", using the page cache");
+            }
+        }
+#    endif
+        if (_fd < 0) {
+            _fd = open(filename.c_str(), flags, 0644);
+        }
+        if (_fd < 0) {
+            throw uhd::os_error(errno_str("Failed to create", filename));
+        }
+    }
+
+    ~output_file()
+    {
+        close(_fd);
+    }
+
+    /*! Append size bytes from buff to the file
+     *
+     * buff must hold size bytes rounded up to DIRECT_IO_ALIGN, the padding
+     * is removed when the file is truncated.
+     */
+    void write_block(const uint8_t* buff, const size_t size)
+    {
+        const size_t padded_size =
+            (size + DIRECT_IO_ALIGN - 1) / DIRECT_IO_ALIGN * DIRECT_IO_ALIGN;
+        size_t written = 0;
+        while (written < padded_size) {
+            const ssize_t ret = write(_fd, buff + written, padded_size - written);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw uhd::os_error(errno_str("Failed to write to", _filename));
+            }
+            written += static_cast<size_t>(ret);
+        }
+        _size += size;
+        if (padded_size != size) {
+            truncate();
+        }
+    }
+
+    //! Remove the padding of the last block
+    void truncate()
+    {
+        if (ftruncate(_fd, static_cast<off_t>(_size)) < 0) {
+            throw uhd::os_error(errno_str("Failed to truncate", _filename));
+        }
+    }
+
+private:
+    const std::string _filename;
+    int _fd      = -1;
+    size_t _size = 0;
+};
+
+class stream_recorder_impl : public stream_recorder
+{
+public:
+    stream_recorder_impl(rx_streamer::sptr rx_stream,
+        const std::string& cpu_format,
+        const std::vector<std::string>& filenames,
+        const uhd::device_addr_t& args)
+        : _rx_stream(rx_stream)
+        , _bpi(convert::get_bytes_per_item(cpu_format))
+        , _block_size(args.cast<size_t>("block_size", DEFAULT_BLOCK_SIZE))
+        , _num_blocks(args.cast<size_t>("ring_size", DEFAULT_RING_SIZE) / _block_size)
+        , _num_chans(filenames.size())
+        , _block_fill(_num_blocks, 0)
+        , _num_blocks_done(_num_chans)
+        , _num_bytes_written(_num_chans)
+    {
+        if (_num_chans != _rx_stream->get_num_channels()) {
+            throw uhd::value_error(
+                str(boost::format("stream_recorder: Got %d files for %d channels")
+                    % _num_chans % _rx_stream->get_num_channels()));
+        }
+        if (_block_size == 0 || _block_size % DIRECT_IO_ALIGN != 0
+            || _block_size % _bpi != 0) {
+            throw uhd::value_error(
+                str(boost::format("stream_recorder: block_size must be a multiple of "
+                                  "%d and of the sample size (%d bytes)")
+                    % DIRECT_IO_ALIGN % _bpi));
+        }
+        if (_num_blocks < 2) {
+            throw uhd::value_error(
+                "stream_recorder: ring_size must be at least two blocks");
+        }
+
+        const bool direct = args.cast<bool>("direct", true);
+        for (const auto& filename : filenames) {
+            _files.emplace_back(new output_file(filename, direct));
+            _rings.emplace_back(new ring_memory(_num_blocks * _block_size));
+            // Samples that don't fit into the ring are received here
+            _scratch.emplace_back(new ring_memory(_block_size));
+        }
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            _num_blocks_done[chan]   = 0;
+            _num_bytes_written[chan] = 0;
+        }
+    }
+
+    ~stream_recorder_impl() override
+    {
+        try {
+            stop();
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR(LOG_ID, "Error while stopping: " << ex.what());
+        }
+    }
+
+    void start() override
+    {
+        std::lock_guard<std::mutex> lock(_control_mutex);
+        // The last block of a recording may be partial, which ends the files
+        if (_started) {
+            throw uhd::runtime_error("stream_recorder: Can only be started once");
+        }
+        _started = true;
+        _running = true;
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            _writer_threads.emplace_back([this, chan]() { _write_loop(chan); });
+            uhd::set_thread_name(&_writer_threads.back(), "recorder_wr");
+        }
+        _recv_thread = std::thread([this]() { _recv_loop(); });
+        uhd::set_thread_name(&_recv_thread, "recorder_rx");
+    }
+
+    void stop() override
+    {
+        std::lock_guard<std::mutex> lock(_control_mutex);
+        if (!_recv_thread.joinable()) {
+            return;
+        }
+        _running = false;
+        _recv_thread.join();
+        for (auto& thread : _writer_threads) {
+            thread.join();
+        }
+        _writer_threads.clear();
+        if (_recv_error) {
+            std::rethrow_exception(_recv_error);
+        }
+        if (_write_error) {
+            std::rethrow_exception(_write_error);
+        }
+    }
+
+    stats_t get_stats() const override
+    {
+        stats_t stats;
+        stats.num_samps_received = _num_samps_received;
+        stats.num_samps_dropped  = _num_samps_dropped;
+        stats.num_overflows      = _num_overflows;
+        stats.max_ring_fill      = _max_ring_fill;
+        size_t bytes_written     = std::numeric_limits<size_t>::max();
+        for (const auto& bytes : _num_bytes_written) {
+            bytes_written = std::min<size_t>(bytes_written, bytes);
+        }
+        stats.num_samps_written = bytes_written / _bpi;
+        return stats;
+    }
+
+private:
+    //! Return the number of blocks that all writers are done with
+    size_t _get_num_blocks_free() const
+    {
+        size_t done = std::numeric_limits<size_t>::max();
+        for (const auto& num_done : _num_blocks_done) {
+            done = std::min<size_t>(done, num_done.load(std::memory_order_acquire));
+        }
+        return done;
+    }
+
+    //! Hand the current block to the writers
+    void _publish_block(const size_t fill)
+    {
+        _block_fill[_num_blocks_published % _num_blocks] = fill;
+        {
+            std::lock_guard<std::mutex> lock(_writer_mutex);
+            _num_blocks_published++;
+        }
+        _writer_cond.notify_all();
+    }
+
+    void _recv_loop()
+    {
+        bool have_block   = false;
+        size_t block_fill = 0;
+        // Nothing can catch exceptions on this thread, so they are thrown from
+        // stop(). The writers still get the samples received so far.
+        try {
+            _recv_samples(have_block, block_fill);
+        } catch (const std::exception& ex) {
+            UHD_LOG_ERROR(LOG_ID, "Error while receiving: " << ex.what());
+            _recv_error = std::current_exception();
+        } catch (...) {
+            _recv_error = std::current_exception();
+        }
+
+        if (have_block && block_fill) {
+            _publish_block(block_fill);
+        }
+        {
+            std::lock_guard<std::mutex> lock(_writer_mutex);
+            _recv_done = true;
+        }
+        _writer_cond.notify_all();
+    }
+
+    /*! Receive into the ring until stopped
+     *
+     * have_block and block_fill describe the block being filled, so the
+     * caller can publish it even if recv() throws.
+     */
+    void _recv_samples(bool& have_block, size_t& block_fill)
+    {
+        std::vector<void*> buffs(_num_chans);
+        rx_metadata_t md;
+        const size_t nsamps_per_block = _block_size / _bpi;
+
+        while (_running) {
+            if (!have_block) {
+                const size_t ring_fill = _num_blocks_published - _get_num_blocks_free();
+                if (ring_fill * _block_size > _max_ring_fill) {
+                    _max_ring_fill = ring_fill * _block_size;
+                }
+                have_block = ring_fill < _num_blocks;
+                block_fill = 0;
+            }
+
+            const size_t block_offset =
+                (_num_blocks_published % _num_blocks) * _block_size + block_fill;
+            for (size_t chan = 0; chan < _num_chans; chan++) {
+                buffs[chan] = have_block ? _rings[chan]->data() + block_offset
+                                         : _scratch[chan]->data();
+            }
+            const size_t nsamps = have_block ? (_block_size - block_fill) / _bpi
+                                             : nsamps_per_block;
+
+            const size_t num_rx = _rx_stream->recv(buffs, nsamps, md, RECV_TIMEOUT);
+            _num_samps_received += num_rx;
+
+            switch (md.error_code) {
+                case rx_metadata_t::ERROR_CODE_NONE:
+                case rx_metadata_t::ERROR_CODE_TIMEOUT:
+                    break;
+                case rx_metadata_t::ERROR_CODE_OVERFLOW:
+                    _num_overflows++;
+                    break;
+                default:
+                    UHD_LOG_WARNING(LOG_ID, "Receive error: " << md.strerror());
+                    break;
+            }
+
+            if (!have_block) {
+                _num_samps_dropped += num_rx;
+                // The samples of all channels are dropped. The tick rate is
+                // not known here, so the events carry no device time.
+                for (size_t chan = 0; num_rx && chan < _num_chans; chan++) {
+                    UHD_LOG_FASTPATH_EVENT('D', chan);
+                }
+                continue;
+            }
+            block_fill += num_rx * _bpi;
+            if (block_fill == _block_size) {
+                _publish_block(block_fill);
+                have_block = false;
+            }
+        }
+    }
+
+    void _write_loop(const size_t chan)
+    {
+        auto& num_done = _num_blocks_done[chan];
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_writer_mutex);
+                _writer_cond.wait(lock, [&]() {
+                    return _recv_done || _num_blocks_published > num_done;
+                });
+                if (_num_blocks_published == num_done) {
+                    return;
+                }
+            }
+
+            const size_t block = num_done % _num_blocks;
+            const size_t fill  = _block_fill[block];
+            try {
+                _files[chan]->write_block(
+                    _rings[chan]->data() + block * _block_size, fill);
+            } catch (...) {
+                // Keep consuming blocks so the receive thread doesn't stall.
+                // The error is thrown from stop().
+                std::lock_guard<std::mutex> lock(_writer_mutex);
+                if (!_write_error) {
+                    _write_error = std::current_exception();
+                    UHD_LOG_ERROR(LOG_ID, "Failed to write samples of channel " << chan);
+                }
+            }
+            _num_bytes_written[chan] += fill;
+            num_done.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    rx_streamer::sptr _rx_stream;
+
+    //! Bytes per sample
+    const size_t _bpi;
+    const size_t _block_size;
+    const size_t _num_blocks;
+    const size_t _num_chans;
+
+    //! One file, ring and scratch block per channel
+    std::vector<std::unique_ptr<output_file>> _files;
+    std::vector<std::unique_ptr<ring_memory>> _rings;
+    std::vector<std::unique_ptr<ring_memory>> _scratch;
+
+    //! Number of valid bytes in each block of the ring, the same for all channels
+    std::vector<size_t> _block_fill;
+
+    //! Number of blocks handed to the writers, protected by _writer_mutex
+    size_t _num_blocks_published = 0;
+    //! Whether the receive thread has published its last block
+    bool _recv_done = false;
+    std::mutex _writer_mutex;
+    std::condition_variable _writer_cond;
+    std::exception_ptr _write_error;
+    //! Exception thrown on the receive thread, read after it was joined
+    std::exception_ptr _recv_error;
+
+    //! Number of blocks each writer is done with
+    std::vector<std::atomic<size_t>> _num_blocks_done;
+    std::vector<std::atomic<size_t>> _num_bytes_written;
+
+    std::atomic<size_t> _num_samps_received{0};
+    std::atomic<size_t> _num_samps_dropped{0};
+    std::atomic<size_t> _num_overflows{0};
+    std::atomic<size_t> _max_ring_fill{0};
+
+    std::mutex _control_mutex;
+    bool _started = false;
+    std::atomic<bool> _running{false};
+    std::thread _recv_thread;
+    std::vector<std::thread> _writer_threads;
+};
+
+} // namespace
+
+stream_recorder::sptr stream_recorder::make(rx_streamer::sptr rx_stream,
+    const std::string& cpu_format,
+    const std::vector<std::string>& filenames,
+    const uhd::device_addr_t& args)
+{
+    return std::make_shared<stream_recorder_impl>(rx_stream, cpu_format, filenames, args);
+}
+
+#endif // UHD_PLATFORM_WIN32
@@ -6,11 +6,112 @@
 
 #include <uhd/cal/pwr_cal.hpp>
 #include <uhd/exception.hpp>
+#include <uhdlib/utils/interpolation.hpp>
 #include <boost/test/unit_test.hpp>
 #include <iostream>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
 
 using namespace uhd::usrp::cal;
 
+namespace {
+
+//! Straightforward, map-based reference for the pwr_cal interpolation
+struct pwr_cal_reference
+{
+    struct table_t
+    {
+        std::map<double, double> g2p;
+        std::map<double, double> p2g;
+        double min_power;
+        double max_power;
+    };
+
+    void add_power_table(const std::map<double, double>& g2p,
+        const double min_power,
+        const double max_power,
+        const double freq)
+    {
+        std::map<double, double> p2g;
+        for (const auto& gp : g2p) {
+            p2g.insert({gp.second, gp.first});
+        }
+        data[static_cast<uint64_t>(freq)] = {g2p, p2g, min_power, max_power};
+    }
+
+    double get_power(const double gain, const double freq) const
+    {
+        using namespace uhd::math;
+        const auto f_iters = get_bounding_iterators(data, uint64_t(freq));
+        const auto& t1     = f_iters.first->second;
+        const auto& t2     = f_iters.second->second;
+        if (f_iters.first == f_iters.second) {
+            return at_lin_interp(t1.g2p, gain);
+        }
+        const double f1    = double(f_iters.first->first);
+        const double f2    = double(f_iters.second->first);
+        const auto g_iters = get_bounding_iterators(t1.g2p, gain);
+        const double g1    = g_iters.first->first;
+        const double g2    = g_iters.second->first;
+        if (g1 == g2) {
+            return linear_interp(freq, f1, t1.g2p.at(g1), f2, t2.g2p.at(g1));
+        }
+        return bilinear_interp(freq,
+            gain,
+            f1,
+            g1,
+            f2,
+            g2,
+            t1.g2p.at(g1),
+            t1.g2p.at(g2),
+            t2.g2p.at(g1),
+            t2.g2p.at(g2));
+    }
+
+    double get_gain(const double power_dbm, const double freq) const
+    {
+        using namespace uhd::math;
+        const auto& limits = at_nearest(data, uint64_t(freq));
+        const double power =
+            uhd::meta_range_t(limits.min_power, limits.max_power).clip(power_dbm);
+        const auto f_iters = get_bounding_iterators(data, uint64_t(freq));
+        const auto& t1     = f_iters.first->second;
+        const auto& t2     = f_iters.second->second;
+        if (f_iters.first == f_iters.second) {
+            return at_lin_interp(t1.p2g, power);
+        }
+        const double f1     = double(f_iters.first->first);
+        const double f2     = double(f_iters.second->first);
+        const auto p1_iters = get_bounding_iterators(t1.p2g, power);
+        const auto p2_iters = get_bounding_iterators(t2.p2g, power);
+        const double pwr1 =
+            linear_interp(freq, f1, p1_iters.first->first, f2, p2_iters.first->first);
+        const double pwr2 =
+            linear_interp(freq, f1, p1_iters.second->first, f2, p2_iters.second->first);
+        if (pwr1 == pwr2) {
+            return linear_interp(
+                freq, f1, at_nearest(t1.p2g, pwr1), f2, at_nearest(t2.p2g, pwr2));
+        }
+        return bilinear_interp(freq,
+            power,
+            f1,
+            pwr1,
+            f2,
+            pwr2,
+            p1_iters.first->second,
+            p1_iters.second->second,
+            p2_iters.first->second,
+            p2_iters.second->second);
+    }
+
+    std::map<uint64_t, table_t> data;
+};
+
+} // namespace
+
 BOOST_AUTO_TEST_CASE(test_pwr_cal_api)
 {
     const std::string name   = "Mock Gain/Power Data";
@@ -153,3 +254,178 @@ BOOST_AUTO_TEST_CASE(test_pwr_cal_des_fail)
 
     BOOST_REQUIRE_THROW(container::make<pwr_cal>(not_actual_data), uhd::runtime_error);
 }
+
+BOOST_AUTO_TEST_CASE(test_pwr_cal_lookup_vs_reference)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> jitter(-0.5, 0.5);
+
+    // One table on an equidistant grid, one on an irregular grid. The power
+    // tables are not quite linear, and include a flat section.
+    for (const bool regular : {true, false}) {
+        auto cal_data = pwr_cal::make();
+        pwr_cal_reference reference;
+        std::vector<double> gains;
+        for (double gain = 0.0; gain <= 60.0;
+             gain += regular ? 1.0 : 1.0 + gains.size()) {
+            gains.push_back(gain);
+        }
+        for (size_t freq_idx = 0; freq_idx < 40; freq_idx++) {
+            const double freq = regular ? 1e9 + freq_idx * 100e6
+                                        : 1e9 + freq_idx * freq_idx * 7.3e6;
+            std::map<double, double> g2p;
+            for (const double gain : gains) {
+                const double power = -60.0 + gain * 1.05 - freq * 1e-9 + jitter(rng);
+                g2p[gain]          = std::min(power, 0.0);
+            }
+            const double min_power = g2p.cbegin()->second;
+            const double max_power = g2p.crbegin()->second;
+            cal_data->add_power_table(g2p, min_power, max_power, freq);
+            reference.add_power_table(g2p, min_power, max_power, freq);
+        }
+
+        std::uniform_real_distribution<double> freq_dist(0.5e9, 6e9);
+        std::uniform_real_distribution<double> gain_dist(-5.0, 65.0);
+        std::uniform_real_distribution<double> power_dist(-70.0, 10.0);
+        std::vector<double> freqs, test_gains, test_powers;
+        for (size_t i = 0; i < 5000; i++) {
+            // Mix in exact grid points, those are the corner cases
+            const bool on_grid    = (i % 4 == 0);
+            const auto& some_freq = std::next(reference.data.cbegin(), i % 40)->first;
+            freqs.push_back(on_grid ? double(some_freq) : freq_dist(rng));
+            test_gains.push_back(on_grid ? gains[i % gains.size()] : gain_dist(rng));
+            test_powers.push_back(power_dist(rng));
+        }
+
+        const auto powers = cal_data->get_power_batch(test_gains, freqs);
+        const auto gains_ = cal_data->get_gain_batch(test_powers, freqs);
+        for (size_t i = 0; i < freqs.size(); i++) {
+            BOOST_CHECK_EQUAL(cal_data->get_power(test_gains[i], freqs[i]), powers[i]);
+            BOOST_CHECK_EQUAL(reference.get_power(test_gains[i], freqs[i]), powers[i]);
+            BOOST_CHECK_EQUAL(cal_data->get_gain(test_powers[i], freqs[i]), gains_[i]);
+            BOOST_CHECK_EQUAL(reference.get_gain(test_powers[i], freqs[i]), gains_[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_pwr_cal_batch_size_mismatch)
+{
+    auto cal_data = pwr_cal::make();
+    cal_data->add_power_table({{0.0, -30.0}, {10.0, -20.0}}, -40.0, -10.0, 1e9);
+    BOOST_CHECK_THROW(cal_data->get_power_batch({0.0, 1.0}, {1e9}), uhd::value_error);
+    BOOST_CHECK_THROW(cal_data->get_gain_batch({-30.0}, {}), uhd::value_error);
+    BOOST_CHECK(cal_data->get_power_batch({}, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_pwr_cal_add_after_lookup)
+{
+    auto cal_data = pwr_cal::make();
+    cal_data->add_power_table({{0.0, -30.0}, {10.0, -20.0}}, -40.0, -10.0, 1e9);
+    BOOST_CHECK_EQUAL(cal_data->get_power(5.0, 2e9), -25.0);
+    // Lookups must see tables that were added after the previous lookup
+    cal_data->add_power_table({{0.0, -40.0}, {10.0, -30.0}}, -50.0, -20.0, 2e9);
+    BOOST_CHECK_EQUAL(cal_data->get_power(5.0, 2e9), -35.0);
+    cal_data->add_power_table({{0.0, -10.0}, {10.0, 0.0}}, -10.0, 0.0, 1e9, 60);
+    BOOST_CHECK_EQUAL(cal_data->get_power(5.0, 1e9, 60), -5.0);
+    BOOST_CHECK_EQUAL(cal_data->get_power(5.0, 1e9), -25.0);
+    cal_data->clear();
+    BOOST_CHECK_THROW(cal_data->get_power(5.0, 1e9), uhd::assertion_error);
+}
+
+namespace {
+
+//! pwr_cal implementation that does not override the batched lookups, like
+// implementations written against earlier versions of the API
+class forwarding_pwr_cal : public pwr_cal
+{
+public:
+    forwarding_pwr_cal(pwr_cal::sptr cal) : _cal(cal) {}
+
+    std::string get_name() const override
+    {
+        return _cal->get_name();
+    }
+    std::string get_serial() const override
+    {
+        return _cal->get_serial();
+    }
+    uint64_t get_timestamp() const override
+    {
+        return _cal->get_timestamp();
+    }
+    std::vector<uint8_t> serialize() override
+    {
+        return _cal->serialize();
+    }
+    void deserialize(const std::vector<uint8_t>& data) override
+    {
+        _cal->deserialize(data);
+    }
+    void add_power_table(const std::map<double, double>& gain_power_map,
+        const double min_power,
+        const double max_power,
+        const double freq,
+        const boost::optional<int> temperature = boost::none) override
+    {
+        _cal->add_power_table(gain_power_map, min_power, max_power, freq, temperature);
+    }
+    void clear() override
+    {
+        _cal->clear();
+    }
+    void set_temperature(const int temperature) override
+    {
+        _cal->set_temperature(temperature);
+    }
+    int get_temperature() const override
+    {
+        return _cal->get_temperature();
+    }
+    void set_ref_gain(const double gain) override
+    {
+        _cal->set_ref_gain(gain);
+    }
+    double get_ref_gain() const override
+    {
+        return _cal->get_ref_gain();
+    }
+    uhd::meta_range_t get_power_limits(const double freq,
+        const boost::optional<int> temperature = boost::none) const override
+    {
+        return _cal->get_power_limits(freq, temperature);
+    }
+    double get_power(const double gain,
+        const double freq,
+        const boost::optional<int> temperature = boost::none) const override
+    {
+        return _cal->get_power(gain, freq, temperature);
+    }
+    double get_gain(const double power_dbm,
+        const double freq,
+        const boost::optional<int> temperature = boost::none) const override
+    {
+        return _cal->get_gain(power_dbm, freq, temperature);
+    }
+
+private:
+    pwr_cal::sptr _cal;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_pwr_cal_default_batch)
+{
+    auto cal_data = std::make_shared<forwarding_pwr_cal>(pwr_cal::make());
+    cal_data->add_power_table({{0.0, -30.0}, {10.0, -20.0}}, -40.0, -10.0, 1e9);
+    cal_data->add_power_table({{0.0, -40.0}, {10.0, -30.0}}, -50.0, -20.0, 2e9);
+
+    const std::vector<double> freqs{1e9, 1.5e9, 2e9};
+    const auto powers = cal_data->get_power_batch({5.0, 5.0, 5.0}, freqs);
+    const auto gains  = cal_data->get_gain_batch({-25.0, -30.0, -35.0}, freqs);
+    for (size_t i = 0; i < freqs.size(); i++) {
+        BOOST_CHECK_EQUAL(powers[i], cal_data->get_power(5.0, freqs[i]));
+        BOOST_CHECK_EQUAL(gains[i], cal_data->get_gain(-25.0 - 5.0 * i, freqs[i]));
+    }
+    BOOST_CHECK_THROW(cal_data->get_power_batch({0.0, 1.0}, {1e9}), uhd::value_error);
+    BOOST_CHECK_THROW(cal_data->get_gain_batch({-30.0}, {}), uhd::value_error);
+}
@@ -37,12 +37,17 @@ class mock_send_transport
 public:
     using sptr = std::shared_ptr<mock_send_transport>;
 
+    /*!
+     * \param flow_control If false, send without waiting for flow control
+     *                     messages (e.g., into a sink that never replies)
+     */
     mock_send_transport(io_service::sptr io_srv,
         send_link_if::sptr send_link,
         recv_link_if::sptr recv_link,
         uint16_t dst_addr,
         uint16_t src_addr,
-        uint32_t credits)
+        uint32_t credits,
+        bool flow_control = true)
         : _credits(credits), _frame_size(send_link->get_send_frame_size())
     {
         _send_addr = (dst_addr << 16) | (src_addr << 0);
@@ -69,9 +74,10 @@ public:
                                       send_link_if* /*send_link*/) {
             return this->recv_buff(buff, link);
         };
-        send_io_if::fc_callback_t fc_cb = [this](const size_t bytes) {
-            return this->can_send(bytes);
-        };
+        send_io_if::fc_callback_t fc_cb = nullptr;
+        if (flow_control) {
+            fc_cb = [this](const size_t bytes) { return this->can_send(bytes); };
+        }
 
         /* Pretend get 1 flow control message per sent packet */
         _send_if = io_srv->make_send_client(
@@ -119,6 +119,10 @@ public:
     template <uhd::endianness_t endianness = uhd::ENDIANNESS_BIG>
     void pop_send_packet(uhd::transport::vrt::if_packet_info_t& ifpi);
 
+    template <typename T, uhd::endianness_t endianness = uhd::ENDIANNESS_BIG>
+    void pop_send_packet(
+        uhd::transport::vrt::if_packet_info_t& ifpi, std::vector<T>& otw_data);
+
 private:
     std::list<boost::shared_array<uint8_t>> _tx_mems;
     std::list<size_t> _tx_lens;
@@ -182,6 +186,14 @@ void mock_zero_copy::push_back_inline_message_packet(
 
 template <uhd::endianness_t endianness>
 void mock_zero_copy::pop_send_packet(uhd::transport::vrt::if_packet_info_t& ifpi)
+{
+    std::vector<uint32_t> otw_data;
+    pop_send_packet<uint32_t, endianness>(ifpi, otw_data);
+}
+
+template <typename T, uhd::endianness_t endianness>
+void mock_zero_copy::pop_send_packet(
+    uhd::transport::vrt::if_packet_info_t& ifpi, std::vector<T>& otw_data)
 {
     using namespace uhd::transport;
 
@@ -194,6 +206,11 @@ void mock_zero_copy::pop_send_packet(uhd::transport::vrt::if_packet_info_t& ifpi
     } else {
         uhd::transport::vrt::if_hdr_unpack_le(tx_buff_ptr, ifpi);
     }
+
+    // Copy data
+    const T* data_ptr = reinterpret_cast<const T*>(tx_buff_ptr + ifpi.num_header_words32);
+    otw_data.assign(data_ptr, data_ptr + ifpi.num_payload_bytes / sizeof(T));
+
     _tx_mems.pop_front();
     _tx_lens.pop_front();
 }
@@ -0,0 +1,496 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/convert.hpp>
+#include <uhd/exception.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd::convert;
+
+//! Alignment of the buffers when no offset is applied
+static constexpr size_t BUFF_ALIGNMENT = 64;
+//! Extra bytes at the end of the buffers, for converters working on blocks of items
+static constexpr size_t BUFF_PADDING = 64;
+
+//! Result of benchmarking one converter for one buffer size and offset
+struct result_t
+{
+    id_type id;
+    priority_type prio;
+    size_t num_samps;
+    size_t offset;
+    double ns_per_samp;
+    double gbps;
+};
+
+//! Identifies a result: converter ID, priority, number of samples and offset
+using result_key_t =
+    std::tuple<std::string, size_t, std::string, size_t, priority_type, size_t, size_t>;
+
+result_key_t get_key(const result_t& result)
+{
+    return std::make_tuple(result.id.input_format,
+        result.id.num_inputs,
+        result.id.output_format,
+        result.id.num_outputs,
+        result.prio,
+        result.num_samps,
+        result.offset);
+}
+
+//! A buffer aligned to BUFF_ALIGNMENT
+class bench_buffer
+{
+public:
+    bench_buffer(const size_t size) : _storage(size + BUFF_ALIGNMENT + BUFF_PADDING)
+    {
+        const size_t addr = reinterpret_cast<size_t>(_storage.data());
+        const size_t skew = (BUFF_ALIGNMENT - addr % BUFF_ALIGNMENT) % BUFF_ALIGNMENT;
+        _data             = _storage.data() + skew;
+    }
+
+    uint8_t* data()
+    {
+        return _data;
+    }
+
+private:
+    std::vector<uint8_t> _storage;
+    uint8_t* _data;
+};
+
+bool is_float_format(const std::string& format)
+{
+    return format[0] == 'f';
+}
+
+//! Fill an input buffer with values which are valid for its format
+void fill_buffer(uint8_t* buff, const size_t size, const std::string& format)
+{
+    std::mt19937 gen(0);
+    if (boost::starts_with(format, "fc64") or boost::starts_with(format, "f64")) {
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        double* values = reinterpret_cast<double*>(buff);
+        for (size_t i = 0; i < size / sizeof(double); i++) {
+            values[i] = dist(gen);
+        }
+    } else if (is_float_format(format)) {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        float* values = reinterpret_cast<float*>(buff);
+        for (size_t i = 0; i < size / sizeof(float); i++) {
+            values[i] = dist(gen);
+        }
+    } else {
+        std::uniform_int_distribution<int> dist(0, 255);
+        for (size_t i = 0; i < size; i++) {
+            buff[i] = static_cast<uint8_t>(dist(gen));
+        }
+    }
+}
+
+/*!
+ * Bytes per sample in each buffer of one side of a converter
+ *
+ * \param format the format of this side
+ * \param num_buffs the number of buffers on this side
+ * \param num_chans the number of channels of the converter
+ */
+size_t get_bytes_per_samp(
+    const std::string& format, const size_t num_buffs, const size_t num_chans)
+{
+    const size_t bpi = get_bytes_per_item(format);
+    // One buffer holds the samples of all channels
+    if (boost::ends_with(format, "_chan_interleaved")
+        or boost::ends_with(format, "_usrp1")) {
+        return bpi * num_chans;
+    }
+    // Each buffer holds one component of the samples
+    if (boost::ends_with(format, "_planar")) {
+        return bpi / num_buffs;
+    }
+    return bpi;
+}
+
+/*!
+ * Number of channels a converter converts
+ *
+ * A `_chan_interleaved` or USRP1 buffer holds the samples of all channels, so
+ * the channels are counted on the other side. A `_planar` format holds one
+ * channel in two buffers.
+ */
+size_t get_num_chans(const id_type& id)
+{
+    auto count_chans = [](const std::string& format, const size_t num_buffs) {
+        if (boost::ends_with(format, "_chan_interleaved")
+            or boost::ends_with(format, "_usrp1")) {
+            return size_t(1);
+        }
+        if (boost::ends_with(format, "_planar")) {
+            return std::max<size_t>(1, num_buffs / 2);
+        }
+        return num_buffs;
+    };
+    return std::max(count_chans(id.input_format, id.num_inputs),
+        count_chans(id.output_format, id.num_outputs));
+}
+
+double get_scalar(const id_type& id)
+{
+    const bool float_in  = is_float_format(id.input_format);
+    const bool float_out = is_float_format(id.output_format);
+    if (float_in and not float_out) {
+        return 32767.;
+    }
+    if (not float_in and float_out) {
+        return 1. / 32767.;
+    }
+    return 1.;
+}
+
+//! Time num_iters conversions of num_samps samples, in seconds
+double time_conversions(converter::sptr conv,
+    const std::vector<const void*>& inputs,
+    const std::vector<void*>& outputs,
+    const size_t num_samps,
+    const size_t num_iters)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_iters; i++) {
+        conv->conv(inputs, outputs, num_samps);
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start_time;
+    return elapsed.count();
+}
+
+/*!
+ * Benchmark all priorities of one converter ID, for all buffer sizes and offsets
+ *
+ * The sizes are numbers of samples summed over all channels, so converters with
+ * many channels work on data of the same size as the others.
+ * The number of iterations of a run is chosen so the run takes about min_time.
+ * The fastest of num_repeats runs is kept, since slower runs are caused by
+ * interruptions rather than by the converter.
+ */
+std::vector<result_t> benchmark_id(const id_type& id,
+    const std::vector<size_t>& sizes,
+    const std::vector<size_t>& offsets,
+    const double min_time,
+    const size_t num_repeats)
+{
+    const size_t num_chans = get_num_chans(id);
+    auto get_chan_samps    = [num_chans](const size_t size) {
+        return std::max<size_t>(1, size / num_chans);
+    };
+    const size_t in_bpi =
+        get_bytes_per_samp(id.input_format, id.num_inputs, num_chans);
+    const size_t out_bpi =
+        get_bytes_per_samp(id.output_format, id.num_outputs, num_chans);
+
+    // Allocate for the largest size, smaller sizes use the start of the buffers
+    const size_t max_size =
+        get_chan_samps(*std::max_element(sizes.begin(), sizes.end()));
+    const size_t max_offset = *std::max_element(offsets.begin(), offsets.end());
+    std::vector<bench_buffer> in_buffs, out_buffs;
+    for (size_t i = 0; i < id.num_inputs; i++) {
+        in_buffs.emplace_back((max_size + max_offset) * in_bpi);
+        fill_buffer(
+            in_buffs.back().data(), (max_size + max_offset) * in_bpi, id.input_format);
+    }
+    for (size_t i = 0; i < id.num_outputs; i++) {
+        out_buffs.emplace_back((max_size + max_offset) * out_bpi);
+    }
+
+    std::vector<converter::sptr> convs;
+    const auto prios = get_converter_priorities(id);
+    for (const priority_type prio : prios) {
+        convs.push_back(get_converter(id, prio)());
+        convs.back()->set_scalar(get_scalar(id));
+    }
+
+    std::vector<result_t> results;
+    std::vector<const void*> inputs(id.num_inputs);
+    std::vector<void*> outputs(id.num_outputs);
+    for (const size_t size : sizes) {
+        const size_t num_samps = get_chan_samps(size);
+        const double bytes_per_call =
+            double(num_samps * (in_bpi * id.num_inputs + out_bpi * id.num_outputs));
+        for (const size_t offset : offsets) {
+            for (size_t i = 0; i < id.num_inputs; i++) {
+                inputs[i] = in_buffs[i].data() + offset * in_bpi;
+            }
+            for (size_t i = 0; i < id.num_outputs; i++) {
+                outputs[i] = out_buffs[i].data() + offset * out_bpi;
+            }
+            for (size_t i = 0; i < convs.size(); i++) {
+                // The first run warms up the caches
+                const double first_run =
+                    time_conversions(convs[i], inputs, outputs, num_samps, 1);
+                const size_t num_iters =
+                    std::max<size_t>(1, static_cast<size_t>(min_time / first_run));
+                double elapsed = std::numeric_limits<double>::max();
+                for (size_t run = 0; run < num_repeats; run++) {
+                    elapsed = std::min(elapsed,
+                        time_conversions(
+                            convs[i], inputs, outputs, num_samps, num_iters));
+                }
+                const double ns_per_call = elapsed * 1e9 / double(num_iters);
+
+                result_t result;
+                result.id          = id;
+                result.prio        = prios[i];
+                result.num_samps   = size;
+                result.offset      = offset;
+                result.ns_per_samp = ns_per_call / double(num_samps * num_chans);
+                result.gbps        = bytes_per_call / ns_per_call;
+                results.push_back(result);
+            }
+        }
+    }
+    return results;
+}
+
+static const std::string CSV_HEADER = "input_format,num_inputs,output_format,num_outputs,"
+                                      "prio,num_samps,offset,ns_per_samp,gbps";
+
+void write_csv(const std::string& filename, const std::vector<result_t>& results)
+{
+    std::ofstream file(filename);
+    file << CSV_HEADER << std::endl;
+    for (const auto& result : results) {
+        file << boost::format("%s,%d,%s,%d,%d,%d,%d,%.6f,%.6f") % result.id.input_format
+                    % result.id.num_inputs % result.id.output_format
+                    % result.id.num_outputs % result.prio % result.num_samps
+                    % result.offset % result.ns_per_samp % result.gbps
+             << std::endl;
+    }
+}
+
+void write_json(const std::string& filename, const std::vector<result_t>& results)
+{
+    std::ofstream file(filename);
+    file << "{\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& result = results[i];
+        file << (i ? ",\n" : "\n")
+             << boost::format("    {\"input_format\": \"%s\", \"num_inputs\": %d, "
+                              "\"output_format\": \"%s\", \"num_outputs\": %d, "
+                              "\"prio\": %d, \"num_samps\": %d, \"offset\": %d, "
+                              "\"ns_per_samp\": %.6f, \"gbps\": %.6f}")
+                    % result.id.input_format % result.id.num_inputs
+                    % result.id.output_format % result.id.num_outputs % result.prio
+                    % result.num_samps % result.offset % result.ns_per_samp
+                    % result.gbps;
+    }
+    file << "\n  ]\n}" << std::endl;
+}
+
+//! Read the ns/sample of each result from a file written by write_csv()
+std::map<result_key_t, double> read_csv(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (not file) {
+        throw uhd::os_error("Failed to open baseline file " + filename);
+    }
+    std::string line;
+    std::getline(file, line);
+    if (boost::trim_copy(line) != CSV_HEADER) {
+        throw uhd::value_error("Baseline file " + filename + " has an unknown format");
+    }
+
+    std::map<result_key_t, double> baseline;
+    while (std::getline(file, line)) {
+        boost::trim(line);
+        if (line.empty()) {
+            continue;
+        }
+        std::vector<std::string> fields;
+        boost::split(fields, line, boost::is_any_of(","));
+        if (fields.size() != 9) {
+            throw uhd::value_error("Invalid line in baseline file: " + line);
+        }
+        result_t result;
+        result.id.input_format  = fields[0];
+        result.id.num_inputs    = boost::lexical_cast<size_t>(fields[1]);
+        result.id.output_format = fields[2];
+        result.id.num_outputs   = boost::lexical_cast<size_t>(fields[3]);
+        result.prio             = boost::lexical_cast<priority_type>(fields[4]);
+        result.num_samps        = boost::lexical_cast<size_t>(fields[5]);
+        result.offset           = boost::lexical_cast<size_t>(fields[6]);
+        baseline[get_key(result)] = boost::lexical_cast<double>(fields[7]);
+    }
+    return baseline;
+}
+
+//! Compare results to a baseline, return the number of regressions
+size_t compare_to_baseline(const std::vector<result_t>& results,
+    const std::map<result_key_t, double>& baseline,
+    const double tolerance)
+{
+    size_t num_regressions = 0;
+    size_t num_missing     = 0;
+    for (const auto& result : results) {
+        const auto it = baseline.find(get_key(result));
+        if (it == baseline.end()) {
+            num_missing++;
+            continue;
+        }
+        const double change = result.ns_per_samp / it->second - 1.0;
+        if (change > tolerance) {
+            num_regressions++;
+            std::cout << boost::format("REGRESSION: %-45s prio %2d %9d samps offset %d: "
+                                       "%.3f ns/samp (baseline %.3f, %+.1f%%)")
+                             % result.id.to_string() % result.prio % result.num_samps
+                             % result.offset % result.ns_per_samp % it->second
+                             % (change * 100)
+                      << std::endl;
+        }
+    }
+    std::cout << boost::format("Compared %d results to the baseline (%d not in the "
+                               "baseline), found %d regression(s)")
+                     % (results.size() - num_missing) % num_missing % num_regressions
+              << std::endl;
+    return num_regressions;
+}
+
+template <typename T>
+std::vector<T> parse_list(const std::string& list)
+{
+    std::vector<std::string> tokens;
+    boost::split(tokens, list, boost::is_any_of(","), boost::token_compress_on);
+    std::vector<T> values;
+    for (const auto& token : tokens) {
+        values.push_back(boost::lexical_cast<T>(boost::trim_copy(token)));
+    }
+    return values;
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string sizes, offsets, filter, csv_file, json_file, baseline_file;
+    double min_time, tolerance;
+    size_t num_repeats;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("sizes", po::value<std::string>(&sizes)->default_value("256,4096,65536,4194304"),
+            "comma-separated list of the number of samples per conversion, "
+            "summed over all channels")
+        ("offsets", po::value<std::string>(&offsets)->default_value("0,1"),
+            "comma-separated list of the offsets of the buffers, in items")
+        ("filter", po::value<std::string>(&filter)->default_value(""),
+            "only benchmark converters whose ID contains this string")
+        ("min-time", po::value<double>(&min_time)->default_value(0.005),
+            "minimum duration of one timed run, in seconds")
+        ("repeats", po::value<size_t>(&num_repeats)->default_value(5),
+            "number of timed runs, the fastest one is reported")
+        ("csv", po::value<std::string>(&csv_file),
+            "write the results to this CSV file")
+        ("json", po::value<std::string>(&json_file),
+            "write the results to this JSON file")
+        ("baseline", po::value<std::string>(&baseline_file),
+            "compare the results to this CSV file, written by a previous run")
+        ("tolerance", po::value<double>(&tolerance)->default_value(0.1),
+            "relative increase of ns/sample over the baseline reported as regression")
+        ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Converter Sweep Benchmark %s") % desc
+                  << std::endl;
+        std::cout
+            << "    Benchmarks every registered converter at every priority,\n"
+               "    for each buffer size and offset. The default sizes range\n"
+               "    from buffers which fit in the L1 cache to buffers which\n"
+               "    only fit in DRAM. Offsets other than 0 make the buffers\n"
+               "    unaligned. The time per sample is the time per sample of\n"
+               "    one channel, for converters with several channels. A\n"
+               "    planar format is one channel in two buffers.\n"
+               "    When a baseline is given, the program fails if any\n"
+               "    converter is slower than in the baseline by more than the\n"
+               "    tolerance.\n"
+               "    A full sweep takes a while, use --filter to select converters.\n"
+            << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto size_list   = parse_list<size_t>(sizes);
+    const auto offset_list = parse_list<size_t>(offsets);
+    if (min_time <= 0 or num_repeats == 0) {
+        throw uhd::value_error("--min-time and --repeats must be positive");
+    }
+    // Load the baseline first, so a bad file doesn't waste a whole sweep
+    std::map<result_key_t, double> baseline;
+    if (vm.count("baseline")) {
+        baseline = read_csv(baseline_file);
+    }
+
+    auto ids = get_converter_ids();
+    std::sort(ids.begin(), ids.end(), [](const id_type& lhs, const id_type& rhs) {
+        return lhs.to_string() < rhs.to_string();
+    });
+
+    std::vector<result_t> results;
+    std::cout << boost::format("%-45s %4s %9s %6s %11s %8s") % "converter" % "prio"
+                     % "samps" % "offset" % "ns/samp" % "GB/s"
+              << std::endl;
+    for (const auto& id : ids) {
+        if (id.to_string().find(filter) == std::string::npos) {
+            continue;
+        }
+        try {
+            get_bytes_per_item(id.input_format);
+            get_bytes_per_item(id.output_format);
+        } catch (const uhd::exception&) {
+            std::cout << "Skipping " << id.to_string() << ": unknown item size"
+                      << std::endl;
+            continue;
+        }
+        for (const auto& result :
+            benchmark_id(id, size_list, offset_list, min_time, num_repeats)) {
+            std::cout << boost::format("%-45s %4d %9d %6d %11.4f %8.3f")
+                             % id.to_string() % result.prio % result.num_samps
+                             % result.offset % result.ns_per_samp % result.gbps
+                      << std::endl;
+            results.push_back(result);
+        }
+    }
+
+    if (vm.count("csv")) {
+        write_csv(csv_file, results);
+    }
+    if (vm.count("json")) {
+        write_json(json_file, results);
+    }
+    if (vm.count("baseline")
+        and compare_to_baseline(results, baseline, tolerance) > 0) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
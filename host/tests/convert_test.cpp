@@ -15,6 +15,7 @@
 // clang-format on
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <complex>
@@ -43,7 +44,7 @@ struct benchmark_result
 
 // List of priority types. This must be manually kept in sync with whatever is
 // defined in convert_common.hpp
-const std::array<uhd::convert::priority_type, 5> CONV_PRIO_TYPES{-1, 0, 1, 2, 3};
+const std::array<uhd::convert::priority_type, 7> CONV_PRIO_TYPES{-1, 0, 1, 2, 3, 4, 5};
 
 // Use this to create a converter with fixed prio in a test case. If prio does
 // not exist, we simply exit the test case. That's normal.
@@ -1606,3 +1607,113 @@ MULTI_CONVERTER_TEST_CASE(benchmark_convert_types_fc32_and_fc32_chdr)
             test_convert_types_fc32(nsamps, id, prio, benchmarks);
         });
 }
+
+/***********************************************************************
+ * Test multi-buffer (planar and chan_interleaved) fc32 conversion
+ **********************************************************************/
+static void test_convert_multi_buffer_fc32(const std::string& input_format,
+    const size_t num_chans,
+    const size_t offset,
+    const size_t nsamps,
+    uhd::convert::priority_type prio)
+{
+    const size_t bytes_per_item = convert::get_bytes_per_item(input_format);
+    const size_t num_bytes      = (offset + nsamps + 4) * bytes_per_item;
+
+    // fill the input buffers with random wire data, and convert them one by
+    // one with the regular converter to get the expected output
+    convert::id_type ref_id;
+    ref_id.input_format  = input_format;
+    ref_id.num_inputs    = 1;
+    ref_id.output_format = "fc32";
+    ref_id.num_outputs   = 1;
+    convert::converter::sptr ref_conv = convert::get_converter(ref_id)();
+    ref_conv->set_scalar(1. / 32767.);
+
+    std::vector<std::vector<uint8_t>> input(num_chans, std::vector<uint8_t>(num_bytes));
+    std::vector<std::vector<fc32_t>> expected(num_chans, std::vector<fc32_t>(nsamps));
+    std::vector<const void*> inputs;
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        for (uint8_t& byte : input[chan]) {
+            byte = uint8_t(std::rand());
+        }
+        inputs.push_back(&input[chan][offset * bytes_per_item]);
+        ref_conv->conv(inputs.back(), &expected[chan][0], nsamps);
+    }
+
+    // planar output, one converter per channel
+    convert::id_type id = ref_id;
+    id.output_format    = "fc32_planar";
+    id.num_outputs      = 2;
+    GET_CONVERTER_SAFE(planar_conv, id, prio);
+    planar_conv->set_scalar(1. / 32767.);
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        std::vector<float> output_i(nsamps + 1, 42.f), output_q(nsamps + 1, 42.f);
+        std::vector<void*> outputs{&output_i[0], &output_q[0]};
+        planar_conv->conv(inputs[chan], outputs, nsamps);
+        for (size_t i = 0; i < nsamps; i++) {
+            MY_CHECK_CLOSE(expected[chan][i].real(), output_i[i], 1e-6f);
+            MY_CHECK_CLOSE(expected[chan][i].imag(), output_q[i], 1e-6f);
+        }
+        BOOST_CHECK_EQUAL(output_i[nsamps], 42.f);
+        BOOST_CHECK_EQUAL(output_q[nsamps], 42.f);
+    }
+
+    // chan_interleaved output, one converter for all channels
+    id.output_format = "fc32_chan_interleaved";
+    id.num_inputs    = num_chans;
+    id.num_outputs   = 1;
+    GET_CONVERTER_SAFE(interleaved_conv, id, prio);
+    interleaved_conv->set_scalar(1. / 32767.);
+    std::vector<fc32_t> output(num_chans * nsamps + 1, fc32_t(42.f, 42.f));
+    interleaved_conv->conv(inputs, &output[0], nsamps);
+    for (size_t i = 0; i < nsamps; i++) {
+        for (size_t chan = 0; chan < num_chans; chan++) {
+            const fc32_t& out = output[i * num_chans + chan];
+            MY_CHECK_CLOSE(expected[chan][i].real(), out.real(), 1e-6f);
+            MY_CHECK_CLOSE(expected[chan][i].imag(), out.imag(), 1e-6f);
+        }
+    }
+    BOOST_CHECK_EQUAL(output[num_chans * nsamps], fc32_t(42.f, 42.f));
+}
+
+MULTI_CONVERTER_TEST_CASE(test_convert_types_multi_buffer_fc32)
+{
+    for (const std::string input_format : {"sc16_chdr",
+             "sc16_item32_le",
+             "sc16_item32_be",
+             "sc12_item32_le",
+             "sc12_item32_be"}) {
+        for (const size_t num_chans : {1, 2, 3, 4, 5}) {
+            // try various offsets and lengths to test edge cases
+            for (size_t offset = 0; offset < 4; offset++) {
+                for (size_t nsamps = 1; nsamps < 35; nsamps++) {
+                    test_convert_multi_buffer_fc32(
+                        input_format, num_chans, offset, nsamps, conv_prio_type);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_convert_registry)
+{
+    convert::id_type id;
+    id.input_format  = "sc16_item32_le";
+    id.num_inputs    = 1;
+    id.output_format = "fc32";
+    id.num_outputs   = 1;
+
+    const auto ids = convert::get_converter_ids();
+    BOOST_CHECK(std::find(ids.begin(), ids.end(), id) != ids.end());
+
+    const auto prios = convert::get_converter_priorities(id);
+    BOOST_REQUIRE(!prios.empty());
+    BOOST_CHECK(std::is_sorted(prios.begin(), prios.end()));
+    for (const auto prio : prios) {
+        BOOST_CHECK(convert::get_converter(id, prio)());
+    }
+
+    id.output_format = "not_a_format";
+    BOOST_CHECK_THROW(convert::get_converter_priorities(id), uhd::key_error);
+}
@@ -0,0 +1,235 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/rfnoc/clock_iface.hpp>
+#include <uhdlib/rfnoc/ctrlport_endpoint.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace uhd::rfnoc;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr size_t BUFF_CAPACITY = 1024;
+
+/*!
+ * Mock device that responds to control requests from a thread of its own
+ *
+ * Every response is sent after a fixed latency, which stands in for the round
+ * trip to the device. Requests are handled in order, like ControlPort does.
+ * The mock keeps track of the number of requests in flight.
+ */
+class mock_ctrlport_device
+{
+public:
+    mock_ctrlport_device(std::chrono::microseconds latency) : _latency(latency)
+    {
+        _client_clk.set_running(true);
+        _timebase_clk.set_running(true);
+        _thread = std::thread([this]() { respond(); });
+    }
+
+    ~mock_ctrlport_device()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cond.notify_one();
+        _thread.join();
+    }
+
+    ctrlport_endpoint::sptr make_endpoint(size_t buff_capacity = BUFF_CAPACITY)
+    {
+        _endpoint = ctrlport_endpoint::make(
+            [this](const chdr::ctrl_payload& request, double) { enqueue(request); },
+            0, // my_epid
+            0, // local_port
+            buff_capacity,
+            0, // max_outstanding_async_msgs
+            _client_clk,
+            _timebase_clk);
+        return _endpoint;
+    }
+
+    size_t get_max_in_flight()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _max_in_flight;
+    }
+
+    //! Stop (or resume) responding to requests for \p addr
+    void set_silent(const uint32_t addr, const bool silent)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (silent) {
+            _silent_addrs.insert(addr);
+        } else {
+            _silent_addrs.erase(addr);
+        }
+    }
+
+    //! Register values
+    std::map<uint32_t, uint32_t> regs;
+
+private:
+    void enqueue(const chdr::ctrl_payload& request)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _requests.emplace_back(std::chrono::steady_clock::now() + _latency, request);
+        _max_in_flight = std::max(_max_in_flight, _requests.size());
+        _cond.notify_one();
+    }
+
+    void respond()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _cond.wait(lock, [this]() { return _stop || !_requests.empty(); });
+            if (_stop) {
+                return;
+            }
+            const auto due = _requests.front().first;
+            if (_cond.wait_until(lock, due, [this]() { return _stop; })) {
+                return;
+            }
+            chdr::ctrl_payload response = _requests.front().second;
+            _requests.pop_front();
+            if (_silent_addrs.count(response.address)) {
+                continue;
+            }
+            if (response.op_code == chdr::OP_WRITE) {
+                regs[response.address] = response.data_vtr[0];
+            } else if (response.op_code == chdr::OP_READ) {
+                response.data_vtr[0] = regs[response.address];
+            }
+            response.is_ack = true;
+            // The endpoint may send new requests from handle_recv()
+            lock.unlock();
+            _endpoint->handle_recv(response);
+            lock.lock();
+        }
+    }
+
+    const std::chrono::microseconds _latency;
+    clock_iface _client_clk{"client", 100e6};
+    clock_iface _timebase_clk{"timebase", 100e6};
+    ctrlport_endpoint::sptr _endpoint;
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::deque<std::pair<std::chrono::steady_clock::time_point, chdr::ctrl_payload>>
+        _requests;
+    size_t _max_in_flight = 0;
+    //! Requests for these addresses never get a response
+    std::set<uint32_t> _silent_addrs;
+    bool _stop            = false;
+    std::thread _thread;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_block_peek_poke_pipelined)
+{
+    mock_ctrlport_device device(2ms);
+    auto endpoint = device.make_endpoint();
+
+    constexpr size_t NUM_REGS = 16;
+    std::vector<uint32_t> values;
+    for (uint32_t i = 0; i < NUM_REGS; i++) {
+        values.push_back(0x1000 + i);
+    }
+    endpoint->block_poke32(0x100, values, uhd::time_spec_t::ASAP, true);
+    BOOST_CHECK_EQUAL(device.regs.at(0x100 + 4 * (NUM_REGS - 1)), values.back());
+
+    const auto start            = std::chrono::steady_clock::now();
+    std::vector<uint32_t> peeked = endpoint->block_peek32(0x100, NUM_REGS);
+    const auto duration         = std::chrono::steady_clock::now() - start;
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        values.begin(), values.end(), peeked.begin(), peeked.end());
+
+    // All requests were sent before the first response arrived
+    BOOST_CHECK_EQUAL(device.get_max_in_flight(), NUM_REGS);
+    // Sequential peeks would have taken NUM_REGS round trips
+    BOOST_CHECK(duration < NUM_REGS * 2ms);
+}
+
+BOOST_AUTO_TEST_CASE(test_async_peek_poke)
+{
+    mock_ctrlport_device device(500us);
+    auto endpoint = device.make_endpoint();
+
+    std::vector<std::future<void>> acks;
+    for (uint32_t i = 0; i < 8; i++) {
+        acks.push_back(endpoint->poke32_async(4 * i, i * i));
+    }
+    std::vector<std::future<uint32_t>> responses;
+    for (uint32_t i = 0; i < 8; i++) {
+        responses.push_back(endpoint->peek32_async(4 * i));
+    }
+    // Futures may be waited for in any order
+    for (size_t i = responses.size(); i > 0; i--) {
+        BOOST_CHECK_EQUAL(responses[i - 1].get(), (i - 1) * (i - 1));
+    }
+    for (auto& ack : acks) {
+        BOOST_CHECK_NO_THROW(ack.get());
+    }
+
+    // Responses of futures that are never waited for are discarded, and don't
+    // affect other transactions
+    endpoint->peek32_async(0);
+    auto ignored = endpoint->peek32_async(4);
+    BOOST_CHECK_EQUAL(endpoint->peek32(8), 4);
+    ignored = endpoint->peek32_async(12);
+    BOOST_CHECK_EQUAL(endpoint->peek32_async(16).get(), 16);
+}
+
+BOOST_AUTO_TEST_CASE(test_pipelined_flow_control)
+{
+    mock_ctrlport_device device(100us);
+    // Room for five read requests (3 words each)
+    auto endpoint = device.make_endpoint(16);
+
+    // More than the sequence numbers can tell apart
+    constexpr size_t NUM_REGS = 200;
+    for (uint32_t i = 0; i < NUM_REGS; i++) {
+        device.regs[4 * i] = ~i;
+    }
+    std::vector<uint32_t> peeked = endpoint->block_peek32(0, NUM_REGS);
+    BOOST_REQUIRE_EQUAL(peeked.size(), NUM_REGS);
+    for (uint32_t i = 0; i < NUM_REGS; i++) {
+        BOOST_CHECK_EQUAL(peeked[i], ~i);
+    }
+    BOOST_CHECK_EQUAL(device.get_max_in_flight(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_pipelined_timeout)
+{
+    mock_ctrlport_device device(100us);
+    auto endpoint = device.make_endpoint();
+    endpoint->set_policy("default", uhd::device_addr_t("timeout=0.05"));
+    device.set_silent(0x8, true);
+
+    auto lost = endpoint->peek32_async(0x8);
+    BOOST_CHECK_THROW(lost.get(), uhd::op_timeout);
+    // The response to the peek of 0xC tells the endpoint that the one of 0x8
+    // was dropped
+    BOOST_CHECK_THROW(endpoint->block_peek32(0x0, 4), uhd::op_seqerr);
+
+    // Once the device responds again, the endpoint recovers
+    device.set_silent(0x8, false);
+    BOOST_CHECK_EQUAL(endpoint->peek32_async(0x8).get(), 0);
+}
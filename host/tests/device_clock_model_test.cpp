@@ -0,0 +1,206 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/rfnoc/device_clock_model.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+using namespace uhd::rfnoc;
+using namespace std::chrono_literals;
+using clock_t_ = device_clock_model::clock_t;
+
+namespace {
+
+constexpr double TICK_RATE = 100e6;
+
+//! Simulated timekeeper, running at a slightly different rate than the host
+struct mock_timekeeper
+{
+    mock_timekeeper(const double freq_offset = 20e-6)
+        : rate(TICK_RATE * (1 + freq_offset))
+    {
+    }
+
+    uint64_t ticks_at(const clock_t_::time_point time) const
+    {
+        return start_ticks
+               + static_cast<uint64_t>(
+                   std::chrono::duration<double>(time - start_time).count() * rate);
+    }
+
+    //! Emulates a register read with a round trip of 2 * latency
+    uint64_t peek()
+    {
+        num_peeks++;
+        std::this_thread::sleep_for(latency);
+        const uint64_t ticks = ticks_at(clock_t_::now());
+        std::this_thread::sleep_for(latency);
+        return ticks;
+    }
+
+    device_clock_model::peek_fn_t peek_fn()
+    {
+        return [this]() { return peek(); };
+    }
+
+    const double rate;
+    clock_t_::time_point start_time = clock_t_::now();
+    uint64_t start_ticks            = 1000000;
+    clock_t_::duration latency      = 200us;
+    size_t num_peeks                = 0;
+};
+
+void check_estimate(const device_clock_model& model, const mock_timekeeper& tk)
+{
+    const auto now      = clock_t_::now();
+    const auto estimate = model.get_estimate(now);
+    BOOST_REQUIRE(estimate);
+    const double actual = static_cast<double>(tk.ticks_at(now));
+    BOOST_CHECK_LE(
+        std::abs(static_cast<double>(estimate->ticks) - actual), estimate->error + 1);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_clock_model_disabled)
+{
+    mock_timekeeper tk;
+    device_clock_model model;
+
+    // The model is disabled by default
+    BOOST_CHECK(!model.is_enabled());
+
+    // Without a tick rate, there is no model
+    model.set_tolerance(1.0);
+    BOOST_CHECK(model.is_enabled());
+    model.get_ticks_now(tk.peek_fn());
+    BOOST_CHECK(!model.get_estimate(clock_t_::now()));
+    model.get_ticks_now(tk.peek_fn());
+    BOOST_CHECK_EQUAL(tk.num_peeks, 2);
+
+    // Without a tolerance, every call reads the device
+    model.set_tick_rate(TICK_RATE);
+    model.set_tolerance(0.0);
+    BOOST_CHECK(!model.is_enabled());
+    for (size_t i = 0; i < 5; i++) {
+        model.get_ticks_now(tk.peek_fn());
+    }
+    BOOST_CHECK_EQUAL(tk.num_peeks, 7);
+    // ...but it still tracks the device time
+    check_estimate(model, tk);
+}
+
+BOOST_AUTO_TEST_CASE(test_clock_model_tolerance)
+{
+    mock_timekeeper tk;
+    // Fast reads, so the tick rate can be measured over a short time
+    tk.latency = 0us;
+    device_clock_model model;
+    model.set_tick_rate(TICK_RATE);
+    model.set_tolerance(5e-3);
+
+    const uint64_t first = model.get_ticks_now(tk.peek_fn());
+    BOOST_CHECK_EQUAL(tk.num_peeks, 1);
+    uint64_t last = first;
+    for (size_t i = 0; i < 100; i++) {
+        const uint64_t ticks = model.get_ticks_now(tk.peek_fn());
+        BOOST_CHECK_GE(ticks, first);
+        last = ticks;
+    }
+    BOOST_CHECK_EQUAL(tk.num_peeks, 1);
+    BOOST_CHECK_GT(last, first);
+    check_estimate(model, tk);
+
+    // The error grows with the time since the last read, beyond the tolerance
+    const auto error_now   = model.get_estimate(clock_t_::now())->error;
+    const auto error_later = model.get_estimate(clock_t_::now() + 10s)->error;
+    BOOST_CHECK_GT(error_later, error_now);
+    BOOST_CHECK_GT(error_later, 5e-3 * TICK_RATE);
+
+    // A second read narrows down the tick rate, so the error grows more slowly
+    std::this_thread::sleep_for(50ms);
+    model.set_tolerance(0.0);
+    model.get_ticks_now(tk.peek_fn());
+    check_estimate(model, tk);
+    BOOST_CHECK_LT(model.get_estimate(clock_t_::now() + 10s)->error, error_later);
+}
+
+BOOST_AUTO_TEST_CASE(test_clock_model_reset)
+{
+    mock_timekeeper tk;
+    device_clock_model model;
+    model.set_tick_rate(TICK_RATE);
+    model.set_tolerance(5e-3);
+
+    model.get_ticks_now(tk.peek_fn());
+    BOOST_REQUIRE(model.get_estimate(clock_t_::now()));
+
+    // After setting the time, the next call needs to read the device
+    tk.start_ticks = 0;
+    tk.start_time  = clock_t_::now();
+    model.reset();
+    BOOST_CHECK(!model.get_estimate(clock_t_::now()));
+    BOOST_CHECK_LT(model.get_ticks_now(tk.peek_fn()), 1000000);
+    BOOST_CHECK_EQUAL(tk.num_peeks, 2);
+    check_estimate(model, tk);
+
+    // Until the next PPS, the device time is unknown, so every call reads it
+    model.reset_at_next_pps();
+    for (size_t i = 0; i < 3; i++) {
+        model.get_ticks_now(tk.peek_fn());
+        BOOST_CHECK(!model.get_estimate(clock_t_::now()));
+    }
+    BOOST_CHECK_EQUAL(tk.num_peeks, 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_clock_model_inconsistent_read)
+{
+    mock_timekeeper tk;
+    device_clock_model model;
+    model.set_tick_rate(TICK_RATE);
+
+    model.get_ticks_now(tk.peek_fn());
+    // The device time is changed without going through the model. The next
+    // read contradicts the model and restarts it.
+    tk.start_ticks += 1000000;
+    model.get_ticks_now(tk.peek_fn());
+    check_estimate(model, tk);
+}
+
+BOOST_AUTO_TEST_CASE(test_clock_model_lower_bound)
+{
+    mock_timekeeper tk;
+    tk.latency = 5ms;
+    device_clock_model model;
+    model.set_tick_rate(TICK_RATE);
+
+    // Lower bounds alone don't make a model
+    model.add_lower_bound(tk.ticks_at(clock_t_::now()), clock_t_::now());
+    BOOST_CHECK(!model.get_estimate(clock_t_::now()));
+
+    // A slow read gives a large error...
+    model.get_ticks_now(tk.peek_fn());
+    const double read_error = model.get_estimate(clock_t_::now())->error;
+    BOOST_CHECK_GT(read_error, 4e-3 * TICK_RATE);
+
+    // ...which timestamps of received packets narrow down (the read sampled the
+    // device time halfway through, so this cuts off about half the interval)
+    const auto now = clock_t_::now();
+    model.add_lower_bound(tk.ticks_at(now) - 1000, now);
+    check_estimate(model, tk);
+    BOOST_CHECK_LT(model.get_estimate(clock_t_::now())->error, 0.75 * read_error);
+
+    // Timestamps from the past don't change anything
+    const auto error = model.get_estimate(now)->error;
+    model.add_lower_bound(tk.ticks_at(now) - 1000000, now);
+    BOOST_CHECK_EQUAL(model.get_estimate(now)->error, error);
+
+    // Timestamps that are ahead of the model invalidate it
+    model.add_lower_bound(tk.ticks_at(now) + 10000000, now);
+    BOOST_CHECK(!model.get_estimate(clock_t_::now()));
+}
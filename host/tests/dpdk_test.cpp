@@ -5,6 +5,35 @@
 //
 /**
  * Benchmark program to check performance of 2 simultaneous links
+ *
+ * Without NICs, this can run on a net_ring virtual device, using
+ * `dpdk_test --polling-mode --loopback --args=use_dpdk=1` and a config file
+ * like this:
+ *
+ *     [use_dpdk=1]
+ *     dpdk_vdev=net_ring0
+ *     dpdk_corelist=0,1,2
+ *     dpdk_mtu=9000
+ *
+ *     [dpdk_mac=<MAC address of net_ring0>]
+ *     dpdk_lcore = 1,2
+ *     dpdk_ipv4 = 192.168.10.1/24
+ *
+ * The MTU must fit the 8000 byte frames plus their headers. The MAC address of
+ * the vdev is logged (at trace level) when the port is initialized.
+ *
+ * Both links then use port 0, but end up on separate queues and lcores. Since
+ * each link receives its own packets, the last received sequence number is
+ * the acknowledgement of the TX window.
+ *
+ * With `--sink` on a net_null virtual device instead, both links send to the
+ * broadcast address (so no ARP is needed), and everything they send is
+ * dropped. The test then checks that the empty frames the device receives are
+ * discarded without leaking packet buffers.
+ *
+ * The unit tests run both modes on virtual devices without hugepages, see
+ * dpdk_test.conf.in. A NIC section can be keyed by dpdk_name=net_ring0 instead
+ * of the MAC address.
  */
 
 
@@ -19,6 +48,7 @@
 #include <sys/syscall.h>
 #include <sys/time.h>
 #include <unistd.h>
+#include <rte_mempool.h>
 #include <boost/program_options.hpp>
 #include <cstdio>
 #include <cstring>
@@ -62,6 +92,12 @@ struct dpdk_test_stats
 
 static void process_udp(int id, uint32_t* udp_data, struct dpdk_test_stats* stats)
 {
+    // Flow control only packets (see send_udp()) repeat the last sequence
+    // number, they are not dropped packets
+    if (udp_data[0] == stats[id].last_seqno) {
+        stats[id].last_ackno = udp_data[1];
+        return;
+    }
     if (udp_data[0] != stats[id].last_seqno + 1) {
         stats[id].lasts[stats[id].dropped_packets & 0xf] = stats[id].last_seqno;
         stats[id].drops[stats[id].dropped_packets & 0xf] = udp_data[0];
@@ -100,10 +136,13 @@ static void send_udp(uhd::transport::mock_send_transport::sptr& stream,
     }
 }
 
-static void bench(uhd::transport::mock_send_transport::sptr* tx_stream,
+//! Returns the number of links that dropped packets
+static int bench(uhd::transport::mock_send_transport::sptr* tx_stream,
     uhd::transport::mock_recv_transport::sptr* rx_stream,
     uint32_t nb_ports,
-    double timeout)
+    double timeout,
+    bool loopback,
+    uint64_t num_packets)
 {
     uint64_t total_xfer[NUM_PORTS];
     uint32_t id;
@@ -115,6 +154,7 @@ static void bench(uhd::transport::mock_send_transport::sptr* tx_stream,
         stats[id].last_ackno      = 0;
         stats[id].last_seqno      = 0;
         stats[id].dropped_packets = 0;
+        stats[id].tx_no_bufs      = 0;
         total_xfer[id]            = 0;
     }
     sleep(1);
@@ -125,7 +165,7 @@ static void bench(uhd::transport::mock_send_transport::sptr* tx_stream,
      */
     uint64_t total_received = 0;
     uint32_t consec_no_rx   = 0;
-    while ((total_received / nb_ports) < 1000000) { //&& consec_no_rx < 10000) {
+    while ((total_received / nb_ports) < num_packets) { //&& consec_no_rx < 10000) {
         for (id = 0; id < nb_ports; id++) {
             unsigned int nb_rx = 0;
             uhd::transport::frame_buff::uptr bufs[BURST_SIZE];
@@ -168,8 +208,8 @@ static void bench(uhd::transport::mock_send_transport::sptr* tx_stream,
 
         for (id = 0; id < nb_ports; id++) {
             /* TX portion */
-            uint32_t window_end = stats[id].last_ackno + TX_CREDITS;
-            // uint32_t window_end = last_seqno[port] + TX_CREDITS;
+            uint32_t window_end =
+                (loopback ? stats[id].last_seqno : stats[id].last_ackno) + TX_CREDITS;
             if (window_end <= stats[id].tx_seqno) {
                 if (consec_no_rx == 9999) {
                     send_udp(tx_stream[id], id, true, stats);
@@ -213,7 +253,73 @@ static void bench(uhd::transport::mock_send_transport::sptr* tx_stream,
         // printf("%d missed/dropped packets\n", errors);
         printf("\n");
     }
+    int status = 0;
+    for (id = 0; id < nb_ports; id++) {
+        if (stats[id].dropped_packets) {
+            status++;
+        }
+    }
     free(stats);
+    return status;
+}
+
+/*!
+ * Send packets into a sink (e.g., a net_null vdev), and check that nothing
+ * arrives on the links and that the RX packet buffers don't run out.
+ *
+ * \return the number of errors
+ */
+static int bench_sink(uhd::transport::mock_send_transport::sptr* tx_stream,
+    uhd::transport::mock_recv_transport::sptr* rx_stream,
+    uint32_t nb_ports,
+    uint64_t num_packets)
+{
+    auto ctx                 = uhd::transport::dpdk::dpdk_ctx::get();
+    struct rte_mempool* pool = ctx->get_port(0)->get_rx_pktbuf_pool();
+    uint64_t tx_no_bufs      = 0;
+    uint64_t unexpected_rx   = 0;
+    struct timeval bench_start, bench_end;
+    gettimeofday(&bench_start, NULL);
+    for (uint64_t pktno = 0; pktno < num_packets; pktno++) {
+        for (uint32_t id = 0; id < nb_ports; id++) {
+            // Wait long enough for the I/O thread to run on a busy CPU
+            uhd::transport::frame_buff::uptr buff = tx_stream[id]->get_data_buff(1000);
+            if (!buff) {
+                tx_no_bufs++;
+                continue;
+            }
+            uint32_t* tx_data;
+            size_t buff_size;
+            std::tie(tx_data, buff_size) = tx_stream[id]->buff_to_data(buff.get());
+            tx_data[0]                   = static_cast<uint32_t>(pktno);
+            memset(&tx_data[1], 0, 8 * BENCH_SPP);
+            tx_stream[id]->release_data_buff(buff, (4 + 8 * BENCH_SPP) / 4);
+
+            buff = rx_stream[id]->get_data_buff(0);
+            if (buff) {
+                unexpected_rx++;
+                rx_stream[id]->release_data_buff(std::move(buff));
+            }
+        }
+    }
+    gettimeofday(&bench_end, NULL);
+    const double elapsed_time = (bench_end.tv_sec - bench_start.tv_sec)
+                                + (bench_end.tv_usec - bench_start.tv_usec) * 1.0e-6;
+    printf("Benchmark complete\n\n");
+    printf("TX Performance = %e Gbps\n",
+        num_packets * nb_ports * 8.0 * BENCH_SPP * 8.0 / 1.0e9 / elapsed_time);
+    printf("Timeouts waiting for TX buffers = %lu\n", tx_no_bufs);
+    printf("Unexpected RX packets = %lu\n", unexpected_rx);
+
+    // The device keeps receiving. If the I/O service leaked what it discards,
+    // the pool would be empty by now.
+    const unsigned int pool_free = rte_mempool_avail_count(pool);
+    printf("RX packet buffers free = %u of %u\n", pool_free, pool->size);
+    int status = (tx_no_bufs > 0) + (unexpected_rx > 0);
+    if (pool_free < pool->size / 2) {
+        status++;
+    }
+    return status;
 }
 
 std::string get_ipv4_addr(unsigned int port_id)
@@ -226,11 +332,22 @@ std::string get_ipv4_addr(unsigned int port_id)
     return std::string(addr_str);
 }
 
-void prepare_and_bench_polling(void)
+std::string get_broadcast_addr(unsigned int port_id)
+{
+    auto ctx  = uhd::transport::dpdk::dpdk_ctx::get();
+    auto port = ctx->get_port(port_id);
+    auto ip   = port->get_ipv4() | ~port->get_netmask();
+    char addr_str[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &ip, addr_str, sizeof(addr_str));
+    return std::string(addr_str);
+}
+
+int prepare_and_bench_polling(bool loopback, bool sink, uint64_t num_packets)
 {
     auto ctx = uhd::transport::dpdk::dpdk_ctx::get();
 
     uhd::transport::udp_dpdk_link::sptr eth_data[NUM_PORTS];
+    uhd::transport::io_service::sptr io_srv[NUM_PORTS];
     uhd::transport::mock_send_transport::sptr tx_strm[NUM_PORTS];
     uhd::transport::mock_recv_transport::sptr rx_strm[NUM_PORTS];
     uhd::transport::link_params_t buff_args;
@@ -238,28 +355,38 @@ void prepare_and_bench_polling(void)
     buff_args.send_frame_size = 8000;
     buff_args.num_send_frames = 32;
     buff_args.num_recv_frames = 32;
-    auto dev_addr             = uhd::device_addr_t();
-    eth_data[0]               = uhd::transport::udp_dpdk_link::make(
-        0, get_ipv4_addr(1), "48888", "48888", buff_args);
-    eth_data[1] = uhd::transport::udp_dpdk_link::make(
-        1, get_ipv4_addr(0), "48888", "48888", buff_args);
-    auto io_srv0 = ctx->get_io_service(0);
-    io_srv0->attach_send_link(eth_data[0]);
-    io_srv0->attach_recv_link(eth_data[0]);
-    auto io_srv1 = ctx->get_io_service(1);
-    io_srv1->attach_send_link(eth_data[1]);
-    io_srv1->attach_recv_link(eth_data[1]);
-    tx_strm[0] = std::make_shared<uhd::transport::mock_send_transport>(
-        io_srv0, eth_data[0], eth_data[0], 0, 0, 32);
-    rx_strm[0] = std::make_shared<uhd::transport::mock_recv_transport>(
-        io_srv0, eth_data[0], eth_data[0], 1, 1, 32);
-    tx_strm[1] = std::make_shared<uhd::transport::mock_send_transport>(
-        io_srv1, eth_data[1], eth_data[1], 1, 1, 32);
-    rx_strm[1] = std::make_shared<uhd::transport::mock_recv_transport>(
-        io_srv1, eth_data[1], eth_data[1], 0, 0, 32);
-
+    for (unsigned int id = 0; id < NUM_PORTS; id++) {
+        // In loopback mode, both links are on port 0 and send to themselves.
+        // In sink mode, both links are on port 0 and send to the broadcast
+        // address. Otherwise, the links on ports 0 and 1 send to each other.
+        const bool single_port     = loopback || sink;
+        const unsigned int port_id = single_port ? 0 : id;
+        const unsigned int dst_id  = single_port ? 0 : (id + 1) % NUM_PORTS;
+        const std::string udp_port = std::to_string(48888 + (single_port ? id : 0));
+        const std::string dst_addr =
+            sink ? get_broadcast_addr(dst_id) : get_ipv4_addr(dst_id);
+        eth_data[id] = uhd::transport::udp_dpdk_link::make(
+            port_id, dst_addr, udp_port, udp_port, buff_args);
+        auto dpdk_io_srv = ctx->get_io_service(port_id, eth_data[id]->get_queue_id());
+        std::cout << "Link " << id << ": Port " << port_id << ", queue "
+                  << eth_data[id]->get_queue_id() << std::endl;
+        dpdk_io_srv->attach_send_link(eth_data[id]);
+        dpdk_io_srv->attach_recv_link(eth_data[id]);
+        io_srv[id] = dpdk_io_srv;
+    }
+    for (unsigned int id = 0; id < NUM_PORTS; id++) {
+        const uint16_t src_id = (loopback || sink) ? id : (id + 1) % NUM_PORTS;
+        // Nothing sends flow control messages back from a sink
+        tx_strm[id] = std::make_shared<uhd::transport::mock_send_transport>(
+            io_srv[id], eth_data[id], eth_data[id], id, id, 32, !sink);
+        rx_strm[id] = std::make_shared<uhd::transport::mock_recv_transport>(
+            io_srv[id], eth_data[id], eth_data[id], src_id, src_id, 32);
+    }
 
-    bench(tx_strm, rx_strm, NUM_PORTS, 0.0);
+    if (sink) {
+        return bench_sink(tx_strm, rx_strm, NUM_PORTS, num_packets);
+    }
+    return bench(tx_strm, rx_strm, NUM_PORTS, 0.0, loopback, num_packets);
 }
 
 int main(int argc, char** argv)
@@ -267,10 +394,18 @@ int main(int argc, char** argv)
     int status = 0;
     std::string args;
     std::string cpusets;
+    uint64_t num_packets;
     po::options_description desc("Allowed options");
     desc.add_options()("help", "help message")("args",
         po::value<std::string>(&args)->default_value(""),
-        "UHD-DPDK args")("polling-mode", "Use polling mode (single thread on own core)");
+        "UHD-DPDK args")("polling-mode", "Use polling mode (single thread on own core)")(
+        "loopback",
+        "Run both links on port 0, each sending to itself (e.g., on a net_ring vdev)")(
+        "sink",
+        "Run both links on port 0, sending to the broadcast address (e.g., on a "
+        "net_null vdev)")("packets",
+        po::value<uint64_t>(&num_packets)->default_value(1000000),
+        "Number of packets per link");
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
     po::notify(vm);
@@ -286,7 +421,8 @@ int main(int argc, char** argv)
     ctx->init(args);
 
     if (vm.count("polling-mode")) {
-        prepare_and_bench_polling();
+        status = prepare_and_bench_polling(
+            vm.count("loopback") > 0, vm.count("sink") > 0, num_packets);
     }
     return status;
 }
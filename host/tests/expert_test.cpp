@@ -11,6 +11,7 @@
 #include <boost/format.hpp>
 #include <boost/test/unit_test.hpp>
 #include <fstream>
+#include <functional>
 #include <memory>
 
 using namespace uhd::experts;
@@ -142,6 +143,44 @@ private:
 
 //=============================================================================
 
+//! Computes out = f(in1, in2) and counts how often it was resolved
+class counting_worker_t : public worker_node_t
+{
+public:
+    counting_worker_t(const node_retriever_t& db,
+        const std::string& in1,
+        const std::string& in2,
+        const std::string& out,
+        std::function<int(int, int)> func,
+        std::shared_ptr<int> count)
+        : worker_node_t(in1 + "," + in2 + "->" + out)
+        , _in1(db, in1)
+        , _in2(db, in2)
+        , _out(db, out)
+        , _func(func)
+        , _count(count)
+    {
+        bind_accessor(_in1);
+        bind_accessor(_in2);
+        bind_accessor(_out);
+    }
+
+private:
+    void resolve() override
+    {
+        _out = _func(_in1, _in2);
+        (*_count)++;
+    }
+
+    data_reader_t<int> _in1;
+    data_reader_t<int> _in2;
+    data_writer_t<int> _out;
+    std::function<int(int, int)> _func;
+    std::shared_ptr<int> _count;
+};
+
+//=============================================================================
+
 #define DUMP_VARS                                                                     \
     BOOST_TEST_MESSAGE(str(                                                           \
         boost::format(                                                                \
@@ -274,3 +313,112 @@ BOOST_AUTO_TEST_CASE(test_experts)
     nodeA.mark_clean();
     BOOST_CHECK(!nodeA.is_dirty());
 }
+
+BOOST_AUTO_TEST_CASE(test_experts_partial_resolve)
+{
+    expert_container::sptr container = expert_factory::create_container("partial");
+
+    // X, Y and Z are inputs. P = X + Z, Q = Y * Z, R = Y - P. P and R share no
+    // inputs with each other, but Q and R both consume Y.
+    expert_factory::add_data_node<int>(container, "X", 1);
+    expert_factory::add_data_node<int>(container, "Y", 2);
+    expert_factory::add_data_node<int>(container, "Z", 3);
+    expert_factory::add_data_node<int>(container, "P", 0);
+    expert_factory::add_data_node<int>(container, "Q", 0);
+    expert_factory::add_data_node<int>(container, "R", 0);
+
+    auto p_count = std::make_shared<int>(0);
+    auto q_count = std::make_shared<int>(0);
+    auto r_count = std::make_shared<int>(0);
+    expert_factory::add_worker_node<counting_worker_t>(container,
+        container->node_retriever(),
+        "X",
+        "Z",
+        "P",
+        std::plus<int>(),
+        p_count);
+    expert_factory::add_worker_node<counting_worker_t>(container,
+        container->node_retriever(),
+        "Y",
+        "Z",
+        "Q",
+        std::multiplies<int>(),
+        q_count);
+    expert_factory::add_worker_node<counting_worker_t>(container,
+        container->node_retriever(),
+        "Y",
+        "P",
+        "R",
+        std::minus<int>(),
+        r_count);
+
+    auto get_node = [&](const std::string& name) -> data_node_t<int>& {
+        return *(const_cast<data_node_t<int>*>(dynamic_cast<const data_node_t<int>*>(
+            &container->node_retriever().lookup(name))));
+    };
+    data_node_t<int>& nodeX = get_node("X");
+    data_node_t<int>& nodeY = get_node("Y");
+    data_node_t<int>& nodeP = get_node("P");
+    data_node_t<int>& nodeQ = get_node("Q");
+    data_node_t<int>& nodeR = get_node("R");
+
+    container->resolve_all();
+    BOOST_CHECK_EQUAL(nodeP.get(), 4);
+    BOOST_CHECK_EQUAL(nodeQ.get(), 6);
+    BOOST_CHECK_EQUAL(nodeR.get(), -2);
+    BOOST_CHECK_EQUAL(*p_count, 1);
+    BOOST_CHECK_EQUAL(*q_count, 1);
+    BOOST_CHECK_EQUAL(*r_count, 1);
+
+    // Only workers downstream of X may run
+    nodeX.set(10);
+    container->resolve_from("X");
+    BOOST_CHECK_EQUAL(nodeP.get(), 13);
+    BOOST_CHECK_EQUAL(nodeR.get(), -11);
+    BOOST_CHECK_EQUAL(*p_count, 2);
+    BOOST_CHECK_EQUAL(*q_count, 1);
+    BOOST_CHECK_EQUAL(*r_count, 2);
+
+    // Resolving Q consumes Y, so R (which also reads Y) must be updated too
+    nodeY.set(5);
+    container->resolve_to("Q");
+    BOOST_CHECK_EQUAL(nodeQ.get(), 15);
+    BOOST_CHECK_EQUAL(nodeR.get(), -8);
+    BOOST_CHECK_EQUAL(*p_count, 2);
+    BOOST_CHECK_EQUAL(*q_count, 2);
+    BOOST_CHECK_EQUAL(*r_count, 3);
+    BOOST_CHECK(!nodeY.is_dirty());
+
+    // Nothing to do if the target is up to date
+    container->resolve_to("R");
+    BOOST_CHECK_EQUAL(*q_count, 2);
+    BOOST_CHECK_EQUAL(*r_count, 3);
+
+    // Nodes that were changed without resolving are picked up by the next
+    // resolve_from(), even if they're not downstream of the named node
+    nodeX.set(20);
+    nodeY.set(1);
+    container->resolve_from("Y");
+    BOOST_CHECK_EQUAL(nodeP.get(), 23);
+    BOOST_CHECK_EQUAL(nodeQ.get(), 3);
+    BOOST_CHECK_EQUAL(nodeR.get(), -22);
+    BOOST_CHECK_EQUAL(*p_count, 3);
+    BOOST_CHECK_EQUAL(*q_count, 3);
+    BOOST_CHECK_EQUAL(*r_count, 4);
+
+    // Adding nodes must refresh the cached graph structure
+    auto s_count = std::make_shared<int>(0);
+    expert_factory::add_data_node<int>(container, "S", 0);
+    expert_factory::add_worker_node<counting_worker_t>(container,
+        container->node_retriever(),
+        "Q",
+        "R",
+        "S",
+        std::plus<int>(),
+        s_count);
+    nodeY.set(2);
+    container->resolve_to("S");
+    BOOST_CHECK_EQUAL(get_node("S").get(), 6 + (2 - 23));
+    BOOST_CHECK_EQUAL(*s_count, 1);
+    BOOST_CHECK_EQUAL(*p_count, 3);
+}
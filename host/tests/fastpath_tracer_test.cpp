@@ -0,0 +1,163 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/utils/fastpath_tracer.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace uhd::log;
+
+BOOST_AUTO_TEST_CASE(test_fastpath_record)
+{
+    fastpath_tracer tracer;
+    BOOST_CHECK(tracer.read_events().empty());
+
+    tracer.record('O', 1, uint64_t(1000));
+    tracer.record('U', fastpath_event_t::NO_CHANNEL);
+    tracer.record('O', 2);
+
+    std::string codes;
+    BOOST_CHECK_EQUAL(
+        tracer.drain([&](const fastpath_event_t& event) { codes.push_back(event.code); }),
+        3);
+    BOOST_CHECK_EQUAL(codes, "OUO");
+    // Nothing new to drain, but the events are kept for read_events()
+    BOOST_CHECK_EQUAL(tracer.drain(), 0);
+
+    const auto events = tracer.read_events();
+    BOOST_REQUIRE_EQUAL(events.size(), 3);
+    BOOST_CHECK_EQUAL(events[0].code, 'O');
+    BOOST_CHECK_EQUAL(events[0].channel, 1);
+    BOOST_CHECK(events[0].has_device_ticks);
+    BOOST_CHECK_EQUAL(events[0].device_ticks, 1000);
+    BOOST_CHECK_EQUAL(events[1].code, 'U');
+    BOOST_CHECK_EQUAL(events[1].channel, fastpath_event_t::NO_CHANNEL);
+    BOOST_CHECK(!events[1].has_device_ticks);
+    BOOST_CHECK_EQUAL(events[2].channel, 2);
+    BOOST_CHECK_LE(events[0].host_tsc, events[2].host_tsc);
+    BOOST_CHECK(tracer.read_events().empty());
+
+    const auto counters = tracer.get_counters();
+    BOOST_CHECK_EQUAL(counters.num_events.size(), 2);
+    BOOST_CHECK_EQUAL(counters.num_events.at('O'), 2);
+    BOOST_CHECK_EQUAL(counters.num_events.at('U'), 1);
+    BOOST_CHECK_EQUAL(counters.num_dropped, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_fastpath_overflow)
+{
+    constexpr size_t NUM_EXTRA = 10;
+    fastpath_tracer tracer;
+
+    for (size_t i = 0; i < fastpath_tracer::RING_SIZE + NUM_EXTRA; i++) {
+        tracer.record('O', 0, uint64_t(i));
+    }
+    auto counters = tracer.get_counters();
+    BOOST_CHECK_EQUAL(
+        counters.num_events.at('O'), fastpath_tracer::RING_SIZE + NUM_EXTRA);
+    BOOST_CHECK_EQUAL(counters.num_dropped, NUM_EXTRA);
+
+    // The newest events were dropped
+    const auto events = tracer.read_events();
+    BOOST_REQUIRE_EQUAL(events.size(), fastpath_tracer::RING_SIZE);
+    BOOST_CHECK_EQUAL(events.back().device_ticks, fastpath_tracer::RING_SIZE - 1);
+
+    // Once drained, there is room again
+    tracer.record('D', 0);
+    BOOST_CHECK_EQUAL(tracer.drain(), 1);
+    BOOST_CHECK_EQUAL(tracer.get_counters().num_dropped, NUM_EXTRA);
+}
+
+BOOST_AUTO_TEST_CASE(test_fastpath_history)
+{
+    constexpr size_t HISTORY_SIZE = 8;
+    fastpath_tracer tracer(HISTORY_SIZE);
+
+    for (size_t i = 0; i < 2 * HISTORY_SIZE; i++) {
+        tracer.record('S', 0, uint64_t(i));
+        if (i % 3 == 0) {
+            tracer.drain();
+        }
+    }
+    // Only the most recent events are kept
+    const auto events = tracer.read_events();
+    BOOST_REQUIRE_EQUAL(events.size(), HISTORY_SIZE);
+    for (size_t i = 0; i < HISTORY_SIZE; i++) {
+        BOOST_CHECK_EQUAL(events[i].device_ticks, HISTORY_SIZE + i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_fastpath_threads)
+{
+    constexpr size_t NUM_THREADS = 4;
+    constexpr size_t NUM_EVENTS  = 10000;
+    fastpath_tracer tracer(0);
+
+    // Drain concurrently, like the logger does
+    std::atomic<bool> done{false};
+    std::vector<std::vector<uint64_t>> ticks(NUM_THREADS);
+    std::thread consumer([&]() {
+        const auto collect = [&](const fastpath_event_t& event) {
+            ticks.at(event.channel).push_back(event.device_ticks);
+        };
+        while (!done) {
+            tracer.drain(collect);
+            std::this_thread::yield();
+        }
+        tracer.drain(collect);
+    });
+
+    std::vector<std::thread> producers;
+    for (size_t chan = 0; chan < NUM_THREADS; chan++) {
+        producers.emplace_back([&tracer, chan]() {
+            for (size_t i = 0; i < NUM_EVENTS; i++) {
+                tracer.record('O', static_cast<uint32_t>(chan), uint64_t(i));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    done = true;
+    consumer.join();
+
+    // Every thread's events arrive in order. Events may have been dropped if
+    // the consumer fell behind, but the counters account for them.
+    const auto counters = tracer.get_counters();
+    BOOST_CHECK_EQUAL(counters.num_events.at('O'), NUM_THREADS * NUM_EVENTS);
+    size_t num_received = 0;
+    for (const auto& chan_ticks : ticks) {
+        for (size_t i = 1; i < chan_ticks.size(); i++) {
+            BOOST_CHECK_LT(chan_ticks[i - 1], chan_ticks[i]);
+        }
+        num_received += chan_ticks.size();
+    }
+    BOOST_CHECK_EQUAL(num_received + counters.num_dropped, NUM_THREADS * NUM_EVENTS);
+}
+
+BOOST_AUTO_TEST_CASE(test_fastpath_multiple_tracers)
+{
+    auto tracer0 = std::make_unique<fastpath_tracer>();
+    fastpath_tracer tracer1;
+
+    tracer0->record('O', 0);
+    tracer1.record('U', 1);
+    tracer0->record('O', 0);
+    BOOST_CHECK_EQUAL(tracer0->read_events().size(), 2);
+    BOOST_CHECK_EQUAL(tracer1.read_events().size(), 1);
+
+    // A new tracer gets a new ring
+    tracer0 = std::make_unique<fastpath_tracer>();
+    tracer0->record('L', 0);
+    const auto events = tracer0->read_events();
+    BOOST_REQUIRE_EQUAL(events.size(), 1);
+    BOOST_CHECK_EQUAL(events[0].code, 'L');
+    BOOST_CHECK_EQUAL(tracer0->get_counters().num_events.size(), 1);
+}
@@ -0,0 +1,195 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/transport/buffer_pool.hpp>
+#include <uhdlib/transport/io_uring_io_service.hpp>
+#include <uhdlib/transport/io_uring_recv_ring.hpp>
+#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <boost/asio.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <iostream>
+
+using namespace uhd::transport;
+namespace asio = boost::asio;
+
+constexpr size_t FRAME_SIZE = 1024;
+constexpr size_t NUM_FRAMES = 32;
+
+namespace {
+
+//! Checks if the kernel lets us use io_uring (it may be disabled by a sysctl
+//  or a seccomp filter)
+bool io_uring_available()
+{
+    int fds[2];
+    UHD_ASSERT_THROW(::socketpair(AF_UNIX, SOCK_DGRAM, 0, fds) == 0);
+    auto pool = buffer_pool::make(1, FRAME_SIZE);
+    bool available = true;
+    try {
+        io_uring_recv_ring ring(fds[0],
+            FRAME_SIZE,
+            {{pool->at(0), FRAME_SIZE}},
+            {pool->at(0)},
+            1);
+    } catch (const uhd::os_error& ex) {
+        std::cout << "io_uring is not available, skipping: " << ex.what() << std::endl;
+        available = false;
+    }
+    ::close(fds[0]);
+    ::close(fds[1]);
+    return available;
+}
+
+void send_seq(int fd, uint32_t seq, size_t len)
+{
+    uint8_t buf[FRAME_SIZE];
+    std::memset(buf, static_cast<int>(seq & 0xff), len);
+    std::memcpy(buf, &seq, sizeof(seq));
+    UHD_ASSERT_THROW(::send(fd, buf, len, 0) == static_cast<ssize_t>(len));
+}
+
+void check_seq(const void* mem, size_t len, uint32_t seq, size_t expected_len)
+{
+    BOOST_REQUIRE_EQUAL(len, expected_len);
+    uint32_t recvd_seq;
+    std::memcpy(&recvd_seq, mem, sizeof(recvd_seq));
+    BOOST_CHECK_EQUAL(recvd_seq, seq);
+    BOOST_CHECK_EQUAL(
+        static_cast<const uint8_t*>(mem)[len - 1], static_cast<uint8_t>(seq & 0xff));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_recv_ring)
+{
+    if (!io_uring_available()) {
+        return;
+    }
+
+    int fds[2];
+    UHD_ASSERT_THROW(::socketpair(AF_UNIX, SOCK_DGRAM, 0, fds) == 0);
+
+    // Post half of the blocks, like a link that has all frames checked out
+    auto pool = buffer_pool::make(2 * NUM_FRAMES, FRAME_SIZE);
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < pool->size(); i++) {
+        blocks.push_back(pool->at(i));
+    }
+    const iovec region = {pool->at(0),
+        size_t(static_cast<char*>(pool->at(pool->size() - 1))
+               - static_cast<char*>(pool->at(0)))
+            + FRAME_SIZE};
+    {
+        io_uring_recv_ring ring(fds[0], FRAME_SIZE, {region}, blocks, NUM_FRAMES);
+
+        void* mem;
+        BOOST_CHECK_EQUAL(ring.recv(mem, 0), 0);
+        BOOST_CHECK_EQUAL(ring.recv(mem, 10), 0);
+
+        // Send more datagrams than there are posted blocks, in bursts, so both
+        // single and batched completions get exercised
+        uint32_t tx_seq = 0, rx_seq = 0;
+        for (size_t burst : {size_t(1), size_t(5), NUM_FRAMES / 2, NUM_FRAMES}) {
+            for (size_t i = 0; i < burst; i++) {
+                send_seq(fds[1], tx_seq, 16 + (tx_seq % 1000));
+                tx_seq++;
+            }
+            for (size_t i = 0; i < burst; i++) {
+                const size_t len = ring.recv(mem, 1000);
+                check_seq(mem, len, rx_seq, 16 + (rx_seq % 1000));
+                rx_seq++;
+                ring.post(mem);
+            }
+        }
+        BOOST_CHECK_EQUAL(ring.recv(mem, 0), 0);
+
+        // Destroying the ring with a datagram pending must not hang
+        send_seq(fds[1], tx_seq, 100);
+    }
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+BOOST_AUTO_TEST_CASE(test_io_service_udp)
+{
+    link_params_t params;
+    params.num_recv_frames = NUM_FRAMES;
+    params.num_send_frames = NUM_FRAMES;
+    params.recv_frame_size = FRAME_SIZE;
+    params.send_frame_size = FRAME_SIZE;
+    params.recv_buff_size  = NUM_FRAMES * FRAME_SIZE * 4;
+    params.send_buff_size  = NUM_FRAMES * FRAME_SIZE * 4;
+
+    // The "device" end of the link
+    asio::io_context io_context;
+    asio::ip::udp::socket dev_sock(
+        io_context, asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 0));
+
+    size_t recv_buff_size, send_buff_size;
+    auto link = udp_boost_asio_link::make("127.0.0.1",
+        std::to_string(dev_sock.local_endpoint().port()),
+        params,
+        recv_buff_size,
+        send_buff_size);
+    dev_sock.connect(asio::ip::udp::endpoint(
+        asio::ip::address_v4::loopback(), link->get_local_port()));
+
+    // Falls back to regular receives if io_uring is not available, so this
+    // test runs either way
+    auto io_srv = io_uring_io_service::make();
+    io_srv->attach_recv_link(link);
+    io_srv->attach_send_link(link);
+
+    auto recv_cb = [](frame_buff::uptr&, recv_link_if*, send_link_if*) { return true; };
+    auto fc_cb   = [](frame_buff::uptr buff, recv_link_if* recv_link, send_link_if*) {
+        recv_link->release_recv_buff(std::move(buff));
+    };
+    auto client = io_srv->make_recv_client(link, NUM_FRAMES, recv_cb, nullptr, 0, fc_cb);
+
+    BOOST_CHECK(!client->get_recv_buff(0));
+
+    // Loop several times over the frames, holding up to half of them at a time
+    uint32_t tx_seq = 0, rx_seq = 0;
+    std::vector<frame_buff::uptr> held;
+    for (size_t round = 0; round < 8; round++) {
+        for (size_t i = 0; i < NUM_FRAMES; i++) {
+            send_seq(dev_sock.native_handle(), tx_seq, 64 + tx_seq);
+            tx_seq++;
+        }
+        for (size_t i = 0; i < NUM_FRAMES; i++) {
+            auto buff = client->get_recv_buff(1000);
+            BOOST_REQUIRE(buff);
+            check_seq(buff->data(), buff->packet_size(), rx_seq, 64 + rx_seq);
+            rx_seq++;
+            held.push_back(std::move(buff));
+            if (held.size() == NUM_FRAMES / 2) {
+                for (auto& b : held) {
+                    client->release_recv_buff(std::move(b));
+                }
+                held.clear();
+            }
+        }
+    }
+    for (auto& b : held) {
+        client->release_recv_buff(std::move(b));
+    }
+
+    client.reset();
+    io_srv->detach_recv_link(link);
+    io_srv->detach_send_link(link);
+
+    // The link keeps working after going back to regular receives
+    send_seq(dev_sock.native_handle(), tx_seq, 64);
+    auto buff = link->get_recv_buff(1000);
+    BOOST_REQUIRE(buff);
+    check_seq(buff->data(), buff->packet_size(), tx_seq, 64);
+    link->release_recv_buff(std::move(buff));
+}
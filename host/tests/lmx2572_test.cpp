@@ -142,3 +142,89 @@ BOOST_AUTO_TEST_CASE(lmx_sync_tune_test)
     // VCO_PHASE_SYNC_EN must be on in this case
     BOOST_CHECK(mem.mem[0] & (1 << 14));
 }
+
+BOOST_AUTO_TEST_CASE(lmx_freq_image_test)
+{
+    // Mimick ZBX settings on two identical LOs: One gets tuned using
+    // precomputed images, the other one the regular way.
+    auto mem_img         = lmx2572_mem{};
+    auto mem_ref         = lmx2572_mem{};
+    size_t num_img_pokes = 0;
+    auto lo_img          = lmx2572_iface::make(
+        [&](const uint8_t addr, const uint16_t data) {
+            num_img_pokes++;
+            mem_img.poke16(addr, data);
+        },
+        [&](const uint8_t addr) -> uint16_t { return mem_img.peek16(addr); },
+        [](const uhd::time_spec_t&) {});
+    auto lo_ref = lmx2572_iface::make(
+        [&](const uint8_t addr, const uint16_t data) { mem_ref.poke16(addr, data); },
+        [&](const uint8_t addr) -> uint16_t { return mem_ref.peek16(addr); },
+        [](const uhd::time_spec_t&) {});
+    for (auto& lo : {lo_img, lo_ref}) {
+        lo->reset();
+        lo->set_sync_mode(true);
+        lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, true);
+        lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, false);
+        lo->commit();
+    }
+    constexpr double fOSC = 64e6;
+    // Cover all sync categories, integer and fractional N
+    const std::vector<double> freqs{50 * fOSC,
+        100 * fOSC,
+        40 * fOSC,
+        10 * fOSC,
+        50.5 * fOSC,
+        50.5 * fOSC / 2,
+        4.1e9 + 12345.0,
+        1.2e9 + 7.0,
+        250e6};
+
+    // Computing images must neither touch the device nor the register cache
+    const auto regs_before = mem_img.mem;
+    num_img_pokes          = 0;
+    std::vector<lmx2572_iface::freq_image_t> images;
+    for (const double freq : freqs) {
+        images.push_back(lo_img->compute_frequency_image(freq, fOSC, false));
+    }
+    BOOST_CHECK_EQUAL(num_img_pokes, 0);
+    lo_img->commit();
+    // Only R0 is rewritten by commit(), nothing changed in the cache
+    BOOST_CHECK_EQUAL(num_img_pokes, 1);
+    BOOST_CHECK(mem_img.mem == regs_before);
+
+    // Hop back and forth: Images must always produce the same device state as
+    // set_frequency(), regardless of the previous frequency
+    for (const size_t idx : {0, 1, 2, 3, 4, 5, 6, 7, 8, 3, 0, 6, 2, 8, 4, 1}) {
+        const double freq = lo_ref->set_frequency(freqs[idx], fOSC, false);
+        lo_ref->commit();
+        BOOST_CHECK_EQUAL(lo_img->set_frequency_image(images[idx]), freq);
+        lo_img->commit();
+        BOOST_CHECK(mem_img.mem == mem_ref.mem);
+    }
+
+    // Re-applying the current image only needs the R0 write
+    num_img_pokes = 0;
+    lo_img->set_frequency_image(images[1]);
+    lo_img->commit();
+    BOOST_CHECK_EQUAL(num_img_pokes, 1);
+
+    // Output enables are not part of the images, changing them does not
+    // require new images
+    for (auto& lo : {lo_img, lo_ref}) {
+        lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_A, false);
+        lo->set_output_enable(lmx2572_iface::output_t::RF_OUTPUT_B, true);
+        lo->commit();
+    }
+    for (const size_t idx : {3, 4, 0, 5}) {
+        const double freq = lo_ref->set_frequency(freqs[idx], fOSC, false);
+        lo_ref->commit();
+        BOOST_CHECK_EQUAL(lo_img->set_frequency_image(images[idx]), freq);
+        lo_img->commit();
+        BOOST_CHECK(mem_img.mem == mem_ref.mem);
+    }
+
+    // Invalid frequencies are reported just like with set_frequency()
+    BOOST_CHECK_THROW(
+        lo_img->compute_frequency_image(10e9, fOSC, false), uhd::value_error);
+}
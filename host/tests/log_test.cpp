@@ -9,6 +9,7 @@
 #include <uhd/utils/log.hpp>
 #include <uhd/utils/log_add.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <iostream>
 
 BOOST_AUTO_TEST_CASE(test_messages)
@@ -41,3 +42,26 @@ BOOST_AUTO_TEST_CASE(test_throw)
 {
     BOOST_CHECK_THROW(log_with_throw(), uhd::runtime_error);
 }
+
+#ifndef UHD_LOG_FASTPATH_DISABLE
+BOOST_AUTO_TEST_CASE(test_fastpath_events)
+{
+    const auto num_overruns = []() {
+        const auto counters = uhd::log::get_fastpath_counters();
+        return counters.num_events.count('O') ? counters.num_events.at('O') : 0;
+    };
+    const uint64_t num_overruns_before = num_overruns();
+    UHD_LOG_FASTPATH_EVENT('O', 3, uint64_t(1234));
+    BOOST_CHECK_EQUAL(num_overruns(), num_overruns_before + 1);
+
+    // The logger may have drained the event already, but it is still there
+    const auto events = uhd::log::read_fastpath_events();
+    const auto event =
+        std::find_if(events.begin(), events.end(), [](const auto& event) {
+            return event.code == 'O' && event.channel == 3;
+        });
+    BOOST_REQUIRE(event != events.end());
+    BOOST_CHECK(event->has_device_ticks);
+    BOOST_CHECK_EQUAL(event->device_ticks, 1234);
+}
+#endif
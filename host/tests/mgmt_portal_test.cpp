@@ -0,0 +1,564 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "common/mock_link.hpp"
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/rfnoc/chdr_ctrl_xport.hpp>
+#include <uhdlib/rfnoc/chdr_packet_writer.hpp>
+#include <uhdlib/rfnoc/mgmt_portal.hpp>
+#include <uhdlib/rfnoc/topo_graph.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/utils/paths.hpp>
+#include <stdlib.h> // setenv or _putenv
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <set>
+#include <string>
+#include <memory>
+#include <vector>
+
+using namespace uhd;
+using namespace uhd::rfnoc;
+using namespace uhd::rfnoc::chdr;
+using namespace uhd::rfnoc::detail;
+using namespace uhd::transport;
+namespace fs = boost::filesystem;
+
+namespace {
+
+constexpr size_t FRAME_SIZE                 = 8000;
+constexpr size_t NUM_FRAMES                 = 64;
+constexpr uint16_t PROTOVER                 = 0x0100;
+constexpr device_id_t HOST_DEVICE_ID        = 1;
+constexpr device_id_t DEVICE_ID             = 2;
+constexpr sep_id_t HOST_EPID                = 1;
+constexpr size_t NUM_XBAR_XPORTS            = 3;
+constexpr size_t NUM_SEPS                   = 4;
+constexpr topo_edge_t::port_t NO_OUTPUT     = -1;
+constexpr topo_edge_t::port_t NOT_CONNECTED = -2;
+
+using node_type = topo_node_t::node_type;
+
+/*!
+ * Simulates the management packet handling of a device with one crossbar.
+ *
+ * The host is connected to a transport, which is attached to crossbar port 0.
+ * The other transport ports of the crossbar are not connected. The stream
+ * endpoints are attached to the remaining crossbar ports.
+ */
+class mock_mgmt_device
+{
+public:
+    mock_mgmt_device(const chdr_packet_factory& pkt_factory,
+        mock_send_link::sptr send_link,
+        const bool reverse_responses = false)
+        : _pkt_factory(pkt_factory)
+        , _send_link(send_link)
+        , _reverse_responses(reverse_responses)
+    {
+        _nodes.push_back(topo_node_t(DEVICE_ID, node_type::XPORT, 0, 0));
+        _nodes.push_back(topo_node_t(DEVICE_ID,
+            node_type::XBAR,
+            0,
+            (NUM_XBAR_XPORTS << 8) | (NUM_XBAR_XPORTS + NUM_SEPS)));
+        for (size_t i = 0; i < NUM_SEPS; i++) {
+            _nodes.push_back(topo_node_t(
+                DEVICE_ID, node_type::STRM_EP, static_cast<sep_inst_t>(i), 3));
+        }
+    }
+
+    //! Process all packets sent by the host, return the responses
+    std::list<std::pair<boost::shared_array<uint8_t>, size_t>> process()
+    {
+        std::list<std::pair<boost::shared_array<uint8_t>, size_t>> responses;
+        const size_t num_packets = _send_link->get_num_packets();
+        max_pipelined_xacts      = std::max(max_pipelined_xacts, num_packets);
+        for (size_t i = 0; i < num_packets; i++) {
+            auto packet = _send_link->pop_send_packet();
+            num_xacts++;
+            auto response = _process_packet(packet.first.get());
+            if (response.first) {
+                // Read the tag back from the serialized response
+                auto resp_pkt = _pkt_factory.make_mgmt();
+                resp_pkt->refresh(response.first.get());
+                mgmt_payload resp_payload;
+                resp_payload.set_header(0, PROTOVER, _pkt_factory.get_chdr_w());
+                resp_pkt->fill_payload(resp_payload);
+                response_tags.push_back(
+                    resp_payload.get_hop(resp_payload.get_num_hops() - 1)
+                        .get_op(0)
+                        .get_op_payload());
+                if (_reverse_responses) {
+                    responses.push_front(response);
+                } else {
+                    responses.push_back(response);
+                }
+            } else {
+                num_dropped_xacts++;
+            }
+        }
+        return responses;
+    }
+
+    size_t num_xacts           = 0;
+    size_t num_dropped_xacts   = 0;
+    size_t max_pipelined_xacts = 0;
+    //! Number of stream endpoint discovery responses to lose on the way back
+    size_t num_sep_responses_to_lose = 0;
+    //! Payloads of the NOP operations of the return hops the host sent
+    std::vector<mgmt_op_t::payload_t> request_tags;
+    //! Payloads of the NOP operations of the return hops we sent back
+    std::vector<mgmt_op_t::payload_t> response_tags;
+
+private:
+    // Index of the transport and the crossbar in _nodes
+    static constexpr size_t XPORT_IDX = 0;
+    static constexpr size_t XBAR_IDX  = 1;
+
+    // Return the index of the node downstream of node_idx on the given port,
+    // or -1 if there is none
+    int _get_next_node(const size_t node_idx, const topo_edge_t::port_t port) const
+    {
+        if (node_idx == XPORT_IDX) {
+            return XBAR_IDX;
+        }
+        if (node_idx != XBAR_IDX || port < 0) {
+            return -1;
+        }
+        if (port == 0) {
+            return XPORT_IDX;
+        }
+        if (static_cast<size_t>(port) < NUM_XBAR_XPORTS
+            || static_cast<size_t>(port) >= NUM_XBAR_XPORTS + NUM_SEPS) {
+            return -1;
+        }
+        return static_cast<int>(XBAR_IDX + 1 + port - NUM_XBAR_XPORTS);
+    }
+
+    std::pair<boost::shared_array<uint8_t>, size_t> _process_packet(const void* data)
+    {
+        auto recv_pkt = _pkt_factory.make_mgmt();
+        recv_pkt->refresh(data);
+        mgmt_payload request;
+        request.set_header(0, PROTOVER, _pkt_factory.get_chdr_w());
+        recv_pkt->fill_payload(request);
+        // The last hop belongs to the host. Its first operation is a NOP, which
+        // the nodes leave untouched.
+        const mgmt_hop_t& return_hop = request.get_hop(request.get_num_hops() - 1);
+        if (return_hop.get_num_ops() > 0
+            && return_hop.get_op(0).get_op_code() == mgmt_op_t::MGMT_OP_NOP) {
+            request_tags.push_back(return_hop.get_op(0).get_op_payload());
+        }
+
+        // The packet enters the device through the transport
+        size_t node_idx = XPORT_IDX;
+        // The port on which the packet entered the current node
+        topo_edge_t::port_t in_port = 0;
+        std::vector<mgmt_op_t> resp_ops;
+        while (request.get_num_hops() > 0) {
+            const mgmt_hop_t hop     = request.pop_hop();
+            const topo_node_t& node  = _nodes.at(node_idx);
+            topo_edge_t::port_t dest = NOT_CONNECTED;
+            bool do_return           = false;
+            bool info_req            = false;
+            for (size_t i = 0; i < hop.get_num_ops(); i++) {
+                const mgmt_op_t& op = hop.get_op(i);
+                switch (op.get_op_code()) {
+                    case mgmt_op_t::MGMT_OP_SEL_DEST:
+                        dest = mgmt_op_t::sel_dest_payload(op.get_op_payload()).dest;
+                        break;
+                    case mgmt_op_t::MGMT_OP_INFO_REQ:
+                        info_req = true;
+                        resp_ops.push_back(mgmt_op_t(mgmt_op_t::MGMT_OP_INFO_RESP,
+                            mgmt_op_t::node_info_payload(node.device_id,
+                                static_cast<uint8_t>(node.type),
+                                static_cast<uint16_t>(
+                                    node.type == node_type::XBAR ? in_port : node.inst),
+                                node.extended_info)));
+                        break;
+                    case mgmt_op_t::MGMT_OP_RETURN:
+                        do_return = true;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            if (do_return) {
+                if (info_req && node.type == node_type::STRM_EP
+                    && num_sep_responses_to_lose > 0) {
+                    num_sep_responses_to_lose--;
+                    return {};
+                }
+                return _make_response(request, resp_ops);
+            }
+            // Move on to the next node
+            const int next_idx = _get_next_node(
+                node_idx, node.type == node_type::XBAR ? dest : NO_OUTPUT);
+            if (next_idx < 0) {
+                // Nothing connected, the packet is lost
+                return {};
+            }
+            in_port  = (node_idx == XPORT_IDX) ? 0 : dest;
+            node_idx = static_cast<size_t>(next_idx);
+        }
+        return {};
+    }
+
+    std::pair<boost::shared_array<uint8_t>, size_t> _make_response(
+        const mgmt_payload& request, const std::vector<mgmt_op_t>& resp_ops)
+    {
+        // Responses are appended to the last remaining hop, which belongs to
+        // the host
+        mgmt_payload response;
+        response.set_header(request.get_src_epid(), PROTOVER, _pkt_factory.get_chdr_w());
+        for (size_t i = 0; i < request.get_num_hops(); i++) {
+            mgmt_hop_t hop(request.get_hop(i));
+            if (i == request.get_num_hops() - 1) {
+                for (const auto& op : resp_ops) {
+                    hop.add_op(op);
+                }
+            }
+            response.add_hop(hop);
+        }
+
+        chdr_header header;
+        boost::shared_array<uint8_t> data(new uint8_t[FRAME_SIZE]);
+        auto send_pkt = _pkt_factory.make_mgmt();
+        send_pkt->refresh(data.get(), header, response);
+        // The packet is returned to the endpoint that sent the request
+        header.set_dst_epid(request.get_src_epid());
+        *reinterpret_cast<uint64_t*>(data.get()) =
+            (_pkt_factory.get_endianness() == ENDIANNESS_BIG)
+                ? uhd::htonx<uint64_t>(header.pack())
+                : uhd::htowx<uint64_t>(header.pack());
+        return {data, header.get_length()};
+    }
+
+    const chdr_packet_factory _pkt_factory;
+    mock_send_link::sptr _send_link;
+    const bool _reverse_responses;
+    std::vector<topo_node_t> _nodes;
+};
+
+/*!
+ * Receive link that lets the mock device respond to everything the host sent
+ * before handing out responses.
+ */
+class mock_device_recv_link : public recv_link_base<mock_device_recv_link>
+{
+public:
+    using sptr   = std::shared_ptr<mock_device_recv_link>;
+    using base_t = recv_link_base<mock_device_recv_link>;
+
+    mock_device_recv_link(mock_mgmt_device& device)
+        : base_t(NUM_FRAMES, FRAME_SIZE), _device(device)
+    {
+        _buffs.resize(NUM_FRAMES);
+        for (auto& buff : _buffs) {
+            base_t::preload_free_buff(&buff);
+        }
+    }
+
+    adapter_id_t get_recv_adapter_id() const override
+    {
+        return NULL_ADAPTER_ID;
+    }
+
+private:
+    friend base_t;
+
+    size_t get_recv_buff_derived(frame_buff& buff, int32_t)
+    {
+        _rx_packets.splice(_rx_packets.end(), _device.process());
+        if (_rx_packets.empty()) {
+            return 0; // timeout
+        }
+        auto* buff_ptr = static_cast<mock_frame_buff*>(&buff);
+        buff_ptr->set_mem(_rx_packets.front().first);
+        buff_ptr->set_packet_size(_rx_packets.front().second);
+        _rx_packets.pop_front();
+        return buff_ptr->packet_size();
+    }
+
+    void release_recv_buff_derived(frame_buff& buff)
+    {
+        auto* buff_ptr = static_cast<mock_frame_buff*>(&buff);
+        buff_ptr->set_mem(boost::shared_array<uint8_t>());
+    }
+
+    mock_mgmt_device& _device;
+    std::vector<mock_frame_buff> _buffs;
+    std::list<std::pair<boost::shared_array<uint8_t>, size_t>> _rx_packets;
+};
+
+struct mgmt_portal_fixture
+{
+    mgmt_portal_fixture(const bool reverse_responses = false,
+        const chdr_w_t chdr_w                        = CHDR_W_64,
+        const endianness_t endianness                = ENDIANNESS_LITTLE)
+        : pkt_factory(chdr_w, endianness)
+        , send_link(std::make_shared<mock_send_link>(
+              mock_send_link::link_params{FRAME_SIZE, NUM_FRAMES}))
+        , device(pkt_factory, send_link, reverse_responses)
+        , recv_link(std::make_shared<mock_device_recv_link>(device))
+        , io_srv(inline_io_service::make())
+    {
+        io_srv->attach_recv_link(recv_link);
+        io_srv->attach_send_link(send_link);
+        xport = chdr_ctrl_xport::make(io_srv,
+            send_link,
+            recv_link,
+            pkt_factory,
+            HOST_EPID,
+            NUM_FRAMES,
+            NUM_FRAMES,
+            []() {});
+    }
+
+    mgmt::mgmt_portal::uptr make_portal(const std::string& topo_cache_key = "")
+    {
+        return mgmt::mgmt_portal::make(*xport,
+            pkt_factory,
+            sep_addr_t(HOST_DEVICE_ID, 0),
+            std::make_shared<topo_graph_t>(),
+            topo_cache_key);
+    }
+
+    chdr_packet_factory pkt_factory;
+    mock_send_link::sptr send_link;
+    mock_mgmt_device device;
+    mock_device_recv_link::sptr recv_link;
+    io_service::sptr io_srv;
+    chdr_ctrl_xport::sptr xport;
+};
+
+/*!
+ * Points the topology cache to an empty temporary directory for the lifetime
+ * of this object.
+ *
+ * This uses a non-portable hack to override the cache path at runtime. If it
+ * does not work, valid() returns false.
+ */
+struct topo_cache_dir
+{
+    topo_cache_dir()
+        : path(fs::temp_directory_path() / fs::unique_path("uhd-topo-cache-%%%%-%%%%"))
+    {
+        fs::create_directories(path);
+#ifdef UHD_PLATFORM_WIN32
+        const std::string putenv_str = std::string("XDG_CACHE_HOME=") + path.string();
+        _putenv(putenv_str.c_str());
+#else
+        setenv("XDG_CACHE_HOME", path.string().c_str(), /* overwrite */ 1);
+#endif
+    }
+
+    ~topo_cache_dir()
+    {
+        boost::system::error_code ec;
+        fs::remove_all(path, ec);
+    }
+
+    bool valid() const
+    {
+        return uhd::get_xdg_cache_home() == path;
+    }
+
+    fs::path get_file_path() const
+    {
+        return path / "uhd" / "topo_cache";
+    }
+
+    const fs::path path;
+};
+
+std::set<sep_addr_t> get_expected_endpoints()
+{
+    std::set<sep_addr_t> endpoints;
+    for (size_t i = 0; i < NUM_SEPS; i++) {
+        endpoints.insert(sep_addr_t(DEVICE_ID, static_cast<sep_inst_t>(i)));
+    }
+    return endpoints;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_mgmt_portal_discovery)
+{
+    mgmt_portal_fixture fixture;
+    auto portal = fixture.make_portal();
+
+    const auto expected = get_expected_endpoints();
+    const auto endpoints = portal->get_reachable_endpoints();
+    BOOST_CHECK(endpoints == expected);
+    // Nothing is connected to crossbar ports 1 and 2, each of them is probed
+    // twice
+    BOOST_CHECK_EQUAL(fixture.device.num_dropped_xacts, 2 * (NUM_XBAR_XPORTS - 1));
+    // All paths behind the crossbar are probed at once
+    BOOST_CHECK_GE(fixture.device.max_pipelined_xacts, NUM_XBAR_XPORTS - 1 + NUM_SEPS);
+}
+
+BOOST_AUTO_TEST_CASE(test_mgmt_portal_out_of_order_responses)
+{
+    mgmt_portal_fixture fixture(true);
+    auto portal = fixture.make_portal();
+
+    const auto expected = get_expected_endpoints();
+    const auto endpoints = portal->get_reachable_endpoints();
+    BOOST_CHECK(endpoints == expected);
+}
+
+BOOST_AUTO_TEST_CASE(test_mgmt_portal_topo_cache)
+{
+    topo_cache_dir cache_dir;
+    if (!cache_dir.valid()) {
+        std::cout << "WARNING: Unable to override the cache path. Skipping test."
+                  << std::endl;
+        return;
+    }
+    const std::string topo_cache_key = "mgmt_portal_test:test_mgmt_portal_topo_cache";
+    const auto expected              = get_expected_endpoints();
+
+    mgmt_portal_fixture fixture;
+    auto portal = fixture.make_portal(topo_cache_key);
+    BOOST_CHECK_EQUAL(fixture.device.num_dropped_xacts, 2 * (NUM_XBAR_XPORTS - 1));
+    const size_t num_xacts = fixture.device.num_xacts;
+
+    // Re-opening the device must skip the empty paths, but find the same
+    // endpoints
+    mgmt_portal_fixture cached_fixture;
+    auto cached_portal = cached_fixture.make_portal(topo_cache_key);
+    BOOST_CHECK_EQUAL(cached_fixture.device.num_dropped_xacts, 0);
+    BOOST_CHECK_EQUAL(
+        cached_fixture.device.num_xacts, num_xacts - 2 * (NUM_XBAR_XPORTS - 1));
+    const auto endpoints = cached_portal->get_reachable_endpoints();
+    BOOST_CHECK(endpoints == expected);
+
+    // Without a key, nothing is cached
+    mgmt_portal_fixture uncached_fixture;
+    auto uncached_portal = uncached_fixture.make_portal();
+    BOOST_CHECK_EQUAL(
+        uncached_fixture.device.num_dropped_xacts, 2 * (NUM_XBAR_XPORTS - 1));
+}
+
+BOOST_AUTO_TEST_CASE(test_mgmt_portal_topo_cache_lost_response)
+{
+    topo_cache_dir cache_dir;
+    if (!cache_dir.valid()) {
+        std::cout << "WARNING: Unable to override the cache path. Skipping test."
+                  << std::endl;
+        return;
+    }
+    const std::string topo_cache_key =
+        "mgmt_portal_test:test_mgmt_portal_topo_cache_lost_response";
+    const auto expected = get_expected_endpoints();
+
+    // A lost response is compensated by the retry, and the path of that
+    // endpoint is not cached as empty
+    mgmt_portal_fixture fixture;
+    fixture.device.num_sep_responses_to_lose = 1;
+    auto portal = fixture.make_portal(topo_cache_key);
+    BOOST_CHECK(portal->get_reachable_endpoints() == expected);
+    BOOST_CHECK_EQUAL(fixture.device.num_sep_responses_to_lose, 0);
+
+    mgmt_portal_fixture cached_fixture;
+    auto cached_portal = cached_fixture.make_portal(topo_cache_key);
+    BOOST_CHECK(cached_portal->get_reachable_endpoints() == expected);
+    BOOST_CHECK_EQUAL(cached_fixture.device.num_dropped_xacts, 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_mgmt_portal_topo_cache_file)
+{
+    topo_cache_dir cache_dir;
+    if (!cache_dir.valid()) {
+        std::cout << "WARNING: Unable to override the cache path. Skipping test."
+                  << std::endl;
+        return;
+    }
+    const std::string topo_cache_key =
+        "mgmt_portal_test:test_mgmt_portal_topo_cache_file";
+
+    {
+        mgmt_portal_fixture fixture;
+        auto portal = fixture.make_portal(topo_cache_key);
+    }
+    // The results are stored on disk, so they are available to other processes
+    BOOST_REQUIRE(fs::exists(cache_dir.get_file_path()));
+    std::ifstream cache_file(cache_dir.get_file_path().string());
+    std::string line;
+    bool found_key = false;
+    while (std::getline(cache_file, line)) {
+        found_key = found_key || line.find(topo_cache_key + "\t") == 0;
+    }
+    cache_file.close();
+    BOOST_CHECK(found_key);
+
+    // Without the file, all paths are probed again
+    fs::remove(cache_dir.get_file_path());
+    {
+        mgmt_portal_fixture fixture;
+        auto portal = fixture.make_portal(topo_cache_key);
+        BOOST_CHECK_EQUAL(fixture.device.num_dropped_xacts, 2 * (NUM_XBAR_XPORTS - 1));
+    }
+
+    // Invalid entries are ignored, valid ones are still used
+    {
+        std::ofstream bad_file(cache_dir.get_file_path().string(), std::ios::app);
+        bad_file << "garbage\n" << "mgmt_portal_test:bad_entry\tnot,a,number\n";
+    }
+    {
+        mgmt_portal_fixture fixture;
+        auto portal = fixture.make_portal(topo_cache_key);
+        BOOST_CHECK_EQUAL(fixture.device.num_dropped_xacts, 0);
+        BOOST_CHECK(portal->get_reachable_endpoints() == get_expected_endpoints());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_mgmt_portal_xact_tags)
+{
+    // The responses are matched to their transactions using the tag in the NOP
+    // operation of the return hop. Check that the tags make it through the
+    // device and back for all packet formats.
+    const auto expected = get_expected_endpoints();
+    for (const auto chdr_w : {CHDR_W_64, CHDR_W_128, CHDR_W_256, CHDR_W_512}) {
+        for (const auto endianness : {ENDIANNESS_LITTLE, ENDIANNESS_BIG}) {
+            for (const bool reverse_responses : {false, true}) {
+                mgmt_portal_fixture fixture(reverse_responses, chdr_w, endianness);
+                auto portal = fixture.make_portal();
+                BOOST_CHECK(portal->get_reachable_endpoints() == expected);
+
+                const auto& device = fixture.device;
+                // Every transaction carries its own tag
+                BOOST_REQUIRE_EQUAL(device.request_tags.size(), device.num_xacts);
+                const std::set<mgmt_op_t::payload_t> unique_tags(
+                    device.request_tags.cbegin(), device.request_tags.cend());
+                BOOST_CHECK_EQUAL(unique_tags.size(), device.num_xacts);
+                BOOST_CHECK(!unique_tags.count(0));
+                // Every response carries the tag of its request
+                std::vector<mgmt_op_t::payload_t> answered_tags;
+                for (const auto tag : device.request_tags) {
+                    if (std::find(device.response_tags.cbegin(),
+                            device.response_tags.cend(),
+                            tag)
+                        != device.response_tags.cend()) {
+                        answered_tags.push_back(tag);
+                    }
+                }
+                BOOST_CHECK_EQUAL(answered_tags.size(), device.response_tags.size());
+                BOOST_CHECK_EQUAL(device.response_tags.size(),
+                    device.num_xacts - device.num_dropped_xacts);
+                // Only the empty paths were probed twice, so all responses were
+                // matched to their transactions
+                BOOST_CHECK_EQUAL(device.num_dropped_xacts, 2 * (NUM_XBAR_XPORTS - 1));
+            }
+        }
+    }
+}
@@ -8,7 +8,9 @@
 #include <uhdlib/transport/offload_io_service.hpp>
 #include <boost/test/unit_test.hpp>
 #include <atomic>
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 using namespace uhd::transport;
 
@@ -152,6 +154,11 @@ using params_t       = offload_io_service::params_t;
 
 std::vector<offload_io_service::wait_mode_t> wait_modes({POLL, BLOCK});
 
+std::vector<offload_io_service::queue_wait_policy_t> queue_wait_policies(
+    {offload_io_service::SPIN,
+        offload_io_service::SPIN_YIELD,
+        offload_io_service::SPIN_FUTEX});
+
 BOOST_AUTO_TEST_CASE(test_construction)
 {
     for (const auto wait_mode : wait_modes) {
@@ -351,3 +358,50 @@ BOOST_AUTO_TEST_CASE(test_attach_detach)
     mock_io_srv->allocate_recv_frames(2, 1);
     recv_client2->release_recv_buff(recv_client2->get_recv_buff(100));
 }
+
+BOOST_AUTO_TEST_CASE(test_recv_queue_wait_policies)
+{
+    constexpr size_t NUM_PACKETS = 20;
+
+    for (const auto wait_mode : wait_modes) {
+        for (const auto wait_policy : queue_wait_policies) {
+            params_t params          = {{}, RECV_ONLY, wait_mode};
+            params.queue_wait_policy = wait_policy;
+            params.queue_spin_count  = 10;
+            auto mock_io_srv = std::make_shared<mock_io_service>();
+            auto io_srv      = offload_io_service::make(mock_io_srv, params);
+            auto recv_link   = make_recv_link(5);
+            io_srv->attach_recv_link(recv_link);
+
+            auto recv_client =
+                io_srv->make_recv_client(recv_link, 1, nullptr, nullptr, 0, nullptr);
+
+            for (size_t i = 0; i < NUM_PACKETS; i++) {
+                recv_link->push_back_recv_packet(
+                    boost::shared_array<uint8_t>(new uint8_t[FRAME_SIZE]), FRAME_SIZE);
+            }
+
+            // Nothing is available yet, so this times out
+            BOOST_CHECK(recv_client->get_recv_buff(5) == nullptr);
+
+            // Make frames available slowly, so the client has to wait for
+            // each of them
+            std::thread producer([&mock_io_srv]() {
+                for (size_t i = 0; i < NUM_PACKETS; i++) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(500));
+                    mock_io_srv->allocate_recv_frames(0, 1);
+                }
+            });
+
+            for (size_t i = 0; i < NUM_PACKETS; i++) {
+                auto buff = recv_client->get_recv_buff(1000);
+                BOOST_CHECK(buff != nullptr);
+                if (buff) {
+                    recv_client->release_recv_buff(std::move(buff));
+                }
+            }
+            producer.join();
+            recv_client.reset();
+        }
+    }
+}
@@ -253,6 +253,51 @@ BOOST_AUTO_TEST_CASE(test_prop_tree_wrong_type_range)
     BOOST_CHECK_EQUAL(prop.get().start(), 5.0);
 }
 
+BOOST_AUTO_TEST_CASE(test_prop_handle)
+{
+    uhd::property_tree::sptr tree = uhd::property_tree::make();
+    coercer_type coercer;
+    setter_type setter;
+    tree->create<int>("/test/prop0")
+        .set_coercer(std::bind(&coercer_type::doit, &coercer, std::placeholders::_1))
+        .add_coerced_subscriber(
+            std::bind(&setter_type::doit, &setter, std::placeholders::_1));
+
+    auto handle = tree->get_handle<int>("/test/prop0");
+    BOOST_CHECK(handle);
+    BOOST_CHECK_EQUAL(handle.get_path(), "/test/prop0");
+
+    // Accesses through the handle and through the tree are interchangeable
+    handle.set(43);
+    BOOST_CHECK_EQUAL(handle.get(), 40);
+    BOOST_CHECK_EQUAL(handle.get_desired(), 43);
+    BOOST_CHECK_EQUAL(tree->access<int>("/test/prop0").get(), 40);
+    BOOST_CHECK_EQUAL(setter._count, 1);
+    tree->access<int>("/test/prop0").set(9);
+    BOOST_CHECK_EQUAL(handle.get(), 8);
+    BOOST_CHECK_EQUAL(setter._count, 2);
+
+    // Handles of a subtree refer to the same property
+    auto sub_handle = tree->subtree("/test")->get_handle<int>("prop0");
+    BOOST_CHECK_EQUAL(sub_handle.get(), 8);
+    BOOST_CHECK(sub_handle.lock() == handle.lock());
+
+    BOOST_CHECK_THROW(tree->get_handle<int>("/test/prop1"), uhd::lookup_error);
+    BOOST_CHECK_THROW(tree->get_handle<std::string>("/test/prop0"), uhd::type_error);
+
+    // Removing the property expires its handles
+    tree->remove("/test/prop0");
+    BOOST_CHECK(not handle);
+    BOOST_CHECK_THROW(handle.get(), uhd::lookup_error);
+    BOOST_CHECK_THROW(handle.set(0), uhd::lookup_error);
+    tree->create<int>("/test/prop0").set(4);
+    BOOST_CHECK(not handle);
+
+    uhd::property_handle<int> unbound_handle;
+    BOOST_CHECK(not unbound_handle);
+    BOOST_CHECK_THROW(unbound_handle.get(), uhd::lookup_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_prop_subtree)
 {
     uhd::property_tree::sptr tree = uhd::property_tree::make();
@@ -0,0 +1,143 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "common/mock_link.hpp"
+#include <uhd/rfnoc/chdr_types.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace po = boost::program_options;
+using namespace uhd::transport;
+using namespace uhd::rfnoc::chdr;
+
+constexpr size_t FRAME_SIZE = 64;
+
+/*!
+ * Benchmark of the receive demux of inline_io_service with several clients
+ * sharing one link, like virtual channels of one transport adapter.
+ *
+ * Every round, the link receives one packet for each client. The client
+ * whose packet arrives last receives first, so the inline I/O service has to
+ * dispatch the packets of all other clients to their queues before it finds
+ * its own. Then all other clients pick up their packets from their queues.
+ * The callbacks match the destination EPID and packet type, like those of the
+ * CHDR transports do.
+ */
+void benchmark_recv_mux(const size_t num_clients, const size_t num_rounds)
+{
+    // Packets wait in the queues of their clients, so the link needs a frame
+    // for each client
+    auto io_srv    = inline_io_service::make();
+    auto recv_link = std::make_shared<mock_recv_link>(
+        mock_recv_link::link_params{FRAME_SIZE, num_clients});
+    io_srv->attach_recv_link(recv_link);
+
+    // Make one CHDR data packet for each client, with EPIDs starting at 2
+    std::vector<boost::shared_array<uint8_t>> packets;
+    for (size_t i = 0; i < num_clients; i++) {
+        chdr_header header;
+        header.set_pkt_type(PKT_TYPE_DATA_NO_TS);
+        header.set_length(FRAME_SIZE);
+        header.set_dst_epid(static_cast<uint16_t>(i + 2));
+        const uint64_t word = uhd::htowx<uint64_t>(header.pack());
+
+        boost::shared_array<uint8_t> packet(new uint8_t[FRAME_SIZE]());
+        std::memcpy(packet.get(), &word, sizeof(word));
+        packets.push_back(packet);
+    }
+
+    std::vector<recv_io_if::sptr> clients;
+    for (size_t i = 0; i < num_clients; i++) {
+        const uint16_t epid = static_cast<uint16_t>(i + 2);
+        auto recv_cb =
+            [epid](frame_buff::uptr& buff, recv_link_if*, send_link_if*) -> bool {
+            uint64_t word;
+            std::memcpy(&word, buff->data(), sizeof(word));
+            const chdr_header header(uhd::wtohx<uint64_t>(word));
+            return header.get_dst_epid() == epid
+                   && header.get_pkt_type() == PKT_TYPE_DATA_NO_TS;
+        };
+        auto fc_cb = [](frame_buff::uptr buff, recv_link_if* link, send_link_if*) {
+            link->release_recv_buff(std::move(buff));
+        };
+        // Each client may hold all frames of the link, since they are shared
+        clients.push_back(io_srv->make_recv_client(recv_link,
+            recv_link->get_num_recv_frames(),
+            recv_cb,
+            nullptr,
+            0,
+            fc_cb));
+    }
+
+    std::chrono::nanoseconds elapsed(0);
+    for (size_t round = 0; round < num_rounds; round++) {
+        for (const auto& packet : packets) {
+            recv_link->push_back_recv_packet(packet, FRAME_SIZE);
+        }
+
+        const auto start_time = std::chrono::steady_clock::now();
+        for (size_t i = num_clients; i > 0; i--) {
+            auto buff = clients[i - 1]->get_recv_buff(0);
+            UHD_ASSERT_THROW(buff);
+            clients[i - 1]->release_recv_buff(std::move(buff));
+        }
+        elapsed += std::chrono::steady_clock::now() - start_time;
+    }
+
+    const double ns_per_packet =
+        double(elapsed.count()) / double(num_rounds * num_clients);
+    std::cout << boost::format("clients: %3d    ns/packet: %8.1f") % num_clients
+                     % ns_per_packet
+              << std::endl;
+
+    clients.clear();
+    io_srv->detach_recv_link(recv_link);
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t max_clients, num_packets;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("max-clients", po::value<size_t>(&max_clients)->default_value(64),
+            "maximum number of clients sharing the link")
+        ("num-packets", po::value<size_t>(&num_packets)->default_value(4000000),
+            "total number of packets received for each number of clients")
+        ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Receive Mux Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of the demultiplexing of received packets to\n"
+                     "    the clients of a link shared by several transports.\n"
+                     "    Uses mock links, no parameters are needed to run this\n"
+                     "    benchmark. The number of clients doubles from 1 up\n"
+                     "    to --max-clients.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    for (size_t num_clients = 1; num_clients <= max_clients; num_clients *= 2) {
+        benchmark_recv_mux(num_clients, std::max<size_t>(num_packets / num_clients, 1));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,185 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/usrp/common/recv_packet_demuxer_3000.hpp>
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+using namespace uhd::transport;
+using uhd::usrp::recv_packet_demuxer_3000;
+
+static constexpr uint32_t SID0 = 0x00A0;
+static constexpr uint32_t SID1 = 0x00B0;
+// Every call reads packets from the transport until it times out
+static constexpr double TIMEOUT = 0.01;
+
+/*!
+ * Receive transport with a fixed number of frames, like the USB transport.
+ * Frames are only handed out again once they were released.
+ */
+class frame_pool_zero_copy : public zero_copy_if
+{
+public:
+    frame_pool_zero_copy(const size_t num_frames) : _frames(num_frames)
+    {
+        for (auto& frame : _frames) {
+            frame.pool = this;
+        }
+    }
+
+    //! Queue a packet with the given SID (word 1) and sequence number (word 2)
+    void push_packet(const uint32_t sid, const uint32_t seq)
+    {
+        _packets.push_back({sid, seq});
+    }
+
+    size_t get_num_frames_in_use() const
+    {
+        return _num_in_use;
+    }
+
+    managed_recv_buffer::sptr get_recv_buff(double) override
+    {
+        if (_packets.empty()) {
+            return managed_recv_buffer::sptr();
+        }
+        for (auto& frame : _frames) {
+            if (not frame.in_use) {
+                frame.in_use = true;
+                _num_in_use++;
+                frame.mem[0] = 0;
+                frame.mem[1] = uhd::htowx(_packets.front().first);
+                frame.mem[2] = _packets.front().second;
+                _packets.pop_front();
+                return frame.make(&frame, frame.mem.data(), sizeof(frame.mem));
+            }
+        }
+        return managed_recv_buffer::sptr(); // all frames in use
+    }
+
+    size_t get_num_recv_frames(void) const override
+    {
+        return _frames.size();
+    }
+    size_t get_recv_frame_size(void) const override
+    {
+        return sizeof(frame_t::mem);
+    }
+    managed_send_buffer::sptr get_send_buff(double) override
+    {
+        return managed_send_buffer::sptr();
+    }
+    size_t get_num_send_frames(void) const override
+    {
+        return 0;
+    }
+    size_t get_send_frame_size(void) const override
+    {
+        return 0;
+    }
+
+private:
+    struct frame_t : managed_recv_buffer
+    {
+        void release(void) override
+        {
+            in_use = false;
+            pool->_num_in_use--;
+        }
+
+        frame_pool_zero_copy* pool = nullptr;
+        bool in_use                = false;
+        std::array<uint32_t, 4> mem;
+    };
+
+    std::vector<frame_t> _frames;
+    std::deque<std::pair<uint32_t, uint32_t>> _packets;
+    std::atomic<size_t> _num_in_use{0};
+};
+
+static uint32_t get_seq(const managed_recv_buffer::sptr& buff)
+{
+    return buff->cast<const uint32_t*>()[2];
+}
+
+BOOST_AUTO_TEST_CASE(test_demux_forwarding)
+{
+    auto xport  = std::make_shared<frame_pool_zero_copy>(4);
+    auto demux  = recv_packet_demuxer_3000::make(xport);
+    auto proxy0 = demux->make_proxy(SID0);
+    auto proxy1 = demux->make_proxy(SID1);
+
+    xport->push_packet(SID1, 0);
+    xport->push_packet(SID1, 1);
+    xport->push_packet(SID0, 0);
+    xport->push_packet(SID1, 2);
+
+    // Packets of SID1 are parked in its ring while SID0 is being read
+    auto buff = proxy0->get_recv_buff(TIMEOUT);
+    BOOST_REQUIRE(buff);
+    BOOST_CHECK_EQUAL(get_seq(buff), 0);
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 3);
+    buff.reset();
+    BOOST_CHECK(not proxy0->get_recv_buff(TIMEOUT));
+
+    for (uint32_t seq = 0; seq < 3; seq++) {
+        buff = proxy1->get_recv_buff(TIMEOUT);
+        BOOST_REQUIRE(buff);
+        BOOST_CHECK_EQUAL(get_seq(buff), seq);
+    }
+    buff.reset();
+    BOOST_CHECK(not proxy1->get_recv_buff(TIMEOUT));
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 0);
+
+    // Packets of unknown SIDs are dropped
+    xport->push_packet(0x1234, 0);
+    BOOST_CHECK(not proxy0->get_recv_buff(TIMEOUT));
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_demux_release)
+{
+    auto xport  = std::make_shared<frame_pool_zero_copy>(4);
+    auto demux  = recv_packet_demuxer_3000::make(xport);
+    auto proxy0 = demux->make_proxy(SID0);
+    auto proxy1 = demux->make_proxy(SID1);
+
+    xport->push_packet(SID1, 0);
+    xport->push_packet(SID1, 1);
+    BOOST_CHECK(not proxy0->get_recv_buff(TIMEOUT));
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 2);
+
+    // Destroying the proxy frees the frames that were queued for it
+    proxy1.reset();
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 0);
+
+    // So does destroying the demuxer. SIDs stay registered after their proxy
+    // is gone.
+    proxy0.reset();
+    xport->push_packet(SID0, 0);
+    xport->push_packet(SID0, 1);
+    BOOST_CHECK(not demux->get_recv_buff(SID1, TIMEOUT));
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 2);
+    demux.reset();
+    BOOST_CHECK_EQUAL(xport->get_num_frames_in_use(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_demux_sid_limit)
+{
+    auto xport   = std::make_shared<frame_pool_zero_copy>(1);
+    auto demux   = recv_packet_demuxer_3000::make(xport);
+    uint32_t sid = 0;
+    for (; sid < 8; sid++) {
+        demux->realloc_sid(sid);
+    }
+    // Re-registering a SID does not take another slot
+    demux->realloc_sid(0);
+    BOOST_CHECK_THROW(demux->realloc_sid(sid), uhd::runtime_error);
+}
@@ -12,6 +12,7 @@
 #include <uhd/utils/math.hpp>
 #include <uhdlib/rfnoc/graph.hpp>
 #include <boost/test/unit_test.hpp>
+#include <array>
 #include <cstddef>
 #include <iostream>
 #include <thread>
@@ -735,6 +736,106 @@ BOOST_FIXTURE_TEST_CASE(zbx_freq_coercion_test, x400_radio_fixture)
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(zbx_tune_plan_test, x400_radio_fixture)
+{
+    auto tree             = test_radio->get_tree();
+    const std::string log = "ZBX_TUNE_PLAN_TEST";
+    // Lowband and highband frequencies, with some repeats
+    const std::vector<double> hop_freqs{
+        1e9, 2.4e9, 5.8e9, 300e6, 7.1e9, 1e9, 3.55e9, 5.8e9, 1.5e6, 2.4e9};
+
+    for (auto fe_path : {
+             fs_path("dboard/tx_frontends/0"),
+             fs_path("dboard/tx_frontends/1"),
+             fs_path("dboard/rx_frontends/0"),
+             fs_path("dboard/rx_frontends/1"),
+         }) {
+        UHD_LOG_INFO(log, "BEGIN TEST: " << fe_path << " TUNE PLAN\n");
+        auto hop = [&]() {
+            std::vector<std::array<double, 3>> results;
+            for (const double freq : hop_freqs) {
+                results.push_back(
+                    {tree->access<double>(fe_path / "freq").set(freq).get(),
+                        tree->access<double>(fe_path / "los" / ZBX_LO1 / "freq" / "value")
+                            .get(),
+                        tree->access<double>(fe_path / "los" / ZBX_LO2 / "freq" / "value")
+                            .get()});
+            }
+            return results;
+        };
+        const auto unplanned = hop();
+        tree->access<std::vector<double>>(fe_path / "tune_plan" / "freqs").set(hop_freqs);
+        const auto planned = hop();
+        for (size_t i = 0; i < hop_freqs.size(); i++) {
+            BOOST_CHECK_EQUAL(unplanned[i][0], planned[i][0]);
+            BOOST_CHECK_EQUAL(unplanned[i][1], planned[i][1]);
+            BOOST_CHECK_EQUAL(unplanned[i][2], planned[i][2]);
+        }
+        tree->access<std::vector<double>>(fe_path / "tune_plan" / "freqs")
+            .set(std::vector<double>());
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(zbx_tune_plan_hop_test, x400_radio_fixture)
+{
+    auto tree             = test_radio->get_tree();
+    const std::string log = "ZBX_TUNE_PLAN_HOP_TEST";
+    // Lowband and highband frequencies, ending in lowband
+    const std::vector<double> hop_freqs{2.4e9, 5.8e9, 300e6, 7.1e9, 3.55e9, 1e9};
+
+    for (auto fe_path : {
+             fs_path("dboard/tx_frontends/0"),
+             fs_path("dboard/tx_frontends/1"),
+             fs_path("dboard/rx_frontends/0"),
+             fs_path("dboard/rx_frontends/1"),
+         }) {
+        UHD_LOG_INFO(log, "BEGIN TEST: " << fe_path << " TUNE PLAN HOP\n");
+        auto freq_prop = [&]() -> uhd::property<double>& {
+            return tree->access<double>(fe_path / "freq");
+        };
+        auto hop_prop = [&]() -> uhd::property<double>& {
+            return tree->access<double>(fe_path / "tune_plan" / "hop");
+        };
+        auto get_lo_freq = [&](const std::string& lo) {
+            return tree->access<double>(fe_path / "los" / lo / "freq" / "value").get();
+        };
+        // What the expert graph tunes to
+        std::vector<double> graph_freqs;
+        for (const double freq : hop_freqs) {
+            graph_freqs.push_back(freq_prop().set(freq).get());
+        }
+        const double graph_lo1_freq = get_lo_freq(ZBX_LO1);
+        const double graph_lo2_freq = get_lo_freq(ZBX_LO2);
+        const double start_freq     = freq_prop().set(2e9).get();
+        const double start_lo2_freq = get_lo_freq(ZBX_LO2);
+
+        tree->access<std::vector<double>>(fe_path / "tune_plan" / "freqs").set(hop_freqs);
+        BOOST_CHECK_THROW(hop_prop().set(1.234e9), uhd::key_error);
+        for (size_t i = 0; i < hop_freqs.size(); i++) {
+            hop_prop().set(hop_freqs[i]);
+            BOOST_CHECK_EQUAL(freq_prop().get(), graph_freqs[i]);
+        }
+
+        // Hopping to the current frequency writes no LO registers, and neither
+        // does the expert graph when it catches up
+        const size_t num_lo_writes = reg_iface->num_lo_spi_writes;
+        hop_prop().set(hop_freqs.back());
+        BOOST_CHECK_EQUAL(reg_iface->num_lo_spi_writes, num_lo_writes);
+        BOOST_CHECK_EQUAL(freq_prop().set(hop_freqs.back()).get(), graph_freqs.back());
+        BOOST_CHECK_EQUAL(reg_iface->num_lo_spi_writes, num_lo_writes);
+        BOOST_CHECK_EQUAL(get_lo_freq(ZBX_LO1), graph_lo1_freq);
+        BOOST_CHECK_EQUAL(get_lo_freq(ZBX_LO2), graph_lo2_freq);
+
+        // Tuning away through the expert graph works as before
+        BOOST_CHECK_EQUAL(freq_prop().set(2e9).get(), start_freq);
+        BOOST_CHECK_EQUAL(get_lo_freq(ZBX_LO2), start_lo2_freq);
+        BOOST_CHECK_GT(reg_iface->num_lo_spi_writes, num_lo_writes);
+
+        tree->access<std::vector<double>>(fe_path / "tune_plan" / "freqs")
+            .set(std::vector<double>());
+    }
+}
+
 BOOST_FIXTURE_TEST_CASE(zbx_tx_gain_coercion_test, x400_radio_fixture)
 {
     auto tree             = test_radio->get_tree();
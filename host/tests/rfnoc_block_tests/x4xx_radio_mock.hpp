@@ -176,6 +176,9 @@ public:
             // UHD_LOG_INFO("TEST", "Register probably just initialized. Ignoring.");
             return;
         }
+        if (!read) {
+            num_lo_spi_writes++;
+        }
         switch (spi_addr) {
             case 0:
                 _muxout_to_lock = spi_data & (1 << 2);
@@ -200,6 +203,8 @@ public:
     }
 
     bool _muxout_to_lock = false;
+    //! Number of LO register writes so far, across all LOs
+    size_t num_lo_spi_writes = 0;
 }; // class x4xx_radio_mock_reg_iface_t
 
 /*
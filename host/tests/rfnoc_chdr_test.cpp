@@ -7,6 +7,7 @@
 #include <uhd/rfnoc/chdr_types.hpp>
 #include <uhd/types/endianness.hpp>
 #include <uhd/utils/byteswap.hpp>
+#include <uhdlib/rfnoc/chdr_packet_view.hpp>
 #include <uhdlib/rfnoc/chdr_packet_writer.hpp>
 #include <boost/format.hpp>
 #include <boost/test/unit_test.hpp>
@@ -278,6 +279,72 @@ BOOST_AUTO_TEST_CASE(chdr_generic_packet_calculate_pyld_offset_64)
 }
 
 
+//! Checks that view_t reads and writes data packets like the generic packet
+//! writer for chdr_w and endianness does
+template <typename view_t>
+bool test_data_packet_view(const chdr_w_t chdr_w, const endianness_t endianness)
+{
+    const chdr_packet_factory factory(chdr_w, endianness);
+    chdr_packet_writer::uptr pkt = factory.make_generic();
+
+    for (const auto pkt_type : {PKT_TYPE_DATA_NO_TS, PKT_TYPE_DATA_WITH_TS}) {
+        for (size_t num_mdata = 0; num_mdata < 3; num_mdata++) {
+            const size_t pyld_size = 24 + num_mdata;
+            const uint64_t tsf     = 0x0123456789ABCDEF;
+            chdr_header header;
+            header.set_pkt_type(pkt_type);
+            header.set_num_mdata(num_mdata);
+            header.set_seq_num(42);
+            header.set_dst_epid(7);
+
+            // Write with the view, read with the generic packet
+            uint64_t buff[MAX_BUF_SIZE_WORDS];
+            chdr_header view_header = header;
+            const size_t pyld_offset =
+                view_t::write_header(buff, view_header, tsf, pyld_size);
+            pkt->refresh(buff);
+            BOOST_CHECK_EQUAL(pkt->get_chdr_header(), view_header);
+            BOOST_CHECK_EQUAL(pkt->get_payload_size(), pyld_size);
+            BOOST_CHECK_EQUAL(pyld_offset,
+                pkt->calculate_payload_offset(pkt_type, num_mdata));
+            BOOST_CHECK(pkt->get_timestamp().is_initialized()
+                        == (pkt_type == PKT_TYPE_DATA_WITH_TS));
+
+            // Write with the generic packet, read with the view
+            pkt->refresh(buff, header, tsf);
+            pkt->update_payload_size(pyld_size);
+            const view_t view(buff);
+            BOOST_CHECK_EQUAL(view.get_chdr_header(), pkt->get_chdr_header());
+            BOOST_CHECK_EQUAL(view.get_payload_size(), pyld_size);
+            BOOST_CHECK_EQUAL(view.get_payload_const_ptr(), pkt->get_payload_const_ptr());
+            BOOST_CHECK_EQUAL(
+                view.has_timestamp(), pkt->get_timestamp().is_initialized());
+            if (view.has_timestamp()) {
+                BOOST_CHECK_EQUAL(view.get_timestamp(), tsf);
+            }
+        }
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(chdr_data_packet_view)
+{
+    for (const auto endianness : {ENDIANNESS_BIG, ENDIANNESS_LITTLE}) {
+        for (const auto chdr_w : {CHDR_W_64, CHDR_W_128, CHDR_W_256, CHDR_W_512}) {
+            BOOST_CHECK(visit_specialized(chdr_w, endianness, [&](auto fmt) {
+                using view_t = typename decltype(fmt)::view_t;
+                BOOST_CHECK_EQUAL(view_t::CHDR_W_BYTES, chdr_w_to_bits(chdr_w) / 8);
+                return test_data_packet_view<view_t>(chdr_w, endianness);
+            }));
+        }
+    }
+    BOOST_CHECK_THROW(
+        visit_specialized(static_cast<chdr_w_t>(4),
+            ENDIANNESS_BIG,
+            [](auto fmt) { return decltype(fmt)::view_t::CHDR_W_BYTES; }),
+        uhd::value_error);
+}
+
 BOOST_AUTO_TEST_CASE(chdr_mgmt_packet_no_swap_64)
 {
     uint64_t buff[MAX_BUF_SIZE_WORDS];
@@ -0,0 +1,131 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "rfnoc_graph_mock_nodes.hpp"
+#include <uhd/utils/log.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/rfnoc/graph.hpp>
+#include <uhdlib/rfnoc/node_accessor.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace po = boost::program_options;
+using uhd::rfnoc::detail::graph_t;
+using edge_t = graph_t::graph_edge_t;
+
+/*! One chain of blocks as found in a receive path:
+ *
+ * Radio -> DDC -> FIFO -> Streamer
+ *
+ * The FIFO forwards the sampling rate dynamically.
+ */
+struct mock_rx_chain_t
+{
+    mock_rx_chain_t(const size_t idx) : radio(idx), fifo(1), streamer(1) {}
+
+    mock_radio_node_t radio;
+    mock_ddc_node_t ddc;
+    mock_fifo_t fifo;
+    mock_streamer_t streamer;
+};
+
+/*! Benchmark of the property propagation of graph_t.
+ *
+ * Builds a graph from num_chains independent receive chains, then measures
+ * how long it takes to set and get a property of the DDC in one chain. Both
+ * calls trigger a property resolution of the graph. Setting the decimation
+ * changes the sampling rate on the edges downstream of the DDC, getting it
+ * leaves the graph unchanged.
+ */
+void benchmark_propprop(const size_t num_chains, const size_t num_iterations)
+{
+    node_accessor_t node_accessor{};
+    graph_t graph{};
+    std::vector<std::unique_ptr<mock_rx_chain_t>> chains;
+    for (size_t i = 0; i < num_chains; i++) {
+        chains.push_back(std::make_unique<mock_rx_chain_t>(i));
+        auto& chain = *chains.back();
+        node_accessor.init_props(&chain.radio);
+        node_accessor.init_props(&chain.ddc);
+        node_accessor.init_props(&chain.fifo);
+        node_accessor.init_props(&chain.streamer);
+        const edge_t edge_info{0, 0, edge_t::DYNAMIC, true};
+        graph.connect(&chain.radio, &chain.ddc, edge_info);
+        graph.connect(&chain.ddc, &chain.fifo, edge_info);
+        graph.connect(&chain.fifo, &chain.streamer, edge_info);
+    }
+    graph.commit();
+
+    // Pick a DDC from the middle of the graph
+    mock_ddc_node_t& ddc = chains.at(num_chains / 2)->ddc;
+
+    auto start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_iterations; i++) {
+        ddc.set_property<int>("decim", (i % 2) ? 4 : 2, 0);
+    }
+    const std::chrono::duration<double, std::micro> set_time =
+        std::chrono::steady_clock::now() - start_time;
+    const int last_decim = (num_iterations % 2) ? 2 : 4;
+    UHD_ASSERT_THROW(ddc.get_property<int>("decim", 0) == last_decim);
+
+    start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_iterations; i++) {
+        ddc.get_property<int>("decim", 0);
+    }
+    const std::chrono::duration<double, std::micro> get_time =
+        std::chrono::steady_clock::now() - start_time;
+
+    std::cout << boost::format("nodes: %4d    set_property: %8.2f us    "
+                               "get_property: %8.2f us")
+                     % (4 * num_chains) % (set_time.count() / num_iterations)
+                     % (get_time.count() / num_iterations)
+              << std::endl;
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t max_chains, num_iterations;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("max-chains", po::value<size_t>(&max_chains)->default_value(16),
+            "maximum number of receive chains (4 nodes each) in the graph")
+        ("iterations", po::value<size_t>(&num_iterations)->default_value(10000),
+            "number of calls to set_property() and get_property() per graph")
+        ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD Property Propagation Benchmark %s") % desc
+                  << std::endl;
+        std::cout << "    Benchmark of the property propagation in RFNoC graphs.\n"
+                     "    Uses mock nodes, no parameters are needed to run this\n"
+                     "    benchmark. The number of receive chains doubles from 1\n"
+                     "    up to --max-chains.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The mock nodes log every resolver call
+    uhd::log::set_log_level(uhd::log::warning);
+    uhd::log::set_console_level(uhd::log::warning);
+
+    for (size_t num_chains = 1; num_chains <= max_chains; num_chains *= 2) {
+        benchmark_propprop(num_chains, num_iterations);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/usrp/common/rpc.hpp>
+#include <uhdlib/utils/rpc.hpp>
+#include <rpc/server.h>
+#include <rpc/this_handler.h>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto SLOW_CALL_DURATION   = 100ms;
+constexpr size_t NUM_SERVER_THREADS = 4;
+
+//! Local stand-in for an MPM RPC server
+struct rpc_server_fixture
+{
+    rpc_server_fixture()
+    {
+        // Find a free port; the server constructor throws if binding fails
+        for (port = 49700; port < 49800 && !server; port++) {
+            try {
+                server = std::make_unique<rpc::server>("127.0.0.1", port);
+            } catch (const std::exception&) {
+                // Port is busy, try the next one
+            }
+        }
+        BOOST_REQUIRE(server);
+        port--;
+
+        server->bind("add", [](int a, int b) { return a + b; });
+        server->bind("slow_echo", [this](const std::string& s) {
+            num_concurrent_calls++;
+            max_concurrent_calls = std::max(max_concurrent_calls.load(),
+                num_concurrent_calls.load());
+            std::this_thread::sleep_for(SLOW_CALL_DURATION);
+            num_concurrent_calls--;
+            return s;
+        });
+        server->bind("fail", []() {
+            rpc::this_handler().respond_error("Simulated failure");
+            return 0;
+        });
+        server->bind("get_last_error", []() { return std::string("Last error"); });
+        server->bind(
+            "get_gpio_srcs", [](const std::string& /*token*/, const std::string& bank) {
+                std::this_thread::sleep_for(SLOW_CALL_DURATION);
+                return std::vector<std::string>{bank + "_PS", bank + "_RF"};
+            });
+        server->bind(
+            "get_mb_sensor", [](const std::string& /*token*/, const std::string& name) {
+                std::this_thread::sleep_for(SLOW_CALL_DURATION);
+                return std::map<std::string, std::string>{{"name", name},
+                    {"type", "STRING"},
+                    {"value", name + "_value"},
+                    {"unit", ""}};
+            });
+        server->bind("db_0_get_sensor",
+            [](const std::string& /*token*/,
+                const std::string& trx,
+                const std::string& name,
+                size_t chan) {
+                std::this_thread::sleep_for(SLOW_CALL_DURATION);
+                return std::map<std::string, std::string>{{"name", name},
+                    {"type", "STRING"},
+                    {"value", trx + std::to_string(chan)},
+                    {"unit", ""}};
+            });
+        server->async_run(NUM_SERVER_THREADS);
+    }
+
+    ~rpc_server_fixture()
+    {
+        server->stop();
+    }
+
+    std::unique_ptr<rpc::server> server;
+    uint16_t port = 0;
+    std::atomic<size_t> num_concurrent_calls{0};
+    std::atomic<size_t> max_concurrent_calls{0};
+};
+
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(test_rpc_async_request, rpc_server_fixture)
+{
+    auto rpcc = uhd::rpc_client::make("127.0.0.1", port);
+
+    auto sum_future = rpcc->request_async<int>("add", 2, 3);
+    BOOST_CHECK_EQUAL(sum_future.get(), 5);
+    // Synchronous requests and asynchronous requests can be mixed
+    auto another_sum_future = rpcc->request_async<int>("add", 4, 5);
+    BOOST_CHECK_EQUAL(rpcc->request<int>("add", 1, 1), 2);
+    BOOST_CHECK_EQUAL(another_sum_future.get(), 9);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rpc_async_pipelining, rpc_server_fixture)
+{
+    auto rpcc = uhd::rpc_client::make("127.0.0.1", port);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    std::vector<std::future<std::string>> futures;
+    for (size_t i = 0; i < NUM_SERVER_THREADS; i++) {
+        futures.push_back(
+            rpcc->request_async<std::string>("slow_echo", std::to_string(i)));
+    }
+    for (size_t i = 0; i < NUM_SERVER_THREADS; i++) {
+        BOOST_CHECK_EQUAL(futures[i].get(), std::to_string(i));
+    }
+    const auto duration = std::chrono::steady_clock::now() - start_time;
+
+    // All requests must have been in flight together
+    BOOST_CHECK_EQUAL(max_concurrent_calls.load(), NUM_SERVER_THREADS);
+    BOOST_CHECK(duration < SLOW_CALL_DURATION * NUM_SERVER_THREADS);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rpc_async_errors, rpc_server_fixture)
+{
+    auto rpcc = uhd::rpc_client::make("127.0.0.1", port, 2000, "get_last_error");
+
+    auto fail_future = rpcc->request_async<int>("fail");
+    BOOST_CHECK_THROW(fail_future.get(), uhd::runtime_error);
+
+    // Type mismatches are reported when the result is retrieved
+    auto bad_cast_future = rpcc->request_async<std::string>("add", 1, 2);
+    BOOST_CHECK_THROW(bad_cast_future.get(), uhd::runtime_error);
+
+    auto timeout_future = rpcc->request_async<std::string>(10, "slow_echo", "x");
+    BOOST_CHECK_THROW(timeout_future.get(), uhd::runtime_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rpc_batch_gpio_srcs, rpc_server_fixture)
+{
+    auto rpcc = uhd::rpc_client::make("127.0.0.1", port);
+    rpcc->set_token("token");
+    uhd::usrp::mpmd_rpc mpmd_rpcc(rpcc);
+
+    const std::vector<std::string> banks{"GPIO0", "GPIO1", "FP0"};
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto gpio_srcs  = mpmd_rpcc.get_gpio_srcs_batch(banks);
+    const auto duration   = std::chrono::steady_clock::now() - start_time;
+
+    BOOST_REQUIRE_EQUAL(gpio_srcs.size(), banks.size());
+    for (size_t i = 0; i < banks.size(); i++) {
+        const std::vector<std::string> expected{banks[i] + "_PS", banks[i] + "_RF"};
+        BOOST_CHECK_EQUAL_COLLECTIONS(gpio_srcs[i].cbegin(),
+            gpio_srcs[i].cend(),
+            expected.cbegin(),
+            expected.cend());
+    }
+    BOOST_CHECK(duration < SLOW_CALL_DURATION * banks.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rpc_batch_sensors, rpc_server_fixture)
+{
+    auto rpcc = uhd::rpc_client::make("127.0.0.1", port);
+    rpcc->set_token("token");
+    uhd::usrp::mpmd_rpc mpmd_rpcc(rpcc);
+
+    const std::vector<std::string> sensor_names{"ref_locked", "temp", "fan"};
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto sensors    = mpmd_rpcc.get_mb_sensor_batch(sensor_names);
+    const auto duration   = std::chrono::steady_clock::now() - start_time;
+
+    BOOST_REQUIRE_EQUAL(sensors.size(), sensor_names.size());
+    for (size_t i = 0; i < sensor_names.size(); i++) {
+        const uhd::sensor_value_t sensor(sensors[i]);
+        BOOST_CHECK_EQUAL(sensor.name, sensor_names[i]);
+        BOOST_CHECK_EQUAL(sensor.value, sensor_names[i] + "_value");
+    }
+    BOOST_CHECK(duration < SLOW_CALL_DURATION * sensor_names.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(test_rpc_batch_db_sensors, rpc_server_fixture)
+{
+    auto rpcc = uhd::rpc_client::make("127.0.0.1", port);
+    rpcc->set_token("token");
+    uhd::usrp::dboard_base_rpc db_rpcc(rpcc, "db_0_");
+
+    const std::vector<std::tuple<std::string, std::string, size_t>> sensor_args{
+        {"rx", "lo_locked", 0}, {"rx", "lo_locked", 1}, {"tx", "temperature", 0}};
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto sensors    = db_rpcc.get_sensor_batch(sensor_args);
+    const auto duration   = std::chrono::steady_clock::now() - start_time;
+
+    BOOST_REQUIRE_EQUAL(sensors.size(), sensor_args.size());
+    for (size_t i = 0; i < sensor_args.size(); i++) {
+        const uhd::sensor_value_t sensor(sensors[i]);
+        BOOST_CHECK_EQUAL(sensor.name, std::get<1>(sensor_args[i]));
+        BOOST_CHECK_EQUAL(sensor.value,
+            std::get<0>(sensor_args[i]) + std::to_string(std::get<2>(sensor_args[i])));
+    }
+    BOOST_CHECK(duration < SLOW_CALL_DURATION * sensor_args.size());
+}
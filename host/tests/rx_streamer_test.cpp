@@ -177,9 +177,11 @@ static std::vector<mock_recv_link::sptr> make_links(const size_t num)
 static std::shared_ptr<mock_rx_streamer> make_rx_streamer(
     std::vector<mock_recv_link::sptr> recv_links,
     const std::string& host_format,
-    const std::string& otw_format = "sc16")
+    const std::string& otw_format = "sc16",
+    const uhd::device_addr_t& args = uhd::device_addr_t())
 {
-    const uhd::stream_args_t stream_args(host_format, otw_format);
+    uhd::stream_args_t stream_args(host_format, otw_format);
+    stream_args.args = args;
     auto streamer = std::make_shared<mock_rx_streamer>(recv_links.size(), stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
@@ -452,6 +454,177 @@ BOOST_AUTO_TEST_CASE(test_recv_one_channel_packet_fragment)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_multi_channel_conv_threads)
+{
+    const size_t NUM_PKTS_TO_TEST = 5;
+    const std::string format("fc32");
+
+    const size_t num_chans = 8;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(
+        recv_links, format, "sc16", uhd::device_addr_t("conv_threads=3"));
+
+    // Read each packet in two fragments, so buffers are released after the
+    // second read only
+    const size_t spp       = 40;
+    const size_t num_samps = spp / 2;
+
+    std::vector<std::vector<std::complex<float>>> buffer(num_chans);
+    std::vector<void*> buffers;
+    for (size_t i = 0; i < num_chans; i++) {
+        buffer[i].resize(num_samps);
+        buffers.push_back(&buffer[i].front());
+    }
+
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        mock_header_t header;
+        header.eob     = true;
+        header.has_tsf = true;
+        header.tsf     = 0;
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            push_back_recv_packet(recv_links[ch], header, spp, ch * spp);
+        }
+
+        for (size_t j = 0; j < 2; j++) {
+            size_t num_samps_ret =
+                streamer->recv(buffers, num_samps, metadata, 1.0, false);
+
+            BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+            BOOST_CHECK_EQUAL(metadata.more_fragments, j == 0);
+
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                for (size_t samp = 0; samp < num_samps; samp++) {
+                    const size_t n   = ch * spp + j * num_samps + samp;
+                    const auto value = std::complex<float>(
+                        (n * 2) * SCALE_FACTOR, (n * 2 + 1) * SCALE_FACTOR);
+                    BOOST_CHECK_EQUAL(value, buffer[ch][samp]);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_multi_channel_planar)
+{
+    const size_t NUM_BUFFS_TO_TEST = 5;
+    const std::string format("fc32_planar");
+
+    const size_t num_chans = 3;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    // Receive two packets with two calls to recv, so that the first call
+    // stops in the middle of the second packet
+    const size_t spp        = 20;
+    const size_t num_samps  = 2 * spp;
+    const size_t first_recv = spp + spp / 2;
+
+    // I and Q buffers for each channel
+    std::vector<std::vector<float>> buffer(2 * num_chans, std::vector<float>(num_samps));
+
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_BUFFS_TO_TEST; i++) {
+        mock_header_t header;
+        header.eob     = false;
+        header.has_tsf = true;
+        header.tsf     = i;
+
+        for (size_t pkt = 0; pkt < 2; pkt++) {
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                push_back_recv_packet(
+                    recv_links[ch], header, spp, ch * num_samps + pkt * spp);
+            }
+        }
+
+        size_t offset = 0;
+        for (const size_t nsamps : {first_recv, num_samps - first_recv}) {
+            std::vector<void*> buffers;
+            for (auto& buff : buffer) {
+                buffers.push_back(&buff[offset]);
+            }
+            size_t num_samps_ret =
+                streamer->recv(buffers, nsamps, metadata, 1.0, false);
+            BOOST_CHECK_EQUAL(num_samps_ret, nsamps);
+            offset += num_samps_ret;
+        }
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            for (size_t samp = 0; samp < num_samps; samp++) {
+                const size_t n = ch * num_samps + samp;
+                BOOST_CHECK_EQUAL(buffer[2 * ch][samp], (n * 2) * SCALE_FACTOR);
+                BOOST_CHECK_EQUAL(buffer[2 * ch + 1][samp], (n * 2 + 1) * SCALE_FACTOR);
+            }
+        }
+    }
+
+    // One buffer per channel is not enough for planar formats
+    std::vector<void*> buffers;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        buffers.push_back(buffer[ch].data());
+    }
+    BOOST_CHECK_THROW(
+        streamer->recv(buffers, num_samps, metadata, 1.0, false), uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_multi_channel_chan_interleaved)
+{
+    const size_t NUM_BUFFS_TO_TEST = 5;
+    const std::string format("fc32_chan_interleaved");
+
+    const size_t num_chans = 3;
+
+    auto recv_links = make_links(num_chans);
+    auto streamer   = make_rx_streamer(recv_links, format);
+
+    // Receive two packets with two calls to recv, so that the first call
+    // stops in the middle of the second packet
+    const size_t spp        = 20;
+    const size_t num_samps  = 2 * spp;
+    const size_t first_recv = spp + spp / 2;
+
+    // A single buffer for all channels
+    std::vector<std::complex<float>> buffer(num_chans * num_samps);
+
+    uhd::rx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_BUFFS_TO_TEST; i++) {
+        mock_header_t header;
+        header.eob     = false;
+        header.has_tsf = true;
+        header.tsf     = i;
+
+        for (size_t pkt = 0; pkt < 2; pkt++) {
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                push_back_recv_packet(
+                    recv_links[ch], header, spp, ch * num_samps + pkt * spp);
+            }
+        }
+
+        size_t offset = 0;
+        for (const size_t nsamps : {first_recv, num_samps - first_recv}) {
+            size_t num_samps_ret = streamer->recv(
+                &buffer[offset * num_chans], nsamps, metadata, 1.0, false);
+            BOOST_CHECK_EQUAL(num_samps_ret, nsamps);
+            offset += num_samps_ret;
+        }
+
+        for (size_t samp = 0; samp < num_samps; samp++) {
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                const size_t n   = ch * num_samps + samp;
+                const auto value = std::complex<float>(
+                    (n * 2) * SCALE_FACTOR, (n * 2 + 1) * SCALE_FACTOR);
+                BOOST_CHECK_EQUAL(value, buffer[samp * num_chans + ch]);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_seq_error)
 {
     // Test that when we get a sequence error the error is returned in the
@@ -769,6 +942,159 @@ BOOST_AUTO_TEST_CASE(test_recv_alignment_error)
     BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_ALIGNMENT);
 }
 
+BOOST_AUTO_TEST_CASE(test_recv_multi_channel_zero_fill)
+{
+    // Test that the streamer fills the gaps of lost packets with zeros when
+    // align_mode=zero_fill, instead of discarding packets of other channels
+    const std::string format("sc16");
+
+    const size_t num_chans    = 3;
+    const size_t num_samps    = 10;
+    const size_t num_pkts     = 6;
+    const uint64_t pkt_ticks  = num_samps * TICK_RATE / SAMP_RATE;
+    const size_t lossy_chan   = 1;
+    const uint64_t lost_pkt_0 = 1;
+    const uint64_t lost_pkt_1 = 2;
+
+    auto push_packets = [&](std::vector<mock_recv_link::sptr>& recv_links) {
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            for (size_t pkt = 0; pkt < num_pkts; pkt++) {
+                if (ch == lossy_chan && (pkt == lost_pkt_0 || pkt == lost_pkt_1)) {
+                    continue;
+                }
+                mock_header_t header;
+                header.has_tsf    = true;
+                header.tsf        = pkt * pkt_ticks;
+                header.ignore_seq = false;
+                header.seq_num    = pkt;
+                push_back_recv_packet(recv_links[ch], header, num_samps, pkt * num_samps);
+            }
+        }
+    };
+
+    auto check_samps = [&](const std::vector<std::complex<uint16_t>>& buffer,
+                           const size_t first_pkt,
+                           const size_t nsamps,
+                           const bool zero) {
+        for (size_t samp = 0; samp < nsamps; samp++) {
+            const size_t n   = first_pkt * num_samps + samp;
+            const auto value = zero ? std::complex<uint16_t>()
+                                    : std::complex<uint16_t>(n * 2, n * 2 + 1);
+            BOOST_CHECK_EQUAL(value, buffer[samp]);
+        }
+    };
+
+    // One packet per call
+    {
+        auto recv_links = make_links(num_chans);
+        auto streamer   = make_rx_streamer(
+            recv_links, format, "sc16", uhd::device_addr_t("align_mode=zero_fill"));
+        push_packets(recv_links);
+
+        std::vector<std::vector<std::complex<uint16_t>>> buffer(num_chans);
+        std::vector<void*> buffers;
+        for (size_t i = 0; i < num_chans; i++) {
+            buffer[i].resize(num_samps);
+            buffers.push_back(&buffer[i].front());
+        }
+
+        uhd::rx_metadata_t metadata;
+        for (size_t pkt = 0; pkt < num_pkts; pkt++) {
+            const bool lost = pkt == lost_pkt_0 || pkt == lost_pkt_1;
+            const size_t num_samps_ret =
+                streamer->recv(buffers, num_samps, metadata, 1.0, false);
+            BOOST_CHECK_EQUAL(num_samps_ret, num_samps);
+            BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+            BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), pkt * pkt_ticks);
+            BOOST_CHECK_EQUAL(metadata.out_of_sequence, lost);
+            if (lost) {
+                const std::vector<size_t> zero_filled_chans{lossy_chan};
+                const auto chans = streamer->get_zero_filled_chans();
+                BOOST_CHECK_EQUAL_COLLECTIONS(chans.begin(),
+                    chans.end(),
+                    zero_filled_chans.begin(),
+                    zero_filled_chans.end());
+            }
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                check_samps(buffer[ch], pkt, num_samps, lost && ch == lossy_chan);
+            }
+        }
+    }
+
+    // Several packets per call, zero-filled samples are returned by separate
+    // calls
+    {
+        auto recv_links = make_links(num_chans);
+        auto streamer   = make_rx_streamer(
+            recv_links, format, "sc16", uhd::device_addr_t("align_mode=zero_fill"));
+        push_packets(recv_links);
+
+        const size_t buff_samps = num_pkts * num_samps;
+        std::vector<std::vector<std::complex<uint16_t>>> buffer(num_chans);
+        std::vector<void*> buffers;
+        for (size_t i = 0; i < num_chans; i++) {
+            buffer[i].resize(buff_samps);
+            buffers.push_back(&buffer[i].front());
+        }
+
+        // Returned samples and whether they are zero-filled, for each call
+        const std::vector<std::pair<size_t, bool>> expected = {{num_samps, false},
+            {num_samps, true},
+            {num_samps, true},
+            {3 * num_samps, false}};
+        size_t pkt = 0;
+        uhd::rx_metadata_t metadata;
+        for (const auto& call : expected) {
+            const size_t num_samps_ret =
+                streamer->recv(buffers, buff_samps, metadata, 0.1, false);
+            BOOST_CHECK_EQUAL(num_samps_ret, call.first);
+            BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+            BOOST_CHECK_EQUAL(metadata.time_spec.to_ticks(TICK_RATE), pkt * pkt_ticks);
+            BOOST_CHECK_EQUAL(metadata.out_of_sequence, call.second);
+            for (size_t ch = 0; ch < num_chans; ch++) {
+                check_samps(buffer[ch], pkt, call.first, call.second && ch == lossy_chan);
+            }
+            pkt += call.first / num_samps;
+        }
+    }
+
+    // Gaps of partial packets are realigned by discarding packets
+    for (const uint64_t gap_ticks : {pkt_ticks / 2, pkt_ticks * 3 / 2}) {
+        auto recv_links = make_links(num_chans);
+        auto streamer   = make_rx_streamer(
+            recv_links, format, "sc16", uhd::device_addr_t("align_mode=zero_fill"));
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            mock_header_t header;
+            header.has_tsf = true;
+            header.tsf     = (ch == lossy_chan) ? gap_ticks : 0;
+            push_back_recv_packet(recv_links[ch], header, num_samps);
+            header.tsf += pkt_ticks;
+            push_back_recv_packet(recv_links[ch], header, num_samps);
+        }
+
+        std::vector<std::vector<std::complex<uint16_t>>> buffer(num_chans);
+        std::vector<void*> buffers;
+        for (size_t i = 0; i < num_chans; i++) {
+            buffer[i].resize(num_samps);
+            buffers.push_back(&buffer[i].front());
+        }
+
+        uhd::rx_metadata_t metadata;
+        const size_t num_samps_ret =
+            streamer->recv(buffers, num_samps, metadata, 0.1, false);
+        BOOST_CHECK_EQUAL(num_samps_ret, 0);
+        BOOST_CHECK_EQUAL(metadata.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+        BOOST_CHECK_EQUAL(metadata.out_of_sequence, false);
+    }
+
+    // Other align modes are rejected
+    BOOST_CHECK_THROW(make_rx_streamer(make_links(num_chans),
+                          format,
+                          "sc16",
+                          uhd::device_addr_t("align_mode=foo")),
+        uhd::value_error);
+}
+
 BOOST_AUTO_TEST_CASE(test_recv_one_channel_one_eov)
 {
     const size_t NUM_PACKETS = 5;
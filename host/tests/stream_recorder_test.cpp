@@ -0,0 +1,376 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/types/metadata.hpp>
+#include <uhd/utils/stream_player.hpp>
+#include <uhd/utils/stream_recorder.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace uhd;
+using namespace uhd::utils;
+namespace fs = boost::filesystem;
+
+namespace {
+
+//! Size of an sc16 sample
+constexpr size_t BPI = 4;
+
+//! Value of sample idx of channel chan in the mock streams
+uint32_t sample_value(const size_t chan, const size_t idx)
+{
+    return static_cast<uint32_t>((chan << 28) | (idx & 0x0FFFFFFF));
+}
+
+/*!
+ * RX streamer that produces a fixed number of sc16 samples, in packets of
+ * max_num_samps samples. Each sample holds its channel and index.
+ */
+class mock_rx_streamer : public rx_streamer
+{
+public:
+    mock_rx_streamer(const size_t num_chans, const size_t num_samps)
+        : _num_chans(num_chans), _num_samps(num_samps)
+    {
+    }
+
+    size_t get_num_channels() const override
+    {
+        return _num_chans;
+    }
+
+    size_t get_max_num_samps() const override
+    {
+        return 1000;
+    }
+
+    size_t recv(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        rx_metadata_t& metadata,
+        const double timeout,
+        const bool) override
+    {
+        metadata.reset();
+        if (_pos == _num_samps) {
+            std::this_thread::sleep_for(std::chrono::duration<double>(timeout / 10));
+            metadata.error_code = rx_metadata_t::ERROR_CODE_TIMEOUT;
+            return 0;
+        }
+        if (_pos >= error_pos) {
+            failed = true;
+            throw uhd::io_error("mock_rx_streamer: recv() failed");
+        }
+        if (_pos == overflow_pos && !_overflowed) {
+            _overflowed         = true;
+            metadata.error_code = rx_metadata_t::ERROR_CODE_OVERFLOW;
+            return 0;
+        }
+        const size_t nsamps =
+            std::min({nsamps_per_buff, get_max_num_samps(), _num_samps - _pos});
+        for (size_t chan = 0; chan < _num_chans; chan++) {
+            uint32_t* buff = static_cast<uint32_t*>(buffs[chan]);
+            for (size_t i = 0; i < nsamps; i++) {
+                buff[i] = sample_value(chan, _pos + i);
+            }
+        }
+        _pos += nsamps;
+        return nsamps;
+    }
+
+    void issue_stream_cmd(const stream_cmd_t&) override {}
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+
+    bool is_done() const
+    {
+        return _pos == _num_samps;
+    }
+
+    //! Position of a simulated overflow
+    size_t overflow_pos = std::numeric_limits<size_t>::max();
+    //! Position from which on recv() throws
+    size_t error_pos = std::numeric_limits<size_t>::max();
+    std::atomic<bool> failed{false};
+
+private:
+    const size_t _num_chans;
+    const size_t _num_samps;
+    std::atomic<size_t> _pos{0};
+    bool _overflowed = false;
+};
+
+//! TX streamer that stores all samples and burst flags it is given
+class mock_tx_streamer : public tx_streamer
+{
+public:
+    mock_tx_streamer(const size_t num_chans) : samps(num_chans) {}
+
+    size_t get_num_channels() const override
+    {
+        return samps.size();
+    }
+
+    size_t get_max_num_samps() const override
+    {
+        return 1000;
+    }
+
+    size_t send(const buffs_type& buffs,
+        const size_t nsamps_per_buff,
+        const tx_metadata_t& metadata,
+        const double) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (nsamps_per_buff && samps[0].size() >= error_pos) {
+            failed = true;
+            throw uhd::io_error("mock_tx_streamer: send() failed");
+        }
+        for (size_t chan = 0; chan < samps.size(); chan++) {
+            const uint32_t* buff = static_cast<const uint32_t*>(buffs[chan]);
+            samps[chan].insert(samps[chan].end(), buff, buff + nsamps_per_buff);
+        }
+        if (metadata.start_of_burst) {
+            num_sob++;
+        }
+        if (metadata.end_of_burst) {
+            num_eob++;
+        }
+        return nsamps_per_buff;
+    }
+
+    bool recv_async_msg(async_metadata_t&, double) override
+    {
+        return false;
+    }
+
+    void post_output_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+
+    //! Number of samples per channel after which send() throws
+    size_t error_pos = std::numeric_limits<size_t>::max();
+    std::atomic<bool> failed{false};
+
+    std::mutex mutex;
+    std::vector<std::vector<uint32_t>> samps;
+    size_t num_sob = 0;
+    size_t num_eob = 0;
+};
+
+//! Temporary directory, on tmpfs if available
+class temp_dir
+{
+public:
+    temp_dir()
+    {
+        const fs::path base = fs::exists("/dev/shm") ? fs::path("/dev/shm")
+                                                     : fs::temp_directory_path();
+        path = base / fs::unique_path("uhd-stream-recorder-%%%%-%%%%");
+        fs::create_directories(path);
+    }
+
+    ~temp_dir()
+    {
+        fs::remove_all(path);
+    }
+
+    std::vector<std::string> make_filenames(const size_t num_chans) const
+    {
+        std::vector<std::string> filenames;
+        for (size_t chan = 0; chan < num_chans; chan++) {
+            const std::string filename = "chan" + std::to_string(chan) + ".dat";
+            filenames.push_back((path / filename).string());
+        }
+        return filenames;
+    }
+
+    fs::path path;
+};
+
+std::vector<uint32_t> read_file(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    std::vector<uint32_t> data(fs::file_size(filename) / sizeof(uint32_t));
+    file.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(uint32_t));
+    return data;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_record)
+{
+    constexpr size_t NUM_CHANS  = 3;
+    constexpr size_t BLOCK_SIZE = 64 * 1024;
+    // Ends in the middle of a block, and in the middle of a packet
+    constexpr size_t NUM_SAMPS = (10 * BLOCK_SIZE + 1234) / BPI;
+
+    temp_dir dir;
+    const auto filenames    = dir.make_filenames(NUM_CHANS);
+    auto rx_stream          = std::make_shared<mock_rx_streamer>(NUM_CHANS, NUM_SAMPS);
+    rx_stream->overflow_pos = 5000;
+
+    auto recorder = stream_recorder::make(rx_stream,
+        "sc16",
+        filenames,
+        device_addr_t("block_size=65536,ring_size=1048576"));
+    recorder->start();
+    while (!rx_stream->is_done()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    recorder->stop();
+
+    const auto stats = recorder->get_stats();
+    BOOST_CHECK_EQUAL(stats.num_samps_received, NUM_SAMPS);
+    BOOST_CHECK_EQUAL(stats.num_samps_written, NUM_SAMPS);
+    BOOST_CHECK_EQUAL(stats.num_samps_dropped, 0);
+    BOOST_CHECK_EQUAL(stats.num_overflows, 1);
+    BOOST_CHECK(stats.max_ring_fill <= 1048576);
+
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        const auto data = read_file(filenames[chan]);
+        BOOST_REQUIRE_EQUAL(data.size(), NUM_SAMPS);
+        for (size_t i = 0; i < NUM_SAMPS; i++) {
+            if (data[i] != sample_value(chan, i)) {
+                BOOST_ERROR("Wrong sample " << i << " in channel " << chan);
+                break;
+            }
+        }
+    }
+
+    // A recorder can't be restarted, since the files end with a partial block
+    BOOST_CHECK_THROW(recorder->start(), uhd::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_record_invalid_args)
+{
+    temp_dir dir;
+    auto rx_stream = std::make_shared<mock_rx_streamer>(2, 0);
+
+    // One file per channel
+    BOOST_CHECK_THROW(stream_recorder::make(rx_stream, "sc16", dir.make_filenames(1)),
+        uhd::value_error);
+    // Blocks must be aligned for O_DIRECT
+    BOOST_CHECK_THROW(stream_recorder::make(rx_stream,
+                          "sc16",
+                          dir.make_filenames(2),
+                          device_addr_t("block_size=1000")),
+        uhd::value_error);
+    // The ring needs room for two blocks
+    BOOST_CHECK_THROW(stream_recorder::make(rx_stream,
+                          "sc16",
+                          dir.make_filenames(2),
+                          device_addr_t("block_size=4096,ring_size=4096")),
+        uhd::value_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_record_and_play)
+{
+    constexpr size_t NUM_CHANS = 2;
+    constexpr size_t NUM_SAMPS = 123457;
+
+    temp_dir dir;
+    const auto filenames = dir.make_filenames(NUM_CHANS);
+    {
+        auto rx_stream = std::make_shared<mock_rx_streamer>(NUM_CHANS, NUM_SAMPS);
+        auto recorder  = stream_recorder::make(rx_stream, "sc16", filenames);
+        recorder->start();
+        while (!rx_stream->is_done()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    auto tx_stream = std::make_shared<mock_tx_streamer>(NUM_CHANS);
+    auto player    = stream_player::make(
+        tx_stream, "sc16", filenames, device_addr_t("samps_per_send=10000"));
+    player->start();
+    BOOST_REQUIRE(player->wait_done(10.0));
+
+    BOOST_CHECK_EQUAL(player->get_stats().num_samps_sent, NUM_SAMPS);
+    BOOST_CHECK_EQUAL(player->get_stats().num_repetitions, 1);
+    BOOST_CHECK_EQUAL(tx_stream->num_sob, 1);
+    BOOST_CHECK_EQUAL(tx_stream->num_eob, 1);
+    for (size_t chan = 0; chan < NUM_CHANS; chan++) {
+        BOOST_REQUIRE_EQUAL(tx_stream->samps[chan].size(), NUM_SAMPS);
+        for (size_t i = 0; i < NUM_SAMPS; i++) {
+            if (tx_stream->samps[chan][i] != sample_value(chan, i)) {
+                BOOST_ERROR("Wrong sample " << i << " in channel " << chan);
+                break;
+            }
+        }
+    }
+
+    // Playing in a loop ends the burst when stopped
+    auto tx_stream_repeat = std::make_shared<mock_tx_streamer>(NUM_CHANS);
+    auto player_repeat    = stream_player::make(
+        tx_stream_repeat, "sc16", filenames, device_addr_t("repeat=1"));
+    player_repeat->start();
+    while (player_repeat->get_stats().num_repetitions < 3) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    player_repeat->stop();
+    BOOST_CHECK_EQUAL(tx_stream_repeat->num_sob, 1);
+    BOOST_CHECK_EQUAL(tx_stream_repeat->num_eob, 1);
+    BOOST_CHECK_EQUAL(
+        tx_stream_repeat->samps[0].size(), player_repeat->get_stats().num_samps_sent);
+}
+
+BOOST_AUTO_TEST_CASE(test_stream_errors)
+{
+    constexpr size_t NUM_SAMPS = 10000;
+    constexpr size_t ERROR_POS = 3000;
+
+    temp_dir dir;
+    const auto filenames = dir.make_filenames(1);
+
+    // Receive errors end the recording, and are thrown from stop()
+    auto rx_stream       = std::make_shared<mock_rx_streamer>(1, NUM_SAMPS);
+    rx_stream->error_pos = ERROR_POS;
+    auto recorder        = stream_recorder::make(rx_stream, "sc16", filenames);
+    recorder->start();
+    while (!rx_stream->failed) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    BOOST_CHECK_THROW(recorder->stop(), uhd::io_error);
+    BOOST_CHECK_EQUAL(recorder->get_stats().num_samps_written, ERROR_POS);
+    BOOST_CHECK_EQUAL(read_file(filenames[0]).size(), ERROR_POS);
+
+    // Send errors end the playback, and are thrown once
+    constexpr size_t TX_ERROR_POS = 2000;
+    auto tx_stream                = std::make_shared<mock_tx_streamer>(1);
+    tx_stream->error_pos          = TX_ERROR_POS;
+    auto player                   = stream_player::make(
+        tx_stream, "sc16", filenames, device_addr_t("samps_per_send=1000"));
+    player->start();
+    BOOST_CHECK_THROW(player->wait_done(10.0), uhd::io_error);
+    BOOST_CHECK(player->wait_done(0.0));
+    BOOST_CHECK_NO_THROW(player->stop());
+    BOOST_CHECK_EQUAL(player->get_stats().num_samps_sent, TX_ERROR_POS);
+
+    // Also when the player is stopped without waiting for it
+    tx_stream->samps[0].clear();
+    tx_stream->failed = false;
+    auto player_repeat = stream_player::make(tx_stream,
+        "sc16",
+        filenames,
+        device_addr_t("repeat=1,samps_per_send=1000"));
+    player_repeat->start();
+    while (!tx_stream->failed) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    BOOST_CHECK_THROW(player_repeat->stop(), uhd::io_error);
+}
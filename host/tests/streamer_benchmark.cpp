@@ -13,9 +13,12 @@
 #include <uhdlib/transport/rx_streamer_impl.hpp>
 #include <uhdlib/transport/tx_streamer_impl.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace po = boost::program_options;
@@ -250,40 +253,66 @@ using tx_streamer_mock_link  = mock_tx_streamer<chdr_tx_data_xport>;
 /*!
  * Helper functions
  */
+static uhd::stream_args_t make_stream_args(
+    const std::string& format, const size_t num_conv_threads)
+{
+    uhd::stream_args_t stream_args(format, "sc16");
+    if (num_conv_threads > 0) {
+        stream_args.args["conv_threads"] = std::to_string(num_conv_threads);
+        // Pin the conversion threads to their own cores, if there are enough,
+        // and leave core 0 to the thread that calls recv() or send()
+        if (num_conv_threads < std::thread::hardware_concurrency()) {
+            for (size_t i = 0; i < num_conv_threads; i++) {
+                stream_args.args["conv_thread_" + std::to_string(i) + "_cpu"] =
+                    std::to_string(i + 1);
+            }
+        }
+    }
+    return stream_args;
+}
+
 static std::shared_ptr<rx_streamer_mock_xport> make_rx_streamer_mock_xport(
-    const size_t spp, const std::string& format)
+    const size_t spp,
+    const std::string& format,
+    const size_t num_chans        = 1,
+    const size_t num_conv_threads = 0)
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
-    auto streamer = std::make_shared<rx_streamer_mock_xport>(1, stream_args);
+    const uhd::stream_args_t stream_args = make_stream_args(format, num_conv_threads);
+    auto streamer = std::make_shared<rx_streamer_mock_xport>(num_chans, stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
-    streamer->set_scale_factor(0, SCALE_FACTOR);
 
     const size_t bpi        = convert::get_bytes_per_item(format);
     const size_t frame_size = bpi * spp;
 
-    auto xport = std::make_unique<mock_rx_data_xport>(frame_size);
-
-    streamer->connect_channel(0, std::move(xport));
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        auto xport = std::make_unique<mock_rx_data_xport>(frame_size);
+        streamer->connect_channel(chan, std::move(xport));
+    }
 
     return streamer;
 }
 
 static std::shared_ptr<tx_streamer_mock_xport> make_tx_streamer_mock_xport(
-    const size_t spp, const std::string& format)
+    const size_t spp,
+    const std::string& format,
+    const size_t num_chans        = 1,
+    const size_t num_conv_threads = 0)
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
-    auto streamer = std::make_shared<tx_streamer_mock_xport>(1, stream_args);
+    const uhd::stream_args_t stream_args = make_stream_args(format, num_conv_threads);
+    auto streamer = std::make_shared<tx_streamer_mock_xport>(num_chans, stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
-    streamer->set_scale_factor(0, SCALE_FACTOR);
 
     const size_t bpi        = convert::get_bytes_per_item(format);
     const size_t frame_size = bpi * spp + sizeof(mock_tx_data_xport::packet_info_t);
 
-    auto xport = std::make_unique<mock_tx_data_xport>(frame_size);
-
-    streamer->connect_channel(0, std::move(xport));
+    for (size_t chan = 0; chan < num_chans; chan++) {
+        streamer->set_scale_factor(chan, SCALE_FACTOR);
+        auto xport = std::make_unique<mock_tx_data_xport>(frame_size);
+        streamer->connect_channel(chan, std::move(xport));
+    }
 
     return streamer;
 }
@@ -388,20 +417,24 @@ static std::shared_ptr<tx_streamer_mock_link> make_tx_streamer_mock_link(
 /*!
  * Benchmark of rx streamer
  */
-void benchmark_rx_streamer(
-    rx_streamer::sptr streamer, const size_t spp, const std::string& format)
+double benchmark_rx_streamer(rx_streamer::sptr streamer,
+    const size_t spp,
+    const std::string& format,
+    const size_t iterations = 1e7)
 {
-    // Allocate buffer
+    // Allocate buffers
     const size_t bpi = convert::get_bytes_per_item(format);
-    std::vector<uint8_t> buffer(spp * bpi);
+    std::vector<std::vector<uint8_t>> buffer(
+        streamer->get_num_channels(), std::vector<uint8_t>(spp * bpi));
     std::vector<void*> buffers;
-    buffers.push_back(buffer.data());
+    for (auto& chan_buffer : buffer) {
+        buffers.push_back(chan_buffer.data());
+    }
 
     // Run benchmark
     uhd::rx_metadata_t md;
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    const auto start_time = std::chrono::steady_clock::now();
 
     for (size_t i = 0; i < iterations; i++) {
         streamer->recv(buffers, spp, md, 1.0, true);
@@ -413,28 +446,32 @@ void benchmark_rx_streamer(
 
     std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
               << time_per_packet * 1e9 << " ns/packet\n";
+    return time_per_packet;
 }
 
 /*!
  * Benchmark of tx streamer
  */
-void benchmark_tx_streamer(tx_streamer::sptr streamer,
+double benchmark_tx_streamer(tx_streamer::sptr streamer,
     const size_t spp,
     const std::string& format,
-    bool use_time_spec)
+    bool use_time_spec,
+    const size_t iterations = 1e7)
 {
-    // Allocate buffer
+    // Allocate buffers
     const size_t bpi = convert::get_bytes_per_item(format);
-    std::vector<uint8_t> buffer(spp * bpi);
+    std::vector<std::vector<uint8_t>> buffer(
+        streamer->get_num_channels(), std::vector<uint8_t>(spp * bpi));
     std::vector<void*> buffers;
-    buffers.push_back(buffer.data());
+    for (auto& chan_buffer : buffer) {
+        buffers.push_back(chan_buffer.data());
+    }
 
     // Run benchmark
     uhd::tx_metadata_t md;
     md.has_time_spec = use_time_spec;
 
-    const auto start_time   = std::chrono::steady_clock::now();
-    const size_t iterations = 1e7;
+    const auto start_time = std::chrono::steady_clock::now();
 
     for (size_t i = 0; i < iterations; i++) {
         if (use_time_spec) {
@@ -449,12 +486,66 @@ void benchmark_tx_streamer(tx_streamer::sptr streamer,
 
     std::cout << format << ": " << time_per_packet / spp * 1e9 << " ns/sample, "
               << time_per_packet * 1e9 << " ns/packet\n";
+    return time_per_packet;
+}
+
+/*!
+ * Benchmark of multi-channel streamers with a varying number of conversion
+ * threads. Prints the aggregate rate across all channels.
+ */
+void benchmark_channel_scaling(
+    const size_t spp, const std::string& format, const size_t max_conv_threads)
+{
+    // Keep the number of converted samples about the same for every setup
+    constexpr size_t samps_per_setup = 1e9;
+
+    for (const size_t num_chans : {1, 2, 4, 8, 16}) {
+        const size_t iterations = samps_per_setup / (spp * num_chans);
+
+        std::vector<size_t> thread_counts = {0};
+        for (size_t num_threads = 1;
+             num_threads <= max_conv_threads && num_threads < num_chans;
+             num_threads *= 2) {
+            thread_counts.push_back(num_threads);
+        }
+
+        for (const size_t num_threads : thread_counts) {
+            std::cout << num_chans << " chans, " << num_threads << " conv threads\n";
+
+            std::cout << "  recv ";
+            auto rx_streamer =
+                make_rx_streamer_mock_xport(spp, format, num_chans, num_threads);
+            const double rx_time =
+                benchmark_rx_streamer(rx_streamer, spp, format, iterations);
+            rx_streamer.reset();
+
+            std::cout << "  send ";
+            auto tx_streamer =
+                make_tx_streamer_mock_xport(spp, format, num_chans, num_threads);
+            const double tx_time =
+                benchmark_tx_streamer(tx_streamer, spp, format, false, iterations);
+            tx_streamer.reset();
+
+            std::cout << "  aggregate rate: recv " << spp * num_chans / rx_time / 1e6
+                      << " Msps, send " << spp * num_chans / tx_time / 1e6 << " Msps\n";
+        }
+    }
 }
 
 int UHD_SAFE_MAIN(int argc, char* argv[])
 {
+    const size_t num_cores = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t max_conv_threads;
     po::options_description desc("Allowed options");
-    desc.add_options()("help", "help message");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("max-conv-threads", po::value<size_t>(&max_conv_threads)->default_value(
+            std::min<size_t>(num_cores - 1, 8)),
+            "maximum number of conversion threads for the multi-channel benchmark")
+        ;
+    // clang-format on
 
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -466,6 +557,8 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
         std::cout << "    Benchmark of send and receive streamer functions\n"
                      "    All benchmarks use mock transport objects. No\n"
                      "    parameters are needed to run this benchmark.\n"
+                     "    The multi-channel benchmark doubles the number of\n"
+                     "    conversion threads up to --max-conv-threads.\n"
                   << std::endl;
         return EXIT_FAILURE;
     }
@@ -542,5 +635,16 @@ int UHD_SAFE_MAIN(int argc, char* argv[])
     }
     std::cout << "\n";
 
+    std::cout << "----------------------------------------------------------\n";
+    std::cout << "Benchmark of multi-channel streamers with mock transport  \n";
+    std::cout << "                                                          \n";
+    std::cout << "   Measures the aggregate rate of all channels, with      \n";
+    std::cout << "   conversion spread across the conv_threads stream arg.  \n";
+    std::cout << "----------------------------------------------------------\n";
+
+    std::cout << "*** fc32 ***\n";
+    benchmark_channel_scaling(spp, "fc32", max_conv_threads);
+    std::cout << "\n";
+
     return EXIT_SUCCESS;
 }
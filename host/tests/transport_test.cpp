@@ -186,3 +186,62 @@ BOOST_AUTO_TEST_CASE(test_oversubscribed)
     UHD_ASSERT_THROW(recv_xport->get_msg(msg) == false);
 }
 */
+
+BOOST_AUTO_TEST_CASE(test_many_muxed_clients)
+{
+    constexpr size_t NUM_XPORTS = 8;
+    auto io_srv    = inline_io_service::make();
+    auto send_link = make_send_link(NUM_XPORTS * 40);
+    io_srv->attach_send_link(send_link);
+    auto recv_link = make_recv_link(NUM_XPORTS * 40);
+    io_srv->attach_recv_link(recv_link);
+
+    std::vector<mock_send_transport::sptr> send_xports;
+    std::vector<mock_recv_transport::sptr> recv_xports;
+    for (size_t i = 0; i < NUM_XPORTS; i++) {
+        const uint16_t src_addr = static_cast<uint16_t>(i + 2);
+        send_xports.push_back(
+            make_send_xport(io_srv, send_link, recv_link, 1, src_addr, 32));
+        recv_xports.push_back(
+            make_recv_xport(io_srv, recv_link, send_link, 1, src_addr, 32));
+    }
+
+    auto send_data = [&](size_t xport) {
+        auto send_buff = send_xports[xport]->get_data_buff(0);
+        UHD_ASSERT_THROW(send_buff);
+        auto buff_data = send_xports[xport]->buff_to_data(send_buff.get());
+        buff_data.first[0] = static_cast<uint32_t>(xport);
+        send_xports[xport]->release_data_buff(send_buff, 1);
+        /* Also moves over the flow control packets of the receivers */
+        while (send_link->get_num_packets() > 0) {
+            auto packet = send_link->pop_send_packet();
+            recv_link->push_back_recv_packet(packet.first, packet.second);
+        }
+    };
+    auto check_data = [&](size_t xport) {
+        auto recv_buff = recv_xports[xport]->get_data_buff(0);
+        UHD_ASSERT_THROW(recv_buff);
+        auto recv_data = recv_xports[xport]->buff_to_data(recv_buff.get());
+        UHD_ASSERT_THROW(recv_data.second == 1);
+        UHD_ASSERT_THROW(recv_data.first[0] == static_cast<uint32_t>(xport));
+        recv_xports[xport]->release_data_buff(std::move(recv_buff));
+    };
+
+    /* Receive in reverse order, so packets for other clients get queued first */
+    for (size_t round = 0; round < 3; round++) {
+        for (size_t i = 0; i < NUM_XPORTS; i++) {
+            send_data(i);
+        }
+        for (size_t i = NUM_XPORTS; i > 0; i--) {
+            check_data(i - 1);
+        }
+    }
+
+    /* Replace a client, its packets must go to the new one */
+    recv_xports[3].reset();
+    recv_xports[3] = make_recv_xport(io_srv, recv_link, send_link, 1, 5, 32);
+    send_data(3);
+    send_data(0);
+    check_data(0);
+    check_data(3);
+}
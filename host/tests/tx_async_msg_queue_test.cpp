@@ -0,0 +1,126 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhdlib/rfnoc/tx_async_msg_queue.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+#ifdef UHD_PLATFORM_LINUX
+#    include <poll.h>
+#endif
+
+using namespace uhd;
+using namespace uhd::rfnoc;
+using namespace std::chrono_literals;
+
+namespace {
+
+async_metadata_t make_msg(
+    const size_t channel, const async_metadata_t::event_code_t event_code)
+{
+    async_metadata_t md;
+    md.channel    = channel;
+    md.event_code = event_code;
+    return md;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_recv_timeout)
+{
+    tx_async_msg_queue queue(16);
+    async_metadata_t md;
+
+    BOOST_CHECK(!queue.recv_async_msg(md, 0));
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_CHECK(!queue.recv_async_msg(md, 20));
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= 20ms);
+
+    queue.enqueue(make_msg(1, async_metadata_t::EVENT_CODE_BURST_ACK));
+    BOOST_REQUIRE(queue.recv_async_msg(md, 0));
+    BOOST_CHECK_EQUAL(md.channel, 1);
+    BOOST_CHECK_EQUAL(md.event_code, async_metadata_t::EVENT_CODE_BURST_ACK);
+}
+
+BOOST_AUTO_TEST_CASE(test_recv_wakeup)
+{
+    tx_async_msg_queue queue(16);
+
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(10ms);
+        queue.enqueue(make_msg(2, async_metadata_t::EVENT_CODE_UNDERFLOW));
+    });
+
+    // The waiting thread must be woken up by the message, not by the timeout
+    async_metadata_t md;
+    const auto start = std::chrono::steady_clock::now();
+    BOOST_REQUIRE(queue.recv_async_msg(md, 10000));
+    BOOST_CHECK(std::chrono::steady_clock::now() - start < 5s);
+    BOOST_CHECK_EQUAL(md.channel, 2);
+    BOOST_CHECK_EQUAL(md.event_code, async_metadata_t::EVENT_CODE_UNDERFLOW);
+    producer.join();
+}
+
+BOOST_AUTO_TEST_CASE(test_callback)
+{
+    tx_async_msg_queue queue(16);
+    std::vector<async_metadata_t::event_code_t> events;
+    queue.register_callback(
+        [&events](const async_metadata_t& md) { events.push_back(md.event_code); });
+
+    queue.enqueue(make_msg(0, async_metadata_t::EVENT_CODE_UNDERFLOW));
+    queue.enqueue(make_msg(0, async_metadata_t::EVENT_CODE_SEQ_ERROR));
+    BOOST_REQUIRE_EQUAL(events.size(), 2);
+    BOOST_CHECK_EQUAL(events[0], async_metadata_t::EVENT_CODE_UNDERFLOW);
+    BOOST_CHECK_EQUAL(events[1], async_metadata_t::EVENT_CODE_SEQ_ERROR);
+
+    // Messages are still queued
+    async_metadata_t md;
+    BOOST_CHECK(queue.recv_async_msg(md, 0));
+    BOOST_CHECK(queue.recv_async_msg(md, 0));
+    BOOST_CHECK(!queue.recv_async_msg(md, 0));
+}
+
+BOOST_AUTO_TEST_CASE(test_register_from_callback)
+{
+    tx_async_msg_queue queue(16);
+    size_t num_outer = 0, num_inner = 0;
+    queue.register_callback([&](const async_metadata_t&) {
+        if (num_outer++ == 0) {
+            queue.register_callback([&](const async_metadata_t&) { num_inner++; });
+        }
+    });
+
+    // The new callback is only called for the next message
+    queue.enqueue(make_msg(0, async_metadata_t::EVENT_CODE_UNDERFLOW));
+    BOOST_CHECK_EQUAL(num_outer, 1);
+    BOOST_CHECK_EQUAL(num_inner, 0);
+    queue.enqueue(make_msg(0, async_metadata_t::EVENT_CODE_UNDERFLOW));
+    BOOST_CHECK_EQUAL(num_outer, 2);
+    BOOST_CHECK_EQUAL(num_inner, 1);
+}
+
+#ifdef UHD_PLATFORM_LINUX
+BOOST_AUTO_TEST_CASE(test_event_fd)
+{
+    tx_async_msg_queue queue(16);
+    pollfd pfd{queue.get_event_fd(), POLLIN, 0};
+    BOOST_REQUIRE(pfd.fd >= 0);
+    BOOST_CHECK_EQUAL(poll(&pfd, 1, 0), 0);
+
+    queue.enqueue(make_msg(0, async_metadata_t::EVENT_CODE_BURST_ACK));
+    queue.enqueue(make_msg(1, async_metadata_t::EVENT_CODE_BURST_ACK));
+    BOOST_CHECK_EQUAL(poll(&pfd, 1, 0), 1);
+
+    // The descriptor stays readable until all messages have been retrieved
+    async_metadata_t md;
+    BOOST_REQUIRE(queue.recv_async_msg(md, 0));
+    BOOST_CHECK_EQUAL(poll(&pfd, 1, 0), 1);
+    BOOST_REQUIRE(queue.recv_async_msg(md, 0));
+    BOOST_CHECK_EQUAL(poll(&pfd, 1, 0), 0);
+}
+#endif
@@ -140,9 +140,12 @@ static std::vector<mock_send_link::sptr> make_links(const size_t num)
 }
 
 static std::shared_ptr<mock_tx_streamer> make_tx_streamer(
-    std::vector<mock_send_link::sptr> send_links, const std::string& format)
+    std::vector<mock_send_link::sptr> send_links,
+    const std::string& format,
+    const uhd::device_addr_t& args = uhd::device_addr_t())
 {
-    const uhd::stream_args_t stream_args(format, "sc16");
+    uhd::stream_args_t stream_args(format, "sc16");
+    stream_args.args = args;
     auto streamer = std::make_shared<mock_tx_streamer>(send_links.size(), stream_args);
     streamer->set_tick_rate(TICK_RATE);
     streamer->set_samp_rate(SAMP_RATE);
@@ -635,6 +638,52 @@ BOOST_AUTO_TEST_CASE(test_send_two_channel_one_packet)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_send_multi_channel_conv_threads)
+{
+    const size_t NUM_PKTS_TO_TEST = 5;
+    const std::string format("sc16");
+
+    const size_t num_chans = 8;
+
+    auto send_links = make_links(num_chans);
+    auto streamer =
+        make_tx_streamer(send_links, format, uhd::device_addr_t("conv_threads=3"));
+
+    // Allocate buffers and write different data for each channel
+    const size_t num_samps = 20;
+    std::vector<std::vector<std::complex<uint16_t>>> buff(num_chans);
+    std::vector<void*> buffs;
+    for (size_t ch = 0; ch < num_chans; ch++) {
+        for (size_t i = 0; i < num_samps; i++) {
+            const size_t n = ch * num_samps + i;
+            buff[ch].push_back(std::complex<uint16_t>(n * 2, n * 2 + 1));
+        }
+        buffs.push_back(buff[ch].data());
+    }
+
+    uhd::tx_metadata_t metadata;
+
+    for (size_t i = 0; i < NUM_PKTS_TO_TEST; i++) {
+        const size_t num_sent = streamer->send(buffs, num_samps, metadata, 1.0);
+        BOOST_CHECK_EQUAL(num_sent, num_samps);
+
+        for (size_t ch = 0; ch < num_chans; ch++) {
+            mock_tx_data_xport::packet_info_t info;
+            std::complex<uint16_t>* data;
+            size_t packet_samps;
+            boost::shared_array<uint8_t> frame_buff;
+
+            std::tie(info, data, packet_samps, frame_buff) =
+                pop_send_packet(send_links[ch]);
+            BOOST_CHECK_EQUAL(num_samps, packet_samps);
+
+            for (size_t j = 0; j < num_samps; j++) {
+                BOOST_CHECK_EQUAL(buff[ch][j], data[j]);
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_meta_data_cache)
 {
     auto send_links = make_links(1);
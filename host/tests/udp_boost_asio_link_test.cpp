@@ -0,0 +1,112 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <sys/socket.h>
+#include <boost/asio.hpp>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace uhd::transport;
+namespace asio = boost::asio;
+
+constexpr size_t FRAME_SIZE = 1024;
+constexpr size_t NUM_FRAMES = 16;
+constexpr size_t BATCH_SIZE = 8;
+
+namespace {
+
+void send_seq(int fd, uint32_t seq, size_t len)
+{
+    uint8_t buf[FRAME_SIZE];
+    std::memset(buf, static_cast<int>(seq & 0xff), len);
+    std::memcpy(buf, &seq, sizeof(seq));
+    UHD_ASSERT_THROW(::send(fd, buf, len, 0) == static_cast<ssize_t>(len));
+}
+
+void check_seq(const frame_buff::uptr& buff, uint32_t seq)
+{
+    const size_t expected_len = 64 + (seq % 128);
+    BOOST_REQUIRE_EQUAL(buff->packet_size(), expected_len);
+    const uint8_t* mem = static_cast<const uint8_t*>(buff->data());
+    uint32_t recvd_seq;
+    std::memcpy(&recvd_seq, mem, sizeof(recvd_seq));
+    BOOST_CHECK_EQUAL(recvd_seq, seq);
+    BOOST_CHECK_EQUAL(mem[expected_len - 1], static_cast<uint8_t>(seq & 0xff));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_recv_batch)
+{
+    link_params_t params;
+    params.num_recv_frames = NUM_FRAMES;
+    params.num_send_frames = NUM_FRAMES;
+    params.recv_frame_size = FRAME_SIZE;
+    params.send_frame_size = FRAME_SIZE;
+    params.recv_buff_size  = NUM_FRAMES * FRAME_SIZE * 16;
+    params.send_buff_size  = NUM_FRAMES * FRAME_SIZE * 4;
+    params.recv_batch_size = BATCH_SIZE;
+
+    // The "device" end of the link
+    asio::io_context io_context;
+    asio::ip::udp::socket dev_sock(
+        io_context, asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 0));
+
+    size_t recv_buff_size, send_buff_size;
+    auto link = udp_boost_asio_link::make("127.0.0.1",
+        std::to_string(dev_sock.local_endpoint().port()),
+        params,
+        recv_buff_size,
+        send_buff_size);
+    dev_sock.connect(asio::ip::udp::endpoint(
+        asio::ip::address_v4::loopback(), link->get_local_port()));
+
+    BOOST_CHECK(!link->get_recv_buff(0));
+
+    // Send rounds that don't line up with the batches, and hold up to half of
+    // the frames, so staged datagrams are handed out while other frames of
+    // the same batch are still in use
+    constexpr size_t PACKETS_PER_ROUND = 3 * BATCH_SIZE + 3;
+    uint32_t tx_seq = 0, rx_seq = 0;
+    std::vector<frame_buff::uptr> held;
+    for (size_t round = 0; round < 8; round++) {
+        for (size_t i = 0; i < PACKETS_PER_ROUND; i++) {
+            send_seq(dev_sock.native_handle(), tx_seq, 64 + (tx_seq % 128));
+            tx_seq++;
+        }
+        for (size_t i = 0; i < PACKETS_PER_ROUND; i++) {
+            auto buff = link->get_recv_buff(1000);
+            BOOST_REQUIRE(buff);
+            check_seq(buff, rx_seq);
+            rx_seq++;
+            held.push_back(std::move(buff));
+            if (held.size() == NUM_FRAMES / 2) {
+                for (auto& b : held) {
+                    link->release_recv_buff(std::move(b));
+                }
+                held.clear();
+            }
+        }
+        // Nothing is left over once all datagrams were handed out
+        BOOST_CHECK(!link->get_recv_buff(0));
+    }
+    for (auto& b : held) {
+        link->release_recv_buff(std::move(b));
+    }
+    held.clear();
+
+    // A frame that arrives while the link waits is received
+    auto buff = link->get_recv_buff(0);
+    BOOST_CHECK(!buff);
+    send_seq(dev_sock.native_handle(), tx_seq, 64 + (tx_seq % 128));
+    buff = link->get_recv_buff(1000);
+    BOOST_REQUIRE(buff);
+    check_seq(buff, tx_seq);
+    link->release_recv_buff(std::move(buff));
+}
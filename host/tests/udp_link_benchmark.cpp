@@ -0,0 +1,143 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/transport/udp_boost_asio_link.hpp>
+#include <boost/asio.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace po   = boost::program_options;
+namespace asio = boost::asio;
+using namespace uhd::transport;
+
+/*!
+ * Benchmark of the receive path of udp_boost_asio_link over a loopback socket
+ * pair.
+ *
+ * A plain socket plays the role of the device. It sends a round of datagrams
+ * that fits into the socket buffer, then the link drains them. Only the time
+ * spent draining is measured, so this is the host-side per-packet cost of the
+ * link (syscalls, polling) without any packet loss.
+ */
+void benchmark_recv(const size_t batch_size,
+    const bool use_io_uring,
+    const size_t frame_size,
+    const size_t packets_per_round,
+    const size_t num_rounds)
+{
+    asio::io_context io_context;
+    asio::ip::udp::socket peer(
+        io_context, asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 0));
+    const std::string peer_port = std::to_string(peer.local_endpoint().port());
+
+    constexpr size_t num_frames = 32;
+    const size_t min_buff_size  = num_frames * MAX_ETHERNET_MTU;
+
+    link_params_t params;
+    params.num_recv_frames = num_frames;
+    params.num_send_frames = num_frames;
+    params.recv_frame_size = frame_size;
+    params.send_frame_size = frame_size;
+    params.recv_buff_size  = std::max(packets_per_round * frame_size * 4, min_buff_size);
+    params.send_buff_size  = min_buff_size;
+    params.recv_batch_size = batch_size;
+
+    size_t recv_buff_size, send_buff_size;
+    auto link = udp_boost_asio_link::make(
+        "127.0.0.1", peer_port, params, recv_buff_size, send_buff_size);
+    if (use_io_uring) {
+        link->enable_io_uring();
+    }
+
+    const asio::ip::udp::endpoint link_endpoint(
+        asio::ip::make_address(link->get_local_addr()), link->get_local_port());
+
+    std::vector<uint32_t> tx_data(frame_size / sizeof(uint32_t));
+    uint32_t tx_seq = 0;
+    uint32_t rx_seq = 0;
+
+    std::chrono::duration<double> elapsed_time(0);
+    for (size_t round = 0; round < num_rounds; round++) {
+        for (size_t i = 0; i < packets_per_round; i++) {
+            tx_data[0] = tx_seq++;
+            peer.send_to(asio::buffer(tx_data), link_endpoint);
+        }
+
+        const auto start_time = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < packets_per_round; i++) {
+            auto buff = link->get_recv_buff(100);
+            if (!buff) {
+                throw uhd::runtime_error("Timeout on loopback receive");
+            }
+            if (buff->packet_size() != frame_size
+                || *static_cast<uint32_t*>(buff->data()) != rx_seq++) {
+                throw uhd::runtime_error("Received corrupt or out-of-order datagram");
+            }
+            link->release_recv_buff(std::move(buff));
+        }
+        elapsed_time += std::chrono::steady_clock::now() - start_time;
+    }
+
+    const size_t num_packets = packets_per_round * num_rounds;
+    const std::string mode = use_io_uring
+                                 ? std::string("io_uring")
+                                 : str(boost::format("recv_batch_size=%d") % batch_size);
+    std::cout << boost::format("%-18s: %8.1f ns/packet, %7.3f Gbps\n") % mode
+                     % (elapsed_time.count() / num_packets * 1e9)
+                     % (num_packets * frame_size * 8 / elapsed_time.count() / 1e9);
+}
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    size_t frame_size, packets_per_round, num_rounds;
+    std::vector<size_t> batch_sizes;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("frame-size", po::value<size_t>(&frame_size)->default_value(1024),
+            "datagram size in bytes")
+        ("packets-per-round", po::value<size_t>(&packets_per_round)->default_value(64),
+            "datagrams sent before each drain, must fit into the socket buffer")
+        ("rounds", po::value<size_t>(&num_rounds)->default_value(10000),
+            "number of send/drain rounds")
+        ("batch", po::value<std::vector<size_t>>(&batch_sizes)->multitoken()
+            ->default_value({1, 8, 32}, "1 8 32"),
+            "values of recv_batch_size to benchmark")
+        ("io-uring", "also benchmark receiving through io_uring")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD UDP Link Benchmark %s") % desc << std::endl;
+        std::cout << "    Benchmark of the batched, unbatched, and io_uring receive\n"
+                     "    paths of the kernel UDP link over a loopback socket pair.\n"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "frame size: " << frame_size << " bytes\n";
+    for (const size_t batch_size : batch_sizes) {
+        benchmark_recv(batch_size, false, frame_size, packets_per_round, num_rounds);
+    }
+    if (vm.count("io-uring")) {
+        benchmark_recv(1, true, frame_size, packets_per_round, num_rounds);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,331 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include "../common/mock_zero_copy.hpp"
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/transport/offload_io_service.hpp>
+#include <uhdlib/transport/rx_streamer_impl.hpp>
+#include <uhdlib/transport/tx_streamer_impl.hpp>
+#include <uhdlib/transport/vrt_data_xport.hpp>
+#include <uhdlib/transport/zero_copy_link.hpp>
+#include <boost/test/unit_test.hpp>
+#include <complex>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace uhd::transport;
+
+static const double TICK_RATE = 100e6;
+static const double SAMP_RATE = 10e6;
+static const size_t TICKS_PER_SAMP = size_t(TICK_RATE / SAMP_RATE);
+static const uint32_t SID = 0x00A0;
+
+// The packet format of the B200
+static const auto LINK_TYPE  = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+static const auto ENDIANNESS = uhd::ENDIANNESS_LITTLE;
+
+//! Make the I/O service of a test, the offload thread blocks on the link
+static io_service::sptr make_io_srv(
+    const bool offload, const offload_io_service::client_type_t client_type)
+{
+    if (!offload) {
+        return inline_io_service::make();
+    }
+    offload_io_service::params_t params;
+    params.client_type = client_type;
+    params.wait_mode   = offload_io_service::BLOCK;
+    return offload_io_service::make(inline_io_service::make(), params);
+}
+
+//! Timeout of the streamer calls, the offload thread needs time to get packets
+static double get_timeout(const bool offload)
+{
+    return offload ? 0.5 : 0.0;
+}
+
+/*!
+ * RX streamer on top of the VRT transport, which records inline messages like
+ * the device streamers do
+ */
+class vrt_rx_streamer : public rx_streamer_impl<vrt_rx_data_xport>
+{
+public:
+    vrt_rx_streamer(const uhd::stream_args_t& stream_args)
+        : rx_streamer_impl(1, stream_args, "_item32_le")
+    {
+        set_tick_rate(TICK_RATE);
+        set_samp_rate(SAMP_RATE);
+        set_scale_factor(0, 1.0);
+        set_overrun_handler([this]() { num_overruns++; });
+    }
+
+    void connect(mock_zero_copy::sptr xport, io_service::sptr io_srv)
+    {
+        recv_link_if::sptr link =
+            zero_copy_link::make(xport, xport->get_num_recv_frames(), 0);
+        io_srv->attach_recv_link(link);
+        connect_channel(0,
+            std::make_unique<vrt_rx_data_xport>(io_srv,
+                link,
+                LINK_TYPE,
+                ENDIANNESS,
+                [this](const uhd::rx_metadata_t::error_code_t error_code) {
+                    if (error_code == uhd::rx_metadata_t::ERROR_CODE_OVERFLOW) {
+                        set_stopped_due_to_overrun();
+                    }
+                },
+                [io_srv, link]() { io_srv->detach_recv_link(link); }));
+    }
+
+    void issue_stream_cmd(const uhd::stream_cmd_t&) override {}
+
+    void post_input_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+
+    size_t num_overruns = 0;
+};
+
+class vrt_tx_streamer : public tx_streamer_impl<vrt_tx_data_xport>
+{
+public:
+    vrt_tx_streamer(const uhd::stream_args_t& stream_args)
+        : tx_streamer_impl(1, stream_args, "_item32_le")
+    {
+        set_tick_rate(TICK_RATE);
+        set_samp_rate(SAMP_RATE);
+        set_scale_factor(0, 1.0);
+    }
+
+    void connect(mock_zero_copy::sptr xport, io_service::sptr io_srv)
+    {
+        send_link_if::sptr link =
+            zero_copy_link::make(xport, 0, xport->get_num_send_frames());
+        io_srv->attach_send_link(link);
+        connect_channel(0,
+            std::make_unique<vrt_tx_data_xport>(io_srv,
+                link,
+                SID,
+                LINK_TYPE,
+                ENDIANNESS,
+                [io_srv, link]() { io_srv->detach_send_link(link); }));
+    }
+
+    bool recv_async_msg(uhd::async_metadata_t&, double) override
+    {
+        return false;
+    }
+
+    void post_output_action(
+        const std::shared_ptr<uhd::rfnoc::action_info>&, const size_t) override
+    {
+    }
+};
+
+static vrt::if_packet_info_t make_data_ifpi()
+{
+    vrt::if_packet_info_t ifpi;
+    ifpi.link_type   = LINK_TYPE;
+    ifpi.packet_type = vrt::if_packet_info_t::PACKET_TYPE_DATA;
+    ifpi.has_sid     = true;
+    ifpi.sid         = SID;
+    ifpi.has_cid     = false;
+    ifpi.has_tsi     = false;
+    ifpi.has_tsf     = true;
+    ifpi.has_tlr     = false;
+    return ifpi;
+}
+
+//! Push a data packet with nsamps samples, sample i holds (first + i, -i)
+static void push_data_packet(mock_zero_copy& xport,
+    vrt::if_packet_info_t& ifpi,
+    const size_t nsamps,
+    const int16_t first)
+{
+    ifpi.num_payload_words32 = nsamps;
+    ifpi.num_payload_bytes   = nsamps * sizeof(uint32_t);
+    std::vector<uint32_t> data(nsamps);
+    for (size_t i = 0; i < nsamps; i++) {
+        const int16_t re = int16_t(first + i);
+        const int16_t im = -int16_t(i);
+        data[i] = uhd::htowx((uint32_t(uint16_t(re)) << 16) | uint16_t(im));
+    }
+    xport.push_back_recv_packet<uint32_t, uhd::ENDIANNESS_LITTLE>(ifpi, data);
+}
+
+static void run_vrt_rx_streamer(const bool offload)
+{
+    constexpr size_t NUM_PKTS = 10;
+    constexpr size_t SPP      = 100;
+    const double timeout      = get_timeout(offload);
+
+    auto xport = std::make_shared<mock_zero_copy>(LINK_TYPE);
+    auto ifpi  = make_data_ifpi();
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        ifpi.packet_count = i;
+        ifpi.tsf          = 1000 + i * SPP * TICKS_PER_SAMP;
+        ifpi.eob          = (i == NUM_PKTS - 1);
+        push_data_packet(*xport, ifpi, SPP, int16_t(i * SPP));
+    }
+
+    uhd::stream_args_t stream_args("sc16", "sc16");
+    vrt_rx_streamer streamer(stream_args);
+    streamer.connect(xport, make_io_srv(offload, offload_io_service::RECV_ONLY));
+    BOOST_CHECK_EQUAL(streamer.get_max_num_samps(),
+        (DEFAULT_RECV_FRAME_SIZE - detail::VRT_DATA_HDR_LEN) / sizeof(uint32_t));
+
+    // Read more than one packet per call
+    std::vector<std::complex<int16_t>> buff(SPP * 3 / 2);
+    uhd::rx_metadata_t md;
+    size_t num_samps_recvd = 0;
+    for (size_t call = 0; num_samps_recvd < NUM_PKTS * SPP; call++) {
+        const size_t num_samps =
+            streamer.recv(buff.data(), buff.size(), md, timeout, false);
+        BOOST_REQUIRE_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_NONE);
+        BOOST_REQUIRE(num_samps > 0);
+        BOOST_CHECK(md.has_time_spec);
+        BOOST_CHECK_EQUAL(md.time_spec.to_ticks(TICK_RATE),
+            1000 + num_samps_recvd * TICKS_PER_SAMP);
+        for (size_t i = 0; i < num_samps; i++) {
+            const size_t samp = num_samps_recvd + i;
+            BOOST_CHECK_EQUAL(buff[i].real(), int16_t(samp));
+            BOOST_CHECK_EQUAL(buff[i].imag(), -int16_t(samp % SPP));
+        }
+        num_samps_recvd += num_samps;
+        BOOST_CHECK_EQUAL(md.end_of_burst, num_samps_recvd == NUM_PKTS * SPP);
+    }
+
+    streamer.recv(buff.data(), buff.size(), md, timeout, false);
+    BOOST_CHECK_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_TIMEOUT);
+}
+
+BOOST_AUTO_TEST_CASE(test_vrt_rx_streamer)
+{
+    run_vrt_rx_streamer(false);
+}
+
+BOOST_AUTO_TEST_CASE(test_vrt_rx_streamer_offload)
+{
+    run_vrt_rx_streamer(true);
+}
+
+BOOST_AUTO_TEST_CASE(test_vrt_rx_streamer_errors)
+{
+    constexpr size_t SPP = 10;
+
+    auto xport = std::make_shared<mock_zero_copy>(LINK_TYPE);
+    auto ifpi  = make_data_ifpi();
+    ifpi.tsf   = 0;
+
+    // The sequence numbers wrap around at 12 bits, then packet 1 is missing
+    for (const size_t seq : {0xffe, 0xfff, 0, 2, 3}) {
+        ifpi.packet_count = seq;
+        push_data_packet(*xport, ifpi, SPP, 0);
+    }
+
+    // Overflow message, the stream restarts with any sequence number
+    vrt::if_packet_info_t msg_ifpi = make_data_ifpi();
+    msg_ifpi.packet_type           = vrt::if_packet_info_t::PACKET_TYPE_CONTEXT;
+    msg_ifpi.num_payload_words32   = 1;
+    msg_ifpi.num_payload_bytes     = sizeof(uint32_t);
+    xport->push_back_inline_message_packet<uhd::ENDIANNESS_LITTLE>(
+        msg_ifpi, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+    ifpi.packet_count = 100;
+    push_data_packet(*xport, ifpi, SPP, 0);
+
+    uhd::stream_args_t stream_args("sc16", "sc16");
+    vrt_rx_streamer streamer(stream_args);
+    streamer.connect(xport, make_io_srv(false, offload_io_service::RECV_ONLY));
+
+    std::vector<std::complex<int16_t>> buff(SPP);
+    uhd::rx_metadata_t md;
+    const auto recv = [&]() {
+        const size_t num_samps = streamer.recv(buff.data(), SPP, md, 0.0, true);
+        return md.error_code == uhd::rx_metadata_t::ERROR_CODE_NONE ? num_samps : 0;
+    };
+
+    BOOST_CHECK_EQUAL(recv(), SPP);
+    BOOST_CHECK_EQUAL(recv(), SPP);
+    BOOST_CHECK_EQUAL(recv(), SPP);
+    BOOST_CHECK_EQUAL(recv(), 0);
+    BOOST_CHECK_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+    BOOST_CHECK(md.out_of_sequence);
+    // The packet after the gap is kept
+    BOOST_CHECK_EQUAL(recv(), SPP);
+    BOOST_CHECK_EQUAL(recv(), SPP);
+
+    // The message is consumed by the transport, the packet after it is still
+    // returned before the overflow
+    BOOST_CHECK_EQUAL(recv(), SPP);
+    BOOST_CHECK_EQUAL(streamer.num_overruns, 0);
+    BOOST_CHECK_EQUAL(recv(), 0);
+    BOOST_CHECK_EQUAL(md.error_code, uhd::rx_metadata_t::ERROR_CODE_OVERFLOW);
+    BOOST_CHECK(!md.out_of_sequence);
+    BOOST_CHECK_EQUAL(streamer.num_overruns, 1);
+}
+
+static void run_vrt_tx_streamer(const bool offload)
+{
+    constexpr size_t NUM_SAMPS = 600;
+
+    auto xport = std::make_shared<mock_zero_copy>(LINK_TYPE);
+    uhd::stream_args_t stream_args("sc16", "sc16");
+    auto streamer = std::make_unique<vrt_tx_streamer>(stream_args);
+    streamer->connect(xport, make_io_srv(offload, offload_io_service::SEND_ONLY));
+    const size_t spp = streamer->get_max_num_samps();
+    BOOST_CHECK_EQUAL(
+        spp, (DEFAULT_SEND_FRAME_SIZE - detail::VRT_DATA_HDR_LEN) / sizeof(uint32_t));
+
+    std::vector<std::complex<int16_t>> buff(NUM_SAMPS);
+    for (size_t i = 0; i < NUM_SAMPS; i++) {
+        buff[i] = std::complex<int16_t>(int16_t(i), -int16_t(i));
+    }
+    uhd::tx_metadata_t md;
+    md.start_of_burst = true;
+    md.end_of_burst   = true;
+    md.has_time_spec  = true;
+    md.time_spec      = uhd::time_spec_t::from_ticks(5000, TICK_RATE);
+    BOOST_CHECK_EQUAL(
+        streamer->send(buff.data(), NUM_SAMPS, md, get_timeout(offload)), NUM_SAMPS);
+    // Disconnect, so the offload thread no longer gets buffers from the mock
+    streamer.reset();
+
+    size_t num_samps_sent = 0;
+    for (size_t seq = 0; num_samps_sent < NUM_SAMPS; seq++) {
+        vrt::if_packet_info_t ifpi;
+        ifpi.link_type = LINK_TYPE;
+        std::vector<uint32_t> payload;
+        xport->pop_send_packet<uint32_t, uhd::ENDIANNESS_LITTLE>(ifpi, payload);
+        const size_t nsamps = std::min(spp, NUM_SAMPS - num_samps_sent);
+        BOOST_CHECK_EQUAL(ifpi.packet_count, seq);
+        BOOST_CHECK(ifpi.has_sid);
+        BOOST_CHECK_EQUAL(ifpi.sid, SID);
+        BOOST_CHECK(ifpi.has_tsf);
+        BOOST_CHECK_EQUAL(ifpi.tsf, 5000 + num_samps_sent * TICKS_PER_SAMP);
+        BOOST_CHECK_EQUAL(ifpi.num_payload_bytes, nsamps * sizeof(uint32_t));
+        BOOST_CHECK_EQUAL(ifpi.eob, num_samps_sent + nsamps == NUM_SAMPS);
+        BOOST_REQUIRE_EQUAL(payload.size(), nsamps);
+        for (size_t i = 0; i < nsamps; i++) {
+            const int16_t samp = int16_t(num_samps_sent + i);
+            const uint32_t item = uhd::wtohx(payload[i]);
+            BOOST_CHECK_EQUAL(int16_t(item >> 16), samp);
+            BOOST_CHECK_EQUAL(int16_t(item & 0xffff), -samp);
+        }
+        num_samps_sent += nsamps;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_vrt_tx_streamer)
+{
+    run_vrt_tx_streamer(false);
+}
+
+BOOST_AUTO_TEST_CASE(test_vrt_tx_streamer_offload)
+{
+    run_vrt_tx_streamer(true);
+}
@@ -0,0 +1,279 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+// Tests the AF_XDP link over a veth pair. The far end of the pair lives in its
+// own network namespace and runs a UDP echo server. Setting this up requires
+// root, so the tests pass without doing anything otherwise.
+
+#include <uhd/exception.hpp>
+#include <uhdlib/transport/udp_xdp_link.hpp>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <boost/format.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+using namespace uhd::transport;
+
+namespace {
+
+constexpr size_t FRAME_SIZE     = 1400;
+constexpr size_t NUM_FRAMES     = 32;
+constexpr uint16_t ECHO_PORT    = 49153;
+const std::string LOCAL_ADDR    = "10.199.77.1";
+const std::string PEER_ADDR     = "10.199.77.2";
+const std::string ECHO_PORT_STR = std::to_string(ECHO_PORT);
+
+bool run(const std::string& cmd)
+{
+    return std::system((cmd + " >/dev/null 2>&1").c_str()) == 0;
+}
+
+std::string run_output(const std::string& cmd)
+{
+    std::string output;
+    FILE* pipe = popen(cmd.c_str(), "r");
+    if (!pipe) {
+        return output;
+    }
+    char buf[256];
+    while (fgets(buf, sizeof(buf), pipe)) {
+        output += buf;
+    }
+    pclose(pipe);
+    return output;
+}
+
+/*!
+ * A veth pair with the peer end in a network namespace, and a UDP echo server
+ * on the peer end
+ */
+class veth_pair
+{
+public:
+    // Deleting a pair takes a while, so every test case gets new names
+    veth_pair(const int id = _next_id++)
+        : netns(str(boost::format("uhd_xdp_%d_%d") % getpid() % id))
+        , iface(str(boost::format("uxdp%d_%da") % (getpid() % 100000) % id))
+        , peer_iface(str(boost::format("uxdp%d_%db") % (getpid() % 100000) % id))
+    {
+        if (geteuid() != 0) {
+            BOOST_TEST_MESSAGE("Not running as root, skipping AF_XDP tests");
+            return;
+        }
+        if (!run("ip netns add " + netns)) {
+            BOOST_TEST_MESSAGE("Cannot create network namespace, skipping AF_XDP tests");
+            return;
+        }
+        _netns_created = true;
+        const std::string peer_cmd = "ip netns exec " + netns + " ";
+        if (!run("ip link add " + iface + " type veth peer name " + peer_iface)
+            || !run("ip link set " + peer_iface + " netns " + netns)
+            || !run("ip addr add " + LOCAL_ADDR + "/24 dev " + iface)
+            || !run("ip link set " + iface + " up")
+            || !run(peer_cmd + "ip addr add " + PEER_ADDR + "/24 dev " + peer_iface)
+            || !run(peer_cmd + "ip link set " + peer_iface + " up")
+            || !run(peer_cmd + "ip link set lo up")) {
+            BOOST_TEST_MESSAGE("Cannot create veth pair, skipping AF_XDP tests");
+            return;
+        }
+
+        std::atomic<int> server_state{0};
+        _echo_thread = std::thread([this, &server_state]() { _echo(server_state); });
+        while (server_state == 0) {
+            std::this_thread::yield();
+        }
+        ok = server_state > 0;
+    }
+
+    ~veth_pair()
+    {
+        _stop = true;
+        if (_echo_thread.joinable()) {
+            _echo_thread.join();
+        }
+        if (_netns_created) {
+            // Removes the peer end, which removes the whole pair
+            run("ip netns del " + netns);
+        }
+    }
+
+    const std::string netns;
+    const std::string iface;
+    const std::string peer_iface;
+    //! True if the pair and the echo server are up
+    bool ok = false;
+
+private:
+    void _echo(std::atomic<int>& state)
+    {
+        // Network namespaces are per thread, so only this thread moves
+        const int ns_fd = open(("/var/run/netns/" + netns).c_str(), O_RDONLY);
+        if (ns_fd < 0 || setns(ns_fd, CLONE_NEWNET) != 0) {
+            state = -1;
+            return;
+        }
+        close(ns_fd);
+        const int sock = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in sa;
+        std::memset(&sa, 0, sizeof(sa));
+        sa.sin_family = AF_INET;
+        sa.sin_port   = htons(ECHO_PORT);
+        inet_pton(AF_INET, PEER_ADDR.c_str(), &sa.sin_addr);
+        timeval tv = {0, 100000};
+        if (sock < 0 || bind(sock, reinterpret_cast<sockaddr*>(&sa), sizeof(sa)) != 0
+            || setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) != 0) {
+            state = -1;
+            return;
+        }
+        state = 1;
+
+        uint8_t buf[9000];
+        while (!_stop) {
+            sockaddr_in from;
+            socklen_t from_len = sizeof(from);
+            const ssize_t len  = recvfrom(
+                sock, buf, sizeof(buf), 0, reinterpret_cast<sockaddr*>(&from), &from_len);
+            if (len >= 0) {
+                sendto(sock, buf, len, 0, reinterpret_cast<sockaddr*>(&from), from_len);
+            }
+        }
+        close(sock);
+    }
+
+    static int _next_id;
+    bool _netns_created = false;
+    std::atomic<bool> _stop{false};
+    std::thread _echo_thread;
+};
+
+int veth_pair::_next_id = 0;
+
+link_params_t make_params()
+{
+    link_params_t params;
+    params.num_recv_frames = NUM_FRAMES;
+    params.num_send_frames = NUM_FRAMES;
+    params.recv_frame_size = FRAME_SIZE;
+    params.send_frame_size = FRAME_SIZE;
+    return params;
+}
+
+//! Send a packet with the given sequence number and check that it comes back
+void check_echo(udp_xdp_link::sptr link, const uint32_t seq)
+{
+    auto send_buff = link->get_send_buff(1000);
+    BOOST_REQUIRE(send_buff);
+    std::memset(send_buff->data(), static_cast<int>(seq & 0xff), FRAME_SIZE);
+    std::memcpy(send_buff->data(), &seq, sizeof(seq));
+    send_buff->set_packet_size(FRAME_SIZE);
+    link->release_send_buff(std::move(send_buff));
+
+    auto recv_buff = link->get_recv_buff(1000);
+    BOOST_REQUIRE(recv_buff);
+    BOOST_REQUIRE_EQUAL(recv_buff->packet_size(), FRAME_SIZE);
+    const uint8_t* mem = static_cast<const uint8_t*>(recv_buff->data());
+    uint32_t recvd_seq;
+    std::memcpy(&recvd_seq, mem, sizeof(recvd_seq));
+    BOOST_CHECK_EQUAL(recvd_seq, seq);
+    BOOST_CHECK_EQUAL(mem[FRAME_SIZE - 1], static_cast<uint8_t>(seq & 0xff));
+    link->release_recv_buff(std::move(recv_buff));
+}
+
+//! Echo a datagram through a regular kernel socket
+bool kernel_echo(const uint32_t seq)
+{
+    const int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in sa;
+    std::memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port   = htons(ECHO_PORT);
+    inet_pton(AF_INET, PEER_ADDR.c_str(), &sa.sin_addr);
+    timeval tv = {1, 0};
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    connect(sock, reinterpret_cast<sockaddr*>(&sa), sizeof(sa));
+    uint32_t recvd_seq = ~seq;
+    const bool ok      = send(sock, &seq, sizeof(seq), 0) == sizeof(seq)
+                    && recv(sock, &recvd_seq, sizeof(recvd_seq), 0) == sizeof(recvd_seq)
+                    && recvd_seq == seq;
+    close(sock);
+    return ok;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_xdp_echo)
+{
+    veth_pair veth;
+    if (!veth.ok) {
+        return;
+    }
+
+    {
+        auto link = udp_xdp_link::make(PEER_ADDR,
+            ECHO_PORT_STR,
+            make_params(),
+            uhd::device_addr_t("xdp_iface=" + veth.iface + ",xdp_queue=0"));
+        BOOST_CHECK_NE(run_output("ip link show dev " + veth.iface).find("prog/xdp"),
+            std::string::npos);
+        for (uint32_t seq = 0; seq < 1000; seq++) {
+            check_echo(link, seq);
+        }
+    }
+
+    // The program is detached once the last link on the interface is gone
+    BOOST_CHECK_EQUAL(
+        run_output("ip link show dev " + veth.iface).find("prog/xdp"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(test_xdp_passes_other_traffic)
+{
+    veth_pair veth;
+    if (!veth.ok) {
+        return;
+    }
+
+    auto link = udp_xdp_link::make(PEER_ADDR,
+        ECHO_PORT_STR,
+        make_params(),
+        uhd::device_addr_t("xdp_iface=" + veth.iface + ",xdp_queue=0"));
+
+    // Other UDP ports on the same queue still reach the kernel, and so does
+    // ARP: without the neighbor entry, the echo below needs an ARP reply.
+    BOOST_REQUIRE(run("ip neigh flush dev " + veth.iface));
+    for (uint32_t seq = 0; seq < 10; seq++) {
+        BOOST_CHECK(kernel_echo(seq));
+    }
+
+    // The link keeps working alongside
+    for (uint32_t seq = 0; seq < 100; seq++) {
+        check_echo(link, seq);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_xdp_queue_required)
+{
+    veth_pair veth;
+    if (!veth.ok) {
+        return;
+    }
+
+    BOOST_CHECK_THROW(udp_xdp_link::make(PEER_ADDR,
+                          ECHO_PORT_STR,
+                          make_params(),
+                          uhd::device_addr_t("xdp_iface=" + veth.iface)),
+        uhd::value_error);
+}
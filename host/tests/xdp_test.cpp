@@ -0,0 +1,106 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+/**
+ * Loopback test of the AF_XDP link against a UDP echo server.
+ *
+ * This needs CAP_NET_ADMIN/CAP_NET_RAW and a peer, but no special hardware.
+ * A veth pair with the far end in its own network namespace works:
+ *
+ *     ip netns add uhd_xdp
+ *     ip link add veth0 type veth peer name veth1
+ *     ip link set veth1 netns uhd_xdp
+ *     ip addr add 10.99.0.1/24 dev veth0 && ip link set veth0 up
+ *     ip netns exec uhd_xdp ip addr add 10.99.0.2/24 dev veth1
+ *     ip netns exec uhd_xdp ip link set veth1 up
+ *     ip netns exec uhd_xdp socat UDP4-LISTEN:49153,fork PIPE &
+ *     sudo ./xdp_test --addr 10.99.0.2 --port 49153 --args xdp_queue=0
+ */
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/safe_main.hpp>
+#include <uhdlib/transport/udp_xdp_link.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace po = boost::program_options;
+using namespace uhd::transport;
+
+int UHD_SAFE_MAIN(int argc, char* argv[])
+{
+    std::string addr, port, args;
+    size_t num_packets, frame_size;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help", "help message")
+        ("addr", po::value<std::string>(&addr)->default_value("10.99.0.2"),
+            "IPv4 address of the echo server")
+        ("port", po::value<std::string>(&port)->default_value("49153"),
+            "UDP port of the echo server")
+        ("args", po::value<std::string>(&args)->default_value("xdp_queue=0"),
+            "link arguments, e.g. xdp_iface=veth0,xdp_queue=0")
+        ("packets", po::value<size_t>(&num_packets)->default_value(100000),
+            "number of packets to echo")
+        ("frame-size", po::value<size_t>(&frame_size)->default_value(1400),
+            "UDP payload size in bytes")
+    ;
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help")) {
+        std::cout << boost::format("UHD AF_XDP Link Test %s") % desc << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    link_params_t params;
+    params.num_recv_frames = 32;
+    params.num_send_frames = 32;
+    params.recv_frame_size = frame_size;
+    params.send_frame_size = frame_size;
+    auto link = udp_xdp_link::make(addr, port, params, uhd::device_addr_t(args));
+
+    size_t num_timeouts = 0;
+    const auto start    = std::chrono::steady_clock::now();
+    for (uint32_t seq = 0; seq < num_packets; seq++) {
+        auto send_buff = link->get_send_buff(1000);
+        if (!send_buff) {
+            throw uhd::runtime_error("Timeout waiting for send buffer");
+        }
+        std::memset(send_buff->data(), 0, frame_size);
+        std::memcpy(send_buff->data(), &seq, sizeof(seq));
+        send_buff->set_packet_size(frame_size);
+        link->release_send_buff(std::move(send_buff));
+
+        auto recv_buff = link->get_recv_buff(100);
+        if (!recv_buff) {
+            num_timeouts++;
+            continue;
+        }
+        uint32_t echo_seq;
+        std::memcpy(&echo_seq, recv_buff->data(), sizeof(echo_seq));
+        if (recv_buff->packet_size() != frame_size || echo_seq != seq) {
+            throw uhd::runtime_error(str(boost::format("Bad echo: expected seq %d, "
+                                                       "size %d, got seq %d, size %d")
+                                         % seq % frame_size % echo_seq
+                                         % recv_buff->packet_size()));
+        }
+        link->release_recv_buff(std::move(recv_buff));
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << boost::format("%d packets echoed, %d timeouts, %.2f us/round trip\n")
+                     % (num_packets - num_timeouts) % num_timeouts
+                     % (elapsed.count() / num_packets * 1e6);
+    return num_timeouts == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,343 @@
+//
+// Copyright 2026 Ettus Research, a National Instruments Brand
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+//
+
+#include <uhd/exception.hpp>
+#include <uhd/utils/byteswap.hpp>
+#include <uhdlib/transport/inline_io_service.hpp>
+#include <uhdlib/transport/offload_io_service.hpp>
+#include <uhdlib/transport/vrt_data_xport.hpp>
+#include <uhdlib/transport/zero_copy_link.hpp>
+#include <uhdlib/usrp/common/recv_packet_demuxer_3000.hpp>
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace uhd::transport;
+using uhd::usrp::recv_packet_demuxer_3000;
+
+static constexpr size_t FRAME_WORDS = 64;
+static constexpr size_t FRAME_SIZE  = FRAME_WORDS * sizeof(uint32_t);
+
+/*!
+ * Thread-safe transport with a fixed number of frames, like the USB transport.
+ * Frames are only handed out again once they were released, and committed send
+ * frames are recorded.
+ */
+class pool_zero_copy : public zero_copy_if
+{
+public:
+    using pkt_t = std::vector<uint32_t>;
+
+    pool_zero_copy(const size_t num_frames)
+        : _recv_frames(num_frames), _send_frames(num_frames)
+    {
+        for (auto& frame : _recv_frames) {
+            frame.pool = this;
+        }
+        for (auto& frame : _send_frames) {
+            frame.pool = this;
+        }
+    }
+
+    void push_packet(const pkt_t& packet)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _packets.push_back(packet);
+    }
+
+    std::deque<pkt_t> get_sent_packets()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _sent_packets;
+    }
+
+    size_t get_num_recv_frames_in_use()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _count_in_use(_recv_frames);
+    }
+
+    size_t get_num_send_frames_in_use()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _count_in_use(_send_frames);
+    }
+
+    managed_recv_buffer::sptr get_recv_buff(double timeout) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_packets.empty()) {
+                for (auto& frame : _recv_frames) {
+                    if (!frame.in_use) {
+                        frame.in_use = true;
+                        const pkt_t& packet = _packets.front();
+                        std::copy(packet.begin(), packet.end(), frame.mem.begin());
+                        const size_t len = packet.size() * sizeof(uint32_t);
+                        _packets.pop_front();
+                        return frame.make(&frame, frame.mem.data(), len);
+                    }
+                }
+            }
+        }
+        if (timeout > 0.0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        return managed_recv_buffer::sptr();
+    }
+
+    managed_send_buffer::sptr get_send_buff(double) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto& frame : _send_frames) {
+            if (!frame.in_use) {
+                frame.in_use = true;
+                return frame.make(&frame, frame.mem.data(), FRAME_SIZE);
+            }
+        }
+        return managed_send_buffer::sptr();
+    }
+
+    size_t get_num_recv_frames(void) const override
+    {
+        return _recv_frames.size();
+    }
+    size_t get_recv_frame_size(void) const override
+    {
+        return FRAME_SIZE;
+    }
+    size_t get_num_send_frames(void) const override
+    {
+        return _send_frames.size();
+    }
+    size_t get_send_frame_size(void) const override
+    {
+        return FRAME_SIZE;
+    }
+
+private:
+    struct recv_frame_t : managed_recv_buffer
+    {
+        void release(void) override
+        {
+            std::lock_guard<std::mutex> lock(pool->_mutex);
+            in_use = false;
+        }
+
+        pool_zero_copy* pool = nullptr;
+        bool in_use          = false;
+        std::array<uint32_t, FRAME_WORDS> mem;
+    };
+
+    struct send_frame_t : managed_send_buffer
+    {
+        void release(void) override
+        {
+            std::lock_guard<std::mutex> lock(pool->_mutex);
+            pool->_sent_packets.emplace_back(
+                mem.begin(), mem.begin() + size() / sizeof(uint32_t));
+            in_use = false;
+        }
+
+        pool_zero_copy* pool = nullptr;
+        bool in_use          = false;
+        std::array<uint32_t, FRAME_WORDS> mem;
+    };
+
+    template <typename frames_t>
+    static size_t _count_in_use(const frames_t& frames)
+    {
+        return std::count_if(frames.begin(), frames.end(), [](const auto& frame) {
+            return frame.in_use;
+        });
+    }
+
+    std::mutex _mutex;
+    std::vector<recv_frame_t> _recv_frames;
+    std::vector<send_frame_t> _send_frames;
+    std::deque<pkt_t> _packets;
+    std::deque<pkt_t> _sent_packets;
+};
+
+BOOST_AUTO_TEST_CASE(test_zero_copy_link_recv)
+{
+    auto xport = std::make_shared<pool_zero_copy>(4);
+    auto link  = zero_copy_link::make(xport, 2, 0);
+    BOOST_CHECK_EQUAL(link->get_num_recv_frames(), 2);
+    BOOST_CHECK_EQUAL(link->get_recv_frame_size(), FRAME_SIZE);
+
+    BOOST_CHECK(!link->get_recv_buff(0));
+
+    xport->push_packet({1, 2, 3});
+    xport->push_packet({4, 5});
+    auto buff0 = link->get_recv_buff(100);
+    auto buff1 = link->get_recv_buff(100);
+    BOOST_REQUIRE(buff0);
+    BOOST_REQUIRE(buff1);
+    BOOST_CHECK_EQUAL(buff0->packet_size(), 3 * sizeof(uint32_t));
+    BOOST_CHECK_EQUAL(buff1->packet_size(), 2 * sizeof(uint32_t));
+    BOOST_CHECK_EQUAL(static_cast<const uint32_t*>(buff0->data())[2], 3);
+    BOOST_CHECK_EQUAL(static_cast<const uint32_t*>(buff1->data())[0], 4);
+    BOOST_CHECK_EQUAL(xport->get_num_recv_frames_in_use(), 2);
+
+    // Frames go back to the transport when they are released, in any order
+    link->release_recv_buff(std::move(buff1));
+    BOOST_CHECK_EQUAL(xport->get_num_recv_frames_in_use(), 1);
+    link->release_recv_buff(std::move(buff0));
+    BOOST_CHECK_EQUAL(xport->get_num_recv_frames_in_use(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_zero_copy_link_send)
+{
+    auto xport = std::make_shared<pool_zero_copy>(4);
+    auto link  = zero_copy_link::make(xport, 0, 2);
+    BOOST_CHECK_EQUAL(link->get_num_send_frames(), 2);
+    BOOST_CHECK_EQUAL(link->get_send_frame_size(), FRAME_SIZE);
+
+    auto buff = link->get_send_buff(100);
+    BOOST_REQUIRE(buff);
+    static_cast<uint32_t*>(buff->data())[0] = 42;
+    buff->set_packet_size(sizeof(uint32_t));
+    link->release_send_buff(std::move(buff));
+    auto sent = xport->get_sent_packets();
+    BOOST_REQUIRE_EQUAL(sent.size(), 1);
+    BOOST_CHECK(sent.front() == pool_zero_copy::pkt_t{42});
+    BOOST_CHECK_EQUAL(xport->get_num_send_frames_in_use(), 0);
+
+    // A frame released without a packet is not sent, and the link keeps its
+    // buffer for the next packet
+    buff = link->get_send_buff(100);
+    BOOST_REQUIRE(buff);
+    link->release_send_buff(std::move(buff));
+    BOOST_CHECK_EQUAL(xport->get_sent_packets().size(), 1);
+    BOOST_CHECK_EQUAL(xport->get_num_send_frames_in_use(), 1);
+    buff = link->get_send_buff(0);
+    BOOST_REQUIRE(buff);
+    BOOST_CHECK_EQUAL(xport->get_num_send_frames_in_use(), 1);
+    link->release_send_buff(std::move(buff));
+
+    // Buffers the link still holds are released as empty packets
+    link.reset();
+    sent = xport->get_sent_packets();
+    BOOST_REQUIRE_EQUAL(sent.size(), 2);
+    BOOST_CHECK(sent.back().empty());
+    BOOST_CHECK_EQUAL(xport->get_num_send_frames_in_use(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_zero_copy_link_num_frames)
+{
+    auto xport = std::make_shared<pool_zero_copy>(4);
+    BOOST_CHECK_THROW(zero_copy_link::make(xport, 5, 0), uhd::value_error);
+    BOOST_CHECK_THROW(zero_copy_link::make(xport, 0, 5), uhd::value_error);
+
+    // Running out of buffers of the transport is a timeout
+    auto link = zero_copy_link::make(xport, 0, 4);
+    std::vector<frame_buff::uptr> buffs;
+    for (size_t i = 0; i < 4; i++) {
+        buffs.push_back(link->get_send_buff(0));
+        BOOST_REQUIRE(buffs.back());
+    }
+    auto other_link = zero_copy_link::make(xport, 0, 4);
+    BOOST_CHECK(!other_link->get_send_buff(10));
+    for (auto& buff : buffs) {
+        buff->set_packet_size(sizeof(uint32_t));
+        link->release_send_buff(std::move(buff));
+    }
+}
+
+/*
+ * The B210 layout: the channels share one transport, and each has a link on its
+ * demuxer proxy. The links are connected to one offload I/O service.
+ */
+BOOST_AUTO_TEST_CASE(test_zero_copy_link_demux_offload)
+{
+    constexpr size_t NUM_PKTS = 20;
+    const std::array<uint32_t, 2> sids{0x00A0, 0x00B0};
+
+    auto xport = std::make_shared<pool_zero_copy>(8);
+    auto demux = recv_packet_demuxer_3000::make(xport);
+
+    // Interleave the streams unevenly
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        for (size_t chan = 0; chan < 2; chan++) {
+            if (chan == 1 && i % 3 == 0) {
+                continue;
+            }
+            vrt::if_packet_info_t ifpi;
+            ifpi.link_type           = vrt::if_packet_info_t::LINK_TYPE_CHDR;
+            ifpi.packet_type         = vrt::if_packet_info_t::PACKET_TYPE_DATA;
+            ifpi.num_payload_words32 = 1;
+            ifpi.num_payload_bytes   = sizeof(uint32_t);
+            ifpi.packet_count        = i;
+            ifpi.has_sid             = true;
+            ifpi.sid                 = sids[chan];
+            ifpi.has_cid             = false;
+            ifpi.has_tsi             = false;
+            ifpi.has_tsf             = false;
+            ifpi.has_tlr             = false;
+            pool_zero_copy::pkt_t packet(FRAME_WORDS);
+            vrt::if_hdr_pack_le(packet.data(), ifpi);
+            packet[ifpi.num_header_words32] = uhd::htowx(uint32_t(i));
+            packet.resize(ifpi.num_packet_words32);
+            xport->push_packet(packet);
+        }
+    }
+
+    offload_io_service::params_t params;
+    params.client_type = offload_io_service::RECV_ONLY;
+    params.wait_mode   = offload_io_service::BLOCK;
+    auto io_srv = offload_io_service::make(inline_io_service::make(), params);
+
+    // Register all SIDs before the first link is attached. The offload thread
+    // starts pulling from the transport right away, and the demuxer drops the
+    // packets of SIDs it does not know yet.
+    std::vector<recv_link_if::sptr> links;
+    for (const uint32_t sid : sids) {
+        links.push_back(zero_copy_link::make(demux->make_proxy(sid), 4, 0));
+    }
+
+    std::vector<vrt_rx_data_xport::uptr> xports;
+    for (const recv_link_if::sptr& link : links) {
+        io_srv->attach_recv_link(link);
+        xports.push_back(std::make_unique<vrt_rx_data_xport>(io_srv,
+            link,
+            vrt::if_packet_info_t::LINK_TYPE_CHDR,
+            uhd::ENDIANNESS_LITTLE,
+            nullptr,
+            [io_srv, link]() { io_srv->detach_recv_link(link); }));
+    }
+
+    // Read the channels in turn, like a streamer. Packets of the channel that is
+    // not being read are parked in the demuxer, which only has the frames of the
+    // transport to park them in.
+    for (size_t i = 0; i < NUM_PKTS; i++) {
+        for (size_t chan = 0; chan < 2; chan++) {
+            if (chan == 1 && i % 3 == 0) {
+                continue;
+            }
+            auto result = xports[chan]->get_recv_buff(1000);
+            auto& buff  = std::get<0>(result);
+            BOOST_REQUIRE(buff);
+            const auto& info = std::get<1>(result);
+            BOOST_CHECK_EQUAL(
+                uhd::wtohx(*static_cast<const uint32_t*>(info.payload)), uint32_t(i));
+            // Gaps of the second channel are sequence errors
+            BOOST_CHECK_EQUAL(std::get<2>(result), chan == 1 && i % 3 == 1 && i > 1);
+            xports[chan]->release_recv_buff(std::move(buff));
+        }
+    }
+    for (auto& chan_xport : xports) {
+        BOOST_CHECK(!std::get<0>(chan_xport->get_recv_buff(10)));
+    }
+
+    xports.clear();
+    links.clear();
+    BOOST_CHECK_EQUAL(xport->get_num_recv_frames_in_use(), 0);
+}